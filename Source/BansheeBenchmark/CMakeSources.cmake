@@ -0,0 +1,20 @@
+set(BS_BENCHMARK_INC_NOFILTER
+	"Include/BsBenchmarkResults.h"
+	"Include/BsBenchmarkRunner.h"
+	"Include/BsCameraPath.h"
+)
+
+set(BS_BENCHMARK_SRC_NOFILTER
+	"Source/BsBenchmarkResults.cpp"
+	"Source/BsBenchmarkRunner.cpp"
+	"Source/BsCameraPath.cpp"
+	"Source/Main.cpp"
+)
+
+source_group("Header Files" FILES ${BS_BENCHMARK_INC_NOFILTER})
+source_group("Source Files" FILES ${BS_BENCHMARK_SRC_NOFILTER})
+
+set(BS_BENCHMARK_SRC
+	${BS_BENCHMARK_INC_NOFILTER}
+	${BS_BENCHMARK_SRC_NOFILTER}
+)
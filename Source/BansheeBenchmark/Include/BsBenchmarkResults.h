@@ -0,0 +1,74 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisites.h"
+
+namespace bs
+{
+	/** Summary of frame times recorded during a benchmark run. All values are in milliseconds. */
+	struct FrameTimeStats
+	{
+		double min = 0.0;
+		double max = 0.0;
+		double mean = 0.0;
+		double p50 = 0.0;
+		double p90 = 0.0;
+		double p95 = 0.0;
+		double p99 = 0.0;
+
+		/** Calculates the statistics from a list of individual frame times, in milliseconds. */
+		static FrameTimeStats calculate(Vector<double> frameTimes);
+	};
+
+	/** Results of a single benchmark run, as written to and read from a results file. */
+	struct BenchmarkResults
+	{
+		String name; /**< Identifier of the benchmarked scene. */
+		UINT32 numFrames = 0; /**< Number of measured frames, not including warmup frames. */
+
+		FrameTimeStats frameTime; /**< Statistics about the time taken by the entire frame. */
+
+		/** Average time spent in each CPU profiler block on the simulation thread, per frame, in milliseconds. */
+		Map<String, double> simThreadTimes;
+
+		/** Average time spent in each CPU profiler block on the core thread, per frame, in milliseconds. */
+		Map<String, double> coreThreadTimes;
+
+		/**
+		 * Average value of each GPU profiler counter (draw calls, state changes, etc.), per frame. Per resource type
+		 * counters are keyed as "resources/<type>/<counter>" and per render pass counters as "passes/<pass>/<counter>".
+		 */
+		Map<String, double> renderStats;
+
+		double simAllocsPerFrame = 0.0; /**< Average number of memory allocations on the simulation thread, per frame. */
+		double simFreesPerFrame = 0.0; /**< Average number of memory frees on the simulation thread, per frame. */
+		double coreAllocsPerFrame = 0.0; /**< Average number of memory allocations on the core thread, per frame. */
+		double coreFreesPerFrame = 0.0; /**< Average number of memory frees on the core thread, per frame. */
+
+		/** Writes the results to a JSON file at the provided path. */
+		void save(const Path& path) const;
+
+		/**
+		 * Reads results previously written by save().
+		 *
+		 * @param[in]	path	Path to the results file.
+		 * @param[out]	results	Results read from the file.
+		 * @return				True if the file exists and contains valid results.
+		 */
+		static bool load(const Path& path, BenchmarkResults& results);
+
+		/**
+		 * Compares two sets of results and outputs a readable report of all differences.
+		 *
+		 * @param[in]	baseline	Results to compare against.
+		 * @param[in]	current		Results to compare.
+		 * @param[in]	threshold	Maximum allowed increase in median, 95th and 99th percentile frame times, as a
+		 *							percentage of the baseline value.
+		 * @param[out]	report		Readable report listing the differences between the two runs.
+		 * @return					True if none of the frame time percentiles regressed above the threshold.
+		 */
+		static bool compare(const BenchmarkResults& baseline, const BenchmarkResults& current, float threshold,
+			String& report);
+	};
+}
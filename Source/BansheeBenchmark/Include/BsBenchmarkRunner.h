@@ -0,0 +1,85 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "BsComponent.h"
+#include "BsBenchmarkResults.h"
+
+namespace bs
+{
+	class CameraPath;
+	struct CPUProfilerBasicSamplingEntry;
+
+	/** Settings that control a benchmark run. */
+	struct BENCHMARK_DESC
+	{
+		String name; /**< Identifier of the benchmarked scene, stored in the results. */
+		UINT32 numFrames = 1000; /**< Number of frames to measure. */
+		UINT32 numWarmupFrames = 60; /**< Number of frames to run before measuring starts. */
+
+		/**
+		 * Amount of time every frame advances the simulation by, in seconds. Makes animation, physics and the camera path
+		 * progress identically on every run regardless of actual frame times. Ignored when playing back recorded input,
+		 * as the recording provides its own frame times. Zero to use real frame times.
+		 */
+		float fixedFrameDelta = 1.0f / 60.0f;
+
+		SPtr<CameraPath> cameraPath; /**< Optional path the main camera follows. */
+		SPtr<InputRecording> input; /**< Optional recorded input to play back during the run. */
+		Path outputPath; /**< Path to write the results to, once the run completes. */
+	};
+
+	/**
+	 * Runs the scene for a fixed number of frames while measuring frame times, profiler data, render statistics and
+	 * memory allocations, then writes the results to a file and requests the application to quit. Should be added to a
+	 * scene object after the benchmarked scene is loaded.
+	 */
+	class BenchmarkRunner : public Component
+	{
+	public:
+		BenchmarkRunner(const HSceneObject& parent, const BENCHMARK_DESC& desc);
+
+		/** Checks if all the requested frames have been measured. */
+		bool hasFinished() const { return mFinished; }
+
+		/** Returns the results of the run. Only valid once hasFinished() returns true. */
+		const BenchmarkResults& getResults() const { return mResults; }
+
+		/** Triggered once per frame. Moves the camera and records data about the previous frame. */
+		void update() override;
+
+	protected:
+		/** @copydoc Component::onDestroyed */
+		void onDestroyed() override;
+
+	private:
+		/** Starts measuring, once the warmup frames are done. */
+		void start();
+
+		/** Calculates the results from the recorded data, saves them and requests the application to quit. */
+		void finish();
+
+		/** Accumulates CPU and GPU profiler data from the most recent frame. */
+		void collectProfilerData();
+
+		/** Accumulates total times of a CPU profiler block and all its children. Children are keyed by their path. */
+		static void accumulateCPUTimes(const CPUProfilerBasicSamplingEntry& entry, const String& parentName,
+			Map<String, double>& totals);
+
+		BENCHMARK_DESC mDesc;
+		BenchmarkResults mResults;
+
+		UINT32 mFrameIdx = 0;
+		UINT64 mLastFrameTime = 0;
+		float mStartTime = 0.0f;
+		bool mFinished = false;
+
+		Vector<double> mFrameTimes;
+		UINT32 mNumGPUReports = 0;
+		UINT64 mStartAllocs = 0;
+		UINT64 mStartFrees = 0;
+		UINT64 mCoreAllocs = 0;
+		UINT64 mCoreFrees = 0;
+	};
+}
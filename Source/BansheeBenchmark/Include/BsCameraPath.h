@@ -0,0 +1,64 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "BsVector3.h"
+
+namespace bs
+{
+	/**
+	 * Scripted path a camera follows during a benchmark run. Consists of a set of keyframes, each specifying the camera
+	 * position and the point the camera is looking at, at a specific time. Values between keyframes are linearly
+	 * interpolated.
+	 *
+	 * Paths are loaded from JSON files in the following format:
+	 * @code
+	 * {
+	 *     "loop": false,
+	 *     "keyframes": [
+	 *         { "time": 0.0, "position": [ 0, 5, 10 ], "target": [ 0, 0, 0 ] },
+	 *         { "time": 5.0, "position": [ 10, 5, 0 ], "target": [ 0, 0, 0 ] }
+	 *     ]
+	 * }
+	 * @endcode
+	 */
+	class CameraPath
+	{
+	public:
+		/** A single point on the camera path. */
+		struct Keyframe
+		{
+			float time; /**< Time at which the camera reaches this point, in seconds. */
+			Vector3 position; /**< World position of the camera. */
+			Vector3 target; /**< World position the camera is looking at. */
+		};
+
+		/**
+		 * Evaluates the camera position and look-at target at the provided time.
+		 *
+		 * @param[in]	time		Time since the start of the path, in seconds.
+		 * @param[out]	position	World position of the camera.
+		 * @param[out]	target		World position the camera is looking at.
+		 */
+		void evaluate(float time, Vector3& position, Vector3& target) const;
+
+		/** Returns the time at which the camera reaches the last keyframe, in seconds. */
+		float getLength() const;
+
+		/** Checks if the path restarts from the first keyframe once the last one is reached. */
+		bool isLooping() const { return mLoop; }
+
+		/**
+		 * Loads a camera path from a JSON file.
+		 *
+		 * @param[in]	path	Path to the camera path file.
+		 * @return				Loaded path, or null if the file doesn't exist or contains no valid keyframes.
+		 */
+		static SPtr<CameraPath> load(const Path& path);
+
+	private:
+		Vector<Keyframe> mKeyframes; // Sorted by time
+		bool mLoop = false;
+	};
+}
@@ -0,0 +1,258 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsBenchmarkResults.h"
+#include "BsFileSystem.h"
+#include "BsDataStream.h"
+#include "ThirdParty/json.hpp"
+
+using json = nlohmann::json;
+
+namespace bs
+{
+	/** Returns the value at the provided percentile of a sorted list, using linear interpolation between entries. */
+	static double getPercentile(const Vector<double>& sorted, double percentile)
+	{
+		if (sorted.empty())
+			return 0.0;
+
+		double rank = (percentile / 100.0) * (sorted.size() - 1);
+		UINT32 lower = (UINT32)rank;
+		UINT32 upper = std::min(lower + 1, (UINT32)sorted.size() - 1);
+
+		double t = rank - lower;
+		return sorted[lower] + (sorted[upper] - sorted[lower]) * t;
+	}
+
+	/** Converts a map of named values into a JSON object. */
+	static json toJSON(const Map<String, double>& values)
+	{
+		json output = json::object();
+		for (auto& entry : values)
+			output[entry.first.c_str()] = entry.second;
+
+		return output;
+	}
+
+	/** Reads a map of named values from a JSON object. Entries that aren't numbers are ignored. */
+	static void fromJSON(const json& input, Map<String, double>& values)
+	{
+		values.clear();
+
+		if (!input.is_object())
+			return;
+
+		for (auto iter = input.begin(); iter != input.end(); ++iter)
+		{
+			if (iter.value().is_number())
+				values[iter.key().c_str()] = iter.value().get<double>();
+		}
+	}
+
+	/** Returns the change from @p baseline to @p current as a percentage of the baseline. */
+	static double getChange(double baseline, double current)
+	{
+		if (baseline == 0.0)
+			return current == 0.0 ? 0.0 : 100.0;
+
+		return (current - baseline) / baseline * 100.0;
+	}
+
+	/** Appends a single row to the comparison report. */
+	static void appendRow(StringStream& stream, const String& name, double baseline, double current)
+	{
+		stream << "  " << name << ": " << baseline << " -> " << current;
+
+		double change = getChange(baseline, current);
+		stream << " (" << (change >= 0.0 ? "+" : "") << change << "%)" << std::endl;
+	}
+
+	/** Appends rows for all entries present in either of the provided maps. */
+	static void appendRows(StringStream& stream, const String& title, const Map<String, double>& baseline,
+		const Map<String, double>& current)
+	{
+		Map<String, std::pair<double, double>> combined;
+		for (auto& entry : baseline)
+			combined[entry.first].first = entry.second;
+
+		for (auto& entry : current)
+			combined[entry.first].second = entry.second;
+
+		if (combined.empty())
+			return;
+
+		stream << title << ":" << std::endl;
+		for (auto& entry : combined)
+			appendRow(stream, entry.first, entry.second.first, entry.second.second);
+	}
+
+	FrameTimeStats FrameTimeStats::calculate(Vector<double> frameTimes)
+	{
+		FrameTimeStats stats;
+		if (frameTimes.empty())
+			return stats;
+
+		std::sort(frameTimes.begin(), frameTimes.end());
+
+		double total = 0.0;
+		for (auto& frameTime : frameTimes)
+			total += frameTime;
+
+		stats.min = frameTimes.front();
+		stats.max = frameTimes.back();
+		stats.mean = total / frameTimes.size();
+		stats.p50 = getPercentile(frameTimes, 50.0);
+		stats.p90 = getPercentile(frameTimes, 90.0);
+		stats.p95 = getPercentile(frameTimes, 95.0);
+		stats.p99 = getPercentile(frameTimes, 99.0);
+
+		return stats;
+	}
+
+	void BenchmarkResults::save(const Path& path) const
+	{
+		json frameTimeJSON =
+		{
+			{ "min", frameTime.min },
+			{ "max", frameTime.max },
+			{ "mean", frameTime.mean },
+			{ "p50", frameTime.p50 },
+			{ "p90", frameTime.p90 },
+			{ "p95", frameTime.p95 },
+			{ "p99", frameTime.p99 }
+		};
+
+		json memoryJSON =
+		{
+			{ "simAllocsPerFrame", simAllocsPerFrame },
+			{ "simFreesPerFrame", simFreesPerFrame },
+			{ "coreAllocsPerFrame", coreAllocsPerFrame },
+			{ "coreFreesPerFrame", coreFreesPerFrame }
+		};
+
+		json resultsJSON;
+		resultsJSON["name"] = name.c_str();
+		resultsJSON["numFrames"] = numFrames;
+		resultsJSON["frameTimeMs"] = frameTimeJSON;
+		resultsJSON["simThreadMs"] = toJSON(simThreadTimes);
+		resultsJSON["coreThreadMs"] = toJSON(coreThreadTimes);
+		resultsJSON["renderStats"] = toJSON(renderStats);
+		resultsJSON["memory"] = memoryJSON;
+
+		if (FileSystem::exists(path))
+			FileSystem::remove(path);
+
+		String jsonString = resultsJSON.dump(4).c_str();
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+		stream->writeString(jsonString);
+		stream->close();
+	}
+
+	bool BenchmarkResults::load(const Path& path, BenchmarkResults& results)
+	{
+		if (!FileSystem::isFile(path))
+		{
+			LOGERR("Unable to load benchmark results. File doesn't exist: " + path.toString());
+			return false;
+		}
+
+		SPtr<DataStream> stream = FileSystem::openFile(path);
+
+		json resultsJSON = json::parse(stream->getAsString().c_str());
+		if (!resultsJSON.is_object())
+		{
+			LOGERR("Unable to load benchmark results. File doesn't contain a JSON object: " + path.toString());
+			return false;
+		}
+
+		results = BenchmarkResults();
+
+		if (resultsJSON["name"].is_string())
+			results.name = resultsJSON["name"].get<std::string>().c_str();
+
+		if (resultsJSON["numFrames"].is_number())
+			results.numFrames = resultsJSON["numFrames"].get<UINT32>();
+
+		Map<String, double> frameTimes;
+		fromJSON(resultsJSON["frameTimeMs"], frameTimes);
+
+		results.frameTime.min = frameTimes["min"];
+		results.frameTime.max = frameTimes["max"];
+		results.frameTime.mean = frameTimes["mean"];
+		results.frameTime.p50 = frameTimes["p50"];
+		results.frameTime.p90 = frameTimes["p90"];
+		results.frameTime.p95 = frameTimes["p95"];
+		results.frameTime.p99 = frameTimes["p99"];
+
+		fromJSON(resultsJSON["simThreadMs"], results.simThreadTimes);
+		fromJSON(resultsJSON["coreThreadMs"], results.coreThreadTimes);
+		fromJSON(resultsJSON["renderStats"], results.renderStats);
+
+		Map<String, double> memory;
+		fromJSON(resultsJSON["memory"], memory);
+
+		results.simAllocsPerFrame = memory["simAllocsPerFrame"];
+		results.simFreesPerFrame = memory["simFreesPerFrame"];
+		results.coreAllocsPerFrame = memory["coreAllocsPerFrame"];
+		results.coreFreesPerFrame = memory["coreFreesPerFrame"];
+
+		return true;
+	}
+
+	bool BenchmarkResults::compare(const BenchmarkResults& baseline, const BenchmarkResults& current, float threshold,
+		String& report)
+	{
+		StringStream stream;
+		stream.precision(4);
+		stream << std::fixed;
+
+		stream << "Comparing '" << current.name << "' (" << current.numFrames << " frames) against baseline '"
+			<< baseline.name << "' (" << baseline.numFrames << " frames)." << std::endl;
+
+		stream << "Frame time (ms):" << std::endl;
+		appendRow(stream, "min", baseline.frameTime.min, current.frameTime.min);
+		appendRow(stream, "mean", baseline.frameTime.mean, current.frameTime.mean);
+		appendRow(stream, "p50", baseline.frameTime.p50, current.frameTime.p50);
+		appendRow(stream, "p90", baseline.frameTime.p90, current.frameTime.p90);
+		appendRow(stream, "p95", baseline.frameTime.p95, current.frameTime.p95);
+		appendRow(stream, "p99", baseline.frameTime.p99, current.frameTime.p99);
+		appendRow(stream, "max", baseline.frameTime.max, current.frameTime.max);
+
+		appendRows(stream, "Simulation thread (ms/frame)", baseline.simThreadTimes, current.simThreadTimes);
+		appendRows(stream, "Core thread (ms/frame)", baseline.coreThreadTimes, current.coreThreadTimes);
+		appendRows(stream, "Render stats (per frame)", baseline.renderStats, current.renderStats);
+
+		stream << "Memory (per frame):" << std::endl;
+		appendRow(stream, "sim allocs", baseline.simAllocsPerFrame, current.simAllocsPerFrame);
+		appendRow(stream, "sim frees", baseline.simFreesPerFrame, current.simFreesPerFrame);
+		appendRow(stream, "core allocs", baseline.coreAllocsPerFrame, current.coreAllocsPerFrame);
+		appendRow(stream, "core frees", baseline.coreFreesPerFrame, current.coreFreesPerFrame);
+
+		// Only the frame time percentiles are used to decide on a regression, min/max are too noisy and per-block times
+		// are expected to shift around as work moves between blocks
+		std::pair<const char*, std::pair<double, double>> checked[] =
+		{
+			{ "p50", { baseline.frameTime.p50, current.frameTime.p50 } },
+			{ "p95", { baseline.frameTime.p95, current.frameTime.p95 } },
+			{ "p99", { baseline.frameTime.p99, current.frameTime.p99 } }
+		};
+
+		bool passed = true;
+		for (auto& entry : checked)
+		{
+			double change = getChange(entry.second.first, entry.second.second);
+			if (change > threshold)
+			{
+				stream << "Regression: " << entry.first << " frame time increased by " << change << "% (threshold "
+					<< threshold << "%)." << std::endl;
+
+				passed = false;
+			}
+		}
+
+		if (passed)
+			stream << "No regressions above " << threshold << "% threshold." << std::endl;
+
+		report = stream.str();
+		return passed;
+	}
+}
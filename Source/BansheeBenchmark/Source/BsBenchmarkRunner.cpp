@@ -0,0 +1,212 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsBenchmarkRunner.h"
+#include "BsCameraPath.h"
+#include "BsApplication.h"
+#include "BsSceneManager.h"
+#include "BsSceneObject.h"
+#include "BsProfilingManager.h"
+#include "BsProfilerGPU.h"
+#include "BsInput.h"
+#include "BsTime.h"
+
+namespace bs
+{
+	BenchmarkRunner::BenchmarkRunner(const HSceneObject& parent, const BENCHMARK_DESC& desc)
+		:Component(parent), mDesc(desc)
+	{
+		setName("BenchmarkRunner");
+
+		mResults.name = desc.name;
+		mFrameTimes.reserve(desc.numFrames);
+	}
+
+	void BenchmarkRunner::update()
+	{
+		if (mFinished)
+			return;
+
+		UINT64 currentTime = gTime().getTimePrecise();
+
+		// Time between two consecutive updates covers the entire frame, including rendering and waiting on the core thread
+		if (mFrameIdx > mDesc.numWarmupFrames)
+		{
+			mFrameTimes.push_back((currentTime - mLastFrameTime) / 1000.0);
+			collectProfilerData();
+		}
+
+		mLastFrameTime = currentTime;
+
+		if (mFrameIdx == mDesc.numWarmupFrames)
+			start();
+
+		mFrameIdx++;
+
+		if (mDesc.cameraPath != nullptr)
+		{
+			HSceneObject cameraSO = gSceneManager().getMainCamera().sceneObject;
+			if (cameraSO != nullptr)
+			{
+				float time = 0.0f;
+				if (mFrameIdx > mDesc.numWarmupFrames)
+					time = gTime().getTime() - mStartTime;
+
+				Vector3 position;
+				Vector3 target;
+				mDesc.cameraPath->evaluate(time, position, target);
+
+				cameraSO->setPosition(position);
+				cameraSO->lookAt(target);
+			}
+		}
+
+		if (mFrameTimes.size() >= mDesc.numFrames)
+			finish();
+	}
+
+	void BenchmarkRunner::onDestroyed()
+	{
+		if (mFinished || mFrameIdx <= mDesc.numWarmupFrames)
+			return;
+
+		if (gInput().isPlayingBack())
+			gInput().stopPlayback();
+
+		gTime()._setFixedFrameDelta(0.0f);
+	}
+
+	void BenchmarkRunner::start()
+	{
+		// Input playback provides its own frame times
+		if (mDesc.input != nullptr)
+			gInput().startPlayback(mDesc.input);
+		else if (mDesc.fixedFrameDelta > 0.0f)
+			gTime()._setFixedFrameDelta(mDesc.fixedFrameDelta);
+
+		// Drop any GPU reports from the warmup frames
+		while (ProfilerGPU::instance().getNumAvailableReports() > 0)
+			ProfilerGPU::instance().getNextReport();
+
+		mStartTime = gTime().getTime();
+		mStartAllocs = MemoryCounter::getNumAllocs();
+		mStartFrees = MemoryCounter::getNumFrees();
+	}
+
+	void BenchmarkRunner::finish()
+	{
+		mFinished = true;
+
+		if (gInput().isPlayingBack())
+			gInput().stopPlayback();
+
+		gTime()._setFixedFrameDelta(0.0f);
+
+		double numFrames = (double)mFrameTimes.size();
+
+		mResults.numFrames = (UINT32)mFrameTimes.size();
+		mResults.frameTime = FrameTimeStats::calculate(mFrameTimes);
+
+		for (auto& entry : mResults.simThreadTimes)
+			entry.second /= numFrames;
+
+		for (auto& entry : mResults.coreThreadTimes)
+			entry.second /= numFrames;
+
+		if (mNumGPUReports > 0)
+		{
+			for (auto& entry : mResults.renderStats)
+				entry.second /= mNumGPUReports;
+		}
+
+		mResults.simAllocsPerFrame = (MemoryCounter::getNumAllocs() - mStartAllocs) / numFrames;
+		mResults.simFreesPerFrame = (MemoryCounter::getNumFrees() - mStartFrees) / numFrames;
+		mResults.coreAllocsPerFrame = mCoreAllocs / numFrames;
+		mResults.coreFreesPerFrame = mCoreFrees / numFrames;
+
+		if (!mDesc.outputPath.isEmpty())
+			mResults.save(mDesc.outputPath);
+
+		gApplication().quitRequested();
+	}
+
+	void BenchmarkRunner::collectProfilerData()
+	{
+		// Reports are only available for the previous frame, since the profiler is updated after the scene
+		const ProfilerReport& simReport = gProfiler().getReport(ProfiledThread::Sim);
+		accumulateCPUTimes(simReport.cpuReport.getBasicSamplingData(), "", mResults.simThreadTimes);
+
+		const ProfilerReport& coreReport = gProfiler().getReport(ProfiledThread::Core);
+		const CPUProfilerBasicSamplingEntry& coreRoot = coreReport.cpuReport.getBasicSamplingData();
+		accumulateCPUTimes(coreRoot, "", mResults.coreThreadTimes);
+
+		mCoreAllocs += coreRoot.data.memAllocs;
+		mCoreFrees += coreRoot.data.memFrees;
+
+		// GPU reports are delayed by a few frames, but only their total matters
+		while (ProfilerGPU::instance().getNumAvailableReports() > 0)
+		{
+			GPUProfilerReport report = ProfilerGPU::instance().getNextReport();
+			const GPUProfileSample& sample = report.frameSample;
+
+			Map<String, double>& stats = mResults.renderStats;
+			stats["gpuTimeMs"] += sample.timeMs;
+			stats["numDrawCalls"] += sample.numDrawCalls;
+			stats["numComputeCalls"] += sample.numComputeCalls;
+			stats["numRenderTargetChanges"] += sample.numRenderTargetChanges;
+			stats["numPresents"] += sample.numPresents;
+			stats["numClears"] += sample.numClears;
+			stats["numVertices"] += sample.numVertices;
+			stats["numPrimitives"] += sample.numPrimitives;
+			stats["numDrawnSamples"] += sample.numDrawnSamples;
+			stats["numPipelineStateChanges"] += sample.numPipelineStateChanges;
+			stats["numGpuParamBinds"] += sample.numGpuParamBinds;
+			stats["numVertexBufferBinds"] += sample.numVertexBufferBinds;
+			stats["numIndexBufferBinds"] += sample.numIndexBufferBinds;
+			stats["numStateCalls"] += sample.numStateCalls;
+			stats["numFilteredStateCalls"] += sample.numFilteredStateCalls;
+			stats["numResourceWrites"] += sample.numResourceWrites;
+			stats["numResourceReads"] += sample.numResourceReads;
+			stats["numObjectsCreated"] += sample.numObjectsCreated;
+			stats["numObjectsDestroyed"] += sample.numObjectsDestroyed;
+			stats["numBytesWritten"] += (double)sample.numBytesWritten;
+
+			for (auto& resource : sample.resources)
+			{
+				String prefix = "resources/" + resource.name + "/";
+				stats[prefix + "numCreated"] += resource.numCreated;
+				stats[prefix + "numDestroyed"] += resource.numDestroyed;
+				stats[prefix + "numReads"] += resource.numReads;
+				stats[prefix + "numWrites"] += resource.numWrites;
+				stats[prefix + "numBytesWritten"] += (double)resource.numBytesWritten;
+			}
+
+			// Renderer passes can be sampled multiple times per frame (e.g. once per view), in which case they're summed
+			for (auto& passSample : report.samples)
+			{
+				String prefix = "passes/" + passSample.name + "/";
+				stats[prefix + "gpuTimeMs"] += passSample.timeMs;
+				stats[prefix + "numDrawCalls"] += passSample.numDrawCalls;
+				stats[prefix + "numPrimitives"] += passSample.numPrimitives;
+				stats[prefix + "numPipelineStateChanges"] += passSample.numPipelineStateChanges;
+				stats[prefix + "numGpuParamBinds"] += passSample.numGpuParamBinds;
+				stats[prefix + "numBytesWritten"] += (double)passSample.numBytesWritten;
+			}
+
+			mNumGPUReports++;
+		}
+	}
+
+	void BenchmarkRunner::accumulateCPUTimes(const CPUProfilerBasicSamplingEntry& entry, const String& parentName,
+		Map<String, double>& totals)
+	{
+		// Empty root is reported when no profiling data was gathered for the frame
+		if (entry.data.name.empty())
+			return;
+
+		String name = parentName.empty() ? entry.data.name : parentName + "/" + entry.data.name;
+		totals[name] += entry.data.totalTimeMs;
+
+		for (auto& child : entry.childEntries)
+			accumulateCPUTimes(child, name, totals);
+	}
+}
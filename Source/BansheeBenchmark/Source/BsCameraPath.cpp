@@ -0,0 +1,125 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsCameraPath.h"
+#include "BsFileSystem.h"
+#include "BsDataStream.h"
+#include "ThirdParty/json.hpp"
+
+using json = nlohmann::json;
+
+namespace bs
+{
+	/** Reads a three component vector stored as a JSON array. Returns false if the value is not a valid vector. */
+	static bool readVector(const json& input, Vector3& output)
+	{
+		if (!input.is_array() || input.size() != 3)
+			return false;
+
+		for (UINT32 i = 0; i < 3; i++)
+		{
+			if (!input[i].is_number())
+				return false;
+
+			output[i] = input[i].get<float>();
+		}
+
+		return true;
+	}
+
+	void CameraPath::evaluate(float time, Vector3& position, Vector3& target) const
+	{
+		if (mKeyframes.empty())
+		{
+			position = Vector3::ZERO;
+			target = -Vector3::UNIT_Z;
+			return;
+		}
+
+		float length = getLength();
+		if (mLoop && length > 0.0f)
+			time = fmod(time - mKeyframes.front().time, length) + mKeyframes.front().time;
+
+		if (time <= mKeyframes.front().time)
+		{
+			position = mKeyframes.front().position;
+			target = mKeyframes.front().target;
+			return;
+		}
+
+		if (time >= mKeyframes.back().time)
+		{
+			position = mKeyframes.back().position;
+			target = mKeyframes.back().target;
+			return;
+		}
+
+		auto iterFind = std::upper_bound(mKeyframes.begin(), mKeyframes.end(), time,
+			[](float time, const Keyframe& keyframe) { return time < keyframe.time; });
+
+		const Keyframe& end = *iterFind;
+		const Keyframe& start = *(iterFind - 1);
+
+		float t = (time - start.time) / (end.time - start.time);
+		position = Vector3::lerp(t, start.position, end.position);
+		target = Vector3::lerp(t, start.target, end.target);
+	}
+
+	float CameraPath::getLength() const
+	{
+		if (mKeyframes.empty())
+			return 0.0f;
+
+		return mKeyframes.back().time - mKeyframes.front().time;
+	}
+
+	SPtr<CameraPath> CameraPath::load(const Path& path)
+	{
+		if (!FileSystem::isFile(path))
+		{
+			LOGERR("Unable to load camera path. File doesn't exist: " + path.toString());
+			return nullptr;
+		}
+
+		SPtr<DataStream> stream = FileSystem::openFile(path);
+
+		json pathJSON = json::parse(stream->getAsString().c_str());
+		if (!pathJSON.is_object())
+		{
+			LOGERR("Unable to load camera path. File doesn't contain a JSON object: " + path.toString());
+			return nullptr;
+		}
+
+		SPtr<CameraPath> output = bs_shared_ptr_new<CameraPath>();
+		if (pathJSON["loop"].is_boolean())
+			output->mLoop = pathJSON["loop"].get<bool>();
+
+		json& keyframesJSON = pathJSON["keyframes"];
+		if (keyframesJSON.is_array())
+		{
+			for (auto& entry : keyframesJSON)
+			{
+				Keyframe keyframe;
+				if (!entry.is_object() || !entry["time"].is_number() || !readVector(entry["position"], keyframe.position) ||
+					!readVector(entry["target"], keyframe.target))
+				{
+					LOGWRN("Skipping invalid keyframe in camera path: " + path.toString());
+					continue;
+				}
+
+				keyframe.time = entry["time"].get<float>();
+				output->mKeyframes.push_back(keyframe);
+			}
+		}
+
+		if (output->mKeyframes.empty())
+		{
+			LOGERR("Unable to load camera path. No valid keyframes found: " + path.toString());
+			return nullptr;
+		}
+
+		std::stable_sort(output->mKeyframes.begin(), output->mKeyframes.end(),
+			[](const Keyframe& a, const Keyframe& b) { return a.time < b.time; });
+
+		return output;
+	}
+}
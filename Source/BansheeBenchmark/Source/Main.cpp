@@ -0,0 +1,279 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsApplication.h"
+#include "BsResources.h"
+#include "BsPrefab.h"
+#include "BsSceneObject.h"
+#include "BsSceneManager.h"
+#include "BsCCamera.h"
+#include "BsInputRecording.h"
+#include "BsFileSystem.h"
+#include "BsEngineConfig.h"
+
+// Benchmark includes
+#include "BsBenchmarkRunner.h"
+#include "BsBenchmarkResults.h"
+#include "BsCameraPath.h"
+
+#include <iostream>
+
+using namespace bs;
+
+namespace
+{
+	/** Options that control the benchmark run, as parsed from the command line. */
+	struct RunOptions
+	{
+		Path scenePath;
+		Path cameraPathPath;
+		Path inputPath;
+		Path outputPath = "BenchmarkResults.json";
+		UINT32 numFrames = 1000;
+		UINT32 numWarmupFrames = 60;
+		float fixedFrameDelta = 1.0f / 60.0f;
+		UINT32 width = 1280;
+		UINT32 height = 720;
+		bool hidden = true;
+	};
+
+	/** Outputs command line usage information. */
+	void printUsage()
+	{
+		std::cout <<
+			"Usage:\n"
+			"  BansheeBenchmark run --scene <prefab> [options]\n"
+			"    --scene <path>         Prefab or scene resource to benchmark.\n"
+			"    --camera-path <path>   JSON file describing the path the main camera follows.\n"
+			"    --input <path>         Recorded input to play back during the run.\n"
+			"    --frames <count>       Number of frames to measure (default 1000).\n"
+			"    --warmup <count>       Number of frames to run before measuring (default 60).\n"
+			"    --fixed-delta <sec>    Simulation time step per frame, 0 for real time (default 1/60).\n"
+			"    --width <pixels>       Width of the render window (default 1280).\n"
+			"    --height <pixels>      Height of the render window (default 720).\n"
+			"    --visible              Show the render window instead of rendering to a hidden one.\n"
+			"    --output <path>        File to write the results to (default BenchmarkResults.json).\n"
+			"\n"
+			"  BansheeBenchmark compare <baseline> <current> [--threshold <percent>]\n"
+			"    Compares two result files. Returns a non-zero exit code if median, 95th or 99th percentile\n"
+			"    frame times regressed by more than the threshold (default 5%).\n";
+	}
+
+	/** Parses options for the run command. Returns false if the options are invalid. */
+	bool parseRunOptions(int argc, char* argv[], RunOptions& options)
+	{
+		for (int i = 2; i < argc; i++)
+		{
+			String arg = argv[i];
+			if (arg == "--visible")
+			{
+				options.hidden = false;
+				continue;
+			}
+
+			if ((i + 1) >= argc)
+			{
+				std::cerr << "Missing value for option: " << arg << std::endl;
+				return false;
+			}
+
+			String value = argv[++i];
+			if (arg == "--scene")
+				options.scenePath = value;
+			else if (arg == "--camera-path")
+				options.cameraPathPath = value;
+			else if (arg == "--input")
+				options.inputPath = value;
+			else if (arg == "--output")
+				options.outputPath = value;
+			else if (arg == "--frames")
+				options.numFrames = parseUINT32(value, options.numFrames);
+			else if (arg == "--warmup")
+				options.numWarmupFrames = parseUINT32(value, options.numWarmupFrames);
+			else if (arg == "--fixed-delta")
+				options.fixedFrameDelta = parseFloat(value, options.fixedFrameDelta);
+			else if (arg == "--width")
+				options.width = parseUINT32(value, options.width);
+			else if (arg == "--height")
+				options.height = parseUINT32(value, options.height);
+			else
+			{
+				std::cerr << "Unknown option: " << arg << std::endl;
+				return false;
+			}
+		}
+
+		if (options.scenePath.isEmpty())
+		{
+			std::cerr << "No scene provided." << std::endl;
+			return false;
+		}
+
+		if (options.numFrames == 0)
+		{
+			std::cerr << "Number of frames must be larger than zero." << std::endl;
+			return false;
+		}
+
+		return true;
+	}
+
+	/** Loads the scene, runs the benchmark and writes out the results. Returns the process exit code. */
+	int runBenchmark(const RunOptions& options)
+	{
+		START_UP_DESC startUpDesc;
+		startUpDesc.renderAPI = BS_RENDER_API_MODULE;
+		startUpDesc.renderer = BS_RENDERER_MODULE;
+		startUpDesc.audio = BS_AUDIO_MODULE;
+		startUpDesc.physics = BS_PHYSICS_MODULE;
+		startUpDesc.input = BS_INPUT_MODULE;
+
+		// There is no way to run the renderer without a window, so a hidden window is the closest to a headless run
+		startUpDesc.primaryWindowDesc.videoMode = VideoMode(options.width, options.height);
+		startUpDesc.primaryWindowDesc.title = "Banshee Benchmark";
+		startUpDesc.primaryWindowDesc.fullscreen = false;
+		startUpDesc.primaryWindowDesc.hidden = options.hidden;
+		startUpDesc.primaryWindowDesc.vsync = false;
+
+		Application::startUp(startUpDesc);
+
+		// Make sure the frame rate is limited only by the amount of work done
+		gApplication().setFPSLimit(0);
+
+		BENCHMARK_DESC desc;
+		desc.name = options.scenePath.getFilename(false);
+		desc.numFrames = options.numFrames;
+		desc.numWarmupFrames = options.numWarmupFrames;
+		desc.fixedFrameDelta = options.fixedFrameDelta;
+		desc.outputPath = options.outputPath;
+
+		bool ready = true;
+		if (!options.cameraPathPath.isEmpty())
+		{
+			desc.cameraPath = CameraPath::load(options.cameraPathPath);
+			ready &= desc.cameraPath != nullptr;
+		}
+
+		if (!options.inputPath.isEmpty())
+		{
+			desc.input = InputRecording::load(options.inputPath);
+			ready &= desc.input != nullptr;
+		}
+
+		HPrefab scene = gResources().load<Prefab>(options.scenePath, ResourceLoadFlag::LoadDependencies);
+		if (!scene.isLoaded(false))
+		{
+			LOGERR("Unable to load the benchmark scene: " + options.scenePath.toString());
+			ready = false;
+		}
+
+		if (!ready)
+		{
+			Application::shutDown();
+			return 1;
+		}
+
+		HSceneObject root = scene->instantiate();
+		if (scene->isScene())
+		{
+			HSceneObject oldRoot = gSceneManager().getRootNode();
+
+			gSceneManager()._setRootNode(root);
+			oldRoot->destroy();
+		}
+
+		// Scenes without their own camera are rendered from the camera path, or from the origin
+		if (gSceneManager().getMainCamera().sceneObject == nullptr)
+		{
+			HSceneObject cameraSO = SceneObject::create("BenchmarkCamera");
+
+			HCamera camera = cameraSO->addComponent<CCamera>(gApplication().getPrimaryWindow());
+			camera->setMain(true);
+		}
+
+		HSceneObject runnerSO = SceneObject::create("BenchmarkRunner");
+		GameObjectHandle<BenchmarkRunner> runner = runnerSO->addComponent<BenchmarkRunner>(desc);
+
+		Application::instance().runMainLoop();
+
+		bool finished = runner->hasFinished();
+		if (finished)
+		{
+			const FrameTimeStats& frameTime = runner->getResults().frameTime;
+			std::cout << "Measured " << runner->getResults().numFrames << " frames. Frame time (ms): p50 "
+				<< frameTime.p50 << ", p95 " << frameTime.p95 << ", p99 " << frameTime.p99 << ", max " << frameTime.max
+				<< "." << std::endl;
+		}
+		else
+			std::cerr << "Benchmark was interrupted before all frames were measured." << std::endl;
+
+		Application::shutDown();
+		return finished ? 0 : 1;
+	}
+
+	/** Compares two result files and outputs the differences. Returns the process exit code. */
+	int compareResults(int argc, char* argv[])
+	{
+		if (argc < 4)
+		{
+			printUsage();
+			return 2;
+		}
+
+		float threshold = 5.0f;
+		for (int i = 4; i < argc; i++)
+		{
+			String arg = argv[i];
+			if (arg == "--threshold" && (i + 1) < argc)
+				threshold = parseFloat(argv[++i], threshold);
+			else
+			{
+				std::cerr << "Unknown option: " << arg << std::endl;
+				return 2;
+			}
+		}
+
+		// Comparison doesn't need the engine to be started
+		BenchmarkResults baseline;
+		BenchmarkResults current;
+		if (!BenchmarkResults::load(argv[2], baseline) || !BenchmarkResults::load(argv[3], current))
+		{
+			std::cerr << "Unable to load the result files." << std::endl;
+			return 2;
+		}
+
+		String report;
+		bool passed = BenchmarkResults::compare(baseline, current, threshold, report);
+
+		std::cout << report;
+		return passed ? 0 : 1;
+	}
+}
+
+/** Main entry point into the benchmark runner. */
+int main(int argc, char* argv[])
+{
+	if (argc < 2)
+	{
+		printUsage();
+		return 2;
+	}
+
+	String command = argv[1];
+	if (command == "run")
+	{
+		RunOptions options;
+		if (!parseRunOptions(argc, argv, options))
+		{
+			printUsage();
+			return 2;
+		}
+
+		return runBenchmark(options);
+	}
+
+	if (command == "compare")
+		return compareResults(argc, argv);
+
+	printUsage();
+	return 2;
+}
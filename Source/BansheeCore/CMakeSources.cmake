@@ -86,6 +86,8 @@ set(BS_BANSHEECORE_INC_INPUT
 	"Include/BsOSInputHandler.h"
 	"Include/BsInputFwd.h"
 	"Include/BsInput.h"
+	"Include/BsInputRecording.h"
+	"Include/BsInputSampler.h"
 )
 
 set(BS_BANSHEECORE_INC_RENDERER
@@ -157,6 +159,7 @@ set(BS_BANSHEECORE_INC_RENDERAPI_MANAGERS
 	"Include/BsRenderWindowManager.h"
 	"Include/BsRenderStateManager.h"
 	"Include/BsQueryManager.h"
+	"Include/BsGpuReadbackManager.h"
 	"Include/BsMeshManager.h"
 	"Include/BsHardwareBufferManager.h"
 	"Include/BsGpuProgramManager.h"
@@ -212,6 +215,8 @@ set(BS_BANSHEECORE_INC_RESOURCES
 	"Include/BsShaderInclude.h"
 	"Include/BsResourceListenerManager.h"
 	"Include/BsIResourceListener.h"
+	"Include/BsTextureStreamingManager.h"
+	"Include/BsResourceCache.h"
 )
 
 set(BS_BANSHEECORE_SRC_UTILITY
@@ -235,6 +240,7 @@ set(BS_BANSHEECORE_SRC_PROFILING
 	"Source/BsProfilerCPU.cpp"
 	"Source/BsProfilerGPU.cpp"
 	"Source/BsProfilingManager.cpp"
+	"Source/BsRenderStats.cpp"
 )
 
 set(BS_BANSHEECORE_SRC_COMPONENTS
@@ -397,6 +403,8 @@ set(BS_BANSHEECORE_SRC_RESOURCES
 	"Source/BsShaderInclude.cpp"
 	"Source/BsResourceListenerManager.cpp"
 	"Source/BsIResourceListener.cpp"
+	"Source/BsTextureStreamingManager.cpp"
+	"Source/BsResourceCache.cpp"
 )
 
 set(BS_BANSHEECORE_SRC_MATERIAL
@@ -415,6 +423,8 @@ set(BS_BANSHEECORE_SRC_MATERIAL
 set(BS_BANSHEECORE_SRC_INPUT
 	"Source/BsInput.cpp"
 	"Source/BsOSInputHandler.cpp"
+	"Source/BsInputRecording.cpp"
+	"Source/BsInputSampler.cpp"
 )
 
 set(BS_BANSHEECORE_INC_LOCALIZATION
@@ -465,6 +475,7 @@ set(BS_BANSHEECORE_SRC_RENDERAPI_MANAGERS
 	"Source/BsHardwareBufferManager.cpp"
 	"Source/BsMeshManager.cpp"
 	"Source/BsQueryManager.cpp"
+	"Source/BsGpuReadbackManager.cpp"
 	"Source/BsRenderStateManager.cpp"
 	"Source/BsRenderWindowManager.cpp"
 	"Source/BsRenderAPIManager.cpp"
@@ -531,6 +542,15 @@ set(BS_BANSHEECORE_SRC_AUDIO
 	"Source/BsAudioManager.cpp"
 )
 
+set(BS_BANSHEECORE_INC_BENCHMARK
+	"Include/BsCoreBenchmarkSuite.h"
+)
+
+set(BS_BANSHEECORE_SRC_BENCHMARK
+	"Source/BsCoreBenchmarkSuite.cpp"
+	"Source/BsCoreBenchmark.cpp"
+)
+
 set(BS_BANSHEECORE_INC_ANIMATION
 	"Include/BsAnimationCurve.h"
 	"Include/BsAnimationClip.h"
@@ -541,6 +561,7 @@ set(BS_BANSHEECORE_INC_ANIMATION
 	"Include/BsAnimationUtility.h"
 	"Include/BsSkeletonMask.h"
 	"Include/BsMorphShapes.h"
+	"Include/BsBonePaletteBuffer.h"
 )
 
 set(BS_BANSHEECORE_SRC_ANIMATION
@@ -552,6 +573,7 @@ set(BS_BANSHEECORE_SRC_ANIMATION
 	"Source/BsAnimationUtility.cpp"
 	"Source/BsSkeletonMask.cpp"
 	"Source/BsMorphShapes.cpp"
+	"Source/BsBonePaletteBuffer.cpp"
 )
 
 set(BS_BANSHEECORE_INC_PLATFORM
@@ -567,6 +589,10 @@ set(BS_BANSHEECORE_INC_PLATFORM_WIN32
 	"Include/Win32/BsWin32Platform.h"
 )
 
+set(BS_BANSHEECORE_INC_PLATFORM_LINUX
+	"Include/Linux/BsLinuxFolderMonitor.h"
+)
+
 set(BS_BANSHEECORE_SRC_PLATFORM
 	"Source/BsPlatform.cpp"
 )
@@ -577,9 +603,16 @@ set(BS_BANSHEECORE_SRC_PLATFORM_WIN32
 	"Source/Win32/BsWin32BrowseDialogs.cpp"
 )
 
+set(BS_BANSHEECORE_SRC_PLATFORM_LINUX
+	"Source/Linux/BsLinuxFolderMonitor.cpp"
+)
+
 if(WIN32)
 	list(APPEND BS_BANSHEECORE_INC_PLATFORM ${BS_BANSHEECORE_INC_PLATFORM_WIN32})
 	list(APPEND BS_BANSHEECORE_SRC_PLATFORM ${BS_BANSHEECORE_SRC_PLATFORM_WIN32})
+elseif(UNIX AND NOT APPLE)
+	list(APPEND BS_BANSHEECORE_INC_PLATFORM ${BS_BANSHEECORE_INC_PLATFORM_LINUX})
+	list(APPEND BS_BANSHEECORE_SRC_PLATFORM ${BS_BANSHEECORE_SRC_PLATFORM_LINUX})
 endif()
 
 source_group("Header Files\\Components" FILES ${BS_BANSHEECORE_INC_COMPONENTS})
@@ -622,6 +655,8 @@ source_group("Header Files\\Audio" FILES ${BS_BANSHEECORE_INC_AUDIO})
 source_group("Source Files\\Audio" FILES ${BS_BANSHEECORE_SRC_AUDIO})
 source_group("Header Files\\Animation" FILES ${BS_BANSHEECORE_INC_ANIMATION})
 source_group("Source Files\\Animation" FILES ${BS_BANSHEECORE_SRC_ANIMATION})
+source_group("Header Files\\Benchmark" FILES ${BS_BANSHEECORE_INC_BENCHMARK})
+source_group("Source Files\\Benchmark" FILES ${BS_BANSHEECORE_SRC_BENCHMARK})
 
 set(BS_BANSHEECORE_SRC
 	${BS_BANSHEECORE_INC_COMPONENTS}
@@ -664,4 +699,9 @@ set(BS_BANSHEECORE_SRC
 	${BS_BANSHEECORE_SRC_ANIMATION}
 	${BS_BANSHEECORE_INC_RENDERAPI_MANAGERS}
 	${BS_BANSHEECORE_SRC_RENDERAPI_MANAGERS}
+)
+
+set(BS_BANSHEECORE_BENCHMARK_SRC
+	${BS_BANSHEECORE_INC_BENCHMARK}
+	${BS_BANSHEECORE_SRC_BENCHMARK}
 )
\ No newline at end of file
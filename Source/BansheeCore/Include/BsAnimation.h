@@ -10,6 +10,7 @@
 #include "BsSkeletonMask.h"
 #include "BsVector2.h"
 #include "BsAABox.h"
+#include "BsCoreThread.h"
 
 namespace bs
 {
@@ -249,6 +250,10 @@ namespace bs
 		UINT32 numMorphVertices;
 		bool morphChannelWeightsDirty;
 
+		// Morph shape outputs, cycled so the one being written is never one the core thread could still be reading
+		SPtr<MeshData> morphShapeOutputs[CoreThread::NUM_SYNC_BUFFERS];
+		UINT32 morphShapeOutputIdx;
+
 		// Culling
 		AABox mBounds;
 		bool mCullEnabled;
@@ -7,6 +7,8 @@
 #include "BsCoreThread.h"
 #include "BsConvexVolume.h"
 #include "BsVertexDataDesc.h"
+#include "BsVector4.h"
+#include "BsMatrix4.h"
 
 namespace bs
 {
@@ -48,6 +50,12 @@ namespace bs
 
 		/** Global joint transforms for all skeletons in the scene. */
 		Vector<Matrix4> transforms;
+
+		/** 
+		 * Same transforms as in @p transforms, stored as three rows of a 3x4 matrix per joint, as expected by the GPU. Each
+		 * joint maps to three consecutive entries, starting at the joint's index in @p transforms multiplied by three.
+		 */
+		Vector<Vector4> packedTransforms;
 	};
 
 	/** 
@@ -121,6 +129,9 @@ namespace bs
 		/** Worker method ran on the animation thread that evaluates all animation at the provided time. */
 		void evaluateAnimation();
 
+		/** Blends all morph shapes of the provided animation using their current weights, and writes them to @p output. */
+		void evaluateMorphShapes(const AnimationProxy& anim, MeshData& output);
+
 		UINT64 mNextId;
 		UnorderedMap<UINT64, Animation*> mAnimations;
 		
@@ -138,6 +149,8 @@ namespace bs
 		Vector<SPtr<AnimationProxy>> mProxies;
 		Vector<ConvexVolume> mCullFrustums;
 		RendererAnimationData mAnimData[CoreThread::NUM_SYNC_BUFFERS];
+		Vector<float> mMorphPositions; // Scratch buffers for morph shape evaluation, four floats per vertex
+		Vector<float> mMorphNormals;
 
 		UINT32 mPoseReadBufferIdx;
 		UINT32 mPoseWriteBufferIdx;
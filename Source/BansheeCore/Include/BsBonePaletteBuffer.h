@@ -0,0 +1,92 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsModule.h"
+#include "BsAnimationManager.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup Animation-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Single GPU buffer containing bone matrices of all skinned renderables in the scene. Poses of all animations
+	 * evaluated during a frame are uploaded with a single write, and renderables reference their bones through an offset
+	 * into the buffer.
+	 *
+	 * The buffer starts with a block of identity transforms, large enough for the largest skeleton that was registered
+	 * with the buffer, followed by the evaluated poses. Renderables without an evaluated pose reference the identity block
+	 * and therefore render in bind pose.
+	 *
+	 * A copy of the last evaluated pose is kept for every animation registered through registerAnimation(). Animations
+	 * that were culled during evaluation keep referencing their last pose, which is appended after the evaluated poses.
+	 * This way objects outside of the view frustum still cast shadows in their animated pose.
+	 *
+	 * @note	Core thread only.
+	 */
+	class BS_CORE_EXPORT BonePaletteBuffer : public Module<BonePaletteBuffer>
+	{
+	public:
+		/**
+		 * Makes sure the identity block is large enough for a skeleton with the provided number of bones. If the block
+		 * needs to grow, the retained poses are re-uploaded after it.
+		 */
+		void reserveIdentityBones(UINT32 numBones);
+
+		/**
+		 * Notifies the buffer that a skinned renderable is animated by the animation with the provided ID, so its poses
+		 * should be retained. Must be paired with a call to unregisterAnimation().
+		 */
+		void registerAnimation(UINT64 animId);
+
+		/** Notifies the buffer that a renderable animated by the animation with the provided ID is no longer skinned. */
+		void unregisterAnimation(UINT64 animId);
+
+		/**
+		 * Uploads the poses of all animations in the provided animation data. Should be called once per frame, before any
+		 * renderables query their bone offsets. If the data contains no animations (e.g. evaluation is paused) the buffer
+		 * is left as is, so renderables can keep referencing the poses from the last upload. Registered animations missing
+		 * from the data (e.g. culled ones) are uploaded using their last evaluated pose.
+		 */
+		void update(const RendererAnimationData& animData);
+
+		/**
+		 * Returns the index of the first bone of the last pose of the animation with the provided ID. Returns the start
+		 * of the identity block if the animation isn't registered or was never evaluated. Offsets are valid until the next
+		 * call to update() or reserveIdentityBones().
+		 */
+		UINT32 getBoneOffset(UINT64 animId) const;
+
+		/**
+		 * Returns the GPU buffer containing the bone matrices, three elements per bone. The buffer can be re-allocated when
+		 * it needs to grow, so this shouldn't be cached across frames.
+		 */
+		const SPtr<GpuBuffer>& getBuffer() const { return mBuffer; }
+
+	private:
+		/** Last evaluated pose of a registered animation. */
+		struct RetainedPose
+		{
+			Vector<Vector4> transforms; /**< Three rows of a 3x4 matrix per bone. */
+			UINT32 offset = 0;
+			UINT32 numRefs = 0;
+			bool evaluated = false;
+		};
+
+		/**
+		 * Makes sure the buffer can hold at least the provided number of bones, re-allocating it if required. Returns
+		 * a pointer to the locked buffer, with the identity block already written.
+		 */
+		UINT8* lock(UINT32 numBones);
+
+		UnorderedMap<UINT64, RetainedPose> mPoses;
+		SPtr<GpuBuffer> mBuffer;
+		UINT32 mCapacity = 0; // In bones
+		UINT32 mNumIdentityBones = 0;
+	};
+
+	/** @} */
+}}
@@ -142,6 +142,16 @@ namespace bs
 		/** @copydoc Camera::setMSAACount */
 		void setMSAACount(UINT32 count) { mInternal->setMSAACount(count); }
 
+		/** @copydoc Camera::getLateLatchMouseSensitivity */
+		const Vector2& getLateLatchMouseSensitivity() const { return mInternal->getLateLatchMouseSensitivity(); }
+
+		/** @copydoc Camera::getLateLatchGamepadSensitivity */
+		const Vector2& getLateLatchGamepadSensitivity() const { return mInternal->getLateLatchGamepadSensitivity(); }
+
+		/** @copydoc Camera::setLateLatchSensitivity */
+		void setLateLatchSensitivity(const Vector2& mouse, const Vector2& gamepad) 
+		{ mInternal->setLateLatchSensitivity(mouse, gamepad); }
+
 		/** Returns settings that are used for controling post-process operations like tonemapping. */
 		const SPtr<PostProcessSettings>& getPostProcessSettings() const { return mInternal->getPostProcessSettings(); }
 
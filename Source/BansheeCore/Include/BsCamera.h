@@ -309,6 +309,31 @@ namespace bs
 		 */
 		void setMSAACount(UINT32 count) { mMSAA = count; _markCoreDirty(); }
 
+		/** Returns the rotation applied per unit of late-latched mouse movement. See setLateLatchSensitivity(). */
+		const Vector2& getLateLatchMouseSensitivity() const { return mLateLatchMouse; }
+
+		/** Returns the rotation applied per second of late-latched right stick deflection. See setLateLatchSensitivity(). */
+		const Vector2& getLateLatchGamepadSensitivity() const { return mLateLatchGamepad; }
+
+		/**
+		 * Enables late latching of look input for this camera. When enabled, right before the frame is rendered, the 
+		 * renderer rotates the camera by any mouse and gamepad right stick input received after the simulation thread 
+		 * last processed input. This hides a frame or more of input latency for first person style cameras. Requires
+		 * input sampling to be enabled through Input::setSamplingRate().
+		 *
+		 * @param[in]	mouse		Yaw (x) and pitch (y) rotation in degrees applied per unit of mouse axis movement. Should 
+		 *							match the rotation speed used by the component controlling the camera.
+		 * @param[in]	gamepad		Yaw (x) and pitch (y) rotation in degrees applied per second of full right stick 
+		 *							deflection.
+		 *
+		 * @note	Set both to zero to disable late latching (default).
+		 */
+		void setLateLatchSensitivity(const Vector2& mouse, const Vector2& gamepad) 
+		{ mLateLatchMouse = mouse; mLateLatchGamepad = gamepad; _markCoreDirty(); }
+
+		/** Checks has late latching of look input been enabled through setLateLatchSensitivity(). */
+		bool isLateLatchEnabled() const { return mLateLatchMouse != Vector2::ZERO || mLateLatchGamepad != Vector2::ZERO; }
+
 		/** Returns settings that are used for controling post-process operations like tonemapping. */
 		const SPtr<PostProcessSettings>& getPostProcessSettings() const { return mPPSettings; }
 
@@ -475,6 +500,8 @@ namespace bs
 		bool mCustomViewMatrix; /**< Is custom view matrix set. */
 		bool mCustomProjMatrix; /**< Is custom projection matrix set. */
 		UINT8 mMSAA; /**< Number of samples to render the scene with. */
+		Vector2 mLateLatchMouse; /**< Rotation in degrees applied per unit of late-latched mouse movement. */
+		Vector2 mLateLatchGamepad; /**< Rotation in degrees applied per second of late-latched right stick deflection. */
 
 		SPtr<PostProcessSettings> mPPSettings; /**< Settings used to control post-process operations. */
 
@@ -43,6 +43,8 @@ namespace bs
 			/** BS_RTTI_MEMBER_PLAIN(mPPSettings, 24) */
 			BS_RTTI_MEMBER_REFLPTR(mPPSettings, 25)
 			/** BS_RTTI_MEMBER_REFL(mSkyTexture, 26) */
+			BS_RTTI_MEMBER_PLAIN(mLateLatchMouse, 27)
+			BS_RTTI_MEMBER_PLAIN(mLateLatchGamepad, 28)
 		BS_END_RTTI_MEMBERS
 			
 	public:
@@ -79,6 +79,9 @@ namespace bs { namespace ct
 		/** Returns the device index this buffer will execute on. */
 		UINT32 getDeviceIdx() const { return mDeviceIdx; }
 
+		/** Returns true if the command buffer can only be executed by appending it to a primary command buffer. */
+		bool isSecondary() const { return mIsSecondary; }
+
 	protected:
 		CommandBuffer(GpuQueueType type, UINT32 deviceIdx, UINT32 queueIdx, bool secondary);
 
@@ -191,6 +191,11 @@ namespace bs
 		 * Signifies that you will modify this buffer fairly often (e.g. every frame). Mutually exclusive with GBU_STATIC. 
 		 */
 		GBU_DYNAMIC = 0x02,
+		/**
+		 * Signifies that the CPU will read back the buffer contents after they have been written by the GPU (e.g. when
+		 * using the buffer as a staging buffer). Can be combined with GBU_STATIC or GBU_DYNAMIC.
+		 */
+		GBU_CPUREADABLE = 0x2000
 	};
 
 	/** Types of generic GPU buffers that may be attached to GPU programs. */
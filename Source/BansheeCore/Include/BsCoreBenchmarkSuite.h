@@ -0,0 +1,44 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsBenchmarkSuite.h"
+#include "BsVector3.h"
+#include "BsAnimationCurve.h"
+#include "BsCurveCache.h"
+
+namespace bs
+{
+	/** Measures the performance of core functionality that doesn't require the core systems to be started. */
+	class CoreBenchmarkSuite : public BenchmarkSuite
+	{
+	public:
+		CoreBenchmarkSuite();
+
+	protected:
+		/** @copydoc BenchmarkSuite::startUp */
+		void startUp() override;
+
+		/** @copydoc BenchmarkSuite::shutDown */
+		void shutDown() override;
+
+	private:
+		void benchPixelConversionToFloat16();
+		void benchPixelConversionToRGBA8();
+		void benchPixelScale();
+		void benchCurveEvaluate();
+		void benchCurveEvaluateCached();
+		void benchVector3CurveEvaluateCached();
+
+		SPtr<PixelData> mPixelsRGBA8;
+		SPtr<PixelData> mPixelsFloat16;
+		SPtr<PixelData> mPixelsFloat32;
+		SPtr<PixelData> mPixelsHalfSize;
+
+		TAnimationCurve<float> mFloatCurve;
+		TAnimationCurve<Vector3> mVector3Curve;
+		TCurveCache<float> mFloatCurveCache;
+		TCurveCache<Vector3> mVector3CurveCache;
+	};
+}
@@ -240,6 +240,8 @@ namespace bs
 	class Input;
 	struct PointerEvent;
 	class RawInputHandler;
+	class InputRecording;
+	class InputSampler;
 	class RendererFactory;
 	class AsyncOp;
 	class HardwareBufferManager;
@@ -4,6 +4,30 @@
 
 #include "BsCorePrerequisites.h"
 
+namespace bs
+{
+	/** @addtogroup Platform-Internal
+	 *  @{
+	 */
+
+	/** Types of notifications we would like to receive when we start a FolderMonitor on a certain folder. */
+	enum class FolderChange
+	{
+		FileName = 0x0001, /**< Called when filename changes. */
+		DirName = 0x0002, /**< Called when directory name changes. */
+		Attributes = 0x0004, /**< Called when attributes changes. */
+		Size = 0x0008, /**< Called when file size changes. */
+		LastWrite = 0x0010, /**< Called when file is written to. */
+		LastAccess = 0x0020, /**< Called when file is accessed. */
+		Creation = 0x0040, /**< Called when file is created. */
+		Security = 0x0080 /**< Called when file security descriptor changes. */
+	};
+
+	/** @} */
+}
+
 #if BS_PLATFORM == BS_PLATFORM_WIN32
 #include "Win32/BsWin32FolderMonitor.h"
+#elif BS_PLATFORM == BS_PLATFORM_LINUX
+#include "Linux/BsLinuxFolderMonitor.h"
 #endif
\ No newline at end of file
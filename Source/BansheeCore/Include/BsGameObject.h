@@ -48,7 +48,7 @@ namespace bs
 		const String& getName() const { return mName; }
 
 		/**	Sets the name of the object. */
-		void setName(const String& name) { mName = name; }
+		virtual void setName(const String& name) { mName = name; }
 
 	public: // ***** INTERNAL ******
 		/** @name Internal
@@ -0,0 +1,126 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsModule.h"
+#include "BsTexture.h"
+#include "BsGpuBuffer.h"
+#include "BsAsyncOp.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup RenderAPI-Internal
+	 *  @{
+	 */
+
+	/** Callback triggered on the core thread when an asynchronous GPU read completes. */
+	typedef std::function<void()> GpuReadbackCallback;
+
+	/**
+	 * Reads the contents of textures and buffers from the GPU without stalling the pipeline.
+	 *
+	 * Instead of waiting for the GPU to finish all queued work (like Texture::readData() or GpuBuffer::readData() do), a
+	 * read request queues a copy of the resource into a CPU readable staging resource, followed by a fence. The staging
+	 * resource is only mapped once the GPU has signaled the fence, which is usually one or more frames later. Staging
+	 * resources are pooled and re-used by later requests with the same size and format.
+	 *
+	 * Requests always complete in the order they were issued in.
+	 *
+	 * @note	Core thread only.
+	 */
+	class BS_CORE_EXPORT GpuReadbackManager : public Module<GpuReadbackManager>
+	{
+		/** Information about a pooled staging texture. */
+		struct StagingTexture
+		{
+			SPtr<Texture> texture;
+			UINT64 lastUsedFrame;
+			bool inUse;
+		};
+
+		/** Information about a pooled staging buffer. */
+		struct StagingBuffer
+		{
+			SPtr<GpuBuffer> buffer;
+			UINT64 lastUsedFrame;
+			bool inUse;
+		};
+
+		/** Information about a read request that is waiting on the GPU. */
+		struct ReadRequest
+		{
+			SPtr<EventQuery> fence;
+			AsyncOp op;
+			GpuReadbackCallback callback;
+
+			bool isTexture;
+			UINT32 stagingIdx;
+
+			SPtr<PixelData> pixelData;
+			UINT32 length;
+		};
+
+	public:
+		~GpuReadbackManager();
+
+		/**
+		 * Queues a read of a single texture sub-resource.
+		 *
+		 * @param[in]	texture		Texture to read from. If the texture is multisampled, it will be resolved first.
+		 *							Cube map textures are not supported.
+		 * @param[in]	data		Buffer to write the contents to, once the read completes. Must be of the same size and
+		 *							format as the sub-resource. Use TextureProperties::allocBuffer() to allocate a
+		 *							buffer of a correct format and size.
+		 * @param[in]	face		Texture face to read from.
+		 * @param[in]	mipLevel	Mip level to read from.
+		 * @param[in]	callback	Optional callback to trigger on the core thread once the read completes.
+		 * @return					Async operation object that completes when @p data has been populated. Can be polled
+		 *							from any thread.
+		 */
+		AsyncOp readTexture(const SPtr<Texture>& texture, const SPtr<PixelData>& data, UINT32 face = 0,
+			UINT32 mipLevel = 0, const GpuReadbackCallback& callback = nullptr);
+
+		/**
+		 * Queues a read of a range of a GPU buffer.
+		 *
+		 * @param[in]	buffer		Buffer to read from.
+		 * @param[in]	offset		Offset to start reading from, in bytes.
+		 * @param[in]	length		Number of bytes to read.
+		 * @param[in]	callback	Optional callback to trigger on the core thread once the read completes.
+		 * @return					Async operation object that completes when the read has finished. The operation will
+		 *							return a SPtr<MemoryDataStream> containing the buffer contents.
+		 */
+		AsyncOp readBuffer(const SPtr<GpuBuffer>& buffer, UINT32 offset, UINT32 length,
+			const GpuReadbackCallback& callback = nullptr);
+
+		/** Returns the number of read requests still waiting on the GPU. */
+		UINT32 getNumPendingReads() const { return (UINT32)mRequests.size(); }
+
+		/**
+		 * Completes any read requests whose fences have been signaled, and releases staging resources that haven't been
+		 * used in a while. Should be called once per frame.
+		 */
+		void _update();
+
+	private:
+		/** Finds an unused staging texture matching the provided description, or creates a new one. */
+		UINT32 allocStagingTexture(const TEXTURE_DESC& desc);
+
+		/** Finds an unused staging buffer matching the provided description, or creates a new one. */
+		UINT32 allocStagingBuffer(const GPU_BUFFER_DESC& desc);
+
+		/** Queues the fence for the provided request and registers the request as pending. */
+		void queueRequest(ReadRequest& request);
+
+		/** Number of frames after which unused staging resources are released. */
+		static const UINT32 MAX_UNUSED_FRAMES;
+
+		Vector<StagingTexture> mStagingTextures;
+		Vector<StagingBuffer> mStagingBuffers;
+		Queue<ReadRequest> mRequests;
+		UINT64 mFrameIdx = 0;
+	};
+
+	/** @} */
+}}
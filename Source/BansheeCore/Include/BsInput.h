@@ -7,6 +7,7 @@
 #include "BsOSInputHandler.h"
 #include "BsRawInputHandler.h"
 #include "BsInputFwd.h"
+#include "BsInputSampler.h"
 
 namespace bs
 {
@@ -128,6 +129,43 @@ namespace bs
 		/** Enables or disables mouse smoothing. Smoothing makes the changes to mouse axes more gradual. */
 		void setMouseSmoothing(bool enabled);
 
+		/** 
+		 * Starts recording all input received from the input handlers, along with frame delta times. Recording starts
+		 * with the next frame. Replaces any recording already in progress.
+		 */
+		void startRecording();
+
+		/** Stops recording input and returns the recorded data. Returns null if no recording was in progress. */
+		SPtr<InputRecording> stopRecording();
+
+		/** 
+		 * Starts replaying previously recorded input, starting with the next frame. While playing back, input reported by
+		 * the input handlers is ignored and frame delta time reported by Time is fixed to the recorded value. This 
+		 * ensures the application receives the same input and frame times on every run, regardless of actual frame 
+		 * duration. Playback stops automatically once all recorded frames are replayed.
+		 */
+		void startPlayback(const SPtr<InputRecording>& recording);
+
+		/** Stops any playback started with startPlayback() and returns back to using real input and frame times. */
+		void stopPlayback();
+
+		/** Checks is recorded input currently being played back. */
+		bool isPlayingBack() const { return mPlayback != nullptr; }
+
+		/**
+		 * Determines how is raw input (mouse, keyboard, gamepad) polled. By default (rate of zero) devices are polled once
+		 * per frame by _update(). When a non-zero rate is provided devices are instead polled on a separate thread the
+		 * provided number of times per second, and the sampled events are processed by the next _update(). This allows
+		 * the renderer to apply look input received after the frame's input was processed, for cameras with late
+		 * latching enabled (see Camera::setLateLatchSensitivity()).
+		 *
+		 * @note	Mouse smoothing relies on per-frame sampling and should be disabled when polling on a separate thread.
+		 */
+		void setSamplingRate(UINT32 rate);
+
+		/** Returns the rate at which raw input is polled on a separate thread, or zero if polled once per frame. */
+		UINT32 getSamplingRate() const { return mSampler != nullptr ? mSampler->getRate() : 0; }
+
 		/** Triggered whenever a button is first pressed. */
 		Event<void(const ButtonEvent&)> onButtonDown;
 
@@ -170,6 +208,15 @@ namespace bs
 		/** Triggers any queued input event callbacks. */
 		void _triggerCallbacks();
 
+		/** Returns the sampler used for polling raw input on a separate thread, if one is active. */
+		SPtr<InputSampler> _getSampler() const { return mSampler; }
+
+		/** 
+		 * Returns look input totals as of the last sampled event processed by _update(). Only relevant if input is
+		 * sampled on a separate thread.
+		 */
+		const LookInput& _getConsumedLookInput() const { return mConsumedLook; }
+
 		/** @} */
 
 	private:
@@ -203,10 +250,26 @@ namespace bs
 		/** Called when window in focus changes, as reported by the OS. */
 		void inputWindowChanged(RenderWindow& win);
 
+		/** Triggers the events recorded for the current playback frame, and advances to the next frame. */
+		void playbackFrame();
+
+		/** Triggers the events sampled by the input sampler since the last call. */
+		void processSampledEvents();
+
+		/** Starts or stops receiving events directly from the raw input handler. */
+		void connectRawInputHandler(bool connect);
+
 	private:
 		SPtr<RawInputHandler> mRawInputHandler;
 		SPtr<OSInputHandler> mOSInputHandler;
 
+		SPtr<InputSampler> mSampler;
+		LookInput mConsumedLook;
+
+		HEvent mRawButtonDownConn;
+		HEvent mRawButtonUpConn;
+		HEvent mRawAxisMovedConn;
+
 		Vector<DeviceData> mDevices;
 		Vector2I mPointerPosition;
 		Vector2I mPointerDelta;
@@ -226,6 +289,11 @@ namespace bs
 		Vector<ButtonEvent> mButtonDownEvents;
 		Vector<ButtonEvent> mButtonUpEvents;
 
+		SPtr<InputRecording> mRecording;
+		SPtr<InputRecording> mPlayback;
+		UINT32 mPlaybackFrame;
+		bool mIgnoreInput; // Set while input handlers are updated during playback
+
 		/************************************************************************/
 		/* 								STATICS		                      		*/
 		/************************************************************************/
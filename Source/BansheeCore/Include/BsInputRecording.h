@@ -0,0 +1,94 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsInputFwd.h"
+#include "BsRawInputHandler.h"
+
+namespace bs
+{
+	/** @addtogroup Input-Internal
+	 *  @{
+	 */
+
+	/** A single input event stored in an InputRecording. */
+	struct BS_CORE_EXPORT RecordedInputEvent
+	{
+		/** Types of recorded input events. */
+		enum class Type
+		{
+			ButtonDown, ButtonUp, AxisMoved, PointerMoved, PointerDown, PointerUp, PointerDoubleClick, TextInput, Command
+		};
+
+		RecordedInputEvent() { }
+
+		/** Creates a button, text input or input command event. */
+		RecordedInputEvent(Type type, UINT32 deviceIdx, UINT32 code, UINT64 timestamp = 0)
+			:type(type), deviceIdx(deviceIdx), code(code), timestamp(timestamp)
+		{ }
+
+		/** Creates an axis event. */
+		RecordedInputEvent(UINT32 deviceIdx, UINT32 axisIdx, const RawAxisState& axis)
+			:type(Type::AxisMoved), deviceIdx(deviceIdx), code(axisIdx), axis(axis)
+		{ }
+
+		/** Creates a pointer event. */
+		RecordedInputEvent(Type type, const PointerEvent& pointer)
+			:type(type), pointer(pointer)
+		{ }
+
+		Type type = Type::ButtonDown;
+		UINT32 deviceIdx = 0;
+		UINT32 code = 0; /**< Button code, axis index, character or input command, depending on type. */
+		UINT64 timestamp = 0;
+		RawAxisState axis;
+		PointerEvent pointer;
+	};
+
+	/**
+	 * Stream of input events captured by Input, grouped per frame together with the frame's delta time. Can be saved to
+	 * a file and played back later through Input::startPlayback(), producing the same input and frame times on every run.
+	 */
+	class BS_CORE_EXPORT InputRecording
+	{
+	public:
+		/** Range of events that were received during a single frame. */
+		struct Frame
+		{
+			float delta; /**< Time since the previous frame, in seconds. */
+			UINT32 firstEvent;
+			UINT32 numEvents;
+		};
+
+		/** Starts a new frame. All events added after this call will belong to this frame. */
+		void beginFrame(float delta);
+
+		/** Adds a new event to the current frame. */
+		void addEvent(const RecordedInputEvent& event);
+
+		/** Returns the number of recorded frames. */
+		UINT32 getNumFrames() const { return (UINT32)mFrames.size(); }
+
+		/** Returns information about a recorded frame. */
+		const Frame& getFrame(UINT32 idx) const { return mFrames[idx]; }
+
+		/** Returns a recorded event. Event indices for a specific frame can be retrieved from getFrame(). */
+		const RecordedInputEvent& getEvent(UINT32 idx) const { return mEvents[idx]; }
+
+		/** Saves the recording to the specified file. */
+		void save(const Path& path) const;
+
+		/** Loads a recording previously saved with save(). Returns null if the file is not a valid recording. */
+		static SPtr<InputRecording> load(const Path& path);
+
+	private:
+		static const UINT32 FILE_MAGIC;
+		static const UINT32 FILE_VERSION;
+
+		Vector<Frame> mFrames;
+		Vector<RecordedInputEvent> mEvents;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,136 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsRawInputHandler.h"
+#include "BsLockFreeQueue.h"
+#include "BsSpinLock.h"
+#include "BsThreadPool.h"
+#include "BsVector2.h"
+#include "BsEvent.h"
+
+namespace bs
+{
+	/** @addtogroup Input-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Running totals of input used for rotating a camera (looking around). Only the difference between two totals is
+	 * meaningful.
+	 */
+	struct LookInput
+	{
+		LookInput()
+			:mouse(BsZero), gamepad(BsZero)
+		{ }
+
+		Vector2 mouse; /**< Sum of all relative mouse X/Y axis movements. */
+		Vector2 gamepad; /**< Primary gamepad right stick X/Y position, integrated over time (in seconds). */
+	};
+
+	/** Raw input event recorded by InputSampler. */
+	struct SampledInputEvent
+	{
+		enum class Type
+		{
+			ButtonDown, ButtonUp, AxisMoved,
+			Tick /**< No input event, only reports updated look input totals. */
+		};
+
+		SampledInputEvent()
+			:type(Type::Tick), deviceIdx(0), code(0), timestamp(0), sampleTime(0)
+		{ }
+
+		Type type;
+		UINT32 deviceIdx;
+		UINT32 code; /**< Button code for button events, or axis type for axis events. */
+		RawAxisState axis;
+		UINT64 timestamp; /**< Timestamp as reported by the input handler, for button events. */
+		UINT64 sampleTime; /**< Time at which the event was sampled, in microseconds since application start. */
+		LookInput look; /**< Look input totals, including this event. */
+	};
+
+	/**
+	 * Polls a raw input handler on a separate thread, at a rate independent of the frame rate. Received events are
+	 * stored in a lock-free queue and are expected to be consumed by the simulation thread once per frame.
+	 *
+	 * Look input totals are additionally published after every sample and can be read from any thread, allowing the
+	 * renderer to account for input received after the simulation thread processed its input for the frame.
+	 *
+	 * @note	Once the sampler is created it is the only one allowed to update the raw input handler.
+	 */
+	class BS_CORE_EXPORT InputSampler
+	{
+	public:
+		/**
+		 * Starts sampling input from the provided handler.
+		 *
+		 * @param[in]	inputHandler	Raw input handler to poll.
+		 * @param[in]	rate			Number of times per second to poll the input handler.
+		 */
+		InputSampler(const SPtr<RawInputHandler>& inputHandler, UINT32 rate);
+		~InputSampler();
+
+		/** Returns the number of times per second the input handler is polled. */
+		UINT32 getRate() const { return mRate; }
+
+		/**
+		 * Removes the oldest sampled event from the queue and outputs it in @p event. Returns false if there are no more
+		 * events. Must only be called from a single thread.
+		 */
+		bool pop(SampledInputEvent& event);
+
+		/** Returns the look input totals as of the most recent sample. Thread safe. */
+		LookInput getLookInput() const;
+
+		/** Notifies the input handler that the window with input focus changed. Thread safe. */
+		void inputWindowChanged(RenderWindow& win);
+
+	private:
+		/** Worker method of the sampling thread. */
+		void run();
+
+		/** Polls the input handler once and publishes the results. */
+		void sample();
+
+		/** Pushes the event to the queue, or to the overflow buffer if the queue is full. */
+		void queueEvent(const SampledInputEvent& event);
+
+		/**	Triggered by input handler when a button is pressed. */
+		void buttonDown(UINT32 deviceIdx, ButtonCode code, UINT64 timestamp);
+
+		/**	Triggered by input handler when a button is released. */
+		void buttonUp(UINT32 deviceIdx, ButtonCode code, UINT64 timestamp);
+
+		/**	Triggered by input handler when a mouse/joystick axis is moved. */
+		void axisMoved(UINT32 deviceIdx, const RawAxisState& state, UINT32 axis);
+
+		static const UINT32 QUEUE_SIZE = 4096;
+
+		SPtr<RawInputHandler> mInputHandler;
+		UINT32 mRate;
+
+		HThread mThread;
+		std::atomic<bool> mShutdown;
+		Mutex mInputHandlerMutex;
+
+		TLockFreeQueue<SampledInputEvent, QUEUE_SIZE> mQueue;
+		Vector<SampledInputEvent> mOverflow; // Events that didn't fit in the queue, only accessed by the sampling thread
+
+		UINT64 mSampleTime;
+		LookInput mLook;
+		LookInput mLastQueuedLook;
+		Vector2 mRightStick;
+
+		mutable SpinLock mPublishedLookLock;
+		LookInput mPublishedLook;
+
+		HEvent mButtonDownConn;
+		HEvent mButtonUpConn;
+		HEvent mAxisMovedConn;
+	};
+
+	/** @} */
+}
@@ -119,12 +119,21 @@ namespace bs
 		 */
 		void readCachedData(MeshData& data);
 
+		/** 
+		 * Returns a counter that is incremented whenever the cached system memory mesh buffer changes. Can be used for
+		 * detecting when data derived from readCachedData() needs to be rebuilt.
+		 */
+		UINT32 getCachedDataVersion() const { return mCachedDataVersion; }
+
 		/** Gets the skeleton required for animation of this mesh, if any is available. */
 		SPtr<Skeleton> getSkeleton() const { return mSkeleton; }
 
 		/** Returns an object containing all shapes used for morph animation, if any are available. */
 		SPtr<MorphShapes> getMorphShapes() const { return mMorphShapes; }
 
+		/** Returns the usage flags the mesh was created with, as a combination of MeshUsage flags. */
+		int getUsage() const { return mUsage; }
+
 		/** Retrieves a core implementation of a mesh usable only from the core thread. */
 		SPtr<ct::Mesh> getCore() const;
 
@@ -154,6 +163,7 @@ namespace bs
 		void updateCPUBuffer(UINT32 subresourceIdx, const MeshData& data);
 
 		mutable SPtr<MeshData> mCPUData;
+		UINT32 mCachedDataVersion = 0;
 
 		SPtr<VertexDataDesc> mVertexDesc;
 		int mUsage;
@@ -55,9 +55,12 @@ namespace bs
 		static SPtr<MorphShape> create(const String& name, float weight, const Vector<MorphVertex>& vertices);
 
 	private:
+		/** Sorts the vertices by the index of the base mesh vertex they modify. */
+		void sortVertices();
+
 		String mName;
 		float mWeight;
-		Vector<MorphVertex> mVertices;
+		Vector<MorphVertex> mVertices; // Sorted by source index, so blending walks the output buffer in order
 
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
@@ -27,6 +27,13 @@ namespace bs
 			:mInitMembers(this)
 		{ }
 
+		void onDeserializationEnded(IReflectable* obj, const UnorderedMap<String, UINT64>& params) override
+		{
+			// Resources saved before vertices were kept sorted
+			MorphShape* shape = static_cast<MorphShape*>(obj);
+			shape->sortVertices();
+		}
+
 		const String& getRTTIName() override
 		{
 			static String name = "MorphShape";
@@ -12,6 +12,18 @@ namespace bs
 	 *  @{
 	 */
 
+	/** Contains profiler statistics about operations on a single type of GPU object, within a GPU profiling sample. */
+	struct GPUProfileResourceSample
+	{
+		String name; /**< Name of the object type. */
+
+		UINT32 numCreated; /**< How many objects of this type were created. */
+		UINT32 numDestroyed; /**< How many objects of this type were destroyed. */
+		UINT32 numReads; /**< How many times were objects of this type read from. */
+		UINT32 numWrites; /**< How many times were objects of this type written to. */
+		UINT64 numBytesWritten; /**< Number of bytes uploaded to objects of this type. */
+	};
+
 	/** Contains various profiler statistics about a single GPU profiling sample. */
 	struct GPUProfileSample
 	{
@@ -19,13 +31,14 @@ namespace bs
 		float timeMs; /**< Time in milliseconds it took to execute the sampled block. */
 
 		UINT32 numDrawCalls; /**< Number of draw calls that happened. */
+		UINT32 numComputeCalls; /**< Number of compute dispatches that happened. */
 		UINT32 numRenderTargetChanges; /**< How many times was render target changed. */
 		UINT32 numPresents; /**< How many times did a buffer swap happen on a double buffered render target. */
 		UINT32 numClears; /**< How many times was render target cleared. */
 
 		UINT32 numVertices; /**< Total number of vertices sent to the GPU. */
 		UINT32 numPrimitives; /**< Total number of primitives sent to the GPU. */
-		UINT32 numDrawnSamples; /**< Number of samples drawn by the GPU. */
+		UINT32 numDrawnSamples; /**< Number of samples drawn by the GPU. Only recorded for the frame sample. */
 
 		UINT32 numPipelineStateChanges; /**< How many times did the pipeline state change. */
 
@@ -33,11 +46,32 @@ namespace bs
 		UINT32 numVertexBufferBinds; /**< How many times was a vertex buffer bound. */
 		UINT32 numIndexBufferBinds; /**< How many times was an index buffer bound. */
 
+		UINT32 numStateCalls; /**< How many low level state calls were issued to the driver. */
+		UINT32 numFilteredStateCalls; /**< How many low level state calls were skipped as redundant. */
+
 		UINT32 numResourceWrites; /**< How many times were GPU resources written to. */
 		UINT32 numResourceReads; /**< How many times were GPU resources read from. */
+		UINT64 numBytesWritten; /**< Number of bytes uploaded to GPU resources. */
 
 		UINT32 numObjectsCreated; /**< How many GPU objects were created. */
 		UINT32 numObjectsDestroyed; /**< How many GPU objects were destroyed. */
+
+		/** Statistics for each type of GPU object that was operated on during the sample. */
+		Vector<GPUProfileResourceSample> resources;
+	};
+
+	/** 
+	 * Limits on GPU profiler statistics for a single frame or sample. A warning is logged whenever a limit is exceeded.
+	 * Zero means no limit.
+	 */
+	struct GPUProfileBudget
+	{
+		float timeMs = 0.0f; /**< Maximum time the GPU may spend executing the sample, in milliseconds. */
+		UINT32 numDrawCalls = 0; /**< Maximum number of draw calls. */
+		UINT32 numPrimitives = 0; /**< Maximum number of primitives sent to the GPU. */
+		UINT32 numPipelineStateChanges = 0; /**< Maximum number of pipeline state changes. */
+		UINT32 numGpuParamBinds = 0; /**< Maximum number of times GPU parameters were bound. */
+		UINT64 numBytesWritten = 0; /**< Maximum number of bytes uploaded to GPU resources. */
 	};
 
 	/** Profiler report containing information about GPU sampling data from a single frame. */
@@ -87,7 +121,9 @@ namespace bs
 		void endFrame();
 
 		/**
-		 * Begins sample measurement. Must be followed by endSample().
+		 * Begins sample measurement. Must be followed by endSample(). Samples can be nested within each other. They only
+		 * measure time and render statistics (not the number of drawn samples), and are only recorded while sample
+		 * recording is enabled through setSamplesEnabled(), or a budget is set for a sample other than the frame.
 		 *
 		 * @param[in]	name	Unique name for the sample you can later use to find the sampling data.
 		 *
@@ -125,6 +161,33 @@ namespace bs
 		 */
 		GPUProfilerReport getNextReport();
 
+		/**
+		 * Sets per-frame limits for a GPU profiling sample. If the sample appears multiple times in a frame, the limits
+		 * apply to the sum of all the occurrences. A warning is logged the first time a limit is exceeded, and again
+		 * only after the sample has been within its limits for at least one frame.
+		 *
+		 * @param[in]	name	Name of the sample to limit, or "Frame" to limit the entire frame.
+		 * @param[in]	budget	Limits to apply.
+		 *
+		 * @note	Thread safe.
+		 */
+		void setBudget(const String& name, const GPUProfileBudget& budget);
+
+		/** 
+		 * Removes limits set by setBudget().
+		 *
+		 * @note	Thread safe.
+		 */
+		void clearBudget(const String& name);
+
+		/**
+		 * Enables or disables recording of samples started with beginSample(). When disabled, reports only contain the
+		 * frame sample. Takes effect starting with the next frame. Disabled by default.
+		 *
+		 * @note	Thread safe.
+		 */
+		void setSamplesEnabled(bool enabled) { mSamplesEnabled.store(enabled, std::memory_order_relaxed); }
+
 	public: // ***** INTERNAL ******
 		/** @name Internal
 		 *  @{
@@ -138,8 +201,11 @@ namespace bs
 		/** @} */
 
 	private:
-		/** Assigns start values for the provided sample. */
-		void beginSampleInternal(ActiveSample& sample);
+		/** 
+		 * Assigns start values for the provided sample. Occlusion queries cannot be nested, so only the frame sample
+		 * should count the drawn samples.
+		 */
+		void beginSampleInternal(ActiveSample& sample, bool countDrawnSamples);
 
 		/**	Assigns end values for the provided sample. */
 		void endSampleInternal(ActiveSample& sample);
@@ -159,9 +225,23 @@ namespace bs
 		/** Resolves an active sample and converts it to report sample. */
 		void resolveSample(const ActiveSample& sample, GPUProfileSample& reportSample);
 
+		/** Checks the frame report against all the set budgets, and logs a warning for any exceeded ones. */
+		void checkBudgets(const GPUProfilerReport& report);
+
 	private:
+		/** Limits set for a single sample. */
+		struct BudgetData
+		{
+			GPUProfileBudget budget;
+			bool exceeded = false;
+		};
+
+		/** Index pushed to the active sample stack for samples that aren't being recorded. */
+		static const UINT32 SKIPPED_SAMPLE = (UINT32)-1;
+
 		ActiveFrame mActiveFrame;
 		bool mIsFrameActive;
+		bool mRecordSamples;
 		Stack<UINT32> mActiveSampleIndexes;
 
 		Queue<ActiveFrame> mUnresolvedFrames;
@@ -170,7 +250,12 @@ namespace bs
 		mutable Stack<SPtr<ct::TimerQuery>> mFreeTimerQueries;
 		mutable Stack<SPtr<ct::OcclusionQuery>> mFreeOcclusionQueries;
 
+		UnorderedMap<String, BudgetData> mBudgets;
+		UINT32 mNumSampleBudgets;
+		std::atomic<bool> mSamplesEnabled;
+
 		Mutex mMutex;
+		Mutex mBudgetMutex;
 	};
 
 	/** Provides global access to ProfilerGPU instance. */
@@ -191,7 +191,14 @@ namespace bs
 		 */
 		MultiThreadedCB			= 1 << 4,
 		/** If set, the render API supports unordered stores to a texture with more than one sample. */
-		MSAAImageStores			= 1 << 5
+		MSAAImageStores			= 1 << 5,
+		/**
+		 * If set, secondary command buffers can be populated from worker threads and appended to a primary command buffer
+		 * (including the main one) using RenderAPI::addCommands(), in the order they need to execute. The render target
+		 * of a secondary command buffer must be set on the core thread before recording starts, and must match the
+		 * render target bound on the primary command buffer when its commands are added.
+		 */
+		ParallelCBRecording		= 1 << 6
 	};
 
 	typedef Flags<RenderAPIFeatureFlag> RenderAPIFeatures;
@@ -20,7 +20,21 @@ namespace bs
 		RenderStatObject_GpuParamBuffer,
 		RenderStatObject_Texture,
 		RenderStatObject_GpuProgram,
-		RenderStatObject_Query
+		RenderStatObject_Query,
+		RenderStatObject_Count,
+
+		/** Render API specific object types start at this index. */
+		RenderStatObject_APISpecific = 100
+	};
+
+	/** Statistics about operations on a single type of GPU object. */
+	struct BS_CORE_EXPORT RenderStatsResourceData
+	{
+		UINT64 numCreated = 0;
+		UINT64 numDestroyed = 0;
+		UINT64 numReads = 0;
+		UINT64 numWrites = 0;
+		UINT64 numBytesWritten = 0;
 	};
 
 	/** Object that stores various render statistics. */
@@ -29,9 +43,13 @@ namespace bs
 		RenderStatsData()
 		: numDrawCalls(0), numComputeCalls(0), numRenderTargetChanges(0), numPresents(0), numClears(0)
 		, numVertices(0), numPrimitives(0), numPipelineStateChanges(0), numGpuParamBinds(0), numVertexBufferBinds(0)
-		, numIndexBufferBinds(0)
+		, numIndexBufferBinds(0), numResourceWrites(0), numResourceReads(0), numBytesWritten(0), numObjectsCreated(0)
+		, numObjectsDestroyed(0), numStateCalls(0), numFilteredStateCalls(0)
 		{ }
 
+		/** Maximum number of object types tracked separately. Includes common and render API specific types. */
+		static const UINT32 MAX_RESOURCE_TYPES = 24;
+
 		UINT64 numDrawCalls;
 		UINT64 numComputeCalls;
 		UINT64 numRenderTargetChanges;
@@ -49,9 +67,16 @@ namespace bs
 
 		UINT64 numResourceWrites;
 		UINT64 numResourceReads;
+		UINT64 numBytesWritten;
 
 		UINT64 numObjectsCreated; 
 		UINT64 numObjectsDestroyed;
+
+		UINT64 numStateCalls;
+		UINT64 numFilteredStateCalls;
+
+		/** Per-type statistics. Use RenderStats::getResourceTypeIdx() to find the entry for a type. */
+		RenderStatsResourceData resources[MAX_RESOURCE_TYPES];
 	};
 
 	/**
@@ -62,6 +87,8 @@ namespace bs
 	class BS_CORE_EXPORT RenderStats : public Module<RenderStats>
 	{
 	public:
+		RenderStats();
+
 		/** Increments draw call counter indicating how many times were render system API Draw methods called. */
 		void incNumDrawCalls() { mData.numDrawCalls++; }
 
@@ -98,6 +125,15 @@ namespace bs
 		/** Increments index buffer change counter indicating how many times was a index buffer bound to the pipeline. */
 		void incNumIndexBufferBinds() { mData.numIndexBufferBinds++; }
 
+		/** Increments the counter of low level render API state calls that were issued to the driver. */
+		void addNumStateCalls(UINT32 count) { mData.numStateCalls += count; }
+
+		/**
+		 * Increments the counter of low level render API state calls that were skipped because they wouldn't change the
+		 * current state.
+		 */
+		void addNumFilteredStateCalls(UINT32 count) { mData.numFilteredStateCalls += count; }
+
 		/**
 		 * Increments created GPU resource counter. 
 		 *
@@ -105,15 +141,11 @@ namespace bs
 		 */
 		void incResCreated(UINT32 category) 
 		{
-			// TODO - I'm ignoring resourceType for now. Later I will want to
-			// count object creation/destruction/read/write per type. I will
-			// also want to allow the caller to assign names to specific "resourceType" id.
-			// (Since many types will be RenderAPI specific).
-
 			// TODO - I should also track number of active GPU objects using this method, instead
 			// of just keeping track of how many were created and destroyed during the frame.
 
 			mData.numObjectsCreated++;
+			mData.resources[getResourceTypeIdx(category)].numCreated++;
 		}
 
 		/**
@@ -121,21 +153,79 @@ namespace bs
 		 *
 		 * @param[in]	category	Category of the resource.
 		 */
-		void incResDestroyed(UINT32 category) { mData.numObjectsDestroyed++; }
+		void incResDestroyed(UINT32 category) 
+		{ 
+			mData.numObjectsDestroyed++;
+			mData.resources[getResourceTypeIdx(category)].numDestroyed++;
+		}
 
 		/**
 		 * Increments GPU resource read counter. 
 		 *
 		 * @param[in]	category	Category of the resource.
 		 */
-		void incResRead(UINT32 category) { mData.numResourceReads++; }
+		void incResRead(UINT32 category) 
+		{ 
+			mData.numResourceReads++;
+			mData.resources[getResourceTypeIdx(category)].numReads++;
+		}
 
 		/**
 		 * Increments GPU resource write counter. 
 		 *
 		 * @param[in]	category	Category of the resource.
 		 */
-		void incResWrite(UINT32 category) { mData.numResourceWrites++; }
+		void incResWrite(UINT32 category) 
+		{ 
+			mData.numResourceWrites++;
+			mData.resources[getResourceTypeIdx(category)].numWrites++;
+		}
+
+		/**
+		 * Increments GPU resource write counter, and the number of bytes uploaded to the GPU.
+		 *
+		 * @param[in]	category	Category of the resource.
+		 * @param[in]	numBytes	Number of bytes written.
+		 */
+		void addResWrite(UINT32 category, UINT64 numBytes)
+		{
+			RenderStatsResourceData& resourceData = mData.resources[getResourceTypeIdx(category)];
+			resourceData.numWrites++;
+			resourceData.numBytesWritten += numBytes;
+
+			mData.numResourceWrites++;
+			mData.numBytesWritten += numBytes;
+		}
+
+		/**
+		 * Assigns a readable name to a resource category, used when displaying per-type statistics. Common categories 
+		 * from RenderStatResourceType are named by default, render API specific ones need to be registered by the render
+		 * API.
+		 */
+		void setResourceTypeName(UINT32 category, const String& name);
+
+		/** 
+		 * Returns the name of the resource type at the provided index in the RenderStatsData::resources array. Returns an
+		 * empty string if no resource category maps to the index.
+		 *
+		 * @note	Thread safe, as long as all names are assigned before the stats are being read.
+		 */
+		const String& getResourceTypeName(UINT32 idx) const { return mResourceTypeNames[idx]; }
+
+		/** 
+		 * Maps a resource category to an index into the RenderStatsData::resources array. Categories that don't fit are
+		 * grouped into the last entry.
+		 */
+		static UINT32 getResourceTypeIdx(UINT32 category)
+		{
+			UINT32 idx = RenderStatsData::MAX_RESOURCE_TYPES - 1;
+			if (category < RenderStatObject_Count)
+				idx = category;
+			else if (category >= RenderStatObject_APISpecific)
+				idx = RenderStatObject_Count + (category - RenderStatObject_APISpecific);
+
+			return std::min(idx, RenderStatsData::MAX_RESOURCE_TYPES - 1);
+		}
 
 		/**
 		 * Returns an object containing various rendering statistics.
@@ -147,16 +237,19 @@ namespace bs
 
 	private:
 		RenderStatsData mData;
+		String mResourceTypeNames[RenderStatsData::MAX_RESOURCE_TYPES];
 	};
 
 #if BS_PROFILING_ENABLED
 	#define BS_INC_RENDER_STAT_CAT(Stat, Category) RenderStats::instance().inc##Stat((UINT32)Category)
 	#define BS_INC_RENDER_STAT(Stat) RenderStats::instance().inc##Stat()
 	#define BS_ADD_RENDER_STAT(Stat, Count) RenderStats::instance().add##Stat(Count)
+	#define BS_ADD_RENDER_STAT_CAT(Stat, Category, Count) RenderStats::instance().add##Stat((UINT32)Category, Count)
 #else
 	#define BS_INC_RENDER_STAT_CAT(Stat, Category)
 	#define BS_INC_RENDER_STAT(Stat)
 	#define BS_ADD_RENDER_STAT(Stat, Count)
+	#define BS_ADD_RENDER_STAT_CAT(Stat, Category, Count)
 #endif
 
 	/** @} */
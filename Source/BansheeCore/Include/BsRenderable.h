@@ -295,9 +295,18 @@ namespace bs
 		 */
 		void updateAnimationBuffers(const RendererAnimationData& animData);
 
-		/** Returns the GPU buffer containing element's bone matrices, if it has any. */
+		/** 
+		 * Returns the GPU buffer containing element's bone matrices, if it has any. The buffer is shared between all
+		 * skinned renderables, use getBoneMatrixOffset() to find the element's bones.
+		 */
 		const SPtr<GpuBuffer>& getBoneMatrixBuffer() const { return mBoneMatrixBuffer; }
 
+		/** 
+		 * Returns the index of the element's first bone in the buffer returned by getBoneMatrixBuffer(). Valid after the
+		 * last call to updateAnimationBuffers().
+		 */
+		UINT32 getBoneMatrixOffset() const { return mBoneMatrixOffset; }
+
 		/** Returns the vertex buffer containing element's morph shape vertices, if it has any. */
 		const SPtr<VertexBuffer>& getMorphShapeBuffer() const { return mMorphShapeBuffer; }
 
@@ -321,6 +330,8 @@ namespace bs
 		UINT32 mRendererId;
 		UINT64 mAnimationId;
 		UINT32 mMorphShapeVersion;
+		UINT32 mBoneMatrixOffset;
+		UINT64 mPaletteAnimationId;
 
 		SPtr<GpuBuffer> mBoneMatrixBuffer;
 		SPtr<VertexBuffer> mMorphShapeBuffer;
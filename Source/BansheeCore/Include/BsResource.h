@@ -28,6 +28,12 @@ namespace bs
 		/**	Retrieves meta-data containing various information describing a resource. */
 		SPtr<ResourceMetaData> getMetaData() const { return mMetaData; }
 
+		/** 
+		 * Returns the size of the resource data, in bytes. For resources loaded from disk this is at least the size of
+		 * their serialized data, and can be used as an estimate of the memory used by the resource.
+		 */
+		UINT32 getSize() const { return mSize; }
+
 		/**	Returns whether or not this resource is allowed to be asynchronously loaded. */
 		virtual bool allowAsyncLoading() const { return true; }
 
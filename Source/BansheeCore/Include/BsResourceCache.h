@@ -0,0 +1,182 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsModule.h"
+
+namespace bs
+{
+	/** @addtogroup Resources-Internal
+	 *  @{
+	 */
+
+	/** Statistics about resources tracked by the resource cache. */
+	struct ResourceCacheStats
+	{
+		/** Number of load requests that were satisfied by an already loaded resource. */
+		UINT64 numHits = 0;
+
+		/** Number of load requests that required the resource to be read from disk. */
+		UINT64 numMisses = 0;
+
+		/** Number of resources unloaded by the cache in order to stay within the budget. */
+		UINT64 numEvictions = 0;
+
+		/** Total size of all resources unloaded by the cache, in bytes. */
+		UINT64 bytesEvicted = 0;
+
+		/** Number of loaded resources tracked by the cache. */
+		UINT32 numResident = 0;
+
+		/** Size of all loaded resources tracked by the cache, in bytes. */
+		UINT64 residentBytes = 0;
+
+		/** Number of loaded resources that aren't referenced outside of the resources system. */
+		UINT32 numUnused = 0;
+
+		/** Size of all loaded resources that aren't referenced outside of the resources system, in bytes. */
+		UINT64 unusedBytes = 0;
+	};
+
+	/**
+	 * Keeps track of memory used by resources loaded from disk and unloads resources that are no longer referenced
+	 * outside of the resources system if their memory use exceeds the set budget. Budgets can be set per resource type,
+	 * as well as for all resources together. Least recently used resources are unloaded first.
+	 *
+	 * Resources are checked for outside references incrementally, a limited number each frame, and a limited number of
+	 * resources are unloaded each frame, so it can take multiple frames for the cache to get back within the budget.
+	 *
+	 * @note
+	 * Only resources loaded with an internal reference (the default) can be unloaded by the cache. Size of a resource is
+	 * as reported by Resource::getSize().
+	 * @note
+	 * Sim thread only.
+	 */
+	class BS_CORE_EXPORT ResourceCache : public Module<ResourceCache>
+	{
+		/** Information about a single loaded resource. */
+		struct ResourceInfo
+		{
+			WeakResourceHandle<Resource> resource;
+			UINT32 typeId = 0;
+			UINT32 size = 0;
+			UINT64 lastUsedFrame = 0;
+			UINT32 scanIdx = 0;
+
+			bool isUnused = false;
+			List<String>::iterator lruIter;
+		};
+
+		/** Information about all loaded resources of a specific type. */
+		struct TypeInfo
+		{
+			UINT64 budget = 0;
+			List<String> unusedLRU; /**< Unused resources, from least to most recently used. */
+			ResourceCacheStats stats;
+		};
+
+		/** Resource chosen to be unloaded. */
+		struct EvictionCandidate
+		{
+			String uuid;
+			UINT32 typeId;
+			UINT32 size;
+		};
+
+	public:
+		ResourceCache();
+		~ResourceCache();
+
+		/**
+		 * Sets the maximum amount of memory (in bytes) that loaded resources of the specified type may use, before the
+		 * cache starts unloading unused ones. Zero means no limit (the default).
+		 *
+		 * @param[in]	typeId	RTTI type ID of the resource type (e.g. TID_Texture).
+		 * @param[in]	budget	Budget in bytes.
+		 */
+		void setBudget(UINT32 typeId, UINT64 budget);
+
+		/** @copydoc setBudget */
+		UINT64 getBudget(UINT32 typeId) const;
+
+		/**
+		 * Sets the maximum amount of memory (in bytes) that all loaded resources may use together, before the cache starts
+		 * unloading unused ones. Zero means no limit (the default).
+		 */
+		void setTotalBudget(UINT64 budget);
+
+		/** @copydoc setTotalBudget */
+		UINT64 getTotalBudget() const;
+
+		/** Sets the maximum number of resources that can be unloaded in a single frame. */
+		void setMaxEvictionsPerFrame(UINT32 count);
+
+		/** @copydoc setMaxEvictionsPerFrame */
+		UINT32 getMaxEvictionsPerFrame() const;
+
+		/**
+		 * Sets the number of resources that are checked for outside references each frame. Higher values allow unused
+		 * resources to be detected sooner, at a higher per-frame cost.
+		 */
+		void setScanRate(UINT32 count);
+
+		/** @copydoc setScanRate */
+		UINT32 getScanRate() const;
+
+		/** Returns statistics for all resources tracked by the cache. */
+		ResourceCacheStats getStats() const;
+
+		/** Returns statistics for resources of the specified type. */
+		ResourceCacheStats getStats(UINT32 typeId) const;
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/**
+		 * Registers newly loaded resources, checks a portion of loaded resources for outside references and unloads
+		 * unused resources if over the budget. Should be called once per frame.
+		 */
+		void _update();
+
+		/** @} */
+	private:
+		/** Triggered by the resources system when a resource finishes loading. */
+		void onResourceLoaded(const HResource& resource);
+
+		/** Triggered by the resources system when a load is requested for an already loaded resource. */
+		void onResourceRequested(const HResource& resource);
+
+		/** Triggered by the resources system when a resource is destroyed. */
+		void onResourceDestroyed(const String& uuid);
+
+		/** Adds the resource to the list of unused resources of its type, as the most recently used entry. */
+		void markUnused(const String& uuid, ResourceInfo& info);
+
+		/** Removes the resource from the list of unused resources of its type. */
+		void markUsed(ResourceInfo& info);
+
+		/** Picks resources to unload in order to get within the budgets, up to the maximum allowed per frame. */
+		void findEvictionCandidates(Vector<EvictionCandidate>& candidates);
+
+		UINT64 mTotalBudget = 0;
+		UINT32 mMaxEvictionsPerFrame = 8;
+		UINT32 mScanRate = 256;
+
+		UnorderedMap<String, ResourceInfo> mResources;
+		UnorderedMap<UINT32, TypeInfo> mTypes;
+		Vector<String> mScanOrder;
+		UINT32 mNextScanIdx = 0;
+
+		Vector<WeakResourceHandle<Resource>> mNewResources;
+		Vector<String> mRequestedResources;
+		mutable Mutex mMutex;
+
+		HEvent mResourceLoadedConn;
+		HEvent mResourceRequestedConn;
+		HEvent mResourceDestroyedConn;
+	};
+
+	/** @} */
+}
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "BsIReflectable.h"
+#include <atomic>
 
 namespace bs
 {
@@ -19,8 +20,11 @@ namespace bs
 
 		SPtr<Resource> mPtr;
 		String mUUID;
-		bool mIsCreated;	
+		std::atomic<bool> mIsCreated;
 		UINT32 mRefCount;
+
+		/** Callbacks to trigger once the resource is created. Protected by the signal the handle data maps to. */
+		Vector<std::function<void()>> mLoadedCallbacks;
 	};
 
 	/**
@@ -50,6 +54,18 @@ namespace bs
 		 */
 		void blockUntilLoaded(bool waitForDependencies = true) const;
 
+		/**
+		 * Registers a callback that will be triggered once the resource is loaded, without blocking the current thread.
+		 * If the resource is already loaded the callback is triggered immediately, on the calling thread. Otherwise it is
+		 * triggered on the thread that finishes loading the resource, which may be a worker thread. Only the resource 
+		 * itself is guaranteed to be loaded when the callback triggers, its dependencies might still be loading.
+		 *
+		 * @note	
+		 * The callback is never triggered if the resource fails to load. Be careful when capturing a handle to the same
+		 * resource within the callback, as it will keep the resource referenced until the callback triggers.
+		 */
+		void notifyWhenLoaded(const std::function<void()>& callback) const;
+
 		/**
 		 * Releases an internal reference to this resource held by the resources system, if there is one.
 		 * 			
@@ -102,9 +118,6 @@ namespace bs
 	private:
 		friend class Resources;
 
-		static Signal mResourceCreatedCondition;
-		static Mutex mResourceCreatedMutex;
-
 	protected:
 		void throwIfNotLoaded() const;
 	};
@@ -162,6 +162,23 @@ namespace bs
 		 */
 		void unloadAllUnused();
 
+		/**
+		 * Checks if the resource with the specified UUID is loaded, but isn't referenced outside of the resources system.
+		 * Such resources are kept loaded only due to internal references and will be unloaded by unloadAllUnused().
+		 */
+		bool isUnused(const String& uuid);
+
+		/**
+		 * Unloads the resource with the specified UUID, if it isn't referenced outside of the resources system. All
+		 * internal references to the resource are released.
+		 *
+		 * @param[in]	uuid	UUID of the resource to unload.
+		 * @return				True if the resource was unloaded, false if it isn't loaded or is still in use.
+		 *
+		 * @see		unloadAllUnused()
+		 */
+		bool unloadIfUnused(const String& uuid);
+
 		/**
 		 * Saves the resource at the specified location.
 		 *
@@ -268,6 +285,14 @@ namespace bs
 		 */
 		Event<void(const String&)> onResourceDestroyed;
 
+		/**
+		 * Called when a load is requested for a resource that is already loaded, or is currently being loaded, and the
+		 * existing resource is returned instead of reading it from disk.
+		 *
+		 * @note	It is undefined from which thread this will get called from.
+		 */
+		Event<void(const HResource&)> onLoadedResourceRequested;
+
 		/**
 		 * Called when the internal resource the handle is pointing to has changed.
 		 *
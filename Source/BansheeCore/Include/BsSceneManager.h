@@ -8,6 +8,8 @@
 
 namespace bs
 {
+	enum class SceneObjectChange;
+
 	/** @addtogroup Scene-Internal
 	 *  @{
 	 */
@@ -112,6 +114,13 @@ namespace bs
 		 */
 		void setMainRenderTarget(const SPtr<RenderTarget>& rt);
 
+		/**
+		 * Triggered whenever a scene object in the scene changes in a way that affects how the scene hierarchy is
+		 * presented. Allows systems mirroring the hierarchy to update only the parts that changed, instead of comparing
+		 * the entire scene.
+		 */
+		Event<void(const HSceneObject&, SceneObjectChange)> onHierarchyChanged;
+
 		/**	Returns all renderables in the scene. */
 		const Map<Renderable*, SceneRenderableData>& getAllRenderables() const { return mRenderables; }
 
@@ -29,6 +29,15 @@ namespace bs
 										 user created ones. */
 	};
 
+	/** Types of scene object changes reported by SceneManager::onHierarchyChanged. */
+	enum class SceneObjectChange
+	{
+		Children, /**< A child was added to or removed from the scene object. */
+		Name, /**< Scene object was renamed. */
+		Active, /**< Active state of the scene object and its children changed. */
+		PrefabLink /**< Prefab link of the scene object and its children changed. */
+	};
+
 	/**
 	 * An object in the scene graph. It has a world position, place in the hierarchy and optionally a number of attached 
 	 * components.
@@ -91,6 +100,9 @@ namespace bs
 		/**	Checks if the scene object has a specific bit flag set. */
 		bool hasFlag(UINT32 flag) const;
 
+		/** @copydoc GameObject::setName */
+		void setName(const String& name) override;
+
 	public: // ***** INTERNAL ******
 		/** @name Internal
 		 *  @{
@@ -123,7 +135,7 @@ namespace bs
 		 * Allows you to change the prefab link UUID of this object. Normally this should be accompanied by reassigning the
 		 * link IDs.
 		 */
-		void _setPrefabLinkUUID(const String& UUID) { mPrefabLinkUUID = UUID; }
+		void _setPrefabLinkUUID(const String& UUID);
 
 		/**
 		 * Returns a prefab diff object containing instance specific modifications of this object compared to its prefab
@@ -509,6 +521,9 @@ namespace bs
 		/** Changes the object active in hierarchy state, and triggers necessary events. */
 		void setActiveHierarchy(bool active, bool triggerEvents = true);
 
+		/** Notifies SceneManager listeners that this object changed, if the object is part of the scene. */
+		void notifyHierarchyChanged(SceneObjectChange change);
+
 		/************************************************************************/
 		/* 								Component	                     		*/
 		/************************************************************************/
@@ -30,7 +30,7 @@ namespace bs
 		/** All mesh data will also be cached in CPU memory, making it available for fast read access from the CPU. */
 		TU_CPUCACHED		BS_SCRIPT_EXPORT(n:CPUCached)		= 0x1000,
 		/** Allows the CPU to directly read the texture data buffers from the GPU. */
-		TU_CPUREADABLE		BS_SCRIPT_EXPORT(n:CPUReadable)		= 0x2000,
+		TU_CPUREADABLE		BS_SCRIPT_EXPORT(n:CPUReadable)		= GBU_CPUREADABLE,
 		/** Default (most common) texture usage. */
 		TU_DEFAULT			BS_SCRIPT_EXPORT(ex:true)			= TU_STATIC
     };
@@ -167,6 +167,8 @@ namespace bs
     class BS_CORE_EXPORT BS_SCRIPT_EXPORT() Texture : public Resource
     {
     public:
+		virtual ~Texture();
+
 		/**
 		 * Updates the texture with new data. Provided data buffer will be locked until the operation completes.
 		 *
@@ -261,6 +263,41 @@ namespace bs
 		static SPtr<Texture> _createPtr(const SPtr<PixelData>& pixelData, int usage = TU_DEFAULT, 
 			bool hwGammaCorrection = false);
 
+		/** 
+		 * Checks can the mip levels of this texture be streamed in and out on demand. Only true for textures whose data
+		 * was loaded from a file.
+		 */
+		bool _isStreamable() const { return mStreamData != nullptr; }
+
+		/** 
+		 * Returns the index of the most detailed mip level that is currently present on the GPU. Always 0 for textures
+		 * that aren't streamable.
+		 */
+		UINT32 _getFirstResidentMip() const { return mFirstResidentMip; }
+
+		/**
+		 * Changes which mip levels of a streamable texture are present on the GPU. Changing the resident mip levels 
+		 * creates a new core thread texture object (retrievable through getCore()) sized to only hold the resident mip
+		 * levels, while existing mip levels are copied over from the old object on the core thread.
+		 *
+		 * Evicting mip levels is applied immediately. Newly required mip levels are read from the source file on a worker
+		 * thread instead, and the change is applied by a later call to _updateResidentMips() once the read completes. 
+		 * Requests for more detailed mip levels are ignored while a read is in progress.
+		 *
+		 * @param[in]	firstMip	Index of the most detailed mip level to keep resident. All less detailed mip levels will
+		 *							also be resident.
+		 */
+		void _setFirstResidentMip(UINT32 firstMip);
+
+		/** Checks is there a read of mip levels, requested through _setFirstResidentMip(), in progress. */
+		bool _isReadingMips() const { return mStreamTask != nullptr; }
+
+		/**
+		 * Applies the change requested by _setFirstResidentMip() if its mip levels finished reading. Returns true if the
+		 * resident mip levels (and therefore the core thread object) changed.
+		 */
+		bool _updateResidentMips();
+
 		/** @} */
 
     protected:
@@ -275,9 +312,33 @@ namespace bs
 		/** @copydoc CoreObject::createCore */
 		SPtr<ct::CoreObject> createCore() const override;
 
+		/** @copydoc Resource::isCompressible */
+		bool isCompressible() const override;
+
 		/** Calculates the size of the texture, in bytes. */
 		UINT32 calculateSize() const;
 
+		/** Returns a descriptor for the core thread texture object that holds only mip levels starting at @p firstMip. */
+		TEXTURE_DESC getResidentDesc(UINT32 firstMip) const;
+
+		/** 
+		 * Reads the data for the specified face and mip level from the provided stream. The stream must be the source
+		 * stream the texture was deserialized from (or a clone of it).
+		 */
+		SPtr<PixelData> readStreamedMip(const SPtr<DataStream>& stream, UINT32 face, UINT32 mipLevel) const;
+
+		/** 
+		 * Returns the data for the specified face and mip level of a streamable texture, using data provided through 
+		 * writeData() if available, or reading it from the provided source stream otherwise.
+		 */
+		SPtr<PixelData> getStreamedMip(const SPtr<DataStream>& stream, UINT32 face, UINT32 mipLevel) const;
+
+		/** 
+		 * Replaces the core thread object with one holding only mip levels starting at @p firstMip. @p newMipData must
+		 * contain data for all faces of mip levels that weren't previously resident, unless provided through writeData().
+		 */
+		void applyResidentMips(UINT32 firstMip, const Vector<SPtr<PixelData>>& newMipData);
+
 		/**
 		 * Creates buffers used for caching of CPU texture data.
 		 *
@@ -293,6 +354,18 @@ namespace bs
 		TextureProperties mProperties;
 		mutable SPtr<PixelData> mInitData;
 
+		UINT32 mFirstResidentMip;
+		SPtr<DataStream> mStreamData;
+		UINT32 mStreamOffset;
+		PixelFormat mStreamFormat;
+		Vector<UINT32> mMipOffsets;
+		UnorderedMap<UINT32, SPtr<PixelData>> mWrittenMipData; /**< Subresources of streamable textures set by writeData(). */
+
+		SPtr<Task> mStreamTask;
+		SPtr<Vector<SPtr<PixelData>>> mStreamTaskData;
+		UINT32 mStreamTaskFirstMip;
+		UINT32 mStreamTaskEndMip;
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
@@ -10,6 +10,8 @@
 #include "BsRenderAPI.h"
 #include "BsTextureManager.h"
 #include "BsPixelData.h"
+#include "BsDataStream.h"
+#include "BsTextureStreamingManager.h"
 
 namespace bs
 {
@@ -50,17 +52,18 @@ namespace bs
 #define BS_ADD_PLAINFIELD(name, id, parentType) \
 	addPlainField(#name, id##, &##parentType##::get##name, &##parentType##::Set##name);
 
-		SPtr<PixelData> getPixelData(Texture* obj, UINT32 idx)
+		/** Temporary data used while a texture is being serialized. */
+		struct SerializationData
 		{
-			UINT32 face = (size_t)Math::floor(idx / (float)(obj->mProperties.getNumMipmaps() + 1));
-			UINT32 mipmap = idx % (obj->mProperties.getNumMipmaps() + 1);
-
-			SPtr<PixelData> pixelData = obj->mProperties.allocBuffer(face, mipmap);
-
-			obj->readData(pixelData, face, mipmap);
-			gCoreThread().submit(true);
+			SPtr<MemoryDataStream> mipData;
+			Vector<UINT32> mipOffsets;
+		};
 
-			return pixelData;
+		// Note: Only used for reading textures saved before per-mip offsets were introduced. Newer textures store their 
+		// data through the "mMipData" field.
+		SPtr<PixelData> getPixelData(Texture* obj, UINT32 idx)
+		{
+			return nullptr;
 		}
 
 		void setPixelData(Texture* obj, UINT32 idx, SPtr<PixelData> data)
@@ -72,7 +75,7 @@ namespace bs
 
 		UINT32 getPixelDataArraySize(Texture* obj)
 		{
-			return obj->mProperties.getNumFaces() * (obj->mProperties.getNumMipmaps() + 1);
+			return 0;
 		}
 
 		void setPixelDataArraySize(Texture* obj, UINT32 size)
@@ -82,6 +85,32 @@ namespace bs
 			pixelData->resize(size);
 		}
 
+		Vector<UINT32>& getMipOffsets(Texture* obj)
+		{
+			SerializationData& data = any_cast_ref<SerializationData>(obj->mRTTIData);
+			return data.mipOffsets;
+		}
+
+		void setMipOffsets(Texture* obj, Vector<UINT32>& val)
+		{
+			obj->mMipOffsets = val;
+		}
+
+		SPtr<DataStream> getMipData(Texture* obj, UINT32& size)
+		{
+			SerializationData& data = any_cast_ref<SerializationData>(obj->mRTTIData);
+
+			size = (UINT32)data.mipData->size();
+			return data.mipData;
+		}
+
+		void setMipData(Texture* obj, const SPtr<DataStream>& val, UINT32 size)
+		{
+			// Making sure that the Texture cannot modify the source stream, which is still used by the deserializer
+			obj->mStreamData = val->clone();
+			obj->mStreamOffset = (UINT32)val->tell();
+		}
+
 	public:
 		TextureRTTI()
 			:mInitMembers(this)
@@ -90,6 +119,77 @@ namespace bs
 
 			addReflectablePtrArrayField("mPixelData", 12, &TextureRTTI::getPixelData, &TextureRTTI::getPixelDataArraySize, 
 				&TextureRTTI::setPixelData, &TextureRTTI::setPixelDataArraySize, RTTI_Flag_SkipInReferenceSearch);
+
+			addPlainField("mMipOffsets", 13, &TextureRTTI::getMipOffsets, &TextureRTTI::setMipOffsets);
+			addDataBlockField("mMipData", 14, &TextureRTTI::getMipData, &TextureRTTI::setMipData, 0);
+		}
+
+		void onSerializationStarted(IReflectable* obj, const UnorderedMap<String, UINT64>& params) override
+		{
+			Texture* texture = static_cast<Texture*>(obj);
+			const TextureProperties& texProps = texture->mProperties;
+
+			UINT32 numFaces = texProps.getNumFaces();
+			UINT32 numMips = texProps.getNumMipmaps() + 1;
+
+			// Read data for all the subresources. Mip levels that aren't resident are read from the source stream, while
+			// the rest are read from the GPU.
+			SPtr<DataStream> sourceStream;
+			if (texture->_isStreamable())
+				sourceStream = texture->mStreamData->clone(false);
+
+			Vector<SPtr<PixelData>> subresources(numFaces * numMips);
+			for (UINT32 mip = 0; mip < numMips; mip++)
+			{
+				for (UINT32 face = 0; face < numFaces; face++)
+				{
+					UINT32 subresourceIdx = texProps.mapToSubresourceIdx(face, mip);
+
+					if (mip < texture->mFirstResidentMip)
+						subresources[subresourceIdx] = texture->getStreamedMip(sourceStream, face, mip);
+					else
+					{
+						subresources[subresourceIdx] = texProps.allocBuffer(face, mip);
+						texture->readData(subresources[subresourceIdx], face, mip);
+					}
+				}
+			}
+
+			gCoreThread().submit(true);
+
+			// Write the mip levels starting with the least detailed one, so the data required on initial load is stored
+			// in a single contiguous block at the start
+			UINT32 totalSize = 0;
+			for (auto& entry : subresources)
+				totalSize += entry->getConsecutiveSize();
+
+			SerializationData data;
+			data.mipOffsets.resize(numMips);
+			data.mipData = bs_shared_ptr_new<MemoryDataStream>(totalSize);
+
+			UINT32 offset = 0;
+			for (INT32 mip = (INT32)numMips - 1; mip >= 0; mip--)
+			{
+				data.mipOffsets[mip] = offset;
+
+				for (UINT32 face = 0; face < numFaces; face++)
+				{
+					const SPtr<PixelData>& pixelData = subresources[texProps.mapToSubresourceIdx(face, (UINT32)mip)];
+					UINT32 size = pixelData->getConsecutiveSize();
+
+					data.mipData->write(pixelData->getData(), size);
+					offset += size;
+				}
+			}
+
+			data.mipData->seek(0);
+			texture->mRTTIData = data;
+		}
+
+		void onSerializationEnded(IReflectable* obj, const UnorderedMap<String, UINT64>& params) override
+		{
+			Texture* texture = static_cast<Texture*>(obj);
+			texture->mRTTIData = nullptr;
 		}
 
 		void onDeserializationStarted(IReflectable* obj, const UnorderedMap<String, UINT64>& params) override
@@ -129,16 +229,50 @@ namespace bs
 				}
 			}
 
+			// Textures stored with per-mip offsets only load the mip levels they require. The rest are streamed in on
+			// demand, if the texture was loaded from a file.
+			SPtr<DataStream> sourceStream = texture->mStreamData;
+			if(sourceStream != nullptr)
+			{
+				texture->mStreamFormat = originalFormat;
+
+				bool streamable = sourceStream->isFile() && texProps.getNumMipmaps() > 0 &&
+					TextureStreamingManager::_canStream(texProps) && TextureStreamingManager::isStarted();
+
+				if (streamable)
+					texture->mFirstResidentMip = TextureStreamingManager::instance()._getMipTail(texProps);
+				else
+					texture->mStreamData = nullptr;
+			}
+
 			// A bit clumsy initializing with already set values, but I feel its better than complicating things and storing the values
 			// in mRTTIData.
 			texture->initialize();
 
-			for(size_t i = 0; i < pixelData->size(); i++)
+			if (sourceStream != nullptr)
 			{
-				UINT32 face = (size_t)Math::floor(i / (float)(texProps.getNumMipmaps() + 1));
-				UINT32 mipmap = i % (texProps.getNumMipmaps() + 1);
+				UINT32 numFaces = texProps.getNumFaces();
+				UINT32 numMips = texProps.getNumMipmaps() + 1;
+
+				for (UINT32 mip = texture->mFirstResidentMip; mip < numMips; mip++)
+				{
+					for (UINT32 face = 0; face < numFaces; face++)
+						texture->writeData(texture->readStreamedMip(sourceStream, face, mip), face, mip, false);
+				}
 
-				texture->writeData(pixelData->at(i), face, mipmap, false);
+				// Streamed data will be read through a clone of the stream when needed, no need to keep the file open
+				if (sourceStream->isFile())
+					sourceStream->close();
+			}
+			else
+			{
+				for (size_t i = 0; i < pixelData->size(); i++)
+				{
+					UINT32 face = (size_t)Math::floor(i / (float)(texProps.getNumMipmaps() + 1));
+					UINT32 mipmap = i % (texProps.getNumMipmaps() + 1);
+
+					texture->writeData(pixelData->at(i), face, mipmap, false);
+				}
 			}
 
 			bs_delete(pixelData);
@@ -0,0 +1,179 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsModule.h"
+
+namespace bs
+{
+	/** @addtogroup Resources-Internal
+	 *  @{
+	 */
+
+	/** Statistics about the current state of texture streaming. */
+	struct TextureStreamingStats
+	{
+		/** Number of textures whose mip levels are managed by the streaming system. */
+		UINT32 numTextures = 0;
+
+		/** Amount of GPU memory used by resident mip levels of all streamed textures, in bytes. */
+		UINT64 residentMemory = 0;
+
+		/** Amount of GPU memory that would be used if all streamed textures were at their requested quality, in bytes. */
+		UINT64 requestedMemory = 0;
+
+		/** Number of bytes of mip data requested to be read from disk and uploaded to the GPU during the last update. */
+		UINT32 bytesStreamedIn = 0;
+
+		/** Number of mip levels removed from the GPU during the last update in order to stay within the budget. */
+		UINT32 mipsEvicted = 0;
+	};
+
+	/**
+	 * Manages residency of mip levels for textures loaded from disk. Such textures initially load only their smallest
+	 * mip levels (the mip tail), while higher detail mip levels are read from the source file on demand, depending on
+	 * how large the textures appear on screen. If the memory used by the resident mip levels exceeds the set budget,
+	 * highest detail mip levels of textures that were least recently visible (or appear smallest on screen) are evicted.
+	 *
+	 * Renderer is expected to report texture usage each frame through _notifyTextureUsage().
+	 *
+	 * @note	Sim thread only unless noted otherwise.
+	 */
+	class BS_CORE_EXPORT TextureStreamingManager : public Module<TextureStreamingManager>
+	{
+		/** Information about a single texture managed by the streaming system. */
+		struct TextureInfo
+		{
+			WeakResourceHandle<Texture> texture;
+			const ct::Texture* core = nullptr;
+
+			UINT32 firstResidentMip = 0;
+			UINT32 requestedMip = 0;
+			UINT64 lastUsedFrame = 0;
+			float screenSize = 0.0f;
+		};
+
+	public:
+		TextureStreamingManager();
+		~TextureStreamingManager();
+
+		/**
+		 * Sets the maximum amount of GPU memory (in bytes) that all streamed textures are allowed to use. Mip tails of the
+		 * textures are always resident and will be kept even if the budget is exceeded.
+		 */
+		void setMemoryBudget(UINT64 budget) { mMemoryBudget = budget; }
+
+		/** @copydoc setMemoryBudget */
+		UINT64 getMemoryBudget() const { return mMemoryBudget; }
+
+		/**
+		 * Sets the maximum number of bytes of mip data that may be read and uploaded in a single frame. Allows streaming to
+		 * be spread across multiple frames in order to avoid spikes. At least one mip level is always streamed per frame, if
+		 * one is requested.
+		 */
+		void setMaxBytesPerFrame(UINT32 bytes) { mMaxBytesPerFrame = bytes; }
+
+		/** @copydoc setMaxBytesPerFrame */
+		UINT32 getMaxBytesPerFrame() const { return mMaxBytesPerFrame; }
+
+		/**
+		 * Sets the size (in pixels) of the largest mip level that will always be kept resident. Mip levels at or below
+		 * this size are loaded together with the texture.
+		 */
+		void setMipTailSize(UINT32 size) { mMipTailSize = std::max(size, 1U); }
+
+		/** @copydoc setMipTailSize */
+		UINT32 getMipTailSize() const { return mMipTailSize; }
+
+		/**
+		 * Sets the number of frames after which a texture that hasn't been visible has its high detail mip levels evicted.
+		 */
+		void setEvictionDelay(UINT32 numFrames) { mEvictionDelay = numFrames; }
+
+		/** @copydoc setEvictionDelay */
+		UINT32 getEvictionDelay() const { return mEvictionDelay; }
+
+		/** Returns statistics about the streamed textures, as calculated during the last update. */
+		const TextureStreamingStats& getStats() const { return mStats; }
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/**
+		 * Determines which mip levels of streamed textures should be resident, evicts mip levels if over the memory
+		 * budget and streams in new mip levels. Should be called once per frame.
+		 */
+		void _update();
+
+		/**
+		 * Reports that the provided textures were used for rendering during the current frame. Each texture is paired
+		 * with the size of the area it covers on screen, in pixels (along the larger dimension).
+		 *
+		 * @note	Core thread.
+		 */
+		void _notifyTextureUsage(const UnorderedMap<const ct::Texture*, float>& usage);
+
+		/**
+		 * Returns the index of the most detailed mip level that is always resident for a texture with the provided
+		 * properties.
+		 *
+		 * @note	Thread safe.
+		 */
+		UINT32 _getMipTail(const TextureProperties& props) const;
+
+		/** 
+		 * Checks are there any textures whose mip levels are managed by the streaming system. Allows the renderer to skip
+		 * calculating texture usage when nothing is being streamed.
+		 *
+		 * @note	Thread safe.
+		 */
+		bool _isActive() const { return mNumTextures.load(std::memory_order_relaxed) > 0; }
+
+		/**
+		 * Checks could a texture with the provided properties have its mip levels streamed, if it has any mip levels. Can
+		 * be used for quickly filtering out textures that are never streamed, on either thread.
+		 */
+		static bool _canStream(const TextureProperties& props);
+
+		/** @} */
+	private:
+		/** Triggered by the resources system when a resource finishes loading. */
+		void onResourceLoaded(const HResource& resource);
+
+		/** Triggered by the resources system when a resource is destroyed. */
+		void onResourceDestroyed(const String& uuid);
+
+		/** Returns the amount of GPU memory used by all faces of the texture, starting with the provided mip level. */
+		static UINT64 calcResidentSize(const TextureProperties& props, UINT32 firstMip);
+
+		/** 
+		 * Changes the resident mip levels of the provided texture. Levels that need to be read from disk are applied in
+		 * a later update, once the read completes.
+		 */
+		void setResidentMips(TextureInfo& info, UINT32 firstMip);
+
+		/** Updates the texture information after its core object changed and notifies any listeners of the change. */
+		void onResidentMipsChanged(TextureInfo& info);
+
+		UINT64 mMemoryBudget = 512 * 1024 * 1024;
+		UINT32 mMaxBytesPerFrame = 8 * 1024 * 1024;
+		UINT32 mMipTailSize = 64;
+		UINT32 mEvictionDelay = 300;
+
+		UnorderedMap<String, TextureInfo> mTextures;
+		UnorderedMap<const ct::Texture*, String> mCoreToUUID;
+		TextureStreamingStats mStats;
+		std::atomic<UINT32> mNumTextures { 0 };
+
+		Vector<WeakResourceHandle<Texture>> mNewTextures;
+		UnorderedMap<const ct::Texture*, float> mUsage;
+		Mutex mMutex;
+
+		HEvent mResourceLoadedConn;
+		HEvent mResourceDestroyedConn;
+	};
+
+	/** @} */
+}
@@ -35,7 +35,7 @@ namespace bs
 	AnimationProxy::AnimationProxy(UINT64 id)
 		: id(id), layers(nullptr), numLayers(0), numSceneObjects(0), sceneObjectInfos(nullptr)
 		, sceneObjectTransforms(nullptr), morphChannelInfos(nullptr), morphShapeInfos(nullptr), numMorphShapes(0)
-		, numMorphChannels(0), numMorphVertices(0), morphChannelWeightsDirty(false), mCullEnabled(true), numGenericCurves(0)
+		, numMorphChannels(0), numMorphVertices(0), morphChannelWeightsDirty(false), morphShapeOutputIdx(0), mCullEnabled(true), numGenericCurves(0)
 		, genericCurveOutputs(nullptr)
 	{ }
 
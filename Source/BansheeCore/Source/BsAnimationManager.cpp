@@ -10,6 +10,7 @@
 #include "BsMorphShapes.h"
 #include "BsMeshData.h"
 #include "BsMeshUtility.h"
+#include "BsSIMD.h"
 
 namespace bs
 {
@@ -132,6 +133,7 @@ namespace bs
 		mPoseWriteBufferIdx = (mPoseWriteBufferIdx + 1) % CoreThread::NUM_SYNC_BUFFERS;
 
 		renderData.transforms.resize(totalNumBones);
+		renderData.packedTransforms.resize(totalNumBones * 3);
 		renderData.infos.clear();
 
 		UINT32 curBoneIdx = 0;
@@ -186,6 +188,11 @@ namespace bs
 				// Animate bones
 				anim->skeleton->getPose(boneDst, anim->skeletonPose, anim->skeletonMask, anim->layers, anim->numLayers);
 
+				// Store in GPU format while the transforms are still in cache, so the renderer can upload all poses at once
+				Vector4* packedDst = renderData.packedTransforms.data() + curBoneIdx * 3;
+				for (UINT32 i = 0; i < numBones; i++)
+					memcpy(&packedDst[i * 3], &boneDst[i], 12 * sizeof(float)); // Assuming row-major format
+
 				curBoneIdx += numBones;
 				hasAnimInfo = true;
 			}
@@ -392,64 +399,14 @@ namespace bs
 				// Generate morph shape vertices
 				if(anim->morphChannelWeightsDirty || hasMorphCurves)
 				{
-					SPtr<MeshData> meshData = bs_shared_ptr_new<MeshData>(anim->numMorphVertices, 0, mBlendShapeVertexDesc);
-
-					UINT8* bufferData = meshData->getData();
-					memset(bufferData, 0, meshData->getSize());
-
-					UINT32 tempDataSize = (sizeof(Vector3) + sizeof(float)) * anim->numMorphVertices;
-					UINT8* tempData = (UINT8*)bs_stack_alloc(tempDataSize);
-					memset(tempData, 0, tempDataSize);
-
-					Vector3* tempNormals = (Vector3*)tempData;
-					float* accumulatedWeight = (float*)(tempData + sizeof(Vector3) * anim->numMorphVertices);
+					// Re-use the output from a few frames ago, which the core thread is guaranteed to be done with
+					anim->morphShapeOutputIdx = (anim->morphShapeOutputIdx + 1) % CoreThread::NUM_SYNC_BUFFERS;
 
-					UINT8* positions = meshData->getElementData(VES_POSITION, 1, 1);
-					UINT8* normals = meshData->getElementData(VES_NORMAL, 1, 1);
-
-					UINT32 stride = mBlendShapeVertexDesc->getVertexStride(1);
-
-					for(UINT32 i = 0; i < anim->numMorphShapes; i++)
-					{
-						const MorphShapeInfo& info = anim->morphShapeInfos[i];
-						float absWeight = Math::abs(info.finalWeight);
+					SPtr<MeshData>& meshData = anim->morphShapeOutputs[anim->morphShapeOutputIdx];
+					if (meshData == nullptr || meshData->getNumVertices() != anim->numMorphVertices)
+						meshData = bs_shared_ptr_new<MeshData>(anim->numMorphVertices, 0, mBlendShapeVertexDesc);
 
-						if (absWeight < 0.0001f)
-							continue;
-
-						const Vector<MorphVertex>& morphVertices = info.shape->getVertices();
-						UINT32 numVertices = (UINT32)morphVertices.size();
-						for(UINT32 j = 0; j < numVertices; j++)
-						{
-							const MorphVertex& vertex = morphVertices[j];
-
-							Vector3* destPos = (Vector3*)(positions + vertex.sourceIdx * stride);
-							*destPos += vertex.deltaPosition * info.finalWeight;
-
-							tempNormals[vertex.sourceIdx] += vertex.deltaNormal * info.finalWeight;
-							accumulatedWeight[vertex.sourceIdx] += absWeight;
-						}
-					}
-
-					for(UINT32 i = 0; i < anim->numMorphVertices; i++)
-					{
-						PackedNormal* destNrm = (PackedNormal*)(normals + i * stride);
-
-						if (accumulatedWeight[i] > 0.0001f)
-						{
-							Vector3 normal = tempNormals[i] / accumulatedWeight[i];
-							normal /= 2.0f; // Accumulated normal is in range [-2, 2] but our normal packing method assumes [-1, 1] range
-
-							MeshUtility::packNormals(&normal, (UINT8*)destNrm, 1, sizeof(Vector3), stride);
-							destNrm->w = (UINT8)(std::min(1.0f, accumulatedWeight[i]) * 255.999f);
-						}
-						else
-						{
-							*destNrm = { 127, 127, 127, 0 };
-						}
-					}
-
-					bs_stack_free(tempData);
+					evaluateMorphShapes(*anim, *meshData);
 
 					animInfo.morphShapeInfo.meshData = meshData;
 
@@ -471,6 +428,72 @@ namespace bs
 		mDataReadyCount.fetch_add(1, std::memory_order_acq_rel);
 	}
 
+	void AnimationManager::evaluateMorphShapes(const AnimationProxy& anim, MeshData& output)
+	{
+		UINT32 numVertices = anim.numMorphVertices;
+
+		// Normals store the total absolute weight in their fourth component
+		mMorphPositions.assign(numVertices * 4, 0.0f);
+		mMorphNormals.assign(numVertices * 4, 0.0f);
+
+		float* positions = mMorphPositions.data();
+		float* normals = mMorphNormals.data();
+
+		for(UINT32 i = 0; i < anim.numMorphShapes; i++)
+		{
+			const MorphShapeInfo& info = anim.morphShapeInfos[i];
+			float absWeight = Math::abs(info.finalWeight);
+
+			if (absWeight < 0.0001f)
+				continue;
+
+			simd::float4 positionWeight = simd::splat(info.finalWeight);
+			simd::float4 normalWeight = simd::set(info.finalWeight, info.finalWeight, info.finalWeight, absWeight);
+
+			// Vertices are sorted by source index, so the scratch buffers are accessed front to back
+			const Vector<MorphVertex>& morphVertices = info.shape->getVertices();
+			for(auto& vertex : morphVertices)
+			{
+				float* destPos = positions + vertex.sourceIdx * 4;
+				float* destNrm = normals + vertex.sourceIdx * 4;
+
+				// Loading four floats picks up the normal's x as well, it ends up in the unused fourth component
+				simd::float4 deltaPosition = simd::load(&vertex.deltaPosition.x);
+				simd::float4 deltaNormal = simd::set(vertex.deltaNormal.x, vertex.deltaNormal.y, vertex.deltaNormal.z, 1.0f);
+
+				simd::store(destPos, simd::madd(deltaPosition, positionWeight, simd::load(destPos)));
+				simd::store(destNrm, simd::madd(deltaNormal, normalWeight, simd::load(destNrm)));
+			}
+		}
+
+		UINT8* outPositions = output.getElementData(VES_POSITION, 1, 1);
+		UINT8* outNormals = output.getElementData(VES_NORMAL, 1, 1);
+		UINT32 stride = mBlendShapeVertexDesc->getVertexStride(1);
+
+		for(UINT32 i = 0; i < numVertices; i++)
+		{
+			memcpy(outPositions + i * stride, positions + i * 4, sizeof(Vector3));
+
+			// Average the normal. Accumulated normal is in range [-2, 2] but our normal packing method assumes [-1, 1] 
+			// range. Vertices without any influence end up with a zero normal.
+			float* normal = normals + i * 4;
+			float scale = normal[3] > 0.0001f ? 0.5f / normal[3] : 0.0f;
+
+			simd::store(normal, simd::mul(simd::load(normal), simd::set(scale, scale, scale, 1.0f)));
+		}
+
+		MeshUtility::packNormals((Vector3*)normals, outNormals, numVertices, sizeof(float) * 4, stride);
+
+		// Packing outputs a constant fourth component, replace it with the accumulated weight
+		for(UINT32 i = 0; i < numVertices; i++)
+		{
+			float weight = normals[i * 4 + 3];
+
+			PackedNormal* destNrm = (PackedNormal*)(outNormals + i * stride);
+			destNrm->w = weight > 0.0001f ? (UINT8)(std::min(1.0f, weight) * 255.999f) : 0;
+		}
+	}
+
 	void AnimationManager::waitUntilComplete()
 	{
 		mAnimationWorker->wait();
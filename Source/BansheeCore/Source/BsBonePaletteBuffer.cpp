@@ -0,0 +1,154 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsBonePaletteBuffer.h"
+#include "BsGpuBuffer.h"
+#include "BsBitwise.h"
+
+namespace bs { namespace ct
+{
+	void BonePaletteBuffer::reserveIdentityBones(UINT32 numBones)
+	{
+		if (numBones <= mNumIdentityBones)
+			return;
+
+		mNumIdentityBones = numBones;
+
+		// Offsets of all poses move, so lay out the retained copies again
+		UINT32 numPoseBones = 0;
+		for (auto& entry : mPoses)
+		{
+			RetainedPose& pose = entry.second;
+			if (pose.transforms.empty())
+				continue;
+
+			pose.offset = mNumIdentityBones + numPoseBones;
+			numPoseBones += (UINT32)pose.transforms.size() / 3;
+		}
+
+		UINT8* dest = lock(mNumIdentityBones + numPoseBones);
+		for (auto& entry : mPoses)
+		{
+			const RetainedPose& pose = entry.second;
+			if (pose.transforms.empty())
+				continue;
+
+			UINT32 size = (UINT32)pose.transforms.size() * sizeof(Vector4);
+			memcpy(dest, pose.transforms.data(), size);
+			dest += size;
+		}
+
+		mBuffer->unlock();
+	}
+
+	void BonePaletteBuffer::registerAnimation(UINT64 animId)
+	{
+		mPoses[animId].numRefs++;
+	}
+
+	void BonePaletteBuffer::unregisterAnimation(UINT64 animId)
+	{
+		auto iterFind = mPoses.find(animId);
+		if (iterFind == mPoses.end())
+			return;
+
+		iterFind->second.numRefs--;
+		if (iterFind->second.numRefs == 0)
+			mPoses.erase(iterFind);
+	}
+
+	void BonePaletteBuffer::update(const RendererAnimationData& animData)
+	{
+		if (animData.infos.empty())
+			return;
+
+		UINT32 numPoseBones = (UINT32)animData.transforms.size();
+		UINT32 numRetainedBones = 0;
+
+		for (auto& entry : mPoses)
+		{
+			RetainedPose& pose = entry.second;
+
+			auto iterFind = animData.infos.find(entry.first);
+			pose.evaluated = iterFind != animData.infos.end() && iterFind->second.poseInfo.numBones > 0;
+
+			if (pose.evaluated)
+			{
+				const RendererAnimationData::PoseInfo& poseInfo = iterFind->second.poseInfo;
+
+				auto iterStart = animData.packedTransforms.begin() + poseInfo.startIdx * 3;
+				pose.transforms.assign(iterStart, iterStart + poseInfo.numBones * 3);
+				pose.offset = mNumIdentityBones + poseInfo.startIdx;
+			}
+			else if (!pose.transforms.empty())
+			{
+				// Culled this frame, keep referencing the last evaluated pose
+				pose.offset = mNumIdentityBones + numPoseBones + numRetainedBones;
+				numRetainedBones += (UINT32)pose.transforms.size() / 3;
+			}
+		}
+
+		UINT8* dest = lock(mNumIdentityBones + numPoseBones + numRetainedBones);
+
+		if (numPoseBones > 0)
+		{
+			memcpy(dest, animData.packedTransforms.data(), numPoseBones * 3 * sizeof(Vector4));
+			dest += numPoseBones * 3 * sizeof(Vector4);
+		}
+
+		if (numRetainedBones > 0)
+		{
+			for (auto& entry : mPoses)
+			{
+				const RetainedPose& pose = entry.second;
+				if (pose.evaluated || pose.transforms.empty())
+					continue;
+
+				UINT32 size = (UINT32)pose.transforms.size() * sizeof(Vector4);
+				memcpy(dest, pose.transforms.data(), size);
+				dest += size;
+			}
+		}
+
+		mBuffer->unlock();
+	}
+
+	UINT32 BonePaletteBuffer::getBoneOffset(UINT64 animId) const
+	{
+		auto iterFind = mPoses.find(animId);
+		if (iterFind == mPoses.end() || iterFind->second.transforms.empty())
+			return 0;
+
+		return iterFind->second.offset;
+	}
+
+	UINT8* BonePaletteBuffer::lock(UINT32 numBones)
+	{
+		// Keep at least one bone, so there is always a valid buffer to bind
+		numBones = std::max(numBones, 1U);
+
+		if (numBones > mCapacity)
+		{
+			mCapacity = Bitwise::nextPow2(numBones);
+
+			GPU_BUFFER_DESC desc;
+			desc.elementCount = mCapacity * 3;
+			desc.elementSize = 0;
+			desc.type = GBT_STANDARD;
+			desc.format = BF_32X4F;
+			desc.usage = GBU_DYNAMIC;
+
+			mBuffer = GpuBuffer::create(desc);
+		}
+
+		// Discarding lets the driver hand out a new region if the GPU is still reading the previous frame's poses
+		UINT8* dest = (UINT8*)mBuffer->lock(0, numBones * 3 * sizeof(Vector4), GBL_WRITE_ONLY_DISCARD);
+		for (UINT32 i = 0; i < mNumIdentityBones; i++)
+		{
+			memcpy(dest, &Matrix4::IDENTITY, 12 * sizeof(float)); // Assuming row-major format
+
+			dest += 12 * sizeof(float);
+		}
+
+		return dest;
+	}
+}}
@@ -22,7 +22,7 @@ namespace bs
 		: mLayers(0xFFFFFFFFFFFFFFFF), mCameraFlags(CameraFlag::HDR), mPosition(BsZero), mRotation(BsIdentity)
 		, mIsActive(true), mProjType(PT_PERSPECTIVE), mHorzFOV(Degree(90.0f)), mFarDist(1000.0f), mNearDist(0.05f)
 		, mAspect(1.33333333333333f), mOrthoHeight(5), mPriority(0), mCustomViewMatrix(false), mCustomProjMatrix(false)
-		, mMSAA(1), mFrustumExtentsManuallySet(false), mProjMatrixRS(BsZero), mProjMatrix(BsZero), mViewMatrix(BsZero)
+		, mMSAA(1), mLateLatchMouse(BsZero), mLateLatchGamepad(BsZero), mFrustumExtentsManuallySet(false), mProjMatrixRS(BsZero), mProjMatrix(BsZero), mViewMatrix(BsZero)
 		, mProjMatrixRSInv(BsZero), mProjMatrixInv(BsZero), mViewMatrixInv(BsZero), mRecalcFrustum(true)
 		, mRecalcFrustumPlanes(true), mRecalcView(true)
 	{
@@ -761,6 +761,8 @@ namespace bs
 			size += rttiGetElemSize(mCameraFlags);
 			size += rttiGetElemSize(mIsActive);
 			size += rttiGetElemSize(mMSAA);
+			size += rttiGetElemSize(mLateLatchMouse);
+			size += rttiGetElemSize(mLateLatchGamepad);
 			size += sizeof(UINT32);
 
 			if(mPPSettings != nullptr)
@@ -793,6 +795,8 @@ namespace bs
 			dataPtr = rttiWriteElem(mCameraFlags, dataPtr);
 			dataPtr = rttiWriteElem(mIsActive, dataPtr);
 			dataPtr = rttiWriteElem(mMSAA, dataPtr);
+			dataPtr = rttiWriteElem(mLateLatchMouse, dataPtr);
+			dataPtr = rttiWriteElem(mLateLatchGamepad, dataPtr);
 
 			dataPtr = rttiWriteElem(ppSize, dataPtr);
 
@@ -885,6 +889,8 @@ namespace bs
 			dataPtr = rttiReadElem(mCameraFlags, dataPtr);
 			dataPtr = rttiReadElem(mIsActive, dataPtr);
 			dataPtr = rttiReadElem(mMSAA, dataPtr);
+			dataPtr = rttiReadElem(mLateLatchMouse, dataPtr);
+			dataPtr = rttiReadElem(mLateLatchGamepad, dataPtr);
 
 			UINT32 ppSize = 0;
 			dataPtr = rttiReadElem(ppSize, dataPtr);
@@ -36,11 +36,15 @@
 #include "BsProfilerCPU.h"
 #include "BsProfilerGPU.h"
 #include "BsQueryManager.h"
+#include "BsGpuReadbackManager.h"
+#include "BsBonePaletteBuffer.h"
 #include "BsThreadPool.h"
 #include "BsTaskScheduler.h"
 #include "BsRenderStats.h"
 #include "BsMessageHandler.h"
 #include "BsResourceListenerManager.h"
+#include "BsTextureStreamingManager.h"
+#include "BsResourceCache.h"
 #include "BsRenderStateManager.h"
 #include "BsShaderManager.h"
 #include "BsPhysicsManager.h"
@@ -66,6 +70,8 @@ namespace bs
 		FontManager::shutDown();
 		MaterialManager::shutDown();
 		MeshManager::shutDown();
+		ct::BonePaletteBuffer::shutDown();
+		ct::GpuReadbackManager::shutDown();
 		ProfilerGPU::shutDown();
 
 		SceneManager::shutDown();
@@ -74,6 +80,8 @@ namespace bs
 
 		ct::ParamBlockManager::shutDown();
 		StringTableManager::shutDown();
+		TextureStreamingManager::shutDown();
+		ResourceCache::shutDown();
 		Resources::shutDown();
 		GameObjectManager::shutDown();
 		ResourceListenerManager::shutDown();
@@ -141,6 +149,8 @@ namespace bs
 		GameObjectManager::startUp();
 		Resources::startUp();
 		ResourceListenerManager::startUp();
+		TextureStreamingManager::startUp();
+		ResourceCache::startUp();
 		GpuProgramManager::startUp();
 		RenderStateManager::startUp();
 		ct::GpuProgramManager::startUp();
@@ -159,6 +169,8 @@ namespace bs
 		startUpRenderer();
 
 		ProfilerGPU::startUp();
+		ct::GpuReadbackManager::startUp();
+		ct::BonePaletteBuffer::startUp();
 		MeshManager::startUp();
 		MaterialManager::startUp();
 		FontManager::startUp();
@@ -235,6 +247,12 @@ namespace bs
 
 			postUpdate();
 
+			// Stream texture mip levels depending on the usage reported by the renderer during the previous frame
+			TextureStreamingManager::instance()._update();
+
+			// Unload resources nothing references anymore, if over their memory budget
+			ResourceCache::instance()._update();
+
 			// Send out resource events in case any were loaded/destroyed/modified
 			ResourceListenerManager::instance().update();
 
@@ -268,6 +286,7 @@ namespace bs
 
 			gCoreThread().queueCommand(std::bind(&ct::RenderWindowManager::_update, ct::RenderWindowManager::instancePtr()), CTQF_InternalQueue);
 			gCoreThread().queueCommand(std::bind(&ct::QueryManager::_update, ct::QueryManager::instancePtr()), CTQF_InternalQueue);
+			gCoreThread().queueCommand(std::bind(&ct::GpuReadbackManager::_update, ct::GpuReadbackManager::instancePtr()), CTQF_InternalQueue);
 			gCoreThread().queueCommand(std::bind(&CoreApplication::endCoreProfiling, this), CTQF_InternalQueue);
 
 			gProfilerCPU().endThread();
@@ -310,7 +329,10 @@ namespace bs
 
 	void CoreApplication::setFPSLimit(UINT32 limit)
 	{
-		mFrameStep = (UINT64)1000000 / limit;
+		if (limit > 0)
+			mFrameStep = (UINT64)1000000 / limit;
+		else
+			mFrameStep = 0;
 	}
 
 	void CoreApplication::frameRenderingFinishedCallback()
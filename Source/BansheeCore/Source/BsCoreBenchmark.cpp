@@ -0,0 +1,13 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsCoreBenchmarkSuite.h"
+
+using namespace bs;
+
+/** Runs the core benchmarks. See BenchmarkSuite::runFromCommandLine() for supported options. */
+int main(int argc, char* argv[])
+{
+	SPtr<BenchmarkSuite> benchmarks = BenchmarkSuite::create<CoreBenchmarkSuite>();
+
+	return BenchmarkSuite::runFromCommandLine(benchmarks, argc, argv);
+}
@@ -0,0 +1,125 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsCoreBenchmarkSuite.h"
+#include "BsPixelData.h"
+#include "BsPixelUtil.h"
+#include "BsColor.h"
+#include "BsMath.h"
+
+namespace bs
+{
+	static const UINT32 IMAGE_SIZE = 256;
+	static const UINT32 NUM_KEYFRAMES = 64;
+	static const UINT32 NUM_CURVE_SAMPLES = 1024;
+
+	/** Creates a curve with keyframes at regular intervals, whose values are provided by the specified functor. */
+	template<class T, class F>
+	TAnimationCurve<T> createCurve(F getValue)
+	{
+		Vector<TKeyframe<T>> keyframes(NUM_KEYFRAMES);
+		for (UINT32 i = 0; i < NUM_KEYFRAMES; i++)
+		{
+			keyframes[i].time = (float)i;
+			keyframes[i].value = getValue(i);
+			keyframes[i].inTangent = getValue(i) * 0.0f;
+			keyframes[i].outTangent = getValue(i) * 0.0f;
+		}
+
+		return TAnimationCurve<T>(keyframes);
+	}
+
+	CoreBenchmarkSuite::CoreBenchmarkSuite()
+	{
+		static const UINT32 NUM_PIXELS = IMAGE_SIZE * IMAGE_SIZE;
+
+		BS_ADD_BENCHMARK_BYTES(CoreBenchmarkSuite::benchPixelConversionToFloat16, NUM_PIXELS * 4);
+		BS_ADD_BENCHMARK_BYTES(CoreBenchmarkSuite::benchPixelConversionToRGBA8, NUM_PIXELS * 16);
+		BS_ADD_BENCHMARK_BYTES(CoreBenchmarkSuite::benchPixelScale, NUM_PIXELS * 4);
+		BS_ADD_BENCHMARK(CoreBenchmarkSuite::benchCurveEvaluate);
+		BS_ADD_BENCHMARK(CoreBenchmarkSuite::benchCurveEvaluateCached);
+		BS_ADD_BENCHMARK(CoreBenchmarkSuite::benchVector3CurveEvaluateCached);
+	}
+
+	void CoreBenchmarkSuite::startUp()
+	{
+		mPixelsRGBA8 = PixelData::create(IMAGE_SIZE, IMAGE_SIZE, 1, PF_R8G8B8A8);
+		mPixelsFloat16 = PixelData::create(IMAGE_SIZE, IMAGE_SIZE, 1, PF_FLOAT16_RGBA);
+		mPixelsFloat32 = PixelData::create(IMAGE_SIZE, IMAGE_SIZE, 1, PF_FLOAT32_RGBA);
+		mPixelsHalfSize = PixelData::create(IMAGE_SIZE / 2, IMAGE_SIZE / 2, 1, PF_R8G8B8A8);
+
+		for (UINT32 y = 0; y < IMAGE_SIZE; y++)
+		{
+			for (UINT32 x = 0; x < IMAGE_SIZE; x++)
+			{
+				Color color(x / (float)IMAGE_SIZE, y / (float)IMAGE_SIZE, ((x + y) % IMAGE_SIZE) / (float)IMAGE_SIZE);
+
+				mPixelsRGBA8->setColorAt(color, x, y);
+				mPixelsFloat32->setColorAt(color, x, y);
+			}
+		}
+
+		mFloatCurve = createCurve<float>([](UINT32 i) { return Math::sin(Radian(i * 0.5f)); });
+		mVector3Curve = createCurve<Vector3>([](UINT32 i)
+		{
+			return Vector3(Math::sin(Radian(i * 0.5f)), Math::cos(Radian(i * 0.5f)), (float)i);
+		});
+	}
+
+	void CoreBenchmarkSuite::shutDown()
+	{
+		mPixelsRGBA8 = nullptr;
+		mPixelsFloat16 = nullptr;
+		mPixelsFloat32 = nullptr;
+		mPixelsHalfSize = nullptr;
+	}
+
+	void CoreBenchmarkSuite::benchPixelConversionToFloat16()
+	{
+		PixelUtil::bulkPixelConversion(*mPixelsRGBA8, *mPixelsFloat16);
+		doNotOptimize(*mPixelsFloat16->getData());
+	}
+
+	void CoreBenchmarkSuite::benchPixelConversionToRGBA8()
+	{
+		PixelUtil::bulkPixelConversion(*mPixelsFloat32, *mPixelsRGBA8);
+		doNotOptimize(*mPixelsRGBA8->getData());
+	}
+
+	void CoreBenchmarkSuite::benchPixelScale()
+	{
+		PixelUtil::scale(*mPixelsRGBA8, *mPixelsHalfSize, PixelUtil::FILTER_LINEAR);
+		doNotOptimize(*mPixelsHalfSize->getData());
+	}
+
+	void CoreBenchmarkSuite::benchCurveEvaluate()
+	{
+		// Random access into the curve, as done when evaluating curves without an animation instance
+		float step = (NUM_KEYFRAMES - 1) / (float)NUM_CURVE_SAMPLES;
+		float total = 0.0f;
+		for (UINT32 i = 0; i < NUM_CURVE_SAMPLES; i++)
+			total += mFloatCurve.evaluate(((i * 7919) % NUM_CURVE_SAMPLES) * step, false);
+
+		doNotOptimize(total);
+	}
+
+	void CoreBenchmarkSuite::benchCurveEvaluateCached()
+	{
+		// Sequential access, as done during animation playback
+		float step = (NUM_KEYFRAMES - 1) / (float)NUM_CURVE_SAMPLES;
+		float total = 0.0f;
+		for (UINT32 i = 0; i < NUM_CURVE_SAMPLES; i++)
+			total += mFloatCurve.evaluate(i * step, mFloatCurveCache, false);
+
+		doNotOptimize(total);
+	}
+
+	void CoreBenchmarkSuite::benchVector3CurveEvaluateCached()
+	{
+		float step = (NUM_KEYFRAMES - 1) / (float)NUM_CURVE_SAMPLES;
+		Vector3 total = Vector3::ZERO;
+		for (UINT32 i = 0; i < NUM_CURVE_SAMPLES; i++)
+			total += mVector3Curve.evaluate(i * step, mVector3CurveCache, false);
+
+		doNotOptimize(total);
+	}
+}
@@ -0,0 +1,233 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsGpuReadbackManager.h"
+#include "BsEventQuery.h"
+#include "BsPixelUtil.h"
+#include "BsPixelData.h"
+#include "BsDataStream.h"
+#include "BsMath.h"
+
+namespace bs { namespace ct
+{
+	const UINT32 GpuReadbackManager::MAX_UNUSED_FRAMES = 60;
+
+	GpuReadbackManager::~GpuReadbackManager()
+	{
+		// Complete any outstanding operations so nobody waits on them forever. Their data is not valid.
+		while (!mRequests.empty())
+		{
+			mRequests.front().op._completeOperation();
+			mRequests.pop();
+		}
+	}
+
+	AsyncOp GpuReadbackManager::readTexture(const SPtr<Texture>& texture, const SPtr<PixelData>& data, UINT32 face,
+		UINT32 mipLevel, const GpuReadbackCallback& callback)
+	{
+		const TextureProperties& props = texture->getProperties();
+
+		if (props.getTextureType() == TEX_TYPE_CUBE_MAP)
+		{
+			LOGERR("Asynchronous reads of cube map textures are not supported.");
+
+			AsyncOp op;
+			op._completeOperation();
+			return op;
+		}
+
+		UINT32 mipWidth, mipHeight, mipDepth;
+		PixelUtil::getSizeForMipLevel(props.getWidth(), props.getHeight(), props.getDepth(), mipLevel, mipWidth,
+			mipHeight, mipDepth);
+
+		if (data->getWidth() != mipWidth || data->getHeight() != mipHeight || data->getDepth() != mipDepth ||
+			data->getFormat() != props.getFormat())
+		{
+			LOGERR("Provided buffer is not of valid dimensions or format in order to read from this texture.");
+
+			AsyncOp op;
+			op._completeOperation();
+			return op;
+		}
+
+		// Only a single face and a single mip level is copied, so the staging texture needs no array slices or mips
+		TEXTURE_DESC desc;
+		desc.type = props.getTextureType();
+		desc.format = props.getFormat();
+		desc.width = mipWidth;
+		desc.height = mipHeight;
+		desc.depth = mipDepth;
+		desc.numMips = 0;
+		desc.usage = TU_CPUREADABLE;
+		desc.hwGamma = props.isHardwareGammaEnabled();
+
+		ReadRequest request;
+		request.isTexture = true;
+		request.stagingIdx = allocStagingTexture(desc);
+		request.pixelData = data;
+		request.length = 0;
+		request.callback = callback;
+
+		// Multisampled surfaces get resolved as part of the copy
+		const SPtr<Texture>& stagingTexture = mStagingTextures[request.stagingIdx].texture;
+		texture->copy(stagingTexture, face, mipLevel, 0, 0);
+
+		queueRequest(request);
+		return request.op;
+	}
+
+	AsyncOp GpuReadbackManager::readBuffer(const SPtr<GpuBuffer>& buffer, UINT32 offset, UINT32 length,
+		const GpuReadbackCallback& callback)
+	{
+		if ((offset + length) > buffer->getSize())
+		{
+			LOGERR("Provided range is out of buffer bounds.");
+
+			AsyncOp op;
+			op._completeOperation(SPtr<MemoryDataStream>());
+			return op;
+		}
+
+		// Staging buffers are just raw memory, so the original buffer's layout doesn't matter
+		GPU_BUFFER_DESC desc;
+		desc.type = GBT_STANDARD;
+		desc.format = BF_32X1U;
+		desc.elementCount = (UINT32)Math::divideAndRoundUp((int)length, 4);
+		desc.elementSize = 0;
+		desc.usage = GBU_CPUREADABLE;
+
+		ReadRequest request;
+		request.isTexture = false;
+		request.stagingIdx = allocStagingBuffer(desc);
+		request.length = length;
+		request.callback = callback;
+
+		const SPtr<GpuBuffer>& stagingBuffer = mStagingBuffers[request.stagingIdx].buffer;
+		stagingBuffer->copyData(*buffer, offset, 0, length, true);
+
+		queueRequest(request);
+		return request.op;
+	}
+
+	void GpuReadbackManager::_update()
+	{
+		// Fences are signaled in order, so stop at the first one that isn't ready
+		while (!mRequests.empty())
+		{
+			ReadRequest& request = mRequests.front();
+			if (!request.fence->isReady())
+				break;
+
+			// GPU is done with the staging resource, so mapping it won't stall
+			if (request.isTexture)
+			{
+				StagingTexture& staging = mStagingTextures[request.stagingIdx];
+				staging.texture->readData(*request.pixelData);
+
+				staging.inUse = false;
+				staging.lastUsedFrame = mFrameIdx;
+
+				request.op._completeOperation();
+			}
+			else
+			{
+				StagingBuffer& staging = mStagingBuffers[request.stagingIdx];
+
+				SPtr<MemoryDataStream> output = bs_shared_ptr_new<MemoryDataStream>(request.length);
+				staging.buffer->readData(0, request.length, output->getPtr());
+
+				staging.inUse = false;
+				staging.lastUsedFrame = mFrameIdx;
+
+				request.op._completeOperation(output);
+			}
+
+			if (request.callback != nullptr)
+				request.callback();
+
+			mRequests.pop();
+		}
+
+		// Release staging resources that haven't been used in a while. Only entries at the end of the lists are
+		// released, since pending requests reference staging resources by index.
+		while (!mStagingTextures.empty())
+		{
+			const StagingTexture& staging = mStagingTextures.back();
+			if (staging.inUse || (mFrameIdx - staging.lastUsedFrame) < MAX_UNUSED_FRAMES)
+				break;
+
+			mStagingTextures.pop_back();
+		}
+
+		while (!mStagingBuffers.empty())
+		{
+			const StagingBuffer& staging = mStagingBuffers.back();
+			if (staging.inUse || (mFrameIdx - staging.lastUsedFrame) < MAX_UNUSED_FRAMES)
+				break;
+
+			mStagingBuffers.pop_back();
+		}
+
+		mFrameIdx++;
+	}
+
+	UINT32 GpuReadbackManager::allocStagingTexture(const TEXTURE_DESC& desc)
+	{
+		UINT32 numEntries = (UINT32)mStagingTextures.size();
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			StagingTexture& staging = mStagingTextures[i];
+			if (staging.inUse)
+				continue;
+
+			const TextureProperties& props = staging.texture->getProperties();
+			if (props.getTextureType() == desc.type && props.getFormat() == desc.format &&
+				props.getWidth() == desc.width && props.getHeight() == desc.height && props.getDepth() == desc.depth &&
+				props.isHardwareGammaEnabled() == desc.hwGamma)
+			{
+				staging.inUse = true;
+				return i;
+			}
+		}
+
+		StagingTexture staging;
+		staging.texture = Texture::create(desc);
+		staging.lastUsedFrame = mFrameIdx;
+		staging.inUse = true;
+
+		mStagingTextures.push_back(staging);
+		return numEntries;
+	}
+
+	UINT32 GpuReadbackManager::allocStagingBuffer(const GPU_BUFFER_DESC& desc)
+	{
+		UINT32 numEntries = (UINT32)mStagingBuffers.size();
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			StagingBuffer& staging = mStagingBuffers[i];
+			if (staging.inUse)
+				continue;
+
+			if (staging.buffer->getProperties().getElementCount() == desc.elementCount)
+			{
+				staging.inUse = true;
+				return i;
+			}
+		}
+
+		StagingBuffer staging;
+		staging.buffer = GpuBuffer::create(desc);
+		staging.lastUsedFrame = mFrameIdx;
+		staging.inUse = true;
+
+		mStagingBuffers.push_back(staging);
+		return numEntries;
+	}
+
+	void GpuReadbackManager::queueRequest(ReadRequest& request)
+	{
+		request.fence = EventQuery::create();
+		request.fence->begin();
+
+		mRequests.push(request);
+	}
+}}
@@ -6,6 +6,7 @@
 #include "BsRect2I.h"
 #include "BsDebug.h"
 #include "BsRenderWindowManager.h"
+#include "BsInputRecording.h"
 
 using namespace std::placeholders;
 
@@ -21,7 +22,7 @@ namespace bs
 	}
 
 	Input::Input()
-		:mPointerDoubleClicked(false), mLastPositionSet(false)
+		:mPointerDoubleClicked(false), mLastPositionSet(false), mPlaybackFrame(0), mIgnoreInput(false)
 	{ 
 		mOSInputHandler = bs_shared_ptr_new<OSInputHandler>();
 
@@ -39,24 +40,73 @@ namespace bs
 	}
 
 	Input::~Input()
-	{ }
+	{
+		// Make sure the sampling thread stops before the input handler is destroyed
+		mSampler = nullptr;
+	}
 
 	void Input::_registerRawInputHandler(SPtr<RawInputHandler> inputHandler)
 	{
 		if(mRawInputHandler != inputHandler)
 		{
+			UINT32 samplingRate = getSamplingRate();
+			mSampler = nullptr;
+
+			connectRawInputHandler(false);
 			mRawInputHandler = inputHandler;
 
 			if(mRawInputHandler != nullptr)
 			{
-				mRawInputHandler->onButtonDown.connect(std::bind(&Input::buttonDown, this, _1, _2, _3));
-				mRawInputHandler->onButtonUp.connect(std::bind(&Input::buttonUp, this, _1, _2, _3));
-
-				mRawInputHandler->onAxisMoved.connect(std::bind(&Input::axisMoved, this, _1, _2, _3));
+				if (samplingRate > 0)
+					mSampler = bs_shared_ptr_new<InputSampler>(mRawInputHandler, samplingRate);
+				else
+					connectRawInputHandler(true);
 			}
 		}
 	}
 
+	void Input::connectRawInputHandler(bool connect)
+	{
+		mRawButtonDownConn.disconnect();
+		mRawButtonUpConn.disconnect();
+		mRawAxisMovedConn.disconnect();
+
+		if (connect && mRawInputHandler != nullptr)
+		{
+			mRawButtonDownConn = mRawInputHandler->onButtonDown.connect(std::bind(&Input::buttonDown, this, _1, _2, _3));
+			mRawButtonUpConn = mRawInputHandler->onButtonUp.connect(std::bind(&Input::buttonUp, this, _1, _2, _3));
+
+			mRawAxisMovedConn = mRawInputHandler->onAxisMoved.connect(std::bind(&Input::axisMoved, this, _1, _2, _3));
+		}
+	}
+
+	void Input::setSamplingRate(UINT32 rate)
+	{
+		if (getSamplingRate() == rate)
+			return;
+
+		// Process anything sampled so far, so no events are lost
+		if (mSampler != nullptr)
+		{
+			processSampledEvents();
+			mSampler = nullptr;
+		}
+
+		if (mRawInputHandler == nullptr)
+		{
+			LOGERR("Raw input handler not initialized!");
+			return;
+		}
+
+		if (rate > 0)
+		{
+			connectRawInputHandler(false);
+			mSampler = bs_shared_ptr_new<InputSampler>(mRawInputHandler, rate);
+		}
+		else
+			connectRawInputHandler(true);
+	}
+
 	void Input::_update()
 	{
 		// Toggle states only remain active for a single frame before they are transitioned
@@ -90,11 +140,20 @@ namespace bs
 		mPointerDelta = Vector2I::ZERO; // Reset delta in case we don't receive any mouse input this frame
 		mPointerDoubleClicked = false;
 
+		if (mRecording != nullptr)
+			mRecording->beginFrame(gTime().getFrameDelta());
+
+		// Handlers still need to be updated during playback so their queued events don't pile up, but their events
+		// are discarded
+		mIgnoreInput = mPlayback != nullptr;
+
 		if(mRawInputHandler == nullptr)
 		{
 			LOGERR("Raw input handler not initialized!");
 			return;
 		}
+		else if (mSampler != nullptr)
+			processSampledEvents();
 		else
 			mRawInputHandler->_update();
 
@@ -105,6 +164,129 @@ namespace bs
 		}
 		else
 			mOSInputHandler->_update();
+
+		mIgnoreInput = false;
+
+		if (mPlayback != nullptr)
+			playbackFrame();
+	}
+
+	void Input::processSampledEvents()
+	{
+		SampledInputEvent event;
+		while (mSampler->pop(event))
+		{
+			switch (event.type)
+			{
+			case SampledInputEvent::Type::ButtonDown:
+				buttonDown(event.deviceIdx, (ButtonCode)event.code, event.timestamp);
+				break;
+			case SampledInputEvent::Type::ButtonUp:
+				buttonUp(event.deviceIdx, (ButtonCode)event.code, event.timestamp);
+				break;
+			case SampledInputEvent::Type::AxisMoved:
+			{
+				// Mouse is sampled multiple times per frame, so its relative movement needs to be summed up instead of
+				// replaced by the latest sample
+				RawAxisState state = event.axis;
+				if (event.code <= (UINT32)InputAxis::MouseZ)
+					state.rel += getAxisValue(event.code, event.deviceIdx);
+
+				axisMoved(event.deviceIdx, state, event.code);
+			}
+				break;
+			case SampledInputEvent::Type::Tick:
+				break;
+			}
+
+			mConsumedLook = event.look;
+		}
+	}
+
+	void Input::startRecording()
+	{
+		mRecording = bs_shared_ptr_new<InputRecording>();
+	}
+
+	SPtr<InputRecording> Input::stopRecording()
+	{
+		SPtr<InputRecording> recording = mRecording;
+		mRecording = nullptr;
+
+		return recording;
+	}
+
+	void Input::startPlayback(const SPtr<InputRecording>& recording)
+	{
+		mPlayback = recording;
+		mPlaybackFrame = 0;
+
+		if (mPlayback == nullptr || mPlayback->getNumFrames() == 0)
+		{
+			stopPlayback();
+			return;
+		}
+
+		// Time is updated before input, so the delta for a frame needs to be set during the frame before it
+		gTime()._setFixedFrameDelta(mPlayback->getFrame(0).delta);
+	}
+
+	void Input::stopPlayback()
+	{
+		mPlayback = nullptr;
+		mPlaybackFrame = 0;
+
+		gTime()._setFixedFrameDelta(0.0f);
+	}
+
+	void Input::playbackFrame()
+	{
+		if (mPlaybackFrame >= mPlayback->getNumFrames())
+		{
+			stopPlayback();
+			return;
+		}
+
+		const InputRecording::Frame& frame = mPlayback->getFrame(mPlaybackFrame);
+		for (UINT32 i = 0; i < frame.numEvents; i++)
+		{
+			const RecordedInputEvent& event = mPlayback->getEvent(frame.firstEvent + i);
+			switch (event.type)
+			{
+			case RecordedInputEvent::Type::ButtonDown:
+				buttonDown(event.deviceIdx, (ButtonCode)event.code, event.timestamp);
+				break;
+			case RecordedInputEvent::Type::ButtonUp:
+				buttonUp(event.deviceIdx, (ButtonCode)event.code, event.timestamp);
+				break;
+			case RecordedInputEvent::Type::AxisMoved:
+				axisMoved(event.deviceIdx, event.axis, event.code);
+				break;
+			case RecordedInputEvent::Type::PointerMoved:
+				cursorMoved(event.pointer);
+				break;
+			case RecordedInputEvent::Type::PointerDown:
+				cursorPressed(event.pointer);
+				break;
+			case RecordedInputEvent::Type::PointerUp:
+				cursorReleased(event.pointer);
+				break;
+			case RecordedInputEvent::Type::PointerDoubleClick:
+				cursorDoubleClick(event.pointer);
+				break;
+			case RecordedInputEvent::Type::TextInput:
+				charInput(event.code);
+				break;
+			case RecordedInputEvent::Type::Command:
+				inputCommandEntered((InputCommandType)event.code);
+				break;
+			}
+		}
+
+		mPlaybackFrame++;
+
+		if (mPlaybackFrame < mPlayback->getNumFrames())
+			gTime()._setFixedFrameDelta(mPlayback->getFrame(mPlaybackFrame).delta);
 	}
 
 	void Input::_triggerCallbacks()
@@ -153,7 +335,9 @@ namespace bs
 
 	void Input::inputWindowChanged(RenderWindow& win)
 	{
-		if(mRawInputHandler != nullptr)
+		if (mSampler != nullptr)
+			mSampler->inputWindowChanged(win);
+		else if(mRawInputHandler != nullptr)
 			mRawInputHandler->_inputWindowChanged(win);
 
 		if(mOSInputHandler != nullptr)
@@ -162,6 +346,12 @@ namespace bs
 
 	void Input::buttonDown(UINT32 deviceIdx, ButtonCode code, UINT64 timestamp)
 	{
+		if (mIgnoreInput)
+			return;
+
+		if (mRecording != nullptr)
+			mRecording->addEvent(RecordedInputEvent(RecordedInputEvent::Type::ButtonDown, deviceIdx, code, timestamp));
+
 		while (deviceIdx >= (UINT32)mDevices.size())
 			mDevices.push_back(DeviceData());
 
@@ -178,6 +368,12 @@ namespace bs
 
 	void Input::buttonUp(UINT32 deviceIdx, ButtonCode code, UINT64 timestamp)
 	{
+		if (mIgnoreInput)
+			return;
+
+		if (mRecording != nullptr)
+			mRecording->addEvent(RecordedInputEvent(RecordedInputEvent::Type::ButtonUp, deviceIdx, code, timestamp));
+
 		while (deviceIdx >= (UINT32)mDevices.size())
 			mDevices.push_back(DeviceData());
 
@@ -197,6 +393,12 @@ namespace bs
 
 	void Input::axisMoved(UINT32 deviceIdx, const RawAxisState& state, UINT32 axis)
 	{
+		if (mIgnoreInput)
+			return;
+
+		if (mRecording != nullptr)
+			mRecording->addEvent(RecordedInputEvent(deviceIdx, axis, state));
+
 		while (deviceIdx >= (UINT32)mDevices.size())
 			mDevices.push_back(DeviceData());
 
@@ -209,6 +411,12 @@ namespace bs
 
 	void Input::cursorMoved(const PointerEvent& event)
 	{
+		if (mIgnoreInput)
+			return;
+
+		if (mRecording != nullptr)
+			mRecording->addEvent(RecordedInputEvent(RecordedInputEvent::Type::PointerMoved, event));
+
 		mQueuedEvents.push_back(QueuedEvent(EventType::PointerMoved, (UINT32)mPointerMovedEvents.size()));
 		mPointerMovedEvents.push_back(event);
 
@@ -221,6 +429,12 @@ namespace bs
 
 	void Input::cursorPressed(const PointerEvent& event)
 	{
+		if (mIgnoreInput)
+			return;
+
+		if (mRecording != nullptr)
+			mRecording->addEvent(RecordedInputEvent(RecordedInputEvent::Type::PointerDown, event));
+
 		mPointerButtonStates[(UINT32)event.button] = ButtonState::ToggledOn;
 
 		mQueuedEvents.push_back(QueuedEvent(EventType::PointerDown, (UINT32)mPointerPressedEvents.size()));
@@ -229,6 +443,12 @@ namespace bs
 
 	void Input::cursorReleased(const PointerEvent& event)
 	{
+		if (mIgnoreInput)
+			return;
+
+		if (mRecording != nullptr)
+			mRecording->addEvent(RecordedInputEvent(RecordedInputEvent::Type::PointerUp, event));
+
 		if (mPointerButtonStates[(UINT32)event.button] == ButtonState::ToggledOn)
 			mPointerButtonStates[(UINT32)event.button] = ButtonState::ToggledOnOff;
 		else
@@ -240,6 +460,12 @@ namespace bs
 
 	void Input::cursorDoubleClick(const PointerEvent& event)
 	{
+		if (mIgnoreInput)
+			return;
+
+		if (mRecording != nullptr)
+			mRecording->addEvent(RecordedInputEvent(RecordedInputEvent::Type::PointerDoubleClick, event));
+
 		mPointerDoubleClicked = true;
 
 		mQueuedEvents.push_back(QueuedEvent(EventType::PointerDoubleClick, (UINT32)mPointerDoubleClickEvents.size()));
@@ -248,12 +474,24 @@ namespace bs
 
 	void Input::inputCommandEntered(InputCommandType commandType)
 	{
+		if (mIgnoreInput)
+			return;
+
+		if (mRecording != nullptr)
+			mRecording->addEvent(RecordedInputEvent(RecordedInputEvent::Type::Command, 0, (UINT32)commandType));
+
 		mQueuedEvents.push_back(QueuedEvent(EventType::Command, (UINT32)mCommandEvents.size()));
 		mCommandEvents.push_back(commandType);
 	}
 
 	void Input::charInput(UINT32 chr)
 	{
+		if (mIgnoreInput)
+			return;
+
+		if (mRecording != nullptr)
+			mRecording->addEvent(RecordedInputEvent(RecordedInputEvent::Type::TextInput, 0, chr));
+
 		TextInputEvent textInputEvent;
 		textInputEvent.textChar = chr;
 
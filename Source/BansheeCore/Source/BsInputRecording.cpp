@@ -0,0 +1,188 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsInputRecording.h"
+#include "BsFileSystem.h"
+#include "BsDataStream.h"
+#include "BsDebug.h"
+
+namespace bs
+{
+	const UINT32 InputRecording::FILE_MAGIC = 0x43455249; // "IREC"
+	const UINT32 InputRecording::FILE_VERSION = 0;
+
+	/** Writes a single value to the stream, in native byte order. */
+	template<class T>
+	static void writeValue(DataStream& stream, const T& value)
+	{
+		stream.write(&value, sizeof(value));
+	}
+
+	/** Reads a single value written by writeValue(). Returns false if the stream ended. */
+	template<class T>
+	static bool readValue(DataStream& stream, T& value)
+	{
+		return stream.read(&value, sizeof(value)) == sizeof(value);
+	}
+
+	void InputRecording::beginFrame(float delta)
+	{
+		Frame frame;
+		frame.delta = delta;
+		frame.firstEvent = (UINT32)mEvents.size();
+		frame.numEvents = 0;
+
+		mFrames.push_back(frame);
+	}
+
+	void InputRecording::addEvent(const RecordedInputEvent& event)
+	{
+		// Events received before the first frame was started are part of the first frame
+		if (mFrames.empty())
+			beginFrame(0.0f);
+
+		mEvents.push_back(event);
+		mFrames.back().numEvents++;
+	}
+
+	void InputRecording::save(const Path& path) const
+	{
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+		if (stream == nullptr)
+		{
+			LOGERR("Unable to save input recording to \"" + path.toString() + "\".");
+			return;
+		}
+
+		writeValue(*stream, FILE_MAGIC);
+		writeValue(*stream, FILE_VERSION);
+		writeValue(*stream, (UINT32)mFrames.size());
+		writeValue(*stream, (UINT32)mEvents.size());
+
+		for (auto& frame : mFrames)
+		{
+			writeValue(*stream, frame.delta);
+			writeValue(*stream, frame.numEvents);
+		}
+
+		for (auto& event : mEvents)
+		{
+			writeValue(*stream, (UINT32)event.type);
+			writeValue(*stream, event.deviceIdx);
+			writeValue(*stream, event.code);
+			writeValue(*stream, event.timestamp);
+			writeValue(*stream, event.axis.rel);
+			writeValue(*stream, event.axis.abs);
+
+			const PointerEvent& pointer = event.pointer;
+			writeValue(*stream, pointer.screenPos.x);
+			writeValue(*stream, pointer.screenPos.y);
+			writeValue(*stream, pointer.delta.x);
+			writeValue(*stream, pointer.delta.y);
+
+			UINT32 flags = 0;
+			for (UINT32 i = 0; i < (UINT32)PointerEventButton::Count; i++)
+				flags |= pointer.buttonStates[i] ? (1 << i) : 0;
+
+			flags |= pointer.shift ? 0x10 : 0;
+			flags |= pointer.control ? 0x20 : 0;
+			flags |= pointer.alt ? 0x40 : 0;
+
+			writeValue(*stream, flags);
+			writeValue(*stream, (UINT32)pointer.button);
+			writeValue(*stream, (UINT32)pointer.type);
+			writeValue(*stream, pointer.mouseWheelScrollAmount);
+		}
+
+		stream->close();
+	}
+
+	SPtr<InputRecording> InputRecording::load(const Path& path)
+	{
+		if (!FileSystem::isFile(path))
+		{
+			LOGERR("Input recording \"" + path.toString() + "\" doesn't exist.");
+			return nullptr;
+		}
+
+		SPtr<DataStream> stream = FileSystem::openFile(path);
+
+		UINT32 magic = 0, version = 0, numFrames = 0, numEvents = 0;
+		if (!readValue(*stream, magic) || !readValue(*stream, version) || magic != FILE_MAGIC || version != FILE_VERSION)
+		{
+			LOGERR("\"" + path.toString() + "\" is not a valid input recording.");
+			return nullptr;
+		}
+
+		// Guard against bogus counts, each frame and event takes up at least 8 bytes
+		if (!readValue(*stream, numFrames) || !readValue(*stream, numEvents) || 
+			((UINT64)numFrames + numEvents) * 8 > (UINT64)stream->size())
+		{
+			LOGERR("Input recording \"" + path.toString() + "\" is corrupt.");
+			return nullptr;
+		}
+
+		SPtr<InputRecording> recording = bs_shared_ptr_new<InputRecording>();
+		recording->mFrames.resize(numFrames);
+		recording->mEvents.resize(numEvents);
+
+		bool valid = true;
+		UINT32 firstEvent = 0;
+		for (auto& frame : recording->mFrames)
+		{
+			valid &= readValue(*stream, frame.delta);
+			valid &= readValue(*stream, frame.numEvents);
+
+			frame.firstEvent = firstEvent;
+			firstEvent += frame.numEvents;
+		}
+
+		valid &= firstEvent == numEvents;
+
+		for (auto& event : recording->mEvents)
+		{
+			if (!valid)
+				break;
+
+			UINT32 type = 0;
+			valid &= readValue(*stream, type);
+			valid &= readValue(*stream, event.deviceIdx);
+			valid &= readValue(*stream, event.code);
+			valid &= readValue(*stream, event.timestamp);
+			valid &= readValue(*stream, event.axis.rel);
+			valid &= readValue(*stream, event.axis.abs);
+
+			event.type = (RecordedInputEvent::Type)type;
+
+			PointerEvent& pointer = event.pointer;
+			valid &= readValue(*stream, pointer.screenPos.x);
+			valid &= readValue(*stream, pointer.screenPos.y);
+			valid &= readValue(*stream, pointer.delta.x);
+			valid &= readValue(*stream, pointer.delta.y);
+
+			UINT32 flags = 0, button = 0, pointerType = 0;
+			valid &= readValue(*stream, flags);
+			valid &= readValue(*stream, button);
+			valid &= readValue(*stream, pointerType);
+			valid &= readValue(*stream, pointer.mouseWheelScrollAmount);
+
+			for (UINT32 i = 0; i < (UINT32)PointerEventButton::Count; i++)
+				pointer.buttonStates[i] = (flags & (1 << i)) != 0;
+
+			pointer.shift = (flags & 0x10) != 0;
+			pointer.control = (flags & 0x20) != 0;
+			pointer.alt = (flags & 0x40) != 0;
+			pointer.button = (PointerEventButton)button;
+			pointer.type = (PointerEventType)pointerType;
+
+			valid &= button < (UINT32)PointerEventButton::Count;
+		}
+
+		if (!valid)
+		{
+			LOGERR("Input recording \"" + path.toString() + "\" is corrupt.");
+			return nullptr;
+		}
+
+		return recording;
+	}
+}
@@ -0,0 +1,177 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsInputSampler.h"
+#include "BsTime.h"
+#include "BsMath.h"
+
+#include <chrono>
+#include <thread>
+
+using namespace std::placeholders;
+
+namespace bs
+{
+	InputSampler::InputSampler(const SPtr<RawInputHandler>& inputHandler, UINT32 rate)
+		:mInputHandler(inputHandler), mRate(std::max(rate, 1U)), mShutdown(false), mSampleTime(0), mRightStick(BsZero)
+	{
+		mButtonDownConn = mInputHandler->onButtonDown.connect(std::bind(&InputSampler::buttonDown, this, _1, _2, _3));
+		mButtonUpConn = mInputHandler->onButtonUp.connect(std::bind(&InputSampler::buttonUp, this, _1, _2, _3));
+		mAxisMovedConn = mInputHandler->onAxisMoved.connect(std::bind(&InputSampler::axisMoved, this, _1, _2, _3));
+
+		mSampleTime = gTime().getTimePrecise();
+		mThread = ThreadPool::instance().run("InputSampler", std::bind(&InputSampler::run, this));
+	}
+
+	InputSampler::~InputSampler()
+	{
+		mShutdown.store(true);
+		mThread.blockUntilComplete();
+
+		mButtonDownConn.disconnect();
+		mButtonUpConn.disconnect();
+		mAxisMovedConn.disconnect();
+	}
+
+	bool InputSampler::pop(SampledInputEvent& event)
+	{
+		return mQueue.pop(event);
+	}
+
+	LookInput InputSampler::getLookInput() const
+	{
+		ScopedSpinLock lock(mPublishedLookLock);
+		return mPublishedLook;
+	}
+
+	void InputSampler::inputWindowChanged(RenderWindow& win)
+	{
+		Lock lock(mInputHandlerMutex);
+		mInputHandler->_inputWindowChanged(win);
+	}
+
+	void InputSampler::run()
+	{
+		typedef std::chrono::steady_clock Clock;
+
+		const Clock::duration interval = std::chrono::microseconds(1000000 / mRate);
+		Clock::time_point nextSample = Clock::now();
+
+		while (!mShutdown.load())
+		{
+			sample();
+
+			nextSample += interval;
+
+			// Don't try to catch up if we fell behind (e.g. the thread wasn't scheduled for a while)
+			Clock::time_point now = Clock::now();
+			if (nextSample < now)
+				nextSample = now;
+
+			std::this_thread::sleep_until(nextSample);
+		}
+	}
+
+	void InputSampler::sample()
+	{
+		UINT64 sampleTime = gTime().getTimePrecise();
+		float elapsed = (sampleTime - mSampleTime) / 1000000.0f;
+		mSampleTime = sampleTime;
+
+		// Stick only reports changes, so integrate its last known position over the time since the last sample
+		mLook.gamepad += mRightStick * elapsed;
+
+		{
+			Lock lock(mInputHandlerMutex);
+			mInputHandler->_update();
+		}
+
+		if (mLook.mouse != mLastQueuedLook.mouse || mLook.gamepad != mLastQueuedLook.gamepad)
+		{
+			SampledInputEvent event;
+			event.type = SampledInputEvent::Type::Tick;
+			event.sampleTime = mSampleTime;
+			event.look = mLook;
+
+			queueEvent(event);
+		}
+
+		ScopedSpinLock lock(mPublishedLookLock);
+		mPublishedLook = mLook;
+	}
+
+	void InputSampler::queueEvent(const SampledInputEvent& event)
+	{
+		mLastQueuedLook = event.look;
+
+		// Keep the events in order, so nothing new can go into the queue until the overflow buffer is emptied
+		UINT32 numFlushed = 0;
+		for (auto& entry : mOverflow)
+		{
+			if (!mQueue.push(entry))
+				break;
+
+			numFlushed++;
+		}
+
+		mOverflow.erase(mOverflow.begin(), mOverflow.begin() + numFlushed);
+
+		if (!mOverflow.empty() || !mQueue.push(event))
+			mOverflow.push_back(event);
+	}
+
+	void InputSampler::buttonDown(UINT32 deviceIdx, ButtonCode code, UINT64 timestamp)
+	{
+		SampledInputEvent event;
+		event.type = SampledInputEvent::Type::ButtonDown;
+		event.deviceIdx = deviceIdx;
+		event.code = (UINT32)code;
+		event.timestamp = timestamp;
+		event.sampleTime = mSampleTime;
+		event.look = mLook;
+
+		queueEvent(event);
+	}
+
+	void InputSampler::buttonUp(UINT32 deviceIdx, ButtonCode code, UINT64 timestamp)
+	{
+		SampledInputEvent event;
+		event.type = SampledInputEvent::Type::ButtonUp;
+		event.deviceIdx = deviceIdx;
+		event.code = (UINT32)code;
+		event.timestamp = timestamp;
+		event.sampleTime = mSampleTime;
+		event.look = mLook;
+
+		queueEvent(event);
+	}
+
+	void InputSampler::axisMoved(UINT32 deviceIdx, const RawAxisState& state, UINT32 axis)
+	{
+		if (deviceIdx == 0)
+		{
+			if (axis == (UINT32)InputAxis::MouseX)
+				mLook.mouse.x += state.rel;
+			else if (axis == (UINT32)InputAxis::MouseY)
+				mLook.mouse.y += state.rel;
+			else if (axis == (UINT32)InputAxis::RightStickX)
+				mRightStick.x = state.abs;
+			else if (axis == (UINT32)InputAxis::RightStickY)
+				mRightStick.y = state.abs;
+		}
+
+		// Mouse axes are reported on every update, no need to queue them if nothing moved
+		bool isMouseAxis = axis == (UINT32)InputAxis::MouseX || axis == (UINT32)InputAxis::MouseY;
+		if (isMouseAxis && state.rel == 0.0f)
+			return;
+
+		SampledInputEvent event;
+		event.type = SampledInputEvent::Type::AxisMoved;
+		event.deviceIdx = deviceIdx;
+		event.code = axis;
+		event.axis = state;
+		event.sampleTime = mSampleTime;
+		event.look = mLook;
+
+		queueEvent(event);
+	}
+}
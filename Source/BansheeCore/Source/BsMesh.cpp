@@ -163,6 +163,7 @@ namespace bs
 		UINT8* src = pixelData.getData();
 
 		memcpy(dest, src, pixelData.getSize());
+		mCachedDataVersion++;
 	}
 
 	void Mesh::readCachedData(MeshData& dest)
@@ -10,7 +10,15 @@ namespace bs
 
 	MorphShape::MorphShape(const String& name, float weight, const Vector<MorphVertex>& vertices)
 		:mName(name), mWeight(weight), mVertices(vertices)
-	{ }
+	{
+		sortVertices();
+	}
+
+	void MorphShape::sortVertices()
+	{
+		std::sort(mVertices.begin(), mVertices.end(), 
+			[](const MorphVertex& a, const MorphVertex& b) { return a.sourceIdx < b.sourceIdx; });
+	}
 
 	/** Creates a new morph shape from the provided set of vertices. */
 	SPtr<MorphShape> MorphShape::create(const String& name, float weight, const Vector<MorphVertex>& vertices)
@@ -8,8 +8,18 @@
 
 namespace bs
 {
+	/** Appends a description of the exceeded limit to the output, if the value is over a non-zero limit. */
+	template<class T>
+	static void checkLimit(StringStream& output, const char* name, T value, T limit)
+	{
+		if (limit == 0 || value <= limit)
+			return;
+
+		output << " " << name << ": " << value << " (limit " << limit << ").";
+	}
+
 	ProfilerGPU::ProfilerGPU()
-		:mIsFrameActive(false)
+		:mIsFrameActive(false), mRecordSamples(false), mNumSampleBudgets(0), mSamplesEnabled(false)
 	{ }
 
 	void ProfilerGPU::beginFrame()
@@ -20,7 +30,12 @@ namespace bs
 		mActiveFrame = ActiveFrame();
 
 		mActiveFrame.frameSample.sampleName = "Frame";
-		beginSampleInternal(mActiveFrame.frameSample);
+		beginSampleInternal(mActiveFrame.frameSample, true);
+
+		{
+			Lock lock(mBudgetMutex);
+			mRecordSamples = mSamplesEnabled.load(std::memory_order_relaxed) || mNumSampleBudgets > 0;
+		}
 
 		mIsFrameActive = true;
 	}
@@ -44,11 +59,17 @@ namespace bs
 		if (!mIsFrameActive)
 			BS_EXCEPT(InvalidStateException, "Cannot begin a sample because no frame is active.");
 
+		if (!mRecordSamples)
+		{
+			mActiveSampleIndexes.push(SKIPPED_SAMPLE);
+			return;
+		}
+
 		mActiveFrame.samples.push_back(ActiveSample());
 		ActiveSample& sample = mActiveFrame.samples.back();
 
 		sample.sampleName = name;
-		beginSampleInternal(sample);
+		beginSampleInternal(sample, false);
 
 		mActiveSampleIndexes.push((UINT32)mActiveFrame.samples.size() - 1);
 	}
@@ -59,6 +80,12 @@ namespace bs
 			return;
 
 		UINT32 lastSampleIdx = mActiveSampleIndexes.top();
+		if (lastSampleIdx == SKIPPED_SAMPLE)
+		{
+			mActiveSampleIndexes.pop();
+			return;
+		}
+
 		ActiveSample& sample = mActiveFrame.samples[lastSampleIdx];
 		if (sample.sampleName != name)
 		{
@@ -92,6 +119,33 @@ namespace bs
 		return report;
 	}
 
+	void ProfilerGPU::setBudget(const String& name, const GPUProfileBudget& budget)
+	{
+		Lock lock(mBudgetMutex);
+
+		auto iterFind = mBudgets.find(name);
+		if (iterFind == mBudgets.end())
+		{
+			iterFind = mBudgets.insert(std::make_pair(name, BudgetData())).first;
+
+			// Frame sample is always recorded, while others need sampling to be on
+			if (name != "Frame")
+				mNumSampleBudgets++;
+		}
+
+		BudgetData& budgetData = iterFind->second;
+		budgetData.budget = budget;
+		budgetData.exceeded = false;
+	}
+
+	void ProfilerGPU::clearBudget(const String& name)
+	{
+		Lock lock(mBudgetMutex);
+
+		if (mBudgets.erase(name) > 0 && name != "Frame")
+			mNumSampleBudgets--;
+	}
+
 	void ProfilerGPU::_update()
 	{
 		while (!mUnresolvedFrames.empty())
@@ -129,6 +183,7 @@ namespace bs
 			resolveSample(sample, newSample);
 		}
 
+		checkBudgets(report);
 		return report;
 	}
 
@@ -136,9 +191,13 @@ namespace bs
 	{
 		reportSample.name = String(sample.sampleName.c_str());
 		reportSample.timeMs = sample.activeTimeQuery->getTimeMs();
-		reportSample.numDrawnSamples = sample.activeOcclusionQuery->getNumSamples();
+		reportSample.numDrawnSamples = 0;
+
+		if (sample.activeOcclusionQuery != nullptr)
+			reportSample.numDrawnSamples = sample.activeOcclusionQuery->getNumSamples();
 
 		reportSample.numDrawCalls = (UINT32)(sample.endStats.numDrawCalls - sample.startStats.numDrawCalls);
+		reportSample.numComputeCalls = (UINT32)(sample.endStats.numComputeCalls - sample.startStats.numComputeCalls);
 		reportSample.numRenderTargetChanges = (UINT32)(sample.endStats.numRenderTargetChanges - sample.startStats.numRenderTargetChanges);
 		reportSample.numPresents = (UINT32)(sample.endStats.numPresents - sample.startStats.numPresents);
 		reportSample.numClears = (UINT32)(sample.endStats.numClears - sample.startStats.numClears);
@@ -152,30 +211,124 @@ namespace bs
 		reportSample.numVertexBufferBinds = (UINT32)(sample.endStats.numVertexBufferBinds - sample.startStats.numVertexBufferBinds);
 		reportSample.numIndexBufferBinds = (UINT32)(sample.endStats.numIndexBufferBinds - sample.startStats.numIndexBufferBinds);
 
+		reportSample.numStateCalls = (UINT32)(sample.endStats.numStateCalls - sample.startStats.numStateCalls);
+		reportSample.numFilteredStateCalls = (UINT32)(sample.endStats.numFilteredStateCalls - sample.startStats.numFilteredStateCalls);
+
 		reportSample.numResourceWrites = (UINT32)(sample.endStats.numResourceWrites - sample.startStats.numResourceWrites);
 		reportSample.numResourceReads = (UINT32)(sample.endStats.numResourceReads - sample.startStats.numResourceReads);
+		reportSample.numBytesWritten = sample.endStats.numBytesWritten - sample.startStats.numBytesWritten;
 
 		reportSample.numObjectsCreated = (UINT32)(sample.endStats.numObjectsCreated - sample.startStats.numObjectsCreated);
 		reportSample.numObjectsDestroyed = (UINT32)(sample.endStats.numObjectsDestroyed - sample.startStats.numObjectsDestroyed);
 
+		// Only report types that were actually used during the sample
+		for (UINT32 i = 0; i < RenderStatsData::MAX_RESOURCE_TYPES; i++)
+		{
+			const RenderStatsResourceData& start = sample.startStats.resources[i];
+			const RenderStatsResourceData& end = sample.endStats.resources[i];
+
+			GPUProfileResourceSample resourceSample;
+			resourceSample.numCreated = (UINT32)(end.numCreated - start.numCreated);
+			resourceSample.numDestroyed = (UINT32)(end.numDestroyed - start.numDestroyed);
+			resourceSample.numReads = (UINT32)(end.numReads - start.numReads);
+			resourceSample.numWrites = (UINT32)(end.numWrites - start.numWrites);
+			resourceSample.numBytesWritten = end.numBytesWritten - start.numBytesWritten;
+
+			if (resourceSample.numCreated == 0 && resourceSample.numDestroyed == 0 && resourceSample.numReads == 0 &&
+				resourceSample.numWrites == 0)
+				continue;
+
+			resourceSample.name = RenderStats::instance().getResourceTypeName(i);
+			if (resourceSample.name.empty())
+				resourceSample.name = "Type" + toString(i);
+
+			reportSample.resources.push_back(resourceSample);
+		}
+
 		mFreeTimerQueries.push(sample.activeTimeQuery);
-		mFreeOcclusionQueries.push(sample.activeOcclusionQuery);
+
+		if (sample.activeOcclusionQuery != nullptr)
+			mFreeOcclusionQueries.push(sample.activeOcclusionQuery);
 	}
 
-	void ProfilerGPU::beginSampleInternal(ActiveSample& sample)
+	void ProfilerGPU::checkBudgets(const GPUProfilerReport& report)
+	{
+		Lock lock(mBudgetMutex);
+
+		for (auto& entry : mBudgets)
+		{
+			// A sample can appear multiple times in a frame (e.g. once per view), so limits apply to the total
+			float timeMs = 0.0f;
+			UINT32 numDrawCalls = 0;
+			UINT32 numPrimitives = 0;
+			UINT32 numPipelineStateChanges = 0;
+			UINT32 numGpuParamBinds = 0;
+			UINT64 numBytesWritten = 0;
+
+			auto accumulate = [&](const GPUProfileSample& sample)
+			{
+				timeMs += sample.timeMs;
+				numDrawCalls += sample.numDrawCalls;
+				numPrimitives += sample.numPrimitives;
+				numPipelineStateChanges += sample.numPipelineStateChanges;
+				numGpuParamBinds += sample.numGpuParamBinds;
+				numBytesWritten += sample.numBytesWritten;
+			};
+
+			if (report.frameSample.name == entry.first)
+				accumulate(report.frameSample);
+
+			for (auto& sample : report.samples)
+			{
+				if (sample.name == entry.first)
+					accumulate(sample);
+			}
+
+			const GPUProfileBudget& budget = entry.second.budget;
+
+			StringStream exceeded;
+			checkLimit(exceeded, "GPU time (ms)", timeMs, budget.timeMs);
+			checkLimit(exceeded, "Draw calls", numDrawCalls, budget.numDrawCalls);
+			checkLimit(exceeded, "Primitives", numPrimitives, budget.numPrimitives);
+			checkLimit(exceeded, "Pipeline state changes", numPipelineStateChanges, budget.numPipelineStateChanges);
+			checkLimit(exceeded, "GPU parameter binds", numGpuParamBinds, budget.numGpuParamBinds);
+			checkLimit(exceeded, "Bytes written", numBytesWritten, budget.numBytesWritten);
+
+			String message = exceeded.str();
+			if (message.empty())
+			{
+				entry.second.exceeded = false;
+				continue;
+			}
+
+			// Only report once per streak of frames over budget, to avoid flooding the log
+			if (!entry.second.exceeded)
+				LOGWRN("GPU profiler sample \"" + entry.first + "\" exceeded its frame budget." + message);
+
+			entry.second.exceeded = true;
+		}
+	}
+
+	void ProfilerGPU::beginSampleInternal(ActiveSample& sample, bool countDrawnSamples)
 	{
 		sample.startStats = RenderStats::instance().getData();
 		sample.activeTimeQuery = getTimerQuery();
 		sample.activeTimeQuery->begin();
 
-		sample.activeOcclusionQuery = getOcclusionQuery();
-		sample.activeOcclusionQuery->begin();
+		if (countDrawnSamples)
+		{
+			sample.activeOcclusionQuery = getOcclusionQuery();
+			sample.activeOcclusionQuery->begin();
+		}
 	}
 
 	void ProfilerGPU::endSampleInternal(ActiveSample& sample)
 	{
 		sample.endStats = RenderStats::instance().getData();
-		sample.activeOcclusionQuery->end();
+
+		if (sample.activeOcclusionQuery != nullptr)
+			sample.activeOcclusionQuery->end();
+
 		sample.activeTimeQuery->end();
 	}
 
@@ -0,0 +1,30 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsRenderStats.h"
+
+namespace bs
+{
+	RenderStats::RenderStats()
+	{
+		setResourceTypeName(RenderStatObject_IndexBuffer, "IndexBuffer");
+		setResourceTypeName(RenderStatObject_VertexBuffer, "VertexBuffer");
+		setResourceTypeName(RenderStatObject_GpuBuffer, "GpuBuffer");
+		setResourceTypeName(RenderStatObject_GpuParamBuffer, "GpuParamBuffer");
+		setResourceTypeName(RenderStatObject_Texture, "Texture");
+		setResourceTypeName(RenderStatObject_GpuProgram, "GpuProgram");
+		setResourceTypeName(RenderStatObject_Query, "Query");
+
+		mResourceTypeNames[RenderStatsData::MAX_RESOURCE_TYPES - 1] = "Other";
+	}
+
+	void RenderStats::setResourceTypeName(UINT32 category, const String& name)
+	{
+		UINT32 idx = getResourceTypeIdx(category);
+
+		// Last entry is shared by all categories that don't fit
+		if (idx == (RenderStatsData::MAX_RESOURCE_TYPES - 1))
+			return;
+
+		mResourceTypeNames[idx] = name;
+	}
+}
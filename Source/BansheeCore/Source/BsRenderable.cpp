@@ -12,6 +12,7 @@
 #include "BsMorphShapes.h"
 #include "BsGpuBuffer.h"
 #include "BsAnimationManager.h"
+#include "BsBonePaletteBuffer.h"
 
 namespace bs
 {
@@ -432,7 +433,8 @@ namespace bs
 	namespace ct
 	{
 	Renderable::Renderable() 
-		:mRendererId(0), mAnimationId((UINT64)-1), mMorphShapeVersion(0)
+		:mRendererId(0), mAnimationId((UINT64)-1), mMorphShapeVersion(0), mBoneMatrixOffset(0)
+		, mPaletteAnimationId((UINT64)-1)
 	{
 	}
 
@@ -440,6 +442,9 @@ namespace bs
 	{
 		if (mIsActive)
 			gRenderer()->notifyRenderableRemoved(this);
+
+		if (mPaletteAnimationId != (UINT64)-1 && BonePaletteBuffer::isStarted())
+			BonePaletteBuffer::instance().unregisterAnimation(mPaletteAnimationId);
 	}
 
 	void Renderable::initialize()
@@ -481,6 +486,13 @@ namespace bs
 
 	void Renderable::createAnimationBuffers()
 	{
+		BonePaletteBuffer& palette = BonePaletteBuffer::instance();
+		if (mPaletteAnimationId != (UINT64)-1)
+		{
+			palette.unregisterAnimation(mPaletteAnimationId);
+			mPaletteAnimationId = (UINT64)-1;
+		}
+
 		if (mAnimType == RenderableAnimType::Skinned || mAnimType == RenderableAnimType::SkinnedMorph)
 		{
 			SPtr<Skeleton> skeleton = mMesh->getSkeleton();
@@ -488,27 +500,16 @@ namespace bs
 
 			if (numBones > 0)
 			{
-				GPU_BUFFER_DESC desc;
-				desc.elementCount = numBones * 3;
-				desc.elementSize = 0;
-				desc.type = GBT_STANDARD;
-				desc.format = BF_32X4F;
-				desc.usage = GBU_DYNAMIC;
-
-				SPtr<GpuBuffer> buffer = GpuBuffer::create(desc);
-				UINT8* dest = (UINT8*)buffer->lock(0, numBones * 3 * sizeof(Vector4), GBL_WRITE_ONLY_DISCARD);
-
-				// Initialize bone transforms to identity, so the object renders properly even if no animation is animating it
-				for (UINT32 i = 0; i < numBones; i++)
-				{
-					memcpy(dest, &Matrix4::IDENTITY, 12 * sizeof(float)); // Assuming row-major format
+				// Reference the identity transforms, so the object renders properly even if no animation is animating it
+				palette.reserveIdentityBones(numBones);
+				mBoneMatrixBuffer = palette.getBuffer();
 
-					dest += 12 * sizeof(float);
+				// Have the palette keep our last pose, so we're still posed when culled from animation evaluation
+				if (mAnimationId != (UINT64)-1)
+				{
+					palette.registerAnimation(mAnimationId);
+					mPaletteAnimationId = mAnimationId;
 				}
-
-				buffer->unlock();
-
-				mBoneMatrixBuffer = buffer;
 			}
 			else
 				mBoneMatrixBuffer = nullptr;
@@ -541,6 +542,7 @@ namespace bs
 			mMorphShapeBuffer = nullptr;
 
 		mMorphShapeVersion = 0;
+		mBoneMatrixOffset = 0;
 	}
 
 	void Renderable::updateAnimationBuffers(const RendererAnimationData& animData)
@@ -554,27 +556,18 @@ namespace bs
 		if (iterFind != animData.infos.end())
 			animInfo = &iterFind->second;
 
-		if (animInfo == nullptr)
-			return;
-
-		if (mAnimType == RenderableAnimType::Skinned || mAnimType == RenderableAnimType::SkinnedMorph)
+		if (mBoneMatrixBuffer != nullptr)
 		{
-			const RendererAnimationData::PoseInfo& poseInfo = animInfo->poseInfo;
+			// Poses are uploaded by the palette once per frame, just point to the relevant ones
+			BonePaletteBuffer& palette = BonePaletteBuffer::instance();
+			mBoneMatrixBuffer = palette.getBuffer();
 
-			// Note: If multiple elements are using the same animation (not possible atm), this buffer should be shared by
-			// all such elements
-			UINT8* dest = (UINT8*)mBoneMatrixBuffer->lock(0, poseInfo.numBones * 3 * sizeof(Vector4), GBL_WRITE_ONLY_DISCARD);
-			for (UINT32 j = 0; j < poseInfo.numBones; j++)
-			{
-				const Matrix4& transform = animData.transforms[poseInfo.startIdx + j];
-				memcpy(dest, &transform, 12 * sizeof(float)); // Assuming row-major format
-
-				dest += 12 * sizeof(float);
-			}
-
-			mBoneMatrixBuffer->unlock();
+			mBoneMatrixOffset = palette.getBoneOffset(mAnimationId);
 		}
 
+		if (animInfo == nullptr)
+			return;
+
 		if (mAnimType == RenderableAnimType::Morph || mAnimType == RenderableAnimType::SkinnedMorph)
 		{
 			if (mMorphShapeVersion != animInfo->morphShapeInfo.version)
@@ -0,0 +1,341 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsResourceCache.h"
+#include "BsResources.h"
+#include "BsResource.h"
+#include "BsTime.h"
+#include "BsRTTIType.h"
+
+using namespace std::placeholders;
+
+namespace bs
+{
+	ResourceCache::ResourceCache()
+	{
+		mResourceLoadedConn = gResources().onResourceLoaded.connect(
+			std::bind(&ResourceCache::onResourceLoaded, this, _1));
+		mResourceRequestedConn = gResources().onLoadedResourceRequested.connect(
+			std::bind(&ResourceCache::onResourceRequested, this, _1));
+		mResourceDestroyedConn = gResources().onResourceDestroyed.connect(
+			std::bind(&ResourceCache::onResourceDestroyed, this, _1));
+	}
+
+	ResourceCache::~ResourceCache()
+	{
+		mResourceLoadedConn.disconnect();
+		mResourceRequestedConn.disconnect();
+		mResourceDestroyedConn.disconnect();
+	}
+
+	void ResourceCache::setBudget(UINT32 typeId, UINT64 budget)
+	{
+		Lock lock(mMutex);
+		mTypes[typeId].budget = budget;
+	}
+
+	UINT64 ResourceCache::getBudget(UINT32 typeId) const
+	{
+		Lock lock(mMutex);
+
+		auto iterFind = mTypes.find(typeId);
+		if (iterFind == mTypes.end())
+			return 0;
+
+		return iterFind->second.budget;
+	}
+
+	void ResourceCache::setTotalBudget(UINT64 budget)
+	{
+		Lock lock(mMutex);
+		mTotalBudget = budget;
+	}
+
+	UINT64 ResourceCache::getTotalBudget() const
+	{
+		Lock lock(mMutex);
+		return mTotalBudget;
+	}
+
+	void ResourceCache::setMaxEvictionsPerFrame(UINT32 count)
+	{
+		Lock lock(mMutex);
+		mMaxEvictionsPerFrame = std::max(count, 1U);
+	}
+
+	UINT32 ResourceCache::getMaxEvictionsPerFrame() const
+	{
+		Lock lock(mMutex);
+		return mMaxEvictionsPerFrame;
+	}
+
+	void ResourceCache::setScanRate(UINT32 count)
+	{
+		Lock lock(mMutex);
+		mScanRate = std::max(count, 1U);
+	}
+
+	UINT32 ResourceCache::getScanRate() const
+	{
+		Lock lock(mMutex);
+		return mScanRate;
+	}
+
+	ResourceCacheStats ResourceCache::getStats() const
+	{
+		Lock lock(mMutex);
+
+		ResourceCacheStats output;
+		for (auto& entry : mTypes)
+		{
+			const ResourceCacheStats& stats = entry.second.stats;
+
+			output.numHits += stats.numHits;
+			output.numMisses += stats.numMisses;
+			output.numEvictions += stats.numEvictions;
+			output.bytesEvicted += stats.bytesEvicted;
+			output.numResident += stats.numResident;
+			output.residentBytes += stats.residentBytes;
+			output.numUnused += stats.numUnused;
+			output.unusedBytes += stats.unusedBytes;
+		}
+
+		return output;
+	}
+
+	ResourceCacheStats ResourceCache::getStats(UINT32 typeId) const
+	{
+		Lock lock(mMutex);
+
+		auto iterFind = mTypes.find(typeId);
+		if (iterFind == mTypes.end())
+			return ResourceCacheStats();
+
+		return iterFind->second.stats;
+	}
+
+	void ResourceCache::_update()
+	{
+		UINT64 curFrame = gTime().getFrameIdx();
+
+		Vector<EvictionCandidate> candidates;
+		{
+			Lock lock(mMutex);
+
+			// Register newly loaded resources
+			for (auto& resource : mNewResources)
+			{
+				if (!resource.isLoaded(false))
+					continue;
+
+				const String& uuid = resource.getUUID();
+				if (mResources.find(uuid) != mResources.end())
+					continue;
+
+				ResourceInfo info;
+				info.resource = resource;
+				info.typeId = resource->getRTTI()->getRTTIId();
+				info.size = resource->getSize();
+				info.lastUsedFrame = curFrame;
+				info.scanIdx = (UINT32)mScanOrder.size();
+
+				ResourceCacheStats& stats = mTypes[info.typeId].stats;
+				stats.numMisses++;
+				stats.numResident++;
+				stats.residentBytes += info.size;
+
+				mResources[uuid] = info;
+				mScanOrder.push_back(uuid);
+			}
+
+			mNewResources.clear();
+
+			// Resources that were requested again are in use, at least until the next scan proves otherwise
+			for (auto& uuid : mRequestedResources)
+			{
+				auto iterFind = mResources.find(uuid);
+				if (iterFind == mResources.end())
+					continue;
+
+				ResourceInfo& info = iterFind->second;
+				info.lastUsedFrame = curFrame;
+				markUsed(info);
+
+				mTypes[info.typeId].stats.numHits++;
+			}
+
+			mRequestedResources.clear();
+
+			// Check a portion of the resources for references outside of the resources system
+			UINT32 numToScan = std::min(mScanRate, (UINT32)mScanOrder.size());
+			for (UINT32 i = 0; i < numToScan; i++)
+			{
+				if (mNextScanIdx >= (UINT32)mScanOrder.size())
+					mNextScanIdx = 0;
+
+				const String& uuid = mScanOrder[mNextScanIdx++];
+				ResourceInfo& info = mResources[uuid];
+
+				bool isUnused = gResources().isUnused(uuid);
+				if (isUnused == info.isUnused)
+					continue;
+
+				if (isUnused)
+				{
+					info.lastUsedFrame = curFrame;
+					markUnused(uuid, info);
+				}
+				else
+					markUsed(info);
+			}
+
+			findEvictionCandidates(candidates);
+		}
+
+		// Unload outside of the lock, as unloading triggers onResourceDestroyed
+		for (auto& candidate : candidates)
+		{
+			if (!gResources().unloadIfUnused(candidate.uuid))
+				continue;
+
+			Lock lock(mMutex);
+
+			ResourceCacheStats& stats = mTypes[candidate.typeId].stats;
+			stats.numEvictions++;
+			stats.bytesEvicted += candidate.size;
+		}
+	}
+
+	void ResourceCache::findEvictionCandidates(Vector<EvictionCandidate>& candidates)
+	{
+		struct TypeEviction
+		{
+			TypeInfo* type;
+			List<String>::iterator next;
+		};
+
+		// Evict least recently used resources from types that are over their own budget
+		Vector<TypeEviction> types;
+		UINT64 totalResident = 0;
+		for (auto& entry : mTypes)
+		{
+			TypeInfo& type = entry.second;
+			totalResident += type.stats.residentBytes;
+
+			TypeEviction typeEviction = { &type, type.unusedLRU.begin() };
+			if (type.budget > 0)
+			{
+				UINT64 resident = type.stats.residentBytes;
+				while (resident > type.budget && typeEviction.next != type.unusedLRU.end())
+				{
+					if (candidates.size() >= mMaxEvictionsPerFrame)
+						return;
+
+					const ResourceInfo& info = mResources[*typeEviction.next];
+					candidates.push_back({ *typeEviction.next, info.typeId, info.size });
+
+					resident -= info.size;
+					totalResident -= info.size;
+					++typeEviction.next;
+				}
+			}
+
+			types.push_back(typeEviction);
+		}
+
+		if (mTotalBudget == 0)
+			return;
+
+		// Evict least recently used resources over all types until within the total budget
+		while (totalResident > mTotalBudget && candidates.size() < mMaxEvictionsPerFrame)
+		{
+			TypeEviction* oldest = nullptr;
+			UINT64 oldestFrame = std::numeric_limits<UINT64>::max();
+			for (auto& typeEviction : types)
+			{
+				if (typeEviction.next == typeEviction.type->unusedLRU.end())
+					continue;
+
+				UINT64 lastUsedFrame = mResources[*typeEviction.next].lastUsedFrame;
+				if (lastUsedFrame < oldestFrame)
+				{
+					oldest = &typeEviction;
+					oldestFrame = lastUsedFrame;
+				}
+			}
+
+			if (oldest == nullptr)
+				break;
+
+			const ResourceInfo& info = mResources[*oldest->next];
+			candidates.push_back({ *oldest->next, info.typeId, info.size });
+
+			totalResident -= info.size;
+			++oldest->next;
+		}
+	}
+
+	void ResourceCache::markUnused(const String& uuid, ResourceInfo& info)
+	{
+		if (info.isUnused)
+			return;
+
+		TypeInfo& type = mTypes[info.typeId];
+		info.lruIter = type.unusedLRU.insert(type.unusedLRU.end(), uuid);
+		info.isUnused = true;
+
+		type.stats.numUnused++;
+		type.stats.unusedBytes += info.size;
+	}
+
+	void ResourceCache::markUsed(ResourceInfo& info)
+	{
+		if (!info.isUnused)
+			return;
+
+		TypeInfo& type = mTypes[info.typeId];
+		type.unusedLRU.erase(info.lruIter);
+		info.isUnused = false;
+
+		type.stats.numUnused--;
+		type.stats.unusedBytes -= info.size;
+	}
+
+	void ResourceCache::onResourceLoaded(const HResource& resource)
+	{
+		Lock lock(mMutex);
+		mNewResources.push_back(resource.getWeak());
+	}
+
+	void ResourceCache::onResourceRequested(const HResource& resource)
+	{
+		Lock lock(mMutex);
+		mRequestedResources.push_back(resource.getUUID());
+	}
+
+	void ResourceCache::onResourceDestroyed(const String& uuid)
+	{
+		Lock lock(mMutex);
+
+		auto iterFind = mResources.find(uuid);
+		if (iterFind == mResources.end())
+			return;
+
+		ResourceInfo& info = iterFind->second;
+		markUsed(info);
+
+		ResourceCacheStats& stats = mTypes[info.typeId].stats;
+		stats.numResident--;
+		stats.residentBytes -= info.size;
+
+		// Swap with the last entry so the scan order remains contiguous
+		UINT32 scanIdx = info.scanIdx;
+		if (scanIdx != (UINT32)mScanOrder.size() - 1)
+		{
+			std::swap(mScanOrder[scanIdx], mScanOrder.back());
+			mResources[mScanOrder[scanIdx]].scanIdx = scanIdx;
+		}
+
+		mScanOrder.pop_back();
+		mResources.erase(iterFind);
+	}
+}
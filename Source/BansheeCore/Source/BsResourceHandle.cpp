@@ -9,8 +9,29 @@
 
 namespace bs
 {
-	Signal ResourceHandleBase::mResourceCreatedCondition;
-	Mutex ResourceHandleBase::mResourceCreatedMutex;
+	/** Signal used for waiting on resources to load. */
+	struct ResourceLoadedSignal
+	{
+		Mutex mutex;
+		Signal signal;
+	};
+
+	/** 
+	 * Handles are spread over multiple signals, so that threads waiting on different resources rarely contend for the
+	 * same mutex, and a finished load only wakes up threads waiting on a small subset of resources.
+	 */
+	static const UINT32 NUM_LOADED_SIGNALS = 64;
+	static ResourceLoadedSignal gLoadedSignals[NUM_LOADED_SIGNALS];
+
+	/** Returns the signal used for waiting on the resource with the provided handle data. */
+	static ResourceLoadedSignal& getLoadedSignal(const ResourceHandleData* data)
+	{
+		// Lowest bits are the same for all allocations due to alignment
+		UINT64 hash = (UINT64)(size_t)data >> 4;
+		hash ^= hash >> 12;
+
+		return gLoadedSignals[hash % NUM_LOADED_SIGNALS];
+	}
 
 	ResourceHandleBase::ResourceHandleBase()
 	{
@@ -24,7 +45,7 @@ namespace bs
 
 	bool ResourceHandleBase::isLoaded(bool checkDependencies) const 
 	{ 
-		bool isLoaded = (mData != nullptr && mData->mIsCreated && mData->mPtr != nullptr);
+		bool isLoaded = (mData != nullptr && mData->mIsCreated.load(std::memory_order_acquire) && mData->mPtr != nullptr);
 
 		if (checkDependencies && isLoaded)
 			isLoaded = mData->mPtr->areDependenciesLoaded();
@@ -37,12 +58,14 @@ namespace bs
 		if(mData == nullptr)
 			return;
 
-		if (!mData->mIsCreated)
+		if (!mData->mIsCreated.load(std::memory_order_acquire))
 		{
-			Lock lock(mResourceCreatedMutex);
-			while (!mData->mIsCreated)
+			ResourceLoadedSignal& loadedSignal = getLoadedSignal(mData.get());
+
+			Lock lock(loadedSignal.mutex);
+			while (!mData->mIsCreated.load(std::memory_order_acquire))
 			{
-				mResourceCreatedCondition.wait(lock);
+				loadedSignal.signal.wait(lock);
 			}
 
 			// Send out ResourceListener events right away, as whatever called this method
@@ -66,6 +89,26 @@ namespace bs
 		}
 	}
 
+	void ResourceHandleBase::notifyWhenLoaded(const std::function<void()>& callback) const
+	{
+		if (mData == nullptr)
+			return;
+
+		if (!mData->mIsCreated.load(std::memory_order_acquire))
+		{
+			ResourceLoadedSignal& loadedSignal = getLoadedSignal(mData.get());
+
+			Lock lock(loadedSignal.mutex);
+			if (!mData->mIsCreated.load(std::memory_order_relaxed))
+			{
+				mData->mLoadedCallbacks.push_back(callback);
+				return;
+			}
+		}
+
+		callback();
+	}
+
 	void ResourceHandleBase::release()
 	{
 		gResources().release(*this);
@@ -84,14 +127,22 @@ namespace bs
 		{
 			mData->mUUID = uuid;
 		
-			if(!mData->mIsCreated)
+			if(!mData->mIsCreated.load(std::memory_order_acquire))
 			{
-				Lock lock(mResourceCreatedMutex);
+				ResourceLoadedSignal& loadedSignal = getLoadedSignal(mData.get());
+
+				Vector<std::function<void()>> callbacks;
 				{
-					mData->mIsCreated = true; 
+					Lock lock(loadedSignal.mutex);
+					mData->mIsCreated.store(true, std::memory_order_release);
+
+					std::swap(callbacks, mData->mLoadedCallbacks);
 				}
 				
-				mResourceCreatedCondition.notify_all();
+				loadedSignal.signal.notify_all();
+
+				for (auto& callback : callbacks)
+					callback();
 			}
 		}
 	}
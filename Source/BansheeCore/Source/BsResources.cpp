@@ -148,6 +148,9 @@ namespace bs
 			}
 		}
 
+		if (alreadyLoading)
+			onLoadedResourceRequested(outputResource);
+
 		// Not loaded and not in progress, start loading of new resource
 		// (or if already loaded or in progress, load any dependencies)
 		if (!alreadyLoading)
@@ -392,11 +395,13 @@ namespace bs
 
 		// Read resource data
 		SPtr<IReflectable> loadedData;
+		UINT32 resourceDataSize = 0;
 		{
 			if(metaData && !stream->eof())
 			{
 				UINT32 objectSize = 0;
 				stream->read(&objectSize, sizeof(objectSize));
+				resourceDataSize = objectSize;
 
 				if (metaData->getCompressionMethod() != 0)
 					stream = Compression::decompress(stream);
@@ -417,6 +422,11 @@ namespace bs
 		}
 
 		SPtr<Resource> resource = std::static_pointer_cast<Resource>(loadedData);
+
+		// Resources that don't calculate their own size are assumed to take up as much memory as their serialized data
+		if (resource != nullptr && resource->mSize == 0)
+			resource->mSize = resourceDataSize;
+
 		return resource;
 	}
 
@@ -480,6 +490,42 @@ namespace bs
 		}
 	}
 
+	bool Resources::isUnused(const String& uuid)
+	{
+		Lock lock(mLoadedResourceMutex);
+		auto iterFind = mLoadedResources.find(uuid);
+		if (iterFind == mLoadedResources.end())
+			return false;
+
+		const LoadedResourceData& resData = iterFind->second;
+		return resData.numInternalRefs > 0 && resData.resource.mData->mRefCount == resData.numInternalRefs;
+	}
+
+	bool Resources::unloadIfUnused(const String& uuid)
+	{
+		HResource resource;
+		UINT32 numInternalRefs = 0;
+		{
+			Lock lock(mLoadedResourceMutex);
+			auto iterFind = mLoadedResources.find(uuid);
+			if (iterFind == mLoadedResources.end())
+				return false;
+
+			const LoadedResourceData& resData = iterFind->second;
+			if (resData.numInternalRefs == 0 || resData.resource.mData->mRefCount != resData.numInternalRefs)
+				return false;
+
+			resource = resData.resource.lock();
+			numInternalRefs = resData.numInternalRefs;
+		}
+
+		// Resource gets destroyed once the last (local) handle goes out of scope
+		for (UINT32 i = 0; i < numInternalRefs; i++)
+			release(resource);
+
+		return true;
+	}
+
 	void Resources::destroy(ResourceHandleBase& resource)
 	{
 		if (resource.mData == nullptr)
@@ -551,6 +597,24 @@ namespace bs
 				return; // Nothing to save
 		}
 
+		UINT32 compressionMethod = (compress && resource->isCompressible()) ? 1 : 0;
+
+		// Encode object data before touching the file, as resources that stream their data might still be reading it 
+		// from the file we're about to overwrite
+		SPtr<MemoryDataStream> objStream;
+		UINT32 objNumBytes = 0;
+		{
+			MemorySerializer ms;
+			UINT8* bytes = ms.encode(resource.get(), objNumBytes);
+
+			objStream = bs_shared_ptr_new<MemoryDataStream>(bytes, objNumBytes);
+			if (compressionMethod != 0)
+			{
+				SPtr<DataStream> srcStream = std::static_pointer_cast<DataStream>(objStream);
+				objStream = Compression::compress(srcStream);
+			}
+		}
+
 		bool fileExists = FileSystem::isFile(filePath);
 		if(fileExists)
 		{
@@ -576,7 +640,6 @@ namespace bs
 		for (UINT32 i = 0; i < (UINT32)dependencyList.size(); i++)
 			dependencyUUIDs[i] = dependencyList[i].resource.getUUID();
 
-		UINT32 compressionMethod = (compress && resource->isCompressible()) ? 1 : 0;
 		SPtr<SavedResourceData> resourceData = bs_shared_ptr_new<SavedResourceData>(dependencyUUIDs, 
 			resource->allowAsyncLoading(), compressionMethod);
 
@@ -602,21 +665,8 @@ namespace bs
 		}
 
 		// Write object data
-		{
-			MemorySerializer ms;
-			UINT32 numBytes = 0;
-			UINT8* bytes = ms.encode(resource.get(), numBytes);
-
-			SPtr<MemoryDataStream> objStream = bs_shared_ptr_new<MemoryDataStream>(bytes, numBytes);
-			if (compressionMethod != 0)
-			{
-				SPtr<DataStream> srcStream = std::static_pointer_cast<DataStream>(objStream);
-				objStream = Compression::compress(srcStream);
-			}
-
-			stream.write((char*)&numBytes, sizeof(numBytes));
-			stream.write((char*)objStream->getPtr(), objStream->size());
-		}
+		stream.write((char*)&objNumBytes, sizeof(objNumBytes));
+		stream.write((char*)objStream->getPtr(), objStream->size());
 
 		stream.close();
 		stream.clear();
@@ -171,9 +171,23 @@ namespace bs
 			rootObj->mPrefabLinkUUID = "";
 			rootObj->mPrefabDiff = nullptr;
 			PrefabUtility::clearPrefabIds(rootObj->getHandle(), true, false);
+
+			rootObj->notifyHierarchyChanged(SceneObjectChange::PrefabLink);
 		}
 	}
 
+	void SceneObject::_setPrefabLinkUUID(const String& UUID)
+	{
+		mPrefabLinkUUID = UUID;
+		notifyHierarchyChanged(SceneObjectChange::PrefabLink);
+	}
+
+	void SceneObject::setName(const String& name)
+	{
+		GameObject::setName(name);
+		notifyHierarchyChanged(SceneObjectChange::Name);
+	}
+
 	bool SceneObject::hasFlag(UINT32 flag) const
 	{
 		return (mFlags & flag) != 0;
@@ -616,6 +630,7 @@ namespace bs
 		mChildren.push_back(object); 
 
 		object->_setFlags(mFlags);
+		notifyHierarchyChanged(SceneObjectChange::Children);
 	}
 
 	void SceneObject::removeChild(const HSceneObject& object)
@@ -629,6 +644,8 @@ namespace bs
 			BS_EXCEPT(InternalErrorException, 
 				"Trying to remove a child but it's not a child of the transform.");
 		}
+
+		notifyHierarchyChanged(SceneObjectChange::Children);
 	}
 
 	HSceneObject SceneObject::findChild(const String& name, bool recursive)
@@ -680,6 +697,8 @@ namespace bs
 	{
 		mActiveSelf = active;
 		setActiveHierarchy(active);
+
+		notifyHierarchyChanged(SceneObjectChange::Active);
 	}
 
 	void SceneObject::setActiveHierarchy(bool active, bool triggerEvents) 
@@ -711,6 +730,15 @@ namespace bs
 		}
 	}
 
+	void SceneObject::notifyHierarchyChanged(SceneObjectChange change)
+	{
+		// Objects still being constructed, or not part of the scene (e.g. prefab contents) aren't reported
+		if (mThisHandle == nullptr || !isInstantiated() || !SceneManager::isStarted())
+			return;
+
+		gSceneManager().onHierarchyChanged(mThisHandle, change);
+	}
+
 	bool SceneObject::getActive(bool self)
 	{
 		if (self)
@@ -9,6 +9,9 @@
 #include "BsAsyncOp.h"
 #include "BsResources.h"
 #include "BsPixelUtil.h"
+#include "BsTextureManager.h"
+#include "BsTextureStreamingManager.h"
+#include "BsTaskScheduler.h"
 
 namespace bs 
 {
@@ -71,23 +74,31 @@ namespace bs
 	}
 
 	Texture::Texture()
+		: mFirstResidentMip(0), mStreamOffset(0), mStreamFormat(PF_UNKNOWN)
 	{
 
 	}
 
 	Texture::Texture(const TEXTURE_DESC& desc)
-		:mProperties(desc)
+		: mProperties(desc), mFirstResidentMip(0), mStreamOffset(0), mStreamFormat(PF_UNKNOWN)
     {
         
     }
 
 	Texture::Texture(const TEXTURE_DESC& desc, const SPtr<PixelData>& pixelData)
-		: mProperties(desc), mInitData(pixelData)
+		: mProperties(desc), mInitData(pixelData), mFirstResidentMip(0), mStreamOffset(0), mStreamFormat(PF_UNKNOWN)
 	{
 		if (mInitData != nullptr)
 			mInitData->_lock();
 	}
 
+	Texture::~Texture()
+	{
+		// Reading task references this object
+		if (mStreamTask != nullptr)
+			mStreamTask->wait();
+	}
+
 	void Texture::initialize()
 	{
 		mSize = calculateSize();
@@ -106,9 +117,8 @@ namespace bs
 
 	SPtr<ct::CoreObject> Texture::createCore() const
 	{
-		const TextureProperties& props = getProperties();
-
-		SPtr<ct::CoreObject> coreObj = ct::TextureManager::instance().createTextureInternal(props.mDesc, mInitData);
+		SPtr<ct::CoreObject> coreObj = ct::TextureManager::instance().createTextureInternal(
+			getResidentDesc(mFirstResidentMip), mInitData);
 
 		if ((mProperties.getUsage() & TU_CPUCACHED) == 0)
 			mInitData = nullptr;
@@ -121,6 +131,39 @@ namespace bs
 		UINT32 subresourceIdx = mProperties.mapToSubresourceIdx(face, mipLevel);
 		updateCPUBuffers(subresourceIdx, *data);
 
+		// Streamable textures keep a copy of the written data, since mip levels that aren't resident don't exist on the 
+		// core thread texture, and resident ones will be re-read from the source file if evicted and streamed in again
+		if (_isStreamable())
+		{
+			UINT32 mipWidth, mipHeight, mipDepth;
+			PixelUtil::getSizeForMipLevel(mProperties.getWidth(), mProperties.getHeight(), mProperties.getDepth(),
+				mipLevel, mipWidth, mipHeight, mipDepth);
+
+			if (data->getWidth() == mipWidth && data->getHeight() == mipHeight && data->getDepth() == mipDepth)
+			{
+				SPtr<PixelData> dataCopy = PixelData::create(mipWidth, mipHeight, mipDepth, mProperties.getFormat());
+				PixelUtil::bulkPixelConversion(*data, *dataCopy);
+
+				mWrittenMipData[subresourceIdx] = dataCopy;
+			}
+			else if (mipLevel < mFirstResidentMip)
+			{
+				LOGERR("Partial writes to mip levels that aren't resident are not supported.");
+			}
+			else
+			{
+				LOGWRN("Partial write to a streamed texture. Data will be lost if the mip level gets evicted.");
+			}
+
+			if (mipLevel < mFirstResidentMip)
+			{
+				AsyncOp op;
+				op._completeOperation();
+
+				return op;
+			}
+		}
+
 		data->_lock();
 
 		std::function<void(const SPtr<ct::Texture>&, UINT32, UINT32, const SPtr<PixelData>&, bool, AsyncOp&)> func =
@@ -133,12 +176,24 @@ namespace bs
 
 		};
 
-		return gCoreThread().queueReturnCommand(std::bind(func, getCore(), face, mipLevel,
+		return gCoreThread().queueReturnCommand(std::bind(func, getCore(), face, mipLevel - mFirstResidentMip,
 			data, discardEntireBuffer, std::placeholders::_1));
 	}
 
 	AsyncOp Texture::readData(const SPtr<PixelData>& data, UINT32 face, UINT32 mipLevel)
 	{
+		// Mip levels that aren't resident are read directly from the source file
+		if (mipLevel < mFirstResidentMip)
+		{
+			SPtr<PixelData> streamedData = getStreamedMip(mStreamData->clone(false), face, mipLevel);
+			PixelUtil::bulkPixelConversion(*streamedData, *data);
+
+			AsyncOp op;
+			op._completeOperation();
+
+			return op;
+		}
+
 		data->_lock();
 
 		std::function<void(const SPtr<ct::Texture>&, UINT32, UINT32, const SPtr<PixelData>&, AsyncOp&)> func =
@@ -154,16 +209,191 @@ namespace bs
 
 		};
 
-		return gCoreThread().queueReturnCommand(std::bind(func, getCore(), face, mipLevel,
+		return gCoreThread().queueReturnCommand(std::bind(func, getCore(), face, mipLevel - mFirstResidentMip,
 			data, std::placeholders::_1));
 	}
 
+	void Texture::_setFirstResidentMip(UINT32 firstMip)
+	{
+		if (!_isStreamable())
+			return;
+
+		firstMip = std::min(firstMip, mProperties.getNumMipmaps());
+		if (firstMip == mFirstResidentMip)
+			return;
+
+		// Evicting doesn't require any data, so it can be applied right away. Mip levels of a read still in progress
+		// will be discarded once it completes, since they no longer neighbor the resident levels.
+		if (firstMip > mFirstResidentMip)
+		{
+			applyResidentMips(firstMip, Vector<SPtr<PixelData>>());
+			return;
+		}
+
+		if (mStreamTask != nullptr)
+			return;
+
+		// Read the newly required mip levels from the source file on a worker, so the calling thread doesn't block on IO
+		UINT32 numFaces = mProperties.getNumFaces();
+		UINT32 endMip = mFirstResidentMip;
+
+		SPtr<DataStream> stream = mStreamData->clone(false);
+		SPtr<Vector<SPtr<PixelData>>> output = bs_shared_ptr_new<Vector<SPtr<PixelData>>>();
+
+		auto readMips = [this, stream, output, firstMip, endMip, numFaces]()
+		{
+			for (UINT32 mip = firstMip; mip < endMip; mip++)
+			{
+				for (UINT32 face = 0; face < numFaces; face++)
+					output->push_back(readStreamedMip(stream, face, mip));
+			}
+		};
+
+		mStreamTask = Task::create("StreamTextureMips", readMips);
+		mStreamTaskData = output;
+		mStreamTaskFirstMip = firstMip;
+		mStreamTaskEndMip = endMip;
+
+		TaskScheduler::instance().addTask(mStreamTask);
+	}
+
+	bool Texture::_updateResidentMips()
+	{
+		if (mStreamTask == nullptr || !mStreamTask->isComplete())
+			return false;
+
+		SPtr<Vector<SPtr<PixelData>>> newMipData = mStreamTaskData;
+		mStreamTask = nullptr;
+		mStreamTaskData = nullptr;
+
+		// Resident mip levels changed while reading
+		if (mStreamTaskEndMip != mFirstResidentMip)
+			return false;
+
+		applyResidentMips(mStreamTaskFirstMip, *newMipData);
+		return true;
+	}
+
+	void Texture::applyResidentMips(UINT32 firstMip, const Vector<SPtr<PixelData>>& newMipData)
+	{
+		UINT32 numFaces = mProperties.getNumFaces();
+		UINT32 numMips = mProperties.getNumMipmaps() + 1;
+		UINT32 oldFirstMip = mFirstResidentMip;
+
+		// Data provided through writeData() takes precedence over data from the source file
+		Vector<SPtr<PixelData>> uploadData;
+		for (UINT32 mip = firstMip; mip < oldFirstMip; mip++)
+		{
+			for (UINT32 face = 0; face < numFaces; face++)
+			{
+				SPtr<PixelData> pixelData;
+
+				auto iterFind = mWrittenMipData.find(mProperties.mapToSubresourceIdx(face, mip));
+				if (iterFind != mWrittenMipData.end())
+					pixelData = iterFind->second;
+				else
+					pixelData = newMipData[(mip - firstMip) * numFaces + face];
+
+				pixelData->_lock();
+				uploadData.push_back(pixelData);
+			}
+		}
+
+		SPtr<ct::Texture> oldCore = getCore();
+		SPtr<ct::Texture> newCore = ct::TextureManager::instance().createTextureInternal(getResidentDesc(firstMip), nullptr);
+
+		auto initializeCore = [=]()
+		{
+			newCore->initialize();
+
+			// Copy mip levels resident in both the old and the new texture
+			UINT32 firstSharedMip = std::max(firstMip, oldFirstMip);
+			for (UINT32 mip = firstSharedMip; mip < numMips; mip++)
+			{
+				for (UINT32 face = 0; face < numFaces; face++)
+					oldCore->copy(newCore, face, mip - oldFirstMip, face, mip - firstMip);
+			}
+
+			// Upload newly streamed mip levels
+			UINT32 idx = 0;
+			for (UINT32 mip = firstMip; mip < oldFirstMip; mip++)
+			{
+				for (UINT32 face = 0; face < numFaces; face++)
+				{
+					const SPtr<PixelData>& pixelData = uploadData[idx++];
+
+					newCore->writeData(*pixelData, mip - firstMip, face);
+					pixelData->_unlock();
+				}
+			}
+		};
+
+		// Note: The old core object is kept alive until the command executes, after which it will be released as soon as
+		// all the objects referencing it are updated
+		queueGpuCommand(newCore, initializeCore);
+
+		mCoreSpecific = newCore;
+		mFirstResidentMip = firstMip;
+	}
+
+	bool Texture::isCompressible() const
+	{
+		// Textures that could be streamed must have their mip levels individually readable from disk
+		return mProperties.getNumMipmaps() == 0 || !TextureStreamingManager::_canStream(mProperties);
+	}
+
 	UINT32 Texture::calculateSize() const
 	{
 		return mProperties.getNumFaces() * PixelUtil::getMemorySize(mProperties.getWidth(),
 			mProperties.getHeight(), mProperties.getDepth(), mProperties.getFormat());
 	}
 
+	TEXTURE_DESC Texture::getResidentDesc(UINT32 firstMip) const
+	{
+		TEXTURE_DESC desc = mProperties.mDesc;
+		if (firstMip == 0)
+			return desc;
+
+		PixelUtil::getSizeForMipLevel(mProperties.getWidth(), mProperties.getHeight(), mProperties.getDepth(), firstMip,
+			desc.width, desc.height, desc.depth);
+		desc.numMips -= firstMip;
+
+		return desc;
+	}
+
+	SPtr<PixelData> Texture::readStreamedMip(const SPtr<DataStream>& stream, UINT32 face, UINT32 mipLevel) const
+	{
+		UINT32 mipWidth, mipHeight, mipDepth;
+		PixelUtil::getSizeForMipLevel(mProperties.getWidth(), mProperties.getHeight(), mProperties.getDepth(),
+			mipLevel, mipWidth, mipHeight, mipDepth);
+
+		SPtr<PixelData> pixelData = PixelData::create(mipWidth, mipHeight, mipDepth, mStreamFormat);
+		UINT32 faceSize = pixelData->getConsecutiveSize();
+
+		stream->seek(mStreamOffset + mMipOffsets[mipLevel] + face * faceSize);
+		stream->read(pixelData->getData(), faceSize);
+
+		// Source data might be in a format not supported by the current render API
+		if (mStreamFormat != mProperties.getFormat())
+		{
+			SPtr<PixelData> convertedData = PixelData::create(mipWidth, mipHeight, mipDepth, mProperties.getFormat());
+			PixelUtil::bulkPixelConversion(*pixelData, *convertedData);
+
+			return convertedData;
+		}
+
+		return pixelData;
+	}
+
+	SPtr<PixelData> Texture::getStreamedMip(const SPtr<DataStream>& stream, UINT32 face, UINT32 mipLevel) const
+	{
+		auto iterFind = mWrittenMipData.find(mProperties.mapToSubresourceIdx(face, mipLevel));
+		if (iterFind != mWrittenMipData.end())
+			return iterFind->second;
+
+		return readStreamedMip(stream, face, mipLevel);
+	}
+
 	void Texture::updateCPUBuffers(UINT32 subresourceIdx, const PixelData& pixelData)
 	{
 		if ((mProperties.getUsage() & TU_CPUCACHED) == 0)
@@ -0,0 +1,291 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsTextureStreamingManager.h"
+#include "BsTexture.h"
+#include "BsResources.h"
+#include "BsTime.h"
+#include "BsMath.h"
+#include "BsRTTIType.h"
+
+using namespace std::placeholders;
+
+namespace bs
+{
+	TextureStreamingManager::TextureStreamingManager()
+	{
+		mResourceLoadedConn = gResources().onResourceLoaded.connect(
+			std::bind(&TextureStreamingManager::onResourceLoaded, this, _1));
+		mResourceDestroyedConn = gResources().onResourceDestroyed.connect(
+			std::bind(&TextureStreamingManager::onResourceDestroyed, this, _1));
+	}
+
+	TextureStreamingManager::~TextureStreamingManager()
+	{
+		mResourceLoadedConn.disconnect();
+		mResourceDestroyedConn.disconnect();
+	}
+
+	void TextureStreamingManager::_update()
+	{
+		UINT64 curFrame = gTime().getFrameIdx();
+
+		// Register any newly loaded textures and retrieve usage reported by the renderer
+		UnorderedMap<const ct::Texture*, float> usage;
+		{
+			Lock lock(mMutex);
+
+			for (auto& texture : mNewTextures)
+			{
+				if (!texture.isLoaded(false))
+					continue;
+
+				TextureInfo info;
+				info.texture = texture;
+				info.core = texture->getCore().get();
+				info.firstResidentMip = texture->_getFirstResidentMip();
+				info.requestedMip = info.firstResidentMip;
+				info.lastUsedFrame = curFrame;
+
+				mCoreToUUID[info.core] = texture.getUUID();
+				mTextures[texture.getUUID()] = info;
+			}
+
+			mNewTextures.clear();
+			std::swap(usage, mUsage);
+		}
+
+		mNumTextures = (UINT32)mTextures.size();
+
+		for (auto& entry : usage)
+		{
+			auto iterFindUUID = mCoreToUUID.find(entry.first);
+			if (iterFindUUID == mCoreToUUID.end())
+				continue;
+
+			TextureInfo& info = mTextures[iterFindUUID->second];
+			if (info.lastUsedFrame != curFrame)
+			{
+				info.lastUsedFrame = curFrame;
+				info.screenSize = 0.0f;
+			}
+
+			info.screenSize = std::max(info.screenSize, entry.second);
+		}
+
+		// Apply mip levels that finished reading since the last update
+		for (auto& entry : mTextures)
+		{
+			TextureInfo& info = entry.second;
+			if (!info.texture.isLoaded(false) || !info.texture->_isReadingMips())
+				continue;
+
+			if (info.texture->_updateResidentMips())
+				onResidentMipsChanged(info);
+		}
+
+		// Determine the mip level each texture requires, depending on the number of texels it covers on screen
+		struct Request
+		{
+			TextureInfo* info;
+			const TextureProperties* props;
+			UINT32 mipTail;
+		};
+
+		Vector<Request> requests;
+		requests.reserve(mTextures.size());
+
+		mStats = TextureStreamingStats();
+		for (auto& entry : mTextures)
+		{
+			TextureInfo& info = entry.second;
+			if (!info.texture.isLoaded(false))
+				continue;
+
+			const TextureProperties& props = info.texture->getProperties();
+			UINT32 mipTail = _getMipTail(props);
+
+			if ((curFrame - info.lastUsedFrame) > mEvictionDelay || info.screenSize <= 0.0f)
+				info.requestedMip = mipTail;
+			else
+			{
+				float texSize = (float)std::max(props.getWidth(), props.getHeight());
+				float mip = Math::log2(texSize / info.screenSize);
+
+				info.requestedMip = (UINT32)Math::clamp(Math::floorToInt(mip), 0, (INT32)mipTail);
+			}
+
+			mStats.numTextures++;
+			mStats.requestedMemory += calcResidentSize(props, info.requestedMip);
+
+			requests.push_back({ &info, &props, mipTail });
+		}
+
+		// If over budget, drop the most detailed mip levels of textures that were least recently used, or cover the least
+		// amount of screen space
+		if (mStats.requestedMemory > mMemoryBudget)
+		{
+			std::sort(requests.begin(), requests.end(),
+				[](const Request& a, const Request& b)
+			{
+				if (a.info->lastUsedFrame != b.info->lastUsedFrame)
+					return a.info->lastUsedFrame < b.info->lastUsedFrame;
+
+				return a.info->screenSize < b.info->screenSize;
+			});
+
+			UINT64 requestedMemory = mStats.requestedMemory;
+			bool anyReduced = true;
+			while (requestedMemory > mMemoryBudget && anyReduced)
+			{
+				anyReduced = false;
+				for (auto& request : requests)
+				{
+					TextureInfo& info = *request.info;
+					if (info.requestedMip >= request.mipTail)
+						continue;
+
+					UINT64 oldSize = calcResidentSize(*request.props, info.requestedMip);
+					info.requestedMip++;
+					UINT64 newSize = calcResidentSize(*request.props, info.requestedMip);
+
+					requestedMemory -= oldSize - newSize;
+					anyReduced = true;
+
+					if (requestedMemory <= mMemoryBudget)
+						break;
+				}
+			}
+		}
+
+		// Evict first so the memory is available for any mip levels that need to be streamed in
+		for (auto& request : requests)
+		{
+			TextureInfo& info = *request.info;
+			if (info.requestedMip > info.firstResidentMip)
+			{
+				mStats.mipsEvicted += info.requestedMip - info.firstResidentMip;
+				setResidentMips(info, info.requestedMip);
+			}
+		}
+
+		// Stream in new mip levels, one level per texture per frame, until the per-frame limit is reached
+		for (auto& request : requests)
+		{
+			TextureInfo& info = *request.info;
+			if (info.requestedMip >= info.firstResidentMip || info.texture->_isReadingMips())
+				continue;
+
+			if (mStats.bytesStreamedIn > 0 && mStats.bytesStreamedIn >= mMaxBytesPerFrame)
+				break;
+
+			UINT32 newMip = info.firstResidentMip - 1;
+			UINT64 sizeDiff = calcResidentSize(*request.props, newMip) - calcResidentSize(*request.props, newMip + 1);
+
+			setResidentMips(info, newMip);
+			mStats.bytesStreamedIn += (UINT32)sizeDiff;
+		}
+
+		for (auto& request : requests)
+			mStats.residentMemory += calcResidentSize(*request.props, request.info->firstResidentMip);
+	}
+
+	void TextureStreamingManager::setResidentMips(TextureInfo& info, UINT32 firstMip)
+	{
+		const WeakResourceHandle<Texture>& texture = info.texture;
+		texture->_setFirstResidentMip(firstMip);
+
+		if (texture->_getFirstResidentMip() != info.firstResidentMip)
+			onResidentMipsChanged(info);
+	}
+
+	void TextureStreamingManager::onResidentMipsChanged(TextureInfo& info)
+	{
+		const WeakResourceHandle<Texture>& texture = info.texture;
+		mCoreToUUID.erase(info.core);
+
+		info.core = texture->getCore().get();
+		info.firstResidentMip = texture->_getFirstResidentMip();
+
+		mCoreToUUID[info.core] = texture.getUUID();
+
+		// Notify listeners (e.g. materials) so they start referencing the new core thread texture object
+		gResources().onResourceModified(gResources()._getResourceHandle(texture.getUUID()));
+	}
+
+	void TextureStreamingManager::_notifyTextureUsage(const UnorderedMap<const ct::Texture*, float>& usage)
+	{
+		Lock lock(mMutex);
+
+		for (auto& entry : usage)
+		{
+			auto iterFind = mUsage.find(entry.first);
+			if (iterFind == mUsage.end())
+				mUsage[entry.first] = entry.second;
+			else
+				iterFind->second = std::max(iterFind->second, entry.second);
+		}
+	}
+
+	UINT32 TextureStreamingManager::_getMipTail(const TextureProperties& props) const
+	{
+		UINT32 width = props.getWidth();
+		UINT32 height = props.getHeight();
+
+		UINT32 mip = 0;
+		while (mip < props.getNumMipmaps() && std::max(width, height) > mMipTailSize)
+		{
+			width = std::max(1U, width / 2);
+			height = std::max(1U, height / 2);
+
+			mip++;
+		}
+
+		return mip;
+	}
+
+	bool TextureStreamingManager::_canStream(const TextureProperties& props)
+	{
+		return props.getTextureType() == TEX_TYPE_2D && (props.getUsage() & ~TU_STATIC) == 0;
+	}
+
+	UINT64 TextureStreamingManager::calcResidentSize(const TextureProperties& props, UINT32 firstMip)
+	{
+		UINT64 size = 0;
+		for (UINT32 mip = firstMip; mip <= props.getNumMipmaps(); mip++)
+		{
+			UINT32 mipWidth, mipHeight, mipDepth;
+			PixelUtil::getSizeForMipLevel(props.getWidth(), props.getHeight(), props.getDepth(), mip,
+				mipWidth, mipHeight, mipDepth);
+
+			size += PixelUtil::getMemorySize(mipWidth, mipHeight, mipDepth, props.getFormat());
+		}
+
+		return size * props.getNumFaces();
+	}
+
+	void TextureStreamingManager::onResourceLoaded(const HResource& resource)
+	{
+		if (resource->getRTTI()->getRTTIId() != TID_Texture)
+			return;
+
+		HTexture texture = static_resource_cast<Texture>(resource);
+		if (!texture->_isStreamable())
+			return;
+
+		// Note: Can be called from worker threads
+		Lock lock(mMutex);
+		mNewTextures.push_back(texture.getWeak());
+	}
+
+	void TextureStreamingManager::onResourceDestroyed(const String& uuid)
+	{
+		auto iterFind = mTextures.find(uuid);
+		if (iterFind == mTextures.end())
+			return;
+
+		mCoreToUUID.erase(iterFind->second.core);
+		mTextures.erase(iterFind);
+
+		mNumTextures = (UINT32)mTextures.size();
+	}
+}
@@ -0,0 +1,902 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsFolderMonitor.h"
+#include "BsFileSystem.h"
+#include "BsException.h"
+#include "BsDebug.h"
+
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <poll.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <chrono>
+
+namespace bs
+{
+	/** Time to wait for more changes after the last detected change, before reporting the changes. */
+	static const UINT64 COALESCE_DELAY_MS = 250;
+
+	/** Maximum time to delay reporting of changes, in case changes keep being made without a pause. */
+	static const UINT64 MAX_COALESCE_DELAY_MS = 2000;
+
+	/**
+	 * Time to wait for the second half of a move notification. If it doesn't arrive the entry was moved outside of the
+	 * monitored folders.
+	 */
+	static const UINT64 MOVE_TIMEOUT_MS = 100;
+
+	/** Returns time in milliseconds from an arbitrary point, for measuring time intervals. */
+	static UINT64 getTimeMs()
+	{
+		return (UINT64)std::chrono::duration_cast<std::chrono::milliseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	/** Converts a path into a string form used for identifying folders, without a trailing separator. */
+	static String toFolderString(const Path& path)
+	{
+		String output = path.toString();
+		while (output.size() > 1 && output.back() == '/')
+			output.pop_back();
+
+		return output;
+	}
+
+	/** Checks is @p path equal to, or located within, @p folder. */
+	static bool isInFolder(const String& path, const String& folder)
+	{
+		if (path.size() < folder.size() || path.compare(0, folder.size(), folder) != 0)
+			return false;
+
+		return path.size() == folder.size() || path[folder.size()] == '/';
+	}
+
+	enum class FileActionType
+	{
+		Added,
+		Removed,
+		Modified,
+		Renamed
+	};
+
+	struct FileAction
+	{
+		FileAction(FileActionType type, const String& path, bool isDirectory, const String& oldPath = StringUtil::BLANK)
+			:type(type), oldPath(oldPath), path(path), isDirectory(isDirectory)
+		{ }
+
+		FileActionType type;
+		String oldPath;
+		String path;
+		bool isDirectory;
+	};
+
+	/**
+	 * Merges file actions reported in a single batch, so that each entry is reported only once, and entries within added
+	 * or removed folders aren't reported at all (the folder notification covers them).
+	 */
+	static void coalesceActions(const Vector<FileAction>& actions, Vector<FileAction>& output)
+	{
+		UnorderedMap<String, UINT32> lastActions; // Path -> index of the last action for that path in the output
+		Vector<bool> dropped;
+
+		auto addAction = [&](const FileAction& action)
+		{
+			auto iterFind = lastActions.find(action.path);
+			if (iterFind != lastActions.end())
+			{
+				UINT32 idx = iterFind->second;
+				FileAction& existing = output[idx];
+
+				switch (existing.type)
+				{
+				case FileActionType::Added:
+					// Added and removed within the same batch, no need to report anything
+					if (action.type == FileActionType::Removed)
+					{
+						dropped[idx] = true;
+						lastActions.erase(iterFind);
+					}
+
+					return;
+				case FileActionType::Removed:
+					// Replaced files are reported as modified, but replaced folders need to be re-added from scratch
+					if (action.type != FileActionType::Removed && !action.isDirectory && !existing.isDirectory)
+					{
+						existing.type = FileActionType::Modified;
+						return;
+					}
+
+					if (action.type == FileActionType::Removed)
+						return;
+
+					break;
+				case FileActionType::Modified:
+					if (action.type == FileActionType::Removed)
+						existing.type = FileActionType::Removed;
+
+					if (action.type != FileActionType::Added || !action.isDirectory)
+						return;
+
+					break;
+				case FileActionType::Renamed:
+					break;
+				}
+			}
+
+			lastActions[action.path] = (UINT32)output.size();
+			output.push_back(action);
+			dropped.push_back(false);
+		};
+
+		for (auto& action : actions)
+		{
+			if (action.type != FileActionType::Renamed)
+			{
+				addAction(action);
+				continue;
+			}
+
+			auto iterFind = lastActions.find(action.oldPath);
+			if (iterFind != lastActions.end())
+			{
+				UINT32 idx = iterFind->second;
+				lastActions.erase(iterFind);
+
+				// Added and renamed within the same batch, report it as added under the new name
+				if (output[idx].type == FileActionType::Added)
+				{
+					dropped[idx] = true;
+					addAction(FileAction(FileActionType::Added, action.path, action.isDirectory));
+
+					continue;
+				}
+			}
+
+			lastActions[action.path] = (UINT32)output.size();
+			output.push_back(action);
+			dropped.push_back(false);
+		}
+
+		UnorderedSet<String> replacedFolders;
+		for (UINT32 i = 0; i < (UINT32)output.size(); i++)
+		{
+			const FileAction& action = output[i];
+			if (dropped[i] || !action.isDirectory)
+				continue;
+
+			if (action.type == FileActionType::Added || action.type == FileActionType::Removed)
+				replacedFolders.insert(action.path);
+		}
+
+		UINT32 numActions = 0;
+		for (UINT32 i = 0; i < (UINT32)output.size(); i++)
+		{
+			if (dropped[i])
+				continue;
+
+			bool isInReplacedFolder = false;
+			if (!replacedFolders.empty())
+			{
+				const String& path = output[i].path;
+
+				size_t separatorIdx = path.rfind('/');
+				while (separatorIdx != String::npos && separatorIdx > 0)
+				{
+					if (replacedFolders.find(path.substr(0, separatorIdx)) != replacedFolders.end())
+					{
+						isInReplacedFolder = true;
+						break;
+					}
+
+					separatorIdx = path.rfind('/', separatorIdx - 1);
+				}
+			}
+
+			if (isInReplacedFolder)
+				continue;
+
+			if (numActions != i)
+				output[numActions] = output[i];
+
+			numActions++;
+		}
+
+		output.erase(output.begin() + numActions, output.end());
+	}
+
+	struct FolderMonitor::FolderWatchInfo
+	{
+		FolderWatchInfo(const String& folderToMonitor, bool monitorSubdirectories, UINT32 changeFilter, UINT32 watchMask)
+			:mFolderToMonitor(folderToMonitor), mMonitorSubdirectories(monitorSubdirectories), mChangeFilter(changeFilter)
+			, mWatchMask(watchMask)
+		{ }
+
+		/** Checks should additions, removals and renames of the file or folder be reported. */
+		bool reportsNames(bool isDirectory) const
+		{
+			UINT32 flag = isDirectory ? (UINT32)FolderChange::DirName : (UINT32)FolderChange::FileName;
+			return (mChangeFilter & flag) != 0;
+		}
+
+		/** Checks should creation of the file or folder be reported. */
+		bool reportsCreation(bool isDirectory) const
+		{
+			return reportsNames(isDirectory) || (mChangeFilter & (UINT32)FolderChange::Creation) != 0;
+		}
+
+		String mFolderToMonitor;
+		bool mMonitorSubdirectories;
+		UINT32 mChangeFilter;
+		UINT32 mWatchMask;
+	};
+
+	struct FolderMonitor::Pimpl
+	{
+		/** Folder watched by a single inotify watch. */
+		struct WatchedFolder
+		{
+			String path;
+			FolderWatchInfo* owner;
+		};
+
+		/** First half of a move notification, waiting for the second half. */
+		struct PendingMove
+		{
+			UINT32 cookie;
+			String path;
+			bool isDirectory;
+			bool report;
+			UINT64 time;
+		};
+
+		static const UINT32 READ_BUFFER_SIZE = 65536;
+
+		/** Starts watching the provided folder, and optionally all of its subfolders. Caller must hold the main mutex. */
+		void addWatches(FolderWatchInfo& watchInfo, const String& folder, bool recursive);
+
+		/** Stops watching the provided folder and all its subfolders. Caller must hold the main mutex. */
+		void removeWatches(const String& folder);
+
+		/** Updates watches after a folder was moved or renamed. Caller must hold the main mutex. */
+		void moveWatches(FolderWatchInfo& watchInfo, const String& oldFolder, const String& newFolder);
+
+		/**
+		 * Looks for changes that might have been missed because the event queue overflowed. Restores any missing
+		 * watches and outputs actions for all entries modified since @p syncTime. Caller must hold the main mutex.
+		 */
+		void rescan(FolderWatchInfo& watchInfo, std::time_t syncTime, Vector<FileAction>& actions);
+
+		/** Scans a single folder as part of rescan(). */
+		void rescanFolder(FolderWatchInfo& watchInfo, const String& folder, std::time_t syncTime,
+			Vector<FileAction>& actions);
+
+		/**
+		 * Resolves any moves whose second half didn't arrive in time as removals. Only called by the worker thread.
+		 * Caller must hold the main mutex.
+		 */
+		void resolvePendingMoves(UINT64 time, Vector<FileAction>& actions);
+
+		/** Queues actions for reporting on the next call to _update(). */
+		void queueActions(const Vector<FileAction>& actions);
+
+		Vector<FolderWatchInfo*> mFoldersToWatch;
+		int mInotifyHandle;
+		int mShutdownPipe[2];
+
+		UnorderedMap<int, WatchedFolder> mWatches; // Watch descriptor -> folder
+		UnorderedMap<String, int> mWatchHandles; // Folder -> watch descriptor
+
+		// Only accessed by the worker thread
+		Vector<PendingMove> mPendingMoves;
+		std::time_t mLastSyncTime;
+		alignas(inotify_event) UINT8 mBuffer[READ_BUFFER_SIZE];
+
+		Vector<FileAction> mFileActions;
+		UINT64 mFirstActionTime;
+		UINT64 mLastActionTime;
+
+		Mutex mMainMutex;
+		Thread* mWorkerThread;
+	};
+
+	void FolderMonitor::Pimpl::addWatches(FolderWatchInfo& watchInfo, const String& folder, bool recursive)
+	{
+		int handle = inotify_add_watch(mInotifyHandle, folder.c_str(), watchInfo.mWatchMask);
+		if (handle == -1)
+		{
+			if (errno == ENOSPC)
+			{
+				LOGWRN("Ran out of inotify watches while monitoring folder \"" + folder + "\". Increase the "
+					"fs.inotify.max_user_watches limit to monitor all folders.");
+			}
+			else
+				LOGWRN("Failed to monitor folder \"" + folder + "\". Error code: " + toString(errno));
+
+			return;
+		}
+
+		// Folder might already be watched, in which case the same descriptor is returned
+		auto iterFind = mWatches.find(handle);
+		if (iterFind != mWatches.end())
+			mWatchHandles.erase(iterFind->second.path);
+
+		mWatches[handle] = { folder, &watchInfo };
+		mWatchHandles[folder] = handle;
+
+		if (!recursive)
+			return;
+
+		DIR* dir = opendir(folder.c_str());
+		if (dir == nullptr)
+			return;
+
+		while (dirent* entry = readdir(dir))
+		{
+			// Skip hidden entries, including "." and ".."
+			if (entry->d_name[0] == '.')
+				continue;
+
+			String path = folder + "/" + entry->d_name;
+
+			bool isDirectory = entry->d_type == DT_DIR;
+			if (entry->d_type == DT_UNKNOWN)
+			{
+				struct stat info;
+				isDirectory = lstat(path.c_str(), &info) == 0 && S_ISDIR(info.st_mode);
+			}
+
+			if (isDirectory)
+				addWatches(watchInfo, path, true);
+		}
+
+		closedir(dir);
+	}
+
+	void FolderMonitor::Pimpl::removeWatches(const String& folder)
+	{
+		for (auto iter = mWatches.begin(); iter != mWatches.end();)
+		{
+			if (isInFolder(iter->second.path, folder))
+			{
+				inotify_rm_watch(mInotifyHandle, iter->first);
+				mWatchHandles.erase(iter->second.path);
+
+				iter = mWatches.erase(iter);
+			}
+			else
+				++iter;
+		}
+	}
+
+	void FolderMonitor::Pimpl::moveWatches(FolderWatchInfo& watchInfo, const String& oldFolder, const String& newFolder)
+	{
+		if (!watchInfo.mMonitorSubdirectories)
+		{
+			removeWatches(oldFolder);
+			return;
+		}
+
+		// Watches follow the folder, only the paths need updating
+		bool foundWatch = false;
+		for (auto& entry : mWatches)
+		{
+			WatchedFolder& watchedFolder = entry.second;
+			if (!isInFolder(watchedFolder.path, oldFolder))
+				continue;
+
+			mWatchHandles.erase(watchedFolder.path);
+
+			watchedFolder.path = newFolder + watchedFolder.path.substr(oldFolder.size());
+			watchedFolder.owner = &watchInfo;
+
+			mWatchHandles[watchedFolder.path] = entry.first;
+			foundWatch = true;
+		}
+
+		if (!foundWatch)
+			addWatches(watchInfo, newFolder, true);
+	}
+
+	void FolderMonitor::Pimpl::rescan(FolderWatchInfo& watchInfo, std::time_t syncTime, Vector<FileAction>& actions)
+	{
+		Vector<String> removedFolders;
+		for (auto& entry : mWatches)
+		{
+			const WatchedFolder& watchedFolder = entry.second;
+			if (watchedFolder.owner != &watchInfo)
+				continue;
+
+			struct stat info;
+			if (stat(watchedFolder.path.c_str(), &info) != 0 || !S_ISDIR(info.st_mode))
+				removedFolders.push_back(watchedFolder.path);
+		}
+
+		for (auto& folder : removedFolders)
+		{
+			if (mWatchHandles.find(folder) == mWatchHandles.end())
+				continue; // Already removed along with its parent
+
+			removeWatches(folder);
+
+			if (watchInfo.reportsNames(true))
+				actions.push_back(FileAction(FileActionType::Removed, folder, true));
+		}
+
+		rescanFolder(watchInfo, watchInfo.mFolderToMonitor, syncTime, actions);
+	}
+
+	void FolderMonitor::Pimpl::rescanFolder(FolderWatchInfo& watchInfo, const String& folder, std::time_t syncTime,
+		Vector<FileAction>& actions)
+	{
+		DIR* dir = opendir(folder.c_str());
+		if (dir == nullptr)
+			return;
+
+		while (dirent* entry = readdir(dir))
+		{
+			if (entry->d_name[0] == '.')
+				continue;
+
+			String path = folder + "/" + entry->d_name;
+
+			struct stat info;
+			if (lstat(path.c_str(), &info) != 0)
+				continue;
+
+			bool isDirectory = S_ISDIR(info.st_mode);
+			if (isDirectory && watchInfo.mMonitorSubdirectories)
+			{
+				// Folder created while the notifications were lost, everything in it is new
+				if (mWatchHandles.find(path) == mWatchHandles.end())
+				{
+					addWatches(watchInfo, path, true);
+
+					if (watchInfo.reportsCreation(true))
+						actions.push_back(FileAction(FileActionType::Added, path, true));
+
+					continue;
+				}
+			}
+
+			// Allow for some imprecision in file system timestamps
+			if (info.st_mtime >= (syncTime - 1) || info.st_ctime >= (syncTime - 1))
+				actions.push_back(FileAction(FileActionType::Modified, path, isDirectory));
+
+			if (isDirectory && watchInfo.mMonitorSubdirectories)
+				rescanFolder(watchInfo, path, syncTime, actions);
+		}
+
+		closedir(dir);
+	}
+
+	void FolderMonitor::Pimpl::resolvePendingMoves(UINT64 time, Vector<FileAction>& actions)
+	{
+		for (auto iter = mPendingMoves.begin(); iter != mPendingMoves.end();)
+		{
+			if ((time - iter->time) < MOVE_TIMEOUT_MS)
+			{
+				++iter;
+				continue;
+			}
+
+			// Moved outside of the monitored folders
+			if (iter->isDirectory)
+				removeWatches(iter->path);
+
+			if (iter->report)
+				actions.push_back(FileAction(FileActionType::Removed, iter->path, iter->isDirectory));
+
+			iter = mPendingMoves.erase(iter);
+		}
+	}
+
+	void FolderMonitor::Pimpl::queueActions(const Vector<FileAction>& actions)
+	{
+		if (actions.empty())
+			return;
+
+		UINT64 time = getTimeMs();
+
+		Lock lock(mMainMutex);
+		if (mFileActions.empty())
+			mFirstActionTime = time;
+
+		mLastActionTime = time;
+		mFileActions.insert(mFileActions.end(), actions.begin(), actions.end());
+	}
+
+	FolderMonitor::FolderMonitor()
+	{
+		mPimpl = bs_new<Pimpl>();
+		mPimpl->mWorkerThread = nullptr;
+		mPimpl->mInotifyHandle = -1;
+		mPimpl->mShutdownPipe[0] = -1;
+		mPimpl->mShutdownPipe[1] = -1;
+		mPimpl->mLastSyncTime = 0;
+		mPimpl->mFirstActionTime = 0;
+		mPimpl->mLastActionTime = 0;
+	}
+
+	FolderMonitor::~FolderMonitor()
+	{
+		stopMonitorAll();
+		bs_delete(mPimpl);
+	}
+
+	void FolderMonitor::startMonitor(const Path& folderPath, bool subdirectories, FolderChange changeFilter)
+	{
+		if(!FileSystem::isDirectory(folderPath))
+		{
+			LOGERR("Provided path \"" + folderPath.toString() + "\" is not a directory");
+			return;
+		}
+
+		if(mPimpl->mInotifyHandle == -1)
+		{
+			mPimpl->mInotifyHandle = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+			if(mPimpl->mInotifyHandle == -1)
+			{
+				BS_EXCEPT(InternalErrorException, "Failed to initialize inotify for folder monitoring. Error code: " +
+					toString(errno));
+			}
+
+			if(pipe2(mPimpl->mShutdownPipe, O_CLOEXEC) != 0)
+			{
+				close(mPimpl->mInotifyHandle);
+				mPimpl->mInotifyHandle = -1;
+
+				BS_EXCEPT(InternalErrorException, "Failed to create a pipe for folder monitoring. Error code: " +
+					toString(errno));
+			}
+		}
+
+		UINT32 filter = (UINT32)changeFilter;
+		UINT32 watchMask = IN_ONLYDIR | IN_EXCL_UNLINK;
+
+		if((filter & ((UINT32)FolderChange::FileName | (UINT32)FolderChange::DirName)) != 0)
+			watchMask |= IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO;
+
+		if((filter & (UINT32)FolderChange::Creation) != 0)
+			watchMask |= IN_CREATE | IN_MOVED_TO;
+
+		if((filter & ((UINT32)FolderChange::Attributes | (UINT32)FolderChange::Security)) != 0)
+			watchMask |= IN_ATTRIB;
+
+		if((filter & ((UINT32)FolderChange::Size | (UINT32)FolderChange::LastWrite)) != 0)
+			watchMask |= IN_MODIFY | IN_CLOSE_WRITE;
+
+		if((filter & (UINT32)FolderChange::LastAccess) != 0)
+			watchMask |= IN_ACCESS;
+
+		// Needed for keeping track of subfolders, even if they don't get reported
+		if(subdirectories)
+			watchMask |= IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO;
+
+		FolderWatchInfo* watchInfo = bs_new<FolderWatchInfo>(toFolderString(folderPath), subdirectories, filter, watchMask);
+
+		{
+			Lock lock(mPimpl->mMainMutex);
+
+			mPimpl->mFoldersToWatch.push_back(watchInfo);
+			mPimpl->addWatches(*watchInfo, watchInfo->mFolderToMonitor, subdirectories);
+		}
+
+		if(mPimpl->mWorkerThread == nullptr)
+		{
+			mPimpl->mLastSyncTime = std::time(nullptr);
+			mPimpl->mWorkerThread = bs_new<Thread>(std::bind(&FolderMonitor::workerThreadMain, this));
+
+			if(mPimpl->mWorkerThread == nullptr)
+			{
+				stopMonitor(folderPath);
+				BS_EXCEPT(InternalErrorException, "Failed to create a new worker thread for folder monitoring");
+			}
+		}
+	}
+
+	void FolderMonitor::stopMonitor(const Path& folderPath)
+	{
+		String folder = toFolderString(folderPath);
+
+		{
+			Lock lock(mPimpl->mMainMutex);
+
+			auto findIter = std::find_if(mPimpl->mFoldersToWatch.begin(), mPimpl->mFoldersToWatch.end(),
+				[&](const FolderWatchInfo* x) { return x->mFolderToMonitor == folder; });
+
+			if(findIter != mPimpl->mFoldersToWatch.end())
+			{
+				FolderWatchInfo* watchInfo = *findIter;
+
+				for (auto iter = mPimpl->mWatches.begin(); iter != mPimpl->mWatches.end();)
+				{
+					if (iter->second.owner == watchInfo)
+					{
+						inotify_rm_watch(mPimpl->mInotifyHandle, iter->first);
+						mPimpl->mWatchHandles.erase(iter->second.path);
+
+						iter = mPimpl->mWatches.erase(iter);
+					}
+					else
+						++iter;
+				}
+
+				bs_delete(watchInfo);
+				mPimpl->mFoldersToWatch.erase(findIter);
+			}
+		}
+
+		if(mPimpl->mFoldersToWatch.size() == 0)
+			stopMonitorAll();
+	}
+
+	void FolderMonitor::stopMonitorAll()
+	{
+		if(mPimpl->mWorkerThread != nullptr)
+		{
+			char value = 0;
+			while (write(mPimpl->mShutdownPipe[1], &value, 1) == -1 && errno == EINTR)
+			{ }
+
+			mPimpl->mWorkerThread->join();
+			bs_delete(mPimpl->mWorkerThread);
+			mPimpl->mWorkerThread = nullptr;
+		}
+
+		// No need for mutex since we know worker thread is shut down by now
+		for(auto& watchInfo : mPimpl->mFoldersToWatch)
+			bs_delete(watchInfo);
+
+		mPimpl->mFoldersToWatch.clear();
+		mPimpl->mWatches.clear();
+		mPimpl->mWatchHandles.clear();
+		mPimpl->mPendingMoves.clear();
+
+		if(mPimpl->mInotifyHandle != -1)
+		{
+			// Closing the instance also releases all of its watches
+			close(mPimpl->mInotifyHandle);
+			mPimpl->mInotifyHandle = -1;
+		}
+
+		for(auto& handle : mPimpl->mShutdownPipe)
+		{
+			if(handle != -1)
+			{
+				close(handle);
+				handle = -1;
+			}
+		}
+	}
+
+	void FolderMonitor::workerThreadMain()
+	{
+		pollfd handles[2];
+		handles[0].fd = mPimpl->mInotifyHandle;
+		handles[0].events = POLLIN;
+		handles[1].fd = mPimpl->mShutdownPipe[0];
+		handles[1].events = POLLIN;
+
+		while(true)
+		{
+			// Only need to wake up on our own if there are moves that might need to time out
+			int timeout = mPimpl->mPendingMoves.empty() ? -1 : (int)MOVE_TIMEOUT_MS;
+
+			handles[0].revents = 0;
+			handles[1].revents = 0;
+
+			int result = poll(handles, 2, timeout);
+			if(result == -1)
+			{
+				if(errno == EINTR)
+					continue;
+
+				LOGERR("Folder monitor failed waiting for notifications. Error code: " + toString(errno));
+				break;
+			}
+
+			if((handles[1].revents & POLLIN) != 0)
+				break;
+
+			if((handles[0].revents & POLLIN) != 0)
+				handleNotifications();
+			else if(!mPimpl->mPendingMoves.empty())
+			{
+				Vector<FileAction> actions;
+
+				{
+					Lock lock(mPimpl->mMainMutex);
+					mPimpl->resolvePendingMoves(getTimeMs(), actions);
+				}
+
+				mPimpl->queueActions(actions);
+			}
+		}
+	}
+
+	void FolderMonitor::handleNotifications()
+	{
+		Vector<FileAction> actions;
+		bool overflow = false;
+
+		std::time_t readTime = std::time(nullptr);
+		UINT64 time = getTimeMs();
+
+		{
+			Lock lock(mPimpl->mMainMutex);
+
+			while(true)
+			{
+				ssize_t numBytes = read(mPimpl->mInotifyHandle, mPimpl->mBuffer, Pimpl::READ_BUFFER_SIZE);
+				if(numBytes <= 0)
+					break;
+
+				UINT8* end = mPimpl->mBuffer + numBytes;
+				for(UINT8* ptr = mPimpl->mBuffer; ptr < end;)
+				{
+					const inotify_event* event = (const inotify_event*)ptr;
+					ptr += sizeof(inotify_event) + event->len;
+
+					if((event->mask & IN_Q_OVERFLOW) != 0)
+					{
+						overflow = true;
+						continue;
+					}
+
+					auto iterFind = mPimpl->mWatches.find(event->wd);
+					if(iterFind == mPimpl->mWatches.end())
+						continue;
+
+					// Watch was removed (e.g. the folder was deleted)
+					if((event->mask & IN_IGNORED) != 0)
+					{
+						mPimpl->mWatchHandles.erase(iterFind->second.path);
+						mPimpl->mWatches.erase(iterFind);
+
+						continue;
+					}
+
+					// Events for the watched folder itself get reported through its parent
+					if(event->len == 0)
+						continue;
+
+					// Ignore notifications about hidden files
+					if(event->name[0] == '.')
+						continue;
+
+					FolderWatchInfo& watchInfo = *iterFind->second.owner;
+					String path = iterFind->second.path + "/" + event->name;
+					bool isDirectory = (event->mask & IN_ISDIR) != 0;
+
+					if((event->mask & IN_CREATE) != 0)
+					{
+						// Anything created in the folder before the watch was added is reported as part of the folder
+						if(isDirectory && watchInfo.mMonitorSubdirectories)
+							mPimpl->addWatches(watchInfo, path, true);
+
+						if(watchInfo.reportsCreation(isDirectory))
+							actions.push_back(FileAction(FileActionType::Added, path, isDirectory));
+					}
+
+					if((event->mask & IN_DELETE) != 0)
+					{
+						if(watchInfo.reportsNames(isDirectory))
+							actions.push_back(FileAction(FileActionType::Removed, path, isDirectory));
+					}
+
+					if((event->mask & (IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB | IN_ACCESS)) != 0)
+						actions.push_back(FileAction(FileActionType::Modified, path, isDirectory));
+
+					if((event->mask & IN_MOVED_FROM) != 0)
+					{
+						Pimpl::PendingMove move;
+						move.cookie = event->cookie;
+						move.path = path;
+						move.isDirectory = isDirectory;
+						move.report = watchInfo.reportsNames(isDirectory);
+						move.time = time;
+
+						mPimpl->mPendingMoves.push_back(move);
+					}
+
+					if((event->mask & IN_MOVED_TO) != 0)
+					{
+						auto iterMove = std::find_if(mPimpl->mPendingMoves.begin(), mPimpl->mPendingMoves.end(),
+							[&](const Pimpl::PendingMove& x) { return x.cookie == event->cookie; });
+
+						if(iterMove != mPimpl->mPendingMoves.end())
+						{
+							if(isDirectory)
+								mPimpl->moveWatches(watchInfo, iterMove->path, path);
+
+							if(iterMove->report || watchInfo.reportsNames(isDirectory))
+							{
+								actions.push_back(FileAction(FileActionType::Renamed, path, isDirectory,
+									iterMove->path));
+							}
+
+							mPimpl->mPendingMoves.erase(iterMove);
+						}
+						else // Moved in from outside of the monitored folders
+						{
+							if(isDirectory && watchInfo.mMonitorSubdirectories)
+								mPimpl->addWatches(watchInfo, path, true);
+
+							if(watchInfo.reportsCreation(isDirectory))
+								actions.push_back(FileAction(FileActionType::Added, path, isDirectory));
+						}
+					}
+				}
+			}
+
+			// Notifications were lost. There is no way to tell where the lost changes were made, so look for anything
+			// modified since the notifications were last read successfully.
+			if(overflow)
+			{
+				LOGWRN("Folder monitor event queue overflowed, rescanning monitored folders for changes.");
+
+				for(auto& watchInfo : mPimpl->mFoldersToWatch)
+					mPimpl->rescan(*watchInfo, mPimpl->mLastSyncTime, actions);
+			}
+
+			mPimpl->resolvePendingMoves(time, actions);
+		}
+
+		mPimpl->mLastSyncTime = readTime;
+		mPimpl->queueActions(actions);
+	}
+
+	void FolderMonitor::_update()
+	{
+		Vector<FileAction> actions;
+
+		{
+			Lock lock(mPimpl->mMainMutex);
+
+			if(mPimpl->mFileActions.empty())
+				return;
+
+			// Wait for bursts of changes (e.g. version control updates) to settle before reporting, so they can be
+			// reported with as few notifications as possible
+			UINT64 time = getTimeMs();
+			if((time - mPimpl->mLastActionTime) < COALESCE_DELAY_MS &&
+				(time - mPimpl->mFirstActionTime) < MAX_COALESCE_DELAY_MS)
+			{
+				return;
+			}
+
+			std::swap(actions, mPimpl->mFileActions);
+		}
+
+		Vector<FileAction> coalescedActions;
+		coalesceActions(actions, coalescedActions);
+
+		for(auto& action : coalescedActions)
+		{
+			switch(action.type)
+			{
+			case FileActionType::Added:
+				if(!onAdded.empty())
+					onAdded(Path(action.path));
+				break;
+			case FileActionType::Removed:
+				if(!onRemoved.empty())
+					onRemoved(Path(action.path));
+				break;
+			case FileActionType::Modified:
+				if(!onModified.empty())
+					onModified(Path(action.path));
+				break;
+			case FileActionType::Renamed:
+				if(!onRenamed.empty())
+					onRenamed(Path(action.oldPath), Path(action.path));
+				break;
+			}
+		}
+	}
+}
@@ -83,7 +83,7 @@ namespace bs { namespace ct
 
 		if (options == GBL_READ_WRITE || options == GBL_WRITE_ONLY || options == GBL_WRITE_ONLY_DISCARD || options == GBL_WRITE_ONLY_NO_OVERWRITE)
 		{
-			BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuBuffer);
+			BS_ADD_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuBuffer, length);
 		}
 #endif
 
@@ -105,7 +105,7 @@ namespace bs { namespace ct
 	void D3D11GpuBuffer::writeData(UINT32 offset, UINT32 length, const void* source, BufferWriteType writeFlags, 
 		UINT32 queueIdx)
 	{
-		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuBuffer);
+		BS_ADD_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuBuffer, length);
 
 		mBuffer->writeData(offset, length, source, writeFlags);
 	}
@@ -50,6 +50,6 @@ namespace bs { namespace ct
 	{
 		mBuffer->writeData(0, mSize, data, BWT_DISCARD);
 
-		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuParamBuffer);
+		BS_ADD_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuParamBuffer, mSize);
 	}
 }}
\ No newline at end of file
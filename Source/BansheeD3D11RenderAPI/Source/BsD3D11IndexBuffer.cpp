@@ -39,7 +39,7 @@ namespace bs { namespace ct
 
 		if (options == GBL_READ_WRITE || options == GBL_WRITE_ONLY || options == GBL_WRITE_ONLY_DISCARD || options == GBL_WRITE_ONLY_NO_OVERWRITE)
 		{
-			BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_IndexBuffer);
+			BS_ADD_RENDER_STAT_CAT(ResWrite, RenderStatObject_IndexBuffer, length);
 		}
 #endif
 
@@ -62,7 +62,7 @@ namespace bs { namespace ct
 	{
 		mBuffer->writeData(offset, length, pSource, writeFlags);
 
-		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_IndexBuffer);
+		BS_ADD_RENDER_STAT_CAT(ResWrite, RenderStatObject_IndexBuffer, length);
 	}
 
 	void D3D11IndexBuffer::copyData(HardwareBuffer& srcBuffer, UINT32 srcOffset,
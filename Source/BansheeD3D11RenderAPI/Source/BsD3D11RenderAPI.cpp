@@ -134,6 +134,15 @@ namespace bs { namespace ct
 
 		mIAManager = bs_new<D3D11InputLayoutManager>();
 
+		RenderStats& renderStats = RenderStats::instance();
+		renderStats.setResourceTypeName(RenderStatObject_DepthStencilState, "DepthStencilState");
+		renderStats.setResourceTypeName(RenderStatObject_RasterizerState, "RasterizerState");
+		renderStats.setResourceTypeName(RenderStatObject_BlendState, "BlendState");
+		renderStats.setResourceTypeName(RenderStatObject_SamplerState, "SamplerState");
+		renderStats.setResourceTypeName(RenderStatObject_InputLayout, "InputLayout");
+		renderStats.setResourceTypeName(RenderStatObject_ResourceView, "ResourceView");
+		renderStats.setResourceTypeName(RenderStatObject_SwapChain, "SwapChain");
+
 		RenderAPI::initialize();
 	}
 
@@ -117,6 +117,10 @@ namespace bs { namespace ct
 		if (mProperties.getNumSamples() > 1)
 			BS_EXCEPT(InvalidStateException, "Multisampled textures cannot be accessed from the CPU directly.");
 
+		UINT32 mipWidth = std::max(1u, mProperties.getWidth() >> mipLevel);
+		UINT32 mipHeight = std::max(1u, mProperties.getHeight() >> mipLevel);
+		UINT32 mipDepth = std::max(1u, mProperties.getDepth() >> mipLevel);
+
 #if BS_PROFILING_ENABLED
 		if (options == GBL_READ_ONLY || options == GBL_READ_WRITE)
 		{
@@ -125,14 +129,11 @@ namespace bs { namespace ct
 
 		if (options == GBL_READ_WRITE || options == GBL_WRITE_ONLY || options == GBL_WRITE_ONLY_DISCARD || options == GBL_WRITE_ONLY_NO_OVERWRITE)
 		{
-			BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_Texture);
+			BS_ADD_RENDER_STAT_CAT(ResWrite, RenderStatObject_Texture,
+				PixelUtil::getMemorySize(mipWidth, mipHeight, mipDepth, mProperties.getFormat()));
 		}
 #endif
 
-		UINT32 mipWidth = std::max(1u, mProperties.getWidth() >> mipLevel);
-		UINT32 mipHeight = std::max(1u, mProperties.getHeight() >> mipLevel);
-		UINT32 mipDepth = std::max(1u, mProperties.getDepth() >> mipLevel);
-
 		PixelData lockedArea(mipWidth, mipHeight, mipDepth, mInternalFormat);
 
 		D3D11_MAP flags = D3D11Mappings::getLockOptions(options);
@@ -232,7 +233,7 @@ namespace bs { namespace ct
 				BS_EXCEPT(RenderingAPIException, "D3D11 device cannot map texture\nError Description:" + errorDescription);
 			}
 
-			BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_Texture);
+			BS_ADD_RENDER_STAT_CAT(ResWrite, RenderStatObject_Texture, src.getConsecutiveSize());
 		}
 		else
 		{
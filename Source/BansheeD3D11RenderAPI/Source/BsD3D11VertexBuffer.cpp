@@ -32,7 +32,7 @@ namespace bs { namespace ct
 
 		if (options == GBL_READ_WRITE || options == GBL_WRITE_ONLY || options == GBL_WRITE_ONLY_DISCARD || options == GBL_WRITE_ONLY_NO_OVERWRITE)
 		{
-			BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_VertexBuffer);
+			BS_ADD_RENDER_STAT_CAT(ResWrite, RenderStatObject_VertexBuffer, length);
 		}
 #endif
 
@@ -54,7 +54,7 @@ namespace bs { namespace ct
 		UINT32 queueIdx)
 	{
 		mBuffer->writeData(offset, length, source, writeFlags);
-		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_VertexBuffer);
+		BS_ADD_RENDER_STAT_CAT(ResWrite, RenderStatObject_VertexBuffer, length);
 	}
 
 	void D3D11VertexBuffer::copyData(HardwareBuffer& srcBuffer, UINT32 srcOffset,
@@ -109,6 +109,7 @@ set(BS_BANSHEEEDITOR_INC_UNDOREDO
 	"Include/BsCmdInstantiateSO.h"
 	"Include/BsCmdBreakPrefab.h"
 	"Include/BsUndoRedo.h"
+	"Include/BsSceneObjectSnapshot.h"
 )
 
 set(BS_BANSHEEEDITOR_INC_RTTI
@@ -196,6 +197,7 @@ set(BS_BANSHEEEDITOR_SRC_UNDOREDO
 	"Source/BsCmdInstantiateSO.cpp"
 	"Source/BsCmdBreakPrefab.cpp"
 	"Source/BsUndoRedo.cpp"
+	"Source/BsSceneObjectSnapshot.cpp"
 )
 
 set(BS_BANSHEEEDITOR_INC_BUILD
@@ -6,6 +6,7 @@
 #include "BsEditorCommand.h"
 #include "BsUndoRedo.h"
 #include "BsEditorUtility.h"
+#include "BsSceneObjectSnapshot.h"
 
 namespace bs
 {
@@ -53,12 +54,14 @@ namespace bs
 		/**	Clears all the stored data and frees memory. */
 		void clear();
 
+		/** @copydoc EditorCommand::getMemoryUsage */
+		UINT32 getMemoryUsage() const override { return mSnapshot.getMemoryUsage(); }
+
 		HSceneObject mSceneObject;
 		EditorUtility::SceneObjProxy mSceneObjectProxy;
 		bool mRecordHierarchy;
 
-		UINT8* mSerializedObject;
-		UINT32 mSerializedObjectSize;
+		SceneObjectSnapshot mSnapshot;
 	};
 
 	/** @} */
@@ -35,6 +35,9 @@ namespace bs
 		/** Triggers when a command is removed from an undo/redo stack. */
 		virtual void onCommandRemoved() {}
 
+		/** Returns the amount of memory used for storing the command's data, in bytes. */
+		virtual UINT32 getMemoryUsage() const { return 0; }
+
 		WString mDescription;
 		UINT32 mId;
 	};
@@ -93,6 +93,15 @@ namespace bs
 
 		/**	Tests the frame allocator. */
 		void TestFrameAlloc();
+
+		/** Tests the lookup of entries sharing a prefix in the project library search index. */
+		void TestProjectLibrarySearchPrefix();
+
+		/** Tests the project library check for modified source files and import options. */
+		void TestProjectLibraryUpToDate();
+
+		/** Tests reading back the contents of a texture through the GPU readback manager. */
+		void TestGpuReadbackTexture();
 	};
 
 	/** @} */
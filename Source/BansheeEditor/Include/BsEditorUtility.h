@@ -62,6 +62,12 @@ namespace bs
 		 */
 		static void restoreIds(const HSceneObject& restored, SceneObjProxy& proxy);
 
+		/**
+		 * Triggered after restoreIds() restores the instance data of a scene object hierarchy. Provides the root of the
+		 * restored hierarchy.
+		 */
+		static Event<void(const HSceneObject&)> onIdsRestored;
+
 	private:
 		/**
 		 * Retrieves all components containing meshes on the specified object and outputs their bounds.
@@ -4,6 +4,7 @@
 
 #include "BsEditorPrerequisites.h"
 #include "BsGUITreeView.h"
+#include "BsSceneObject.h"
 #include "BsEvent.h"
 #include "BsServiceLocator.h"
 
@@ -131,10 +132,26 @@ namespace bs
 			const String& editBoxStyle, const String& dragHighlightStyle, const String& dragSepHighlightStyle, const GUIDimensions& dimensions);
 
 		/**
-		 * Checks it the SceneObject referenced by this tree element changed in any way and updates the tree element. This
-		 * can involve recursing all children and updating them as well.
+		 * Checks if the children of the SceneObject referenced by this tree element changed in any way and updates the
+		 * child tree elements.
+		 *
+		 * @param[in]	element		Element whose children to update.
+		 * @param[in]	recursive	If true, children of the child elements will be updated as well, all the way down the
+		 *							hierarchy. If false only newly added children are populated recursively.
 		 */
-		void updateTreeElement(SceneTreeElement* element);
+		void updateTreeElement(SceneTreeElement* element, bool recursive);
+
+		/** Checks if the name, active or prefab state of the SceneObject referenced by the tree element changed. */
+		void updateElementState(SceneTreeElement* element);
+
+		/** Triggered when a scene object in the scene changes. Marks the affected tree elements for update. */
+		void onHierarchyChanged(const HSceneObject& so, SceneObjectChange change);
+
+		/**
+		 * Triggered when an undo operation restores a scene object hierarchy. Restored objects re-use the IDs of the
+		 * objects they replace, so the matching tree elements are marked for a recursive update.
+		 */
+		void onIdsRestored(const HSceneObject& so);
 
 		/**
 		 * Triggered when a drag and drop operation that was started by the tree view ends, regardless if it was processed
@@ -193,6 +210,11 @@ namespace bs
 		Vector<HSceneObject> mCopyList;
 		bool mCutFlag;
 
+		UnorderedMap<UINT64, SceneTreeElement*> mElementLookup;
+		UnorderedMap<UINT64, bool> mDirtyElements; // Maps element ID to whether it needs a recursive update
+		HEvent mHierarchyChangedConn;
+		HEvent mIdsRestoredConn;
+
 		static const Color PREFAB_TINT;
 	};
 
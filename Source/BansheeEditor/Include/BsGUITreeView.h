@@ -19,6 +19,9 @@ namespace bs
 	 *
 	 * Elements may be selected, renamed, dragged and re-parented.
 	 *
+	 * Only the elements within (or close to) the visible area of the parent scroll area own GUI elements. Other elements
+	 * are only accounted for during layout, which keeps the cost of the tree view low regardless of the number of elements.
+	 *
 	 * This class is abstract and meant to be extended by an implementation specific to some content type (for example scene
 	 * object hierarchy). 
 	 */
@@ -59,8 +62,12 @@ namespace bs
 			bool mIsVisible;
 			bool mIsCut;
 			bool mIsDisabled;
+			bool mIsInView;
 			Color mTint;
 
+			Rect2I mBounds; /**< Bounds of the element's row as of the last layout update, valid if the element is visible. */
+			INT32 mOptimalWidth; /**< Last known optimal width of the element's label. */
+
 			bool isParentRec(TreeElement* element) const;
 		};
 
@@ -237,6 +244,13 @@ namespace bs
 		/**	Rebuilds the needed GUI elements for the provided TreeElement. */
 		void updateElementGUI(TreeElement* element);
 
+		/**
+		 * Determines which visible elements are within the visible area of the tree view and creates GUI elements for
+		 * them, while releasing GUI elements of the ones that scrolled out of view. Does nothing if neither the elements
+		 * nor the visible area changed since the last call.
+		 */
+		void updateVisibleRows();
+
 		/**	Close any elements that were temporarily expanded due to a drag operation hovering over them. */
 		void closeTemporarilyExpandedElements();
 
@@ -285,6 +299,10 @@ namespace bs
 
 		Vector<InteractableElement> mVisibleElements;
 
+		UINT32 mRowHeight;
+		Rect2I mVisibleRowArea;
+		bool mRowsDirty;
+
 		bool mIsElementSelected;
 		Vector<SelectedElement> mSelectedElements;
 
@@ -313,6 +331,7 @@ namespace bs
 		static const UINT32 INDENT_SIZE;
 		static const UINT32 INITIAL_INDENT_OFFSET;
 		static const UINT32 DRAG_MIN_DISTANCE;
+		static const UINT32 VISIBLE_ROW_PADDING;
 		static const float AUTO_EXPAND_DELAY_SEC;
 		static const float SCROLL_AREA_HEIGHT_PCT;
 		static const UINT32 SCROLL_SPEED_PX_PER_SEC;
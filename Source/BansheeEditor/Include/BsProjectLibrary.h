@@ -51,6 +51,8 @@ namespace bs
 
 			SPtr<ProjectFileMeta> meta; /**< Meta file containing various information about the resource(s). */
 			std::time_t lastUpdateTime; /**< Timestamp of when we last imported the resource. */
+			String sourceHash; /**< Hash of the source file contents at the time of the last import. */
+			String importOptionsHash; /**< Hash of the import options used by the last import. */
 		};
 
 		/**	A library entry representing a folder that contains other entries. */
@@ -115,11 +117,13 @@ namespace bs
 		SPtr<ProjectResourceMeta> findResourceMeta(const Path& path) const;
 
 		/**
-		 * Searches the library for a pattern and returns all entries matching it.
+		 * Searches the library for a pattern and returns all entries matching it. Matching is case insensitive and uses
+		 * an index of entry names that is only rebuilt after the library changes. Patterns that don't start with a 
+		 * wildcard only need to check entries sharing their prefix.
 		 *
 		 * @param[in]	pattern	Pattern to search for. Use wildcard * to match any character(s).
-		 * @return		A list of entries matching the pattern. Values returned by this method are transient, they may be
-		 *				destroyed on any following ProjectLibrary call.
+		 * @return		A list of entries matching the pattern, sorted by name and then by path. Values returned by this
+		 *				method are transient, they may be destroyed on any following ProjectLibrary call.
 		 */
 		Vector<LibraryEntry*> search(const WString& pattern);
 
@@ -128,8 +132,8 @@ namespace bs
 		 *
 		 * @param[in]	pattern	Pattern to search for. Use wildcard * to match any character(s).
 		 * @param[in]	typeIds	RTTI type IDs of the resource types we're interested in searching.
-		 * @return		A list of entries matching the pattern. Values returned by this method are transient, they may be
-		 *				destroyed on any following ProjectLibrary call.
+		 * @return		A list of entries matching the pattern, sorted by name and then by path. Values returned by this
+		 *				method are transient, they may be destroyed on any following ProjectLibrary call.
 		 */
 		Vector<LibraryEntry*> search(const WString& pattern, const Vector<UINT32>& typeIds);
 
@@ -269,6 +273,15 @@ namespace bs
 		static const Path RESOURCES_DIR;
 		static const Path INTERNAL_RESOURCES_DIR;
 	private:
+		friend class EditorTestSuite;
+
+		/** Entry in the name index used for searching the library. */
+		struct SearchIndexEntry
+		{
+			WString name; /**< Name of the library entry, in lower case. */
+			LibraryEntry* entry;
+		};
+
 		/**
 		 * Common code for adding a new resource entry to the library.
 		 *
@@ -336,8 +349,46 @@ namespace bs
 		 */
 		void createInternalParentHierarchy(const Path& fullPath, DirectoryEntry** newHierarchyRoot, DirectoryEntry** newHierarchyLeaf);
 
-		/**	Checks has a file been modified since the last import. */
-		bool isUpToDate(FileEntry* file) const;
+		/**
+		 * Checks has a file been modified since the last import. If the file's timestamp changed but its contents didn't
+		 * (e.g. after a version control checkout) the file is considered up to date and its timestamp is refreshed.
+		 *
+		 * @param[in]	file			File to check.
+		 * @param[in]	importOptions	Import options the file would be imported with. If they differ from the options
+		 *								used by the last import the file is not up to date. If null the options stored in
+		 *								the file's meta-data are used.
+		 */
+		bool isUpToDate(FileEntry* file, const SPtr<ImportOptions>& importOptions = nullptr);
+
+		/**
+		 * Part of isUpToDate() that checks the source file and import options, without checking that the imported
+		 * resources exist.
+		 */
+		static bool isSourceUpToDate(FileEntry* file, const SPtr<ImportOptions>& importOptions);
+
+		/** Calculates a hash of the contents of the file at the specified path. Returns an empty string on failure. */
+		static String getSourceHash(const Path& path);
+
+		/** Calculates a hash of the provided import options. Returns an empty string if no options are provided. */
+		static String getImportOptionsHash(const SPtr<ImportOptions>& importOptions);
+
+		/**
+		 * Rebuilds the indices used for searching, if any entries changed since they were last built. The indices are
+		 * derived from the entry hierarchy, which is what gets saved with the library, so they aren't saved themselves.
+		 * Changes tend to come in batches (e.g. a folder import), which makes a single rebuild before the next search
+		 * cheaper than updating the indices after every change.
+		 */
+		void updateSearchIndex();
+
+		/**
+		 * Finds the range of entries in a search index whose names start with the provided prefix. 
+		 *
+		 * @param[in]	index	Search index, sorted by name.
+		 * @param[in]	prefix	Prefix to look for, in lower case.
+		 * @return				Index of the first matching entry, and one past the last matching entry. Both are equal
+		 *						if no entries match.
+		 */
+		static std::pair<UINT32, UINT32> findPrefixRange(const Vector<SearchIndexEntry>& index, const WString& prefix);
 
 		/**	Checks is the resource a native engine resource that doesn't require importing. */
 		bool isNative(const Path& path) const;
@@ -391,6 +442,10 @@ namespace bs
 
 		UnorderedMap<Path, Vector<Path>> mDependencies;
 		UnorderedMap<String, Path> mUUIDToPath;
+
+		Vector<SearchIndexEntry> mSearchIndex; /**< Sorted by name. */
+		UnorderedMap<UINT32, Vector<LibraryEntry*>> mSearchTypeIndex;
+		bool mSearchIndexDirty;
 	};
 
 	/**	Provides easy access to ProjectLibrary. */
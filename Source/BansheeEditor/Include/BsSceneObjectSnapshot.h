@@ -0,0 +1,71 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+
+namespace bs
+{
+	/** @addtogroup UndoRedo
+	 *  @{
+	 */
+
+	/**
+	 * Serialized state of a scene object, as stored by undo/redo commands.
+	 *
+	 * Snapshots of the same scene object are chained together. Only the most recent snapshot keeps the full serialized
+	 * data, while older ones are stored as a BinaryDelta against the next newer snapshot. Since commands are undone in
+	 * reverse order, editing a single property of a large hierarchy only costs the size of the change. Stored data is
+	 * additionally compressed, if that makes it smaller.
+	 */
+	class BS_ED_EXPORT SceneObjectSnapshot
+	{
+	public:
+		SceneObjectSnapshot() { }
+		~SceneObjectSnapshot();
+
+		SceneObjectSnapshot(const SceneObjectSnapshot&) = delete;
+		SceneObjectSnapshot& operator=(const SceneObjectSnapshot&) = delete;
+
+		/**
+		 * Serializes the provided scene object, its components and children, replacing any previously stored data. Caller
+		 * should temporarily detach any children that shouldn't be recorded.
+		 */
+		void record(const HSceneObject& sceneObject);
+
+		/** Returns the full serialized data of the scene object, or null if nothing was recorded. */
+		SPtr<MemoryDataStream> getData() const;
+
+		/** Releases the stored data. */
+		void clear();
+
+		/** Returns the number of bytes used for storing the snapshot. */
+		UINT32 getMemoryUsage() const;
+
+	private:
+		/** Replaces the stored data, compressing it if that makes it smaller. */
+		void setData(const SPtr<MemoryDataStream>& data, bool isDelta);
+
+		/** Replaces the stored data with a delta against a newer snapshot of the same object. */
+		void encodeAgainst(SceneObjectSnapshot* newer, const SPtr<MemoryDataStream>& newerData);
+
+		/** Replaces the stored delta with full data, so the snapshot no longer depends on the newer snapshot. */
+		void makeIndependent();
+
+		/** Minimum size of the stored data before compression is attempted, in bytes. */
+		static const UINT32 MIN_COMPRESSION_SIZE;
+
+		/** Most recent snapshot of each scene object, keyed by scene object instance ID. */
+		static UnorderedMap<UINT64, SceneObjectSnapshot*> sLatestSnapshots;
+
+		SPtr<MemoryDataStream> mData;
+		bool mIsDelta = false;
+		bool mIsCompressed = false;
+		UINT64 mObjectId = 0;
+
+		SceneObjectSnapshot* mNewer = nullptr; // Snapshot this one is encoded against, if stored as a delta
+		SceneObjectSnapshot* mOlder = nullptr; // Snapshot encoded against this one, if any
+	};
+
+	/** @} */
+}
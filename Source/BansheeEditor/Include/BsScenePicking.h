@@ -31,6 +31,9 @@ namespace bs
 
 	namespace ct { class ScenePicking; }
 
+	/** Callback triggered when an asynchronous picking operation completes. */
+	typedef std::function<void(const Vector<HSceneObject>&, const SnapData&)> PickCallback;
+
 	/**	Handles picking of scene objects with a pointer in scene view. */
 	class BS_ED_EXPORT ScenePicking : public Module<ScenePicking>
 	{
@@ -79,9 +82,60 @@ namespace bs
 		Vector<HSceneObject> pickObjects(const SPtr<Camera>& cam, const Vector2I& position, const Vector2I& area, 
 			Vector<HSceneObject>& ignoreRenderables, SnapData* data = nullptr);
 
+		/**
+		 * Same as pickObjects(), except the picking results are read back from the GPU without stalling the pipeline. 
+		 * The results are usually available a frame or two later, at which point @p callback is triggered.
+		 *
+		 * @param[in]	cam					Camera to perform the picking from.
+		 * @param[in]	position			Pointer position relative to the camera viewport, in pixels.
+		 * @param[in]	area				Width/height of the checked area in pixels. Use (1, 1) if you want the exact 
+		 *									position under the pointer.
+		 * @param[in]	ignoreRenderables	A list of objects that should be ignored during scene picking.
+		 * @param[in]	callback			Callback to trigger with the picked objects once the results are available.
+		 *									Triggered on the simulation thread, from update().
+		 * @param[in]	gatherSnapData		If true, picking position and normal will be provided to the callback.
+		 */
+		void pickObjectsAsync(const SPtr<Camera>& cam, const Vector2I& position, const Vector2I& area, 
+			Vector<HSceneObject>& ignoreRenderables, const PickCallback& callback, bool gatherSnapData = false);
+
+		/** Triggers callbacks for any asynchronous picking operations that have completed. Called once per frame. */
+		void update();
+
+		/**
+		 * Attempts to find a single nearest scene object under the provided position by casting a ray against the scene
+		 * on the CPU. Unlike pickClosestObject() this doesn't render the scene or wait on the GPU, but gizmos are not
+		 * considered.
+		 *
+		 * Rays are first tested against renderable bounds, and then against triangles of their meshes. Meshes must be
+		 * created with the MU_CPUCACHED flag in order for their triangles to be tested. For other meshes, as well as
+		 * for meshes deformed by skeletal or morph animation, only the bounds are tested.
+		 *
+		 * @param[in]	cam					Camera to perform the picking from.
+		 * @param[in]	position			Pointer position relative to the camera viewport, in pixels.
+		 * @param[in]	ignoreRenderables	A list of objects that should be ignored during scene picking.
+		 * @param[out]	data				Picking data regarding position and normal.
+		 * @return							Nearest SceneObject under the provided position, or an empty handle if no 
+		 *									object is found.
+		 */
+		HSceneObject pickClosestObjectCPU(const SPtr<Camera>& cam, const Vector2I& position, 
+			Vector<HSceneObject>& ignoreRenderables, SnapData* data = nullptr);
+
 	private:
 		friend class ct::ScenePicking;
 
+		/** Information required for mapping picking results to scene objects. */
+		struct PickRequest
+		{
+			Map<UINT32, HSceneObject> idxToRenderable;
+			Map<UINT32, HSceneObject> idxToGizmo;
+
+			AsyncOp op;
+			SPtr<Camera> camera;
+			Vector2I position;
+			bool gatherSnapData = false;
+			PickCallback callback;
+		};
+
 		typedef Set<RenderablePickData, std::function<bool(const RenderablePickData&, const RenderablePickData&)>> RenderableSet;
 
 		/**	Encodes a pickable object identifier to a unique color. */
@@ -90,7 +144,38 @@ namespace bs
 		/** Decodes a color into a unique object identifier. Color should have initially been encoded with encodeIndex(). */
 		static UINT32 decodeIndex(Color color);
 
+		/**
+		 * Queues rendering of all pickable objects and gizmos into the picking target, and records the information 
+		 * required for resolving the results in @p request. Returns the target the objects are rendered to.
+		 */
+		SPtr<ct::RenderTarget> beginPicking(const SPtr<Camera>& cam, const Vector2I& position, const Vector2I& area,
+			Vector<HSceneObject>& ignoreRenderables, PickRequest& request);
+
+		/** Maps the object indices in the picking results into scene objects. */
+		static Vector<HSceneObject> resolveObjects(const PickRequest& request, const PickResults& pickResults);
+
+		/** 
+		 * Returns a triangle hierarchy for the provided mesh, building it if not already cached or if the mesh's cached 
+		 * data changed since it was built. Returns null if the mesh has no CPU accessible data.
+		 */
+		SPtr<TriangleBVH> getMeshBVH(const HMesh& mesh);
+
+		/** Triggered when a resource is modified or destroyed. Removes any cached data for the resource. */
+		void onResourceChanged(const String& uuid);
+
 		ct::ScenePicking* mCore;
+		Vector<PickRequest> mPendingRequests;
+
+		/** Triangle hierarchy built for a mesh, along with the version of mesh data it was built from. */
+		struct MeshBVH
+		{
+			SPtr<TriangleBVH> bvh;
+			UINT32 version;
+		};
+
+		UnorderedMap<String, MeshBVH> mMeshBVHs;
+		HEvent mResourceDestroyedConn;
+		HEvent mResourceModifiedConn;
 	};
 
 	/** @} */
@@ -142,13 +227,21 @@ namespace bs
 		 * @param[in]	position		Position of the pointer where to pick objects, in pixels relative to viewport.
 		 * @param[in]	area			Width/height of the area to pick objects, in pixels.
 		 * @param[in]	gatherSnapData	Determines whather normal & depth information will be recorded.
+		 * @param[in]	async			If true the results will be read back from the GPU without waiting for it to
+		 *								finish rendering, and @p asyncOp will complete during one of the following
+		 *								frames. Otherwise the results are read immediately.
 		 * @param[out]	asyncOp			Async operation handle that when complete will contain the results of the picking
-		 *								operation in the form of Vector<SelectedObject>.
+		 *								operation in the form of PickResults.
 		 */
 		void corePickingEnd(const SPtr<RenderTarget>& target, const Rect2& viewportArea, const Vector2I& position,
-			const Vector2I& area, bool gatherSnapData, AsyncOp& asyncOp);
+			const Vector2I& area, bool gatherSnapData, bool async, AsyncOp& asyncOp);
 
 	private:
+		/** Counts the object indices in the picked area and returns them sorted by the number of covered pixels. */
+		static PickResults resolvePicking(const Vector2I& position, const Vector2I& area, bool flipY,
+			const SPtr<PixelData>& outputPixelData, const SPtr<PixelData>& depthPixelData, 
+			const SPtr<PixelData>& normalsPixelData);
+
 		friend class bs::ScenePicking;
 
 		static const float ALPHA_CUTOFF;
@@ -69,6 +69,7 @@ namespace bs
 		GpuParamMat4 mMatWorldViewProj[4];
 		GpuParamColor mColor[4];
 		GpuParamBuffer mBoneMatrices[4];
+		GpuParamInt mBoneOffset[4];
 
 		UINT32 mTechniqueIndices[4];
 
@@ -81,7 +81,11 @@ namespace bs
 		/**	Removes all entries from the redo stack. */
 		void clearRedoStack();
 
+		/** Removes the oldest entries from the undo stack until the memory used by the undo stack fits the budget. */
+		void enforceMemoryBudget();
+
 		static const UINT32 MAX_STACK_ELEMENTS;
+		static const UINT64 MAX_STACK_MEMORY;
 
 		SPtr<EditorCommand>* mUndoStack;
 		SPtr<EditorCommand>* mRedoStack;
@@ -4,12 +4,12 @@
 #include "BsSceneObject.h"
 #include "BsComponent.h"
 #include "BsMemorySerializer.h"
+#include "BsDataStream.h"
 
 namespace bs
 {
 	CmdDeleteSO::CmdDeleteSO(const WString& description, const HSceneObject& sceneObject)
-		: EditorCommand(description), mSceneObject(sceneObject), mSerializedObject(nullptr), mSerializedObjectSize(0)
-		, mSerializedObjectParentId(0)
+		: EditorCommand(description), mSceneObject(sceneObject), mSerializedObjectParentId(0)
 	{
 
 	}
@@ -22,14 +22,8 @@ namespace bs
 
 	void CmdDeleteSO::clear()
 	{
-		mSerializedObjectSize = 0;
 		mSerializedObjectParentId = 0;
-
-		if (mSerializedObject != nullptr)
-		{
-			bs_free(mSerializedObject);
-			mSerializedObject = nullptr;
-		}
+		mSnapshot.clear();
 	}
 
 	void CmdDeleteSO::execute(const HSceneObject& sceneObject, const WString& description)
@@ -58,6 +52,10 @@ namespace bs
 		if (mSceneObject == nullptr)
 			return;
 
+		SPtr<MemoryDataStream> serializedObject = mSnapshot.getData();
+		if (serializedObject == nullptr)
+			return;
+
 		HSceneObject parent;
 		if (mSerializedObjectParentId != 0)
 			parent = GameObjectManager::instance().getObject(mSerializedObjectParentId);
@@ -70,7 +68,8 @@ namespace bs
 			mSceneObject->destroy(true);
 
 		MemorySerializer serializer;
-		SPtr<SceneObject> restored = std::static_pointer_cast<SceneObject>(serializer.decode(mSerializedObject, mSerializedObjectSize));
+		SPtr<SceneObject> restored = std::static_pointer_cast<SceneObject>(
+			serializer.decode(serializedObject->getPtr(), (UINT32)serializedObject->size()));
 
 		EditorUtility::restoreIds(restored->getHandle(), mSceneObjectProxy);
 		restored->setParent(parent);
@@ -80,14 +79,7 @@ namespace bs
 
 	void CmdDeleteSO::recordSO(const HSceneObject& sceneObject)
 	{
-		bool isInstantiated = !mSceneObject->hasFlag(SOF_DontInstantiate);
-		mSceneObject->_setFlags(SOF_DontInstantiate);
-
-		MemorySerializer serializer;
-		mSerializedObject = serializer.encode(mSceneObject.get(), mSerializedObjectSize);
-
-		if (isInstantiated)
-			mSceneObject->_unsetFlags(SOF_DontInstantiate);
+		mSnapshot.record(mSceneObject);
 
 		HSceneObject parent = mSceneObject->getParent();
 		if (parent != nullptr)
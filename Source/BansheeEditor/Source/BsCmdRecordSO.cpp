@@ -4,12 +4,12 @@
 #include "BsSceneObject.h"
 #include "BsComponent.h"
 #include "BsMemorySerializer.h"
+#include "BsDataStream.h"
 
 namespace bs
 {
 	CmdRecordSO::CmdRecordSO(const WString& description, const HSceneObject& sceneObject, bool recordHierarchy)
 		: EditorCommand(description), mSceneObject(sceneObject), mRecordHierarchy(recordHierarchy)
-		, mSerializedObject(nullptr), mSerializedObjectSize(0)
 	{
 
 	}
@@ -22,13 +22,7 @@ namespace bs
 
 	void CmdRecordSO::clear()
 	{
-		mSerializedObjectSize = 0;
-
-		if (mSerializedObject != nullptr)
-		{
-			bs_free(mSerializedObject);
-			mSerializedObject = nullptr;
-		}
+		mSnapshot.clear();
 	}
 
 	void CmdRecordSO::execute(const HSceneObject& sceneObject, bool recordHierarchy, const WString& description)
@@ -56,6 +50,10 @@ namespace bs
 		if (mSceneObject == nullptr || mSceneObject.isDestroyed())
 			return;
 
+		SPtr<MemoryDataStream> serializedObject = mSnapshot.getData();
+		if (serializedObject == nullptr)
+			return;
+
 		HSceneObject parent = mSceneObject->getParent();
 
 		UINT32 numChildren = mSceneObject->getNumChildren();
@@ -77,7 +75,8 @@ namespace bs
 		GameObjectManager::instance().setDeserializationMode(GODM_RestoreExternal | GODM_UseNewIds);
 
 		MemorySerializer serializer;
-		SPtr<SceneObject> restored = std::static_pointer_cast<SceneObject>(serializer.decode(mSerializedObject, mSerializedObjectSize));
+		SPtr<SceneObject> restored = std::static_pointer_cast<SceneObject>(
+			serializer.decode(serializedObject->getPtr(), (UINT32)serializedObject->size()));
 
 		EditorUtility::restoreIds(restored->getHandle(), mSceneObjectProxy);
 		restored->setParent(parent);
@@ -110,15 +109,7 @@ namespace bs
 			}
 		}
 
-		bool isInstantiated = !mSceneObject->hasFlag(SOF_DontInstantiate);
-		mSceneObject->_setFlags(SOF_DontInstantiate);
-
-		MemorySerializer serializer;
-		mSerializedObject = serializer.encode(mSceneObject.get(), mSerializedObjectSize);
-
-		if (isInstantiated)
-			mSceneObject->_unsetFlags(SOF_DontInstantiate);
-
+		mSnapshot.record(mSceneObject);
 		mSceneObjectProxy = EditorUtility::createProxy(mSceneObject);
 
 		if (!mRecordHierarchy)
@@ -158,6 +158,7 @@ namespace bs
 
 		EditorWidgetManager::instance().update();
 		DropDownWindowManager::instance().update();
+		ScenePicking::instance().update();
 	}
 
 	void EditorApplication::postUpdate()
@@ -16,6 +16,14 @@
 #include "BsFrameAlloc.h"
 #include "BsFileSystem.h"
 #include "BsSceneManager.h"
+#include "BsProjectLibrary.h"
+#include "BsTextureImportOptions.h"
+#include "BsDataStream.h"
+#include "BsTexture.h"
+#include "BsPixelData.h"
+#include "BsGpuReadbackManager.h"
+#include "BsRenderAPI.h"
+#include "BsCoreThread.h"
 
 namespace bs
 {
@@ -414,6 +422,9 @@ namespace bs
 		BS_ADD_TEST(EditorTestSuite::TestPrefabComplex);
 		BS_ADD_TEST(EditorTestSuite::TestPrefabDiff);
 		BS_ADD_TEST(EditorTestSuite::TestFrameAlloc);
+		BS_ADD_TEST(EditorTestSuite::TestProjectLibrarySearchPrefix);
+		BS_ADD_TEST(EditorTestSuite::TestProjectLibraryUpToDate);
+		BS_ADD_TEST(EditorTestSuite::TestGpuReadbackTexture);
 	}
 
 	void EditorTestSuite::SceneObjectRecord_UndoRedo()
@@ -808,4 +819,150 @@ namespace bs
 		alloc.dealloc(a13);
 		alloc.clear();
 	}
+
+	void EditorTestSuite::TestProjectLibrarySearchPrefix()
+	{
+		Vector<WString> names = { L"", L"a", L"ab", L"abc", L"abd", L"b", L"ba" };
+
+		Vector<ProjectLibrary::SearchIndexEntry> index;
+		for (auto& name : names)
+		{
+			ProjectLibrary::SearchIndexEntry entry;
+			entry.name = name;
+			entry.entry = nullptr;
+
+			index.push_back(entry);
+		}
+
+		// Empty prefix matches everything
+		std::pair<UINT32, UINT32> range = ProjectLibrary::findPrefixRange(index, L"");
+		BS_TEST_ASSERT(range.first == 0 && range.second == (UINT32)index.size());
+
+		range = ProjectLibrary::findPrefixRange(index, L"a");
+		BS_TEST_ASSERT(range.first == 1 && range.second == 5);
+
+		range = ProjectLibrary::findPrefixRange(index, L"ab");
+		BS_TEST_ASSERT(range.first == 2 && range.second == 5);
+
+		range = ProjectLibrary::findPrefixRange(index, L"abc");
+		BS_TEST_ASSERT(range.first == 3 && range.second == 4);
+
+		// Last entries in the index
+		range = ProjectLibrary::findPrefixRange(index, L"b");
+		BS_TEST_ASSERT(range.first == 5 && range.second == 7);
+
+		// Prefix longer than any entry, and prefixes sorting between and after the entries
+		range = ProjectLibrary::findPrefixRange(index, L"abcd");
+		BS_TEST_ASSERT(range.first == range.second);
+
+		range = ProjectLibrary::findPrefixRange(index, L"abb");
+		BS_TEST_ASSERT(range.first == range.second);
+
+		range = ProjectLibrary::findPrefixRange(index, L"c");
+		BS_TEST_ASSERT(range.first == range.second && range.first == (UINT32)index.size());
+
+		// Empty index
+		range = ProjectLibrary::findPrefixRange(Vector<ProjectLibrary::SearchIndexEntry>(), L"a");
+		BS_TEST_ASSERT(range.first == 0 && range.second == 0);
+	}
+
+	void EditorTestSuite::TestProjectLibraryUpToDate()
+	{
+		Path filePath = Path::combine(FileSystem::getTempDirectoryPath(), "projectLibraryUpToDate.txt");
+
+		auto writeFile = [&](const String& contents)
+		{
+			SPtr<DataStream> stream = FileSystem::createAndOpenFile(filePath);
+			stream->writeString(contents);
+			stream->close();
+		};
+
+		writeFile("Original contents");
+		std::time_t modifiedTime = FileSystem::getLastModifiedTime(filePath);
+
+		ProjectLibrary::FileEntry entry(filePath, L"projectLibraryUpToDate.txt", nullptr);
+		entry.sourceHash = ProjectLibrary::getSourceHash(filePath);
+		entry.lastUpdateTime = modifiedTime;
+
+		BS_TEST_ASSERT(!entry.sourceHash.empty());
+		BS_TEST_ASSERT(ProjectLibrary::isSourceUpToDate(&entry, nullptr));
+
+		// Timestamp is newer than the last import but the contents are the same, the timestamp should get refreshed
+		entry.lastUpdateTime = modifiedTime - 10;
+		BS_TEST_ASSERT(ProjectLibrary::isSourceUpToDate(&entry, nullptr));
+		BS_TEST_ASSERT(entry.lastUpdateTime >= modifiedTime);
+
+		// Contents changed
+		writeFile("Modified contents");
+		modifiedTime = FileSystem::getLastModifiedTime(filePath);
+
+		entry.lastUpdateTime = modifiedTime - 10;
+		BS_TEST_ASSERT(!ProjectLibrary::isSourceUpToDate(&entry, nullptr));
+
+		entry.sourceHash = ProjectLibrary::getSourceHash(filePath);
+		BS_TEST_ASSERT(ProjectLibrary::isSourceUpToDate(&entry, nullptr));
+
+		// Import options are compared by value
+		SPtr<TextureImportOptions> importOptions = TextureImportOptions::create();
+		entry.importOptionsHash = ProjectLibrary::getImportOptionsHash(importOptions);
+		BS_TEST_ASSERT(!entry.importOptionsHash.empty());
+		BS_TEST_ASSERT(ProjectLibrary::isSourceUpToDate(&entry, importOptions));
+
+		SPtr<TextureImportOptions> sameImportOptions = TextureImportOptions::create();
+		BS_TEST_ASSERT(ProjectLibrary::isSourceUpToDate(&entry, sameImportOptions));
+
+		SPtr<TextureImportOptions> newImportOptions = TextureImportOptions::create();
+		newImportOptions->setGenerateMipmaps(!importOptions->getGenerateMipmaps());
+		BS_TEST_ASSERT(!ProjectLibrary::isSourceUpToDate(&entry, newImportOptions));
+
+		// Entries without hashes fall back to the timestamp
+		entry.sourceHash.clear();
+		entry.importOptionsHash.clear();
+
+		entry.lastUpdateTime = modifiedTime;
+		BS_TEST_ASSERT(ProjectLibrary::isSourceUpToDate(&entry, newImportOptions));
+
+		entry.lastUpdateTime = modifiedTime - 10;
+		BS_TEST_ASSERT(!ProjectLibrary::isSourceUpToDate(&entry, nullptr));
+
+		FileSystem::remove(filePath);
+	}
+
+	void EditorTestSuite::TestGpuReadbackTexture()
+	{
+		const UINT32 SIZE = 4;
+
+		SPtr<PixelData> srcData = PixelData::create(SIZE, SIZE, 1, PF_R8G8B8A8);
+		for (UINT32 y = 0; y < SIZE; y++)
+		{
+			for (UINT32 x = 0; x < SIZE; x++)
+				srcData->setColorAt(Color(x / (float)SIZE, y / (float)SIZE, 0.5f, 1.0f), x, y);
+		}
+
+		// Default description, with the sample count left at zero
+		SPtr<Texture> texture = Texture::_createPtr(srcData);
+		SPtr<ct::Texture> coreTexture = texture->getCore();
+		SPtr<PixelData> dstData = texture->getProperties().allocBuffer(0, 0);
+
+		AsyncOp readOp;
+		gCoreThread().queueCommand([&]()
+		{
+			readOp = ct::GpuReadbackManager::instance().readTexture(coreTexture, dstData);
+		});
+		gCoreThread().submit(true);
+
+		// Read only completes once the GPU signals the fence, so keep flushing queued work until it does
+		for (UINT32 i = 0; i < 1000 && !readOp.hasCompleted(); i++)
+		{
+			gCoreThread().queueCommand([]()
+			{
+				ct::RenderAPI::instance().submitCommandBuffer(nullptr);
+				ct::GpuReadbackManager::instance()._update();
+			});
+			gCoreThread().submit(true);
+		}
+
+		BS_TEST_ASSERT(readOp.hasCompleted());
+		BS_TEST_ASSERT(memcmp(srcData->getData(), dstData->getData(), srcData->getConsecutiveSize()) == 0);
+	}
 }
\ No newline at end of file
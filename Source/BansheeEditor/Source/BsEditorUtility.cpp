@@ -6,6 +6,8 @@
 
 namespace bs
 {
+	Event<void(const HSceneObject&)> EditorUtility::onIdsRestored;
+
 	AABox EditorUtility::calculateBounds(const HSceneObject& object)
 	{
 		Vector<HSceneObject> objects = { object };
@@ -210,5 +212,7 @@ namespace bs
 				todo.push(TempData(data.proxy.children[i], data.restoredObj->getChild(i)));
 			}
 		}
+
+		onIdsRestored(restored);
 	}
 }
\ No newline at end of file
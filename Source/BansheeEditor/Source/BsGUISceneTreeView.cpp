@@ -9,10 +9,13 @@
 #include "BsCmdDeleteSO.h"
 #include "BsCmdCloneSO.h"
 #include "BsCmdCreateSO.h"
+#include "BsEditorUtility.h"
 #include "BsDragAndDropManager.h"
 #include "BsGUIResourceTreeView.h"
 #include "BsGUIContextMenu.h"
 
+using namespace std::placeholders;
+
 namespace bs
 {
 	const MessageId GUISceneTreeView::SELECTION_CHANGED_MSG = MessageId("SceneTreeView_SelectionChanged");
@@ -38,6 +41,10 @@ namespace bs
 	{
 		SceneTreeViewLocator::_provide(this);
 
+		mHierarchyChangedConn = gSceneManager().onHierarchyChanged.connect(
+			std::bind(&GUISceneTreeView::onHierarchyChanged, this, _1, _2));
+		mIdsRestoredConn = EditorUtility::onIdsRestored.connect(std::bind(&GUISceneTreeView::onIdsRestored, this, _1));
+
 		SPtr<GUIContextMenu> contextMenu = bs_shared_ptr_new<GUIContextMenu>();
 
 		contextMenu->addMenuItem(L"New scene object", std::bind(&GUISceneTreeView::createNewSO, this), 50);
@@ -54,6 +61,9 @@ namespace bs
 
 	GUISceneTreeView::~GUISceneTreeView()
 	{
+		mHierarchyChangedConn.disconnect();
+		mIdsRestoredConn.disconnect();
+
 		SceneTreeViewLocator::_remove(this);
 	}
 
@@ -74,7 +84,7 @@ namespace bs
 			dragHighlightStyle, dragSepHighlightStyle, GUIDimensions::create(options));
 	}
 
-	void GUISceneTreeView::updateTreeElement(SceneTreeElement* element)
+	void GUISceneTreeView::updateTreeElement(SceneTreeElement* element, bool recursive)
 	{
 		HSceneObject currentSO = element->mSceneObject;
 
@@ -113,7 +123,7 @@ namespace bs
 		completeMatch &= visibleChildCount == element->mChildren.size();
 
 		// Not a complete match, compare everything and insert/delete elements as needed
-		bool needsUpdate = false;
+		Vector<SceneTreeElement*> addedChildren;
 		if(!completeMatch)
 		{
 			Vector<TreeElement*> newChildren;
@@ -169,6 +179,8 @@ namespace bs
 					newChild->mIsPrefabInstance = isPrefabInstance;
 
 					newChildren.push_back(newChild);
+					addedChildren.push_back(newChild);
+					mElementLookup[newChild->mId] = newChild;
 
 					updateElementGUI(newChild);
 				}
@@ -185,9 +197,51 @@ namespace bs
 			bs_stack_free(tempToDelete);
 
 			element->mChildren = newChildren;
-			needsUpdate = true;
+			updateElementGUI(element);
+		}
+
+		for(UINT32 i = 0; i < (UINT32)element->mChildren.size(); i++)
+		{
+			SceneTreeElement* sceneElement = static_cast<SceneTreeElement*>(element->mChildren[i]);
+			updateElementState(sceneElement);
+
+			if(recursive)
+				updateTreeElement(sceneElement, true);
 		}
 
+		// Newly added elements don't have their children populated yet
+		if(!recursive)
+		{
+			for (auto& child : addedChildren)
+				updateTreeElement(child, true);
+		}
+
+		// Calculate the sorted index of the elements based on their name
+		bs_frame_mark();
+		FrameVector<SceneTreeElement*> sortVector;
+		for (auto& child : element->mChildren)
+			sortVector.push_back(static_cast<SceneTreeElement*>(child));
+
+		std::sort(sortVector.begin(), sortVector.end(),
+			[&](const SceneTreeElement* lhs, const SceneTreeElement* rhs)
+		{
+			return StringUtil::compare(lhs->mName, rhs->mName, false) < 0;
+		});
+
+		UINT32 idx = 0;
+		for (auto& child : sortVector)
+		{
+			child->mSortedIdx = idx;
+			idx++;
+		}
+
+		bs_frame_clear();
+	}
+
+	void GUISceneTreeView::updateElementState(SceneTreeElement* element)
+	{
+		bool needsUpdate = false;
+
 		// Check if name needs updating
 		const String& name = element->mSceneObject->getName();
 		if(element->mName != name)
@@ -221,44 +275,83 @@ namespace bs
 
 		if(needsUpdate)
 			updateElementGUI(element);
+	}
 
-		for(UINT32 i = 0; i < (UINT32)element->mChildren.size(); i++)
+	void GUISceneTreeView::updateTreeElementHierarchy()
+	{
+		HSceneObject root = gSceneManager().getRootNode();
+		if (mRootElement.mSceneObject != root)
 		{
-			SceneTreeElement* sceneElement = static_cast<SceneTreeElement*>(element->mChildren[i]);
-			updateTreeElement(sceneElement);
+			// Whole scene was replaced, rebuild everything
+			mElementLookup.erase(mRootElement.mId);
+
+			mRootElement.mSceneObject = root;
+			mRootElement.mId = root->getInstanceId();
+			mRootElement.mSortedIdx = 0;
+			mRootElement.mIsExpanded = true;
+			mElementLookup[mRootElement.mId] = &mRootElement;
+
+			mDirtyElements.clear();
+			updateTreeElement(&mRootElement, true);
+
+			return;
 		}
 
-		// Calculate the sorted index of the elements based on their name
-		bs_frame_mark();
-		FrameVector<SceneTreeElement*> sortVector;
-		for (auto& child : element->mChildren)
-			sortVector.push_back(static_cast<SceneTreeElement*>(child));
+		if (mDirtyElements.empty())
+			return;
 
-		std::sort(sortVector.begin(), sortVector.end(),
-			[&](const SceneTreeElement* lhs, const SceneTreeElement* rhs)
+		UnorderedMap<UINT64, bool> dirtyElements;
+		std::swap(dirtyElements, mDirtyElements);
+
+		for (auto& entry : dirtyElements)
 		{
-			return StringUtil::compare(lhs->mName, rhs->mName, false) < 0;
-		});
+			// Element might have been removed while updating one of its parents
+			auto iterFind = mElementLookup.find(entry.first);
+			if (iterFind == mElementLookup.end())
+				continue;
 
-		UINT32 idx = 0;
-		for (auto& child : sortVector)
+			SceneTreeElement* element = iterFind->second;
+			if (element->mSceneObject.isDestroyed())
+				continue;
+
+			updateTreeElement(element, entry.second);
+		}
+	}
+
+	void GUISceneTreeView::onHierarchyChanged(const HSceneObject& so, SceneObjectChange change)
+	{
+		auto iterFind = mElementLookup.find(so.getInstanceId());
+		if (iterFind == mElementLookup.end())
+			return;
+
+		SceneTreeElement* element = iterFind->second;
+
+		// Children are updated by the element itself, while its own state (and sort order) is updated by its parent
+		switch(change)
 		{
-			child->mSortedIdx = idx;
-			idx++;
+		case SceneObjectChange::Children:
+			mDirtyElements.insert(std::make_pair(element->mId, false));
+			break;
+		case SceneObjectChange::Name:
+			break;
+		case SceneObjectChange::Active:
+		case SceneObjectChange::PrefabLink:
+			mDirtyElements[element->mId] = true;
+			break;
 		}
 
-		bs_frame_clear();
+		if (change != SceneObjectChange::Children && element->mParent != nullptr)
+		{
+			SceneTreeElement* parent = static_cast<SceneTreeElement*>(element->mParent);
+			mDirtyElements.insert(std::make_pair(parent->mId, false));
+		}
 	}
 
-	void GUISceneTreeView::updateTreeElementHierarchy()
+	void GUISceneTreeView::onIdsRestored(const HSceneObject& so)
 	{
-		HSceneObject root = gSceneManager().getRootNode();
-		mRootElement.mSceneObject = root;
-		mRootElement.mId = root->getInstanceId();
-		mRootElement.mSortedIdx = 0;
-		mRootElement.mIsExpanded = true;
-
-		updateTreeElement(&mRootElement);
+		// Restored object might not be part of the tree yet, in which case it gets fully populated when its parent adds
+		// it. Otherwise the element stays matched to the restored object by ID, but its children might be stale.
+		mDirtyElements[so.getInstanceId()] = true;
 	}
 
 	void GUISceneTreeView::renameTreeElement(GUITreeView::TreeElement* element, const WString& name)
@@ -292,6 +385,23 @@ namespace bs
 		if(element->mIsSelected)
 			unselectElement(element);
 
+		Stack<TreeElement*> todo;
+		todo.push(element);
+
+		while (!todo.empty())
+		{
+			SceneTreeElement* currentElem = static_cast<SceneTreeElement*>(todo.top());
+			todo.pop();
+
+			// Element with the same ID might have already replaced this one (e.g. an object restored by undo)
+			auto iterFind = mElementLookup.find(currentElem->mId);
+			if (iterFind != mElementLookup.end() && iterFind->second == currentElem)
+				mElementLookup.erase(iterFind);
+
+			for (auto& child : currentElem->mChildren)
+				todo.push(child);
+		}
+
 		bs_delete(element);
 	}
 
@@ -450,25 +560,11 @@ namespace bs
 
 	GUISceneTreeView::SceneTreeElement* GUISceneTreeView::findTreeElement(const HSceneObject& so)
 	{
-		Stack<SceneTreeElement*> todo;
-		todo.push(&mRootElement);
-
-		while (!todo.empty())
-		{
-			SceneTreeElement* currentElem = todo.top();
-			todo.pop();
-
-			if (so == currentElem->mSceneObject)
-				return currentElem;
-
-			for (auto& child : currentElem->mChildren)
-			{
-				SceneTreeElement* sceneChild = static_cast<SceneTreeElement*>(child);
-				todo.push(sceneChild);
-			}
-		}
+		auto iterFind = mElementLookup.find(so.getInstanceId());
+		if (iterFind == mElementLookup.end())
+			return nullptr;
 
-		return nullptr;
+		return iterFind->second;
 	}
 
 	void GUISceneTreeView::duplicateSelection()
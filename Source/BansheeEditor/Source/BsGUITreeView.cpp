@@ -25,6 +25,7 @@ namespace bs
 	const UINT32 GUITreeView::INDENT_SIZE = 10;
 	const UINT32 GUITreeView::INITIAL_INDENT_OFFSET = 16;
 	const UINT32 GUITreeView::DRAG_MIN_DISTANCE = 3;
+	const UINT32 GUITreeView::VISIBLE_ROW_PADDING = 10;
 	const float GUITreeView::AUTO_EXPAND_DELAY_SEC = 0.5f;
 	const float GUITreeView::SCROLL_AREA_HEIGHT_PCT = 0.1f;
 	const UINT32 GUITreeView::SCROLL_SPEED_PX_PER_SEC = 100;
@@ -33,7 +34,7 @@ namespace bs
 
 	GUITreeView::TreeElement::TreeElement()
 		: mParent(nullptr), mFoldoutBtn(nullptr), mElement(nullptr), mSortedIdx(0), mIsExpanded(false), mIsSelected(false)
-		, mIsHighlighted(false), mIsVisible(true), mIsCut(false), mIsDisabled(false)
+		, mIsHighlighted(false), mIsVisible(true), mIsCut(false), mIsDisabled(false), mIsInView(false), mOptimalWidth(0)
 	{ }
 
 	GUITreeView::TreeElement::~TreeElement()
@@ -87,7 +88,8 @@ namespace bs
 		, mFoldoutBtnStyle(foldoutBtnStyle), mSelectionBackgroundStyle(selectionBackgroundStyle)
 		, mHighlightBackgroundStyle(highlightBackgroundStyle), mEditBoxStyle(editBoxStyle)
 		, mDragHighlightStyle(dragHighlightStyle), mDragSepHighlightStyle(dragSepHighlightStyle), mIsElementSelected(false)
-		, mIsElementHighlighted(false), mEditElement(nullptr), mNameEditBox(nullptr), mDragInProgress(false)
+		, mRowHeight(0), mRowsDirty(true), mIsElementHighlighted(false), mEditElement(nullptr), mNameEditBox(nullptr)
+		, mDragInProgress(false)
 		, mDragHighlight(nullptr), mDragSepHighlight(nullptr), mScrollState(ScrollState::None), mLastScrollTime(0.0f)
 		, mMouseOverDragElement(nullptr), mMouseOverDragElementTime(0.0f)
 	{
@@ -152,11 +154,8 @@ namespace bs
 			temporarilyExpandElement(element);
 		}
 
-		// NOTE - Instead of iterating through every visible element and comparing it with internal values,
-		// I might just want to add callbacks to SceneManager that notify me of any changes and then only perform
-		// update if anything is actually dirty
-
 		updateTreeElementHierarchy();
+		updateVisibleRows();
 
 		// Attempt to scroll if needed
 		if(mScrollState != ScrollState::None)
@@ -750,7 +749,7 @@ namespace bs
 		if(element == &getRootElement())
 			return;
 
-		if(element->mIsVisible)
+		if(element->mIsVisible && element->mIsInView)
 		{
 			HString name(toWString(element->mName));
 			if(element->mElement == nullptr)
@@ -814,13 +813,82 @@ namespace bs
 				element->mFoldoutBtn = nullptr;
 			}
 
-			if(element->mIsSelected && element->mIsExpanded)
-				unselectElement(element);
+			if(!element->mIsVisible)
+			{
+				element->mIsInView = false;
+
+				if(element->mIsSelected && element->mIsExpanded)
+					unselectElement(element);
+			}
 		}
 
+		mRowsDirty = true;
 		_markLayoutAsDirty();
 	}
 
+	void GUITreeView::updateVisibleRows()
+	{
+		Rect2I visibleArea = _getClippedBounds();
+		if(!mRowsDirty && visibleArea == mVisibleRowArea)
+			return;
+
+		mVisibleRowArea = visibleArea;
+
+		// Rows are laid out in the same order as in _updateLayoutInternal, but only their positions are calculated here
+		Stack<TreeElement*> todo;
+		todo.push(&getRootElement());
+
+		Vector<TreeElement*> tempOrderedElements;
+
+		INT32 rowY = mLayoutData.area.y;
+		while(!todo.empty())
+		{
+			TreeElement* current = todo.top();
+			todo.pop();
+
+			if(current != &getRootElement())
+			{
+				INT32 rowStride = (INT32)(mRowHeight + ELEMENT_EXTRA_SPACING);
+				INT32 padding = (INT32)VISIBLE_ROW_PADDING * rowStride;
+
+				// Row height isn't known until at least one element is created, so always create the first one
+				bool inView = mRowHeight == 0 || current == mEditElement ||
+					((rowY + rowStride) > (visibleArea.y - padding) &&
+					rowY < (visibleArea.y + (INT32)visibleArea.height + padding));
+
+				if(current->mIsInView != inView)
+				{
+					current->mIsInView = inView;
+					updateElementGUI(current);
+				}
+
+				if(mRowHeight == 0 && current->mElement != nullptr)
+				{
+					mRowHeight = (UINT32)current->mElement->_getOptimalSize().y;
+					rowStride = (INT32)(mRowHeight + ELEMENT_EXTRA_SPACING);
+				}
+
+				rowY += rowStride;
+			}
+
+			tempOrderedElements.resize(current->mChildren.size(), nullptr);
+			for(auto& child : current->mChildren)
+				tempOrderedElements[child->mSortedIdx] = child;
+
+			for(auto iter = tempOrderedElements.rbegin(); iter != tempOrderedElements.rend(); ++iter)
+			{
+				TreeElement* child = *iter;
+
+				if(!child->mIsVisible)
+					continue;
+
+				todo.push(child);
+			}
+		}
+
+		mRowsDirty = false;
+	}
+
 	void GUITreeView::elementToggled(TreeElement* element, bool toggled)
 	{
 		clearPing();
@@ -863,6 +931,13 @@ namespace bs
 		mNameEditBox->setText(toWString(element->mName));
 		mNameEditBox->setFocus(true);
 
+		// Edit box is positioned relative to the element, so make sure it exists even if the element is out of view
+		if(!element->mIsInView)
+		{
+			element->mIsInView = true;
+			updateElementGUI(element);
+		}
+
 		if(element->mElement != nullptr)
 			element->mElement->setVisible(false);
 	}
@@ -916,9 +991,12 @@ namespace bs
 				todo.pop();
 
 				INT32 yOffset = 0;
-				if(current->mElement != nullptr)
+				if(current != &getRootElementConst())
 				{
-					Vector2I curOptimalSize = current->mElement->_getOptimalSize();
+					Vector2I curOptimalSize(current->mOptimalWidth, (INT32)mRowHeight);
+					if(current->mElement != nullptr)
+						curOptimalSize = current->mElement->_getOptimalSize();
+
 					optimalSize.x = std::max(optimalSize.x, 
 						(INT32)(INITIAL_INDENT_OFFSET + curOptimalSize.x + currentUpdateElement.indent * INDENT_SIZE));
 					yOffset = curOptimalSize.y + ELEMENT_EXTRA_SPACING;
@@ -984,9 +1062,6 @@ namespace bs
 		Stack<UpdateTreeElement> todo;
 		todo.push(UpdateTreeElement(&getRootElement(), 0));
 
-		// NOTE - Instead of iterating through all elements, try to find those within the clip rect
-		// and only iterate through those. Others should somehow be marked in-active (similar to GUIElement::isDisabled()?)
-
 		Vector<TreeElement*> tempOrderedElements;
 
 		Vector2I offset(data.area.x, data.area.y);
@@ -1000,9 +1075,16 @@ namespace bs
 
 			INT32 btnHeight = 0;
 			INT32 yOffset = 0;
-			if(current->mElement != nullptr)
+			if(current != &getRootElement())
 			{
-				Vector2I elementSize = current->mElement->_getOptimalSize();
+				// Elements out of view don't have GUI elements, but they still take up space
+				Vector2I elementSize(current->mOptimalWidth, (INT32)mRowHeight);
+				if(current->mElement != nullptr)
+				{
+					elementSize = current->mElement->_getOptimalSize();
+					current->mOptimalWidth = elementSize.x;
+				}
+
 				btnHeight = elementSize.y;
 
 				mVisibleElements.push_back(InteractableElement(current->mParent, current->mSortedIdx * 2 + 0, Rect2I(data.area.x, offset.y, data.area.width, ELEMENT_EXTRA_SPACING)));
@@ -1017,7 +1099,10 @@ namespace bs
 				childData.area.width = elementSize.x;
 				childData.area.height = elementSize.y;
 
-				current->mElement->_setLayoutData(childData);
+				current->mBounds = childData.area;
+
+				if(current->mElement != nullptr)
+					current->mElement->_setLayoutData(childData);
 
 				yOffset = btnHeight;
 			}
@@ -1073,25 +1158,24 @@ namespace bs
 
 		for(auto selectedElem : mSelectedElements)
 		{
-			GUILabel* targetElement = selectedElem.element->mElement;
-			if (targetElement == nullptr)
+			if (!selectedElem.element->mIsVisible)
 				continue;
 
 			GUILayoutData childData = data;
-			childData.area.y = targetElement->_getLayoutData().area.y;
-			childData.area.height = targetElement->_getLayoutData().area.height;
+			childData.area.y = selectedElem.element->mBounds.y;
+			childData.area.height = selectedElem.element->mBounds.height;
 
 			selectedElem.background->_setLayoutData(childData);
 		}
 
 		if (mIsElementHighlighted)
 		{
-			GUILabel* targetElement = mHighlightedElement.element->mElement;
-			if (targetElement != nullptr)
+			TreeElement* targetElement = mHighlightedElement.element;
+			if (targetElement->mIsVisible)
 			{
 				GUILayoutData childData = data;
-				childData.area.y = targetElement->_getLayoutData().area.y;
-				childData.area.height = targetElement->_getLayoutData().area.height;
+				childData.area.y = targetElement->mBounds.y;
+				childData.area.height = targetElement->mBounds.height;
 
 				mHighlightedElement.background->_setLayoutData(childData);
 			}
@@ -1293,7 +1377,7 @@ namespace bs
 
 	void GUITreeView::scrollToElement(TreeElement* element, bool center)
 	{
-		if(element->mElement == nullptr)
+		if(!element->mIsVisible)
 			return;
 
 		GUIScrollArea* scrollArea = findParentScrollArea();
@@ -1304,7 +1388,7 @@ namespace bs
 		{
 			Rect2I myBounds = _getClippedBounds();
 			INT32 clipVertCenter = myBounds.y + (INT32)Math::roundToInt(myBounds.height * 0.5f);
-			INT32 elemVertCenter = element->mElement->_getLayoutData().area.y + (INT32)Math::roundToInt(element->mElement->_getLayoutData().area.height * 0.5f);
+			INT32 elemVertCenter = element->mBounds.y + (INT32)Math::roundToInt(element->mBounds.height * 0.5f);
 
 			if(elemVertCenter > clipVertCenter)
 				scrollArea->scrollDownPx(elemVertCenter - clipVertCenter);
@@ -1314,8 +1398,8 @@ namespace bs
 		else
 		{
 			Rect2I myBounds = _getClippedBounds();
-			INT32 elemVertTop = element->mElement->_getLayoutData().area.y;
-			INT32 elemVertBottom = element->mElement->_getLayoutData().area.y + element->mElement->_getLayoutData().area.height;
+			INT32 elemVertTop = element->mBounds.y;
+			INT32 elemVertBottom = element->mBounds.y + element->mBounds.height;
 
 			INT32 top = myBounds.y;
 			INT32 bottom = myBounds.y + myBounds.height;
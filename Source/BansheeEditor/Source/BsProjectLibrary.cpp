@@ -16,7 +16,8 @@
 #include "BsResource.h"
 #include "BsEditorApplication.h"
 #include "BsShader.h"
-#include <regex>
+#include "BsMemorySerializer.h"
+#include "BsDataStream.h"
 
 using namespace std::placeholders;
 
@@ -51,7 +52,7 @@ namespace bs
 	{ }
 
 	ProjectLibrary::ProjectLibrary()
-		: mRootEntry(nullptr), mIsLoaded(false)
+		: mRootEntry(nullptr), mIsLoaded(false), mSearchIndexDirty(true)
 	{
 		mRootEntry = bs_new<DirectoryEntry>(mResourcesFolder, mResourcesFolder.getWTail(), nullptr);
 	}
@@ -275,6 +276,7 @@ namespace bs
 	{
 		FileEntry* newResource = bs_new<FileEntry>(filePath, filePath.getWTail(), parent);
 		parent->mChildren.push_back(newResource);
+		mSearchIndexDirty = true;
 
 		reimportResourceInternal(newResource, importOptions, forceReimport);
 		onEntryAdded(newResource->path);
@@ -286,6 +288,7 @@ namespace bs
 	{
 		DirectoryEntry* newEntry = bs_new<DirectoryEntry>(dirPath, dirPath.getWTail(), parent);
 		parent->mChildren.push_back(newEntry);
+		mSearchIndexDirty = true;
 
 		onEntryAdded(newEntry->path);
 		return newEntry;
@@ -322,6 +325,7 @@ namespace bs
 			[&] (const LibraryEntry* entry) { return entry == resource; });
 
 		parent->mChildren.erase(findIter);
+		mSearchIndexDirty = true;
 
 		Path originalPath = resource->path;
 		onEntryRemoved(originalPath);
@@ -355,6 +359,8 @@ namespace bs
 			parent->mChildren.erase(findIter);
 		}
 
+		mSearchIndexDirty = true;
+
 		onEntryRemoved(directory->path);
 		bs_delete(directory);
 	}
@@ -376,6 +382,7 @@ namespace bs
 				{
 					SPtr<ProjectFileMeta> fileMeta = std::static_pointer_cast<ProjectFileMeta>(loadedMeta);
 					fileEntry->meta = fileMeta;
+					mSearchIndexDirty = true;
 
 					auto& resourceMetas = fileEntry->meta->getResourceMetaData();
 
@@ -393,7 +400,7 @@ namespace bs
 			}
 		}
 
-		if (!isUpToDate(fileEntry) || forceReimport)
+		if (forceReimport || !isUpToDate(fileEntry, importOptions))
 		{
 			// Note: If resource is native we just copy it to the internal folder. We could avoid the copy and 
 			// load the resource directly from the Resources folder but that requires complicating library code.
@@ -410,6 +417,9 @@ namespace bs
 			else
 				curImportOptions = importOptions;
 
+			// Hash the source before importing, so changes made during the import are detected on the next check
+			String sourceHash = getSourceHash(fileEntry->path);
+
 			Vector<SubResource> importedResources;
 			if (isNativeResource)
 			{
@@ -554,13 +564,16 @@ namespace bs
 			}
 
 			fileEntry->lastUpdateTime = std::time(nullptr);
+			fileEntry->sourceHash = sourceHash;
+			fileEntry->importOptionsHash = getImportOptionsHash(curImportOptions);
+			mSearchIndexDirty = true;
 
 			onEntryImported(fileEntry->path);
 			reimportDependants(fileEntry->path);
 		}
 	}
 
-	bool ProjectLibrary::isUpToDate(FileEntry* resource) const
+	bool ProjectLibrary::isUpToDate(FileEntry* resource, const SPtr<ImportOptions>& importOptions)
 	{
 		if(resource->meta == nullptr)
 			return false;
@@ -576,8 +589,60 @@ namespace bs
 				return false;
 		}
 
+		const SPtr<ImportOptions>& curImportOptions = 
+			importOptions != nullptr ? importOptions : resource->meta->getImportOptions();
+
+		return isSourceUpToDate(resource, curImportOptions);
+	}
+
+	bool ProjectLibrary::isSourceUpToDate(FileEntry* resource, const SPtr<ImportOptions>& importOptions)
+	{
+		// Entries imported before hashes were tracked have no hashes, in which case only the timestamp is checked
+		if (!resource->importOptionsHash.empty())
+		{
+			if (getImportOptionsHash(importOptions) != resource->importOptionsHash)
+				return false;
+		}
+
 		std::time_t lastModifiedTime = FileSystem::getLastModifiedTime(resource->path);
-		return lastModifiedTime <= resource->lastUpdateTime;
+		if (lastModifiedTime <= resource->lastUpdateTime)
+			return true;
+
+		// Timestamp changes without content changes are common (e.g. version control checkouts), so compare the contents
+		// before deciding a reimport is needed
+		if (resource->sourceHash.empty() || getSourceHash(resource->path) != resource->sourceHash)
+			return false;
+
+		resource->lastUpdateTime = std::time(nullptr);
+		return true;
+	}
+
+	String ProjectLibrary::getSourceHash(const Path& path)
+	{
+		if (!FileSystem::isFile(path))
+			return StringUtil::BLANK;
+
+		SPtr<DataStream> stream = FileSystem::openFile(path);
+		if (stream == nullptr)
+			return StringUtil::BLANK;
+
+		String hash = md5(stream);
+		stream->close();
+
+		return hash;
+	}
+
+	String ProjectLibrary::getImportOptionsHash(const SPtr<ImportOptions>& importOptions)
+	{
+		if (importOptions == nullptr)
+			return StringUtil::BLANK;
+
+		MemorySerializer ms;
+		UINT32 numBytes = 0;
+		UINT8* bytes = ms.encode(importOptions.get(), numBytes);
+
+		SPtr<DataStream> stream = bs_shared_ptr_new<MemoryDataStream>(bytes, numBytes);
+		return md5(stream);
 	}
 
 	Vector<ProjectLibrary::LibraryEntry*> ProjectLibrary::search(const WString& pattern)
@@ -587,77 +652,128 @@ namespace bs
 
 	Vector<ProjectLibrary::LibraryEntry*> ProjectLibrary::search(const WString& pattern, const Vector<UINT32>& typeIds)
 	{
-		Vector<LibraryEntry*> foundEntries;
+		updateSearchIndex();
 
-		std::wregex escape(L"[.^$|()\\[\\]{}*+?\\\\]");
-		WString replace(L"\\\\&");
-		WString escapedPattern = std::regex_replace(pattern, escape, replace, std::regex_constants::match_default | std::regex_constants::format_sed);
+		WString lowerPattern = pattern;
+		StringUtil::toLowerCase(lowerPattern);
 
-		std::wregex wildcard(L"\\\\\\*");
-		WString wildcardReplace(L".*");
-		WString searchPattern = std::regex_replace(escapedPattern, wildcard, L".*");
+		Vector<WString> tokens = StringUtil::tokenizePattern(lowerPattern);
 
-		std::wregex searchRegex(searchPattern, std::regex_constants::ECMAScript | std::regex_constants::icase);
+		bool hasName = false;
+		for (auto& token : tokens)
+			hasName |= !token.empty();
 
-		Stack<DirectoryEntry*> todo;
-		todo.push(mRootEntry);
-		while (!todo.empty())
+		UnorderedSet<LibraryEntry*> typeMatches;
+		for (auto& typeId : typeIds)
 		{
-			DirectoryEntry* dirEntry = todo.top();
-			todo.pop();
+			auto iterFind = mSearchTypeIndex.find(typeId);
+			if (iterFind != mSearchTypeIndex.end())
+				typeMatches.insert(iterFind->second.begin(), iterFind->second.end());
+		}
 
-			for (auto& child : dirEntry->mChildren)
+		Vector<LibraryEntry*> foundEntries;
+		if (!hasName && typeIds.size() > 0)
+			foundEntries.assign(typeMatches.begin(), typeMatches.end());
+		else
+		{
+			// Index is sorted by name, so if the pattern doesn't start with a wildcard only the entries starting with the
+			// same prefix need to be checked
+			std::pair<UINT32, UINT32> range = findPrefixRange(mSearchIndex, tokens[0]);
+			for (UINT32 i = range.first; i < range.second; i++)
 			{
-				if (std::regex_match(child->elementName, searchRegex))
-				{
-					if (typeIds.size() == 0)
-						foundEntries.push_back(child);
-					else
-					{
-						if (child->type == LibraryEntryType::File)
-						{
-							FileEntry* childFileEntry = static_cast<FileEntry*>(child);
-							if (childFileEntry->meta != nullptr)
-							{
-								auto& resourceMetas = childFileEntry->meta->getResourceMetaData();
-								for (auto& typeId : typeIds)
-								{
-									bool found = false;
-									for (auto& resMeta : resourceMetas)
-									{
-										if (resMeta->getTypeID() == typeId)
-										{
-											foundEntries.push_back(child);
-											found = true;
-											break;
-										}
-									}
-
-									if (found)
-										break;
-								}
-							}
-						}
-					}
-				}
+				const SearchIndexEntry& indexEntry = mSearchIndex[i];
+				if (typeIds.size() > 0 && typeMatches.find(indexEntry.entry) == typeMatches.end())
+					continue;
 
-				if (child->type == LibraryEntryType::Directory)
-				{
-					DirectoryEntry* childDirEntry = static_cast<DirectoryEntry*>(child);
-					todo.push(childDirEntry);
-				}
+				if (StringUtil::matchTokens(indexEntry.name, tokens))
+					foundEntries.push_back(indexEntry.entry);
 			}
 		}
 
+		// Type matches come from an unordered set and entries in different folders can share a name, so fall back to
+		// the path to keep the order the same between searches
 		std::sort(foundEntries.begin(), foundEntries.end(), 
 			[&](const LibraryEntry* a, const LibraryEntry* b) 
 		{ 
-			return a->elementName.compare(b->elementName) < 0;
+			int cmp = a->elementName.compare(b->elementName);
+			if (cmp != 0)
+				return cmp < 0;
+
+			return a->path.toWString() < b->path.toWString();
 		});
 
 		return foundEntries;
 	}
 
+	std::pair<UINT32, UINT32> ProjectLibrary::findPrefixRange(const Vector<SearchIndexEntry>& index, 
+		const WString& prefix)
+	{
+		if (prefix.empty())
+			return std::make_pair(0U, (UINT32)index.size());
+
+		auto iterBegin = std::lower_bound(index.begin(), index.end(), prefix,
+			[](const SearchIndexEntry& entry, const WString& value) { return entry.name < value; });
+
+		auto iterEnd = iterBegin;
+		while (iterEnd != index.end() && iterEnd->name.compare(0, prefix.size(), prefix) == 0)
+			++iterEnd;
+
+		return std::make_pair((UINT32)(iterBegin - index.begin()), (UINT32)(iterEnd - index.begin()));
+	}
+
+	void ProjectLibrary::updateSearchIndex()
+	{
+		if (!mSearchIndexDirty)
+			return;
+
+		mSearchIndex.clear();
+		mSearchTypeIndex.clear();
+
+		if (mRootEntry != nullptr)
+		{
+			Stack<DirectoryEntry*> todo;
+			todo.push(mRootEntry);
+			while (!todo.empty())
+			{
+				DirectoryEntry* dirEntry = todo.top();
+				todo.pop();
+
+				for (auto& child : dirEntry->mChildren)
+				{
+					SearchIndexEntry indexEntry;
+					indexEntry.name = child->elementName;
+					indexEntry.entry = child;
+					StringUtil::toLowerCase(indexEntry.name);
+
+					mSearchIndex.push_back(indexEntry);
+
+					if (child->type == LibraryEntryType::File)
+					{
+						FileEntry* childFileEntry = static_cast<FileEntry*>(child);
+						if (childFileEntry->meta == nullptr)
+							continue;
+
+						auto& resourceMetas = childFileEntry->meta->getResourceMetaData();
+						for (auto& resMeta : resourceMetas)
+						{
+							// Files can contain multiple resources of the same type, only register them once
+							Vector<LibraryEntry*>& typeEntries = mSearchTypeIndex[resMeta->getTypeID()];
+							if (typeEntries.empty() || typeEntries.back() != child)
+								typeEntries.push_back(child);
+						}
+					}
+					else if (child->type == LibraryEntryType::Directory)
+						todo.push(static_cast<DirectoryEntry*>(child));
+				}
+			}
+		}
+
+		std::sort(mSearchIndex.begin(), mSearchIndex.end(),
+			[](const SearchIndexEntry& a, const SearchIndexEntry& b) { return a.name < b.name; });
+
+		mSearchIndexDirty = false;
+	}
+
 	ProjectLibrary::LibraryEntry* ProjectLibrary::findEntry(const Path& path) const
 	{
 		Path fullPath = path;
@@ -969,6 +1085,7 @@ namespace bs
 				oldEntry->parent = newEntryParent;
 				oldEntry->path = newFullPath;
 				oldEntry->elementName = newFullPath.getWTail();
+				mSearchIndexDirty = true;
 
 				if(oldEntry->type == LibraryEntryType::Directory) // Update child paths
 				{
@@ -1514,6 +1631,7 @@ namespace bs
 				FileSystem::remove(entry);
 		}
 
+		mSearchIndexDirty = true;
 		mIsLoaded = true;
 	}
 
@@ -1538,6 +1656,7 @@ namespace bs
 
 		deleteRecursive(mRootEntry);
 		mRootEntry = nullptr;
+		mSearchIndexDirty = true;
 	}
 
 	Vector<Path> ProjectLibrary::getImportDependencies(const FileEntry* entry)
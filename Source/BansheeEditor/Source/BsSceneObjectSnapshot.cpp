@@ -0,0 +1,174 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsSceneObjectSnapshot.h"
+#include "BsSceneObject.h"
+#include "BsMemorySerializer.h"
+#include "BsBinaryDelta.h"
+#include "BsCompression.h"
+#include "BsDataStream.h"
+
+namespace bs
+{
+	const UINT32 SceneObjectSnapshot::MIN_COMPRESSION_SIZE = 1024;
+
+	UnorderedMap<UINT64, SceneObjectSnapshot*> SceneObjectSnapshot::sLatestSnapshots;
+
+	SceneObjectSnapshot::~SceneObjectSnapshot()
+	{
+		clear();
+	}
+
+	void SceneObjectSnapshot::record(const HSceneObject& sceneObject)
+	{
+		clear();
+
+		bool isInstantiated = !sceneObject->hasFlag(SOF_DontInstantiate);
+		sceneObject->_setFlags(SOF_DontInstantiate);
+
+		UINT32 size = 0;
+		MemorySerializer serializer;
+		UINT8* buffer = serializer.encode(sceneObject.get(), size);
+
+		if (isInstantiated)
+			sceneObject->_unsetFlags(SOF_DontInstantiate);
+
+		SPtr<MemoryDataStream> data = bs_shared_ptr_new<MemoryDataStream>(buffer, size);
+		mObjectId = sceneObject->getInstanceId();
+
+		// The previous snapshot of the same object now only needs to store what differs from this one
+		auto iterFind = sLatestSnapshots.find(mObjectId);
+		if (iterFind != sLatestSnapshots.end())
+			iterFind->second->encodeAgainst(this, data);
+
+		sLatestSnapshots[mObjectId] = this;
+		setData(data, false);
+	}
+
+	SPtr<MemoryDataStream> SceneObjectSnapshot::getData() const
+	{
+		if (mData == nullptr)
+			return nullptr;
+
+		SPtr<MemoryDataStream> data = mData;
+		if (mIsCompressed)
+		{
+			data->seek(0);
+
+			SPtr<DataStream> input = data;
+			data = Compression::decompress(input);
+
+			if (data == nullptr)
+				return nullptr;
+		}
+
+		if (!mIsDelta)
+			return data;
+
+		SPtr<MemoryDataStream> base = mNewer->getData();
+		if (base == nullptr)
+			return nullptr;
+
+		UINT32 size = 0;
+		UINT8* buffer = BinaryDelta::decode(base->getPtr(), (UINT32)base->size(), data->getPtr(), (UINT32)data->size(),
+			size);
+
+		if (buffer == nullptr)
+			return nullptr;
+
+		return bs_shared_ptr_new<MemoryDataStream>(buffer, size);
+	}
+
+	void SceneObjectSnapshot::clear()
+	{
+		// Snapshot encoded against this one must be able to decode without it
+		SceneObjectSnapshot* older = mOlder;
+		if (older != nullptr)
+			older->makeIndependent();
+
+		if (mNewer != nullptr)
+		{
+			mNewer->mOlder = nullptr;
+			mNewer = nullptr;
+		}
+
+		auto iterFind = sLatestSnapshots.find(mObjectId);
+		if (iterFind != sLatestSnapshots.end() && iterFind->second == this)
+		{
+			// Let new snapshots chain with the older one instead
+			if (older != nullptr)
+				iterFind->second = older;
+			else
+				sLatestSnapshots.erase(iterFind);
+		}
+
+		mData = nullptr;
+		mIsDelta = false;
+		mIsCompressed = false;
+	}
+
+	UINT32 SceneObjectSnapshot::getMemoryUsage() const
+	{
+		if (mData == nullptr)
+			return 0;
+
+		return (UINT32)mData->size();
+	}
+
+	void SceneObjectSnapshot::setData(const SPtr<MemoryDataStream>& data, bool isDelta)
+	{
+		mData = data;
+		mIsDelta = isDelta;
+		mIsCompressed = false;
+
+		if (data->size() < MIN_COMPRESSION_SIZE)
+			return;
+
+		data->seek(0);
+
+		SPtr<DataStream> input = data;
+		SPtr<MemoryDataStream> compressed = Compression::compress(input);
+
+		if (compressed != nullptr && compressed->size() < data->size())
+		{
+			mData = compressed;
+			mIsCompressed = true;
+		}
+	}
+
+	void SceneObjectSnapshot::encodeAgainst(SceneObjectSnapshot* newer, const SPtr<MemoryDataStream>& newerData)
+	{
+		// Only the latest snapshot is ever encoded against a new one, and the latest snapshot always stores full data
+		SPtr<MemoryDataStream> data = getData();
+		if (data == nullptr)
+			return;
+
+		UINT32 deltaSize = 0;
+		UINT8* delta = BinaryDelta::encode(newerData->getPtr(), (UINT32)newerData->size(), data->getPtr(),
+			(UINT32)data->size(), deltaSize);
+
+		mNewer = newer;
+		newer->mOlder = this;
+
+		setData(bs_shared_ptr_new<MemoryDataStream>(delta, deltaSize), true);
+	}
+
+	void SceneObjectSnapshot::makeIndependent()
+	{
+		if (!mIsDelta)
+			return;
+
+		SPtr<MemoryDataStream> data = getData();
+
+		mNewer->mOlder = nullptr;
+		mNewer = nullptr;
+
+		if (data != nullptr)
+			setData(data, false);
+		else
+		{
+			mData = nullptr;
+			mIsDelta = false;
+			mIsCompressed = false;
+		}
+	}
+}
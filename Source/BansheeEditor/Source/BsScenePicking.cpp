@@ -25,6 +25,11 @@
 #include "BsRenderer.h"
 #include "BsGizmoManager.h"
 #include "BsRendererUtility.h"
+#include "BsGpuReadbackManager.h"
+#include "BsTriangleBVH.h"
+#include "BsMeshData.h"
+#include "BsVertexDataDesc.h"
+#include "BsResources.h"
 
 using namespace std::placeholders;
 
@@ -44,10 +49,18 @@ namespace bs
 		}
 
 		gCoreThread().queueCommand(std::bind(&ct::ScenePicking::initialize, mCore));
+
+		mResourceDestroyedConn = gResources().onResourceDestroyed.connect(
+			std::bind(&ScenePicking::onResourceChanged, this, _1));
+		mResourceModifiedConn = gResources().onResourceModified.connect(
+			[this](const HResource& resource) { onResourceChanged(resource.getUUID()); });
 	}
 
 	ScenePicking::~ScenePicking()
 	{
+		mResourceDestroyedConn.disconnect();
+		mResourceModifiedConn.disconnect();
+
 		gCoreThread().queueCommand(std::bind(&ct::ScenePicking::destroy, mCore));
 	}
 
@@ -68,8 +81,236 @@ namespace bs
 		return selectedObjects[0];
 	}
 
+	HSceneObject ScenePicking::pickClosestObjectCPU(const SPtr<Camera>& cam, const Vector2I& position, 
+		Vector<HSceneObject>& ignoreRenderables, SnapData* data)
+	{
+		Ray ray = cam->screenPointToRay(position);
+
+		HSceneObject closestObject;
+		float closestDistance = std::numeric_limits<float>::max();
+		Vector3 closestNormal = -ray.getDirection();
+
+		const Map<Renderable*, SceneRenderableData>& renderables = SceneManager::instance().getAllRenderables();
+		for (auto& renderableData : renderables)
+		{
+			SPtr<Renderable> renderable = renderableData.second.renderable;
+			HSceneObject so = renderableData.second.sceneObject;
+
+			if (!so->getActive())
+				continue;
+
+			HMesh mesh = renderable->getMesh();
+			if (!mesh.isLoaded())
+				continue;
+
+			auto iterFind = std::find(ignoreRenderables.begin(), ignoreRenderables.end(), so);
+			if (iterFind != ignoreRenderables.end())
+				continue;
+
+			Matrix4 worldTransform = so->getWorldTfrm();
+			Bounds worldBounds = mesh->getProperties().getBounds();
+			worldBounds.transformAffine(worldTransform);
+
+			std::pair<bool, float> boundsHit = ray.intersects(worldBounds.getBox());
+			if (!boundsHit.first || boundsHit.second >= closestDistance)
+				continue;
+
+			// Animated meshes get deformed on the GPU so their cached triangles don't match what is rendered, fall back
+			// to bounds for them
+			SPtr<TriangleBVH> bvh;
+			if (mesh->getSkeleton() == nullptr && mesh->getMorphShapes() == nullptr)
+				bvh = getMeshBVH(mesh);
+
+			if (bvh == nullptr)
+			{
+				const AABox& box = worldBounds.getBox();
+				Vector3 hitPoint = ray.getPoint(boundsHit.second);
+
+				// Pick the normal of the box face closest to the hit point
+				Vector3 offset = hitPoint - box.getCenter();
+				Vector3 halfSize = box.getHalfSize();
+
+				UINT32 axis = 0;
+				float maxDist = -1.0f;
+				for (UINT32 i = 0; i < 3; i++)
+				{
+					float dist = halfSize[i] > 0.0f ? Math::abs(offset[i]) / halfSize[i] : 1.0f;
+					if (dist > maxDist)
+					{
+						maxDist = dist;
+						axis = i;
+					}
+				}
+
+				closestNormal = Vector3::ZERO;
+				closestNormal[axis] = offset[axis] >= 0.0f ? 1.0f : -1.0f;
+				closestDistance = boundsHit.second;
+				closestObject = so;
+
+				continue;
+			}
+
+			// Test the triangles in local space, then convert the results back to world space
+			Matrix4 invWorldTransform = worldTransform.inverseAffine();
+
+			Ray localRay = ray;
+			localRay.transformAffine(invWorldTransform);
+
+			float localDistance;
+			Vector3 localNormal;
+			UINT32 triangleIdx;
+			if (!bvh->intersects(localRay, localDistance, localNormal, triangleIdx))
+				continue;
+
+			Vector3 hitPoint = worldTransform.multiplyAffine(localRay.getPoint(localDistance));
+			float distance = hitPoint.distance(ray.getOrigin());
+			if (distance >= closestDistance)
+				continue;
+
+			closestNormal = Vector3::normalize(invWorldTransform.transpose().multiplyDirection(localNormal));
+			closestDistance = distance;
+			closestObject = so;
+		}
+
+		if (data != nullptr && closestObject)
+		{
+			data->pickPosition = ray.getPoint(closestDistance);
+			data->normal = closestNormal;
+		}
+
+		return closestObject;
+	}
+
+	SPtr<TriangleBVH> ScenePicking::getMeshBVH(const HMesh& mesh)
+	{
+		const String& uuid = mesh.getUUID();
+
+		// Mesh data can be modified at runtime without the resource being reported as modified, so check the version
+		UINT32 version = mesh->getCachedDataVersion();
+
+		auto iterFind = mMeshBVHs.find(uuid);
+		if (iterFind != mMeshBVHs.end() && iterFind->second.version == version)
+			return iterFind->second.bvh;
+
+		// Cache the result even if the mesh can't be used, so we don't check again next time
+		SPtr<TriangleBVH> bvh;
+		if ((mesh->getUsage() & MU_CPUCACHED) != 0)
+		{
+			SPtr<MeshData> meshData = mesh->allocBuffer();
+			mesh->readCachedData(*meshData);
+
+			const SPtr<VertexDataDesc>& vertexDesc = meshData->getVertexDesc();
+			if (vertexDesc->hasElement(VES_POSITION))
+			{
+				UINT32 numVertices = meshData->getNumVertices();
+				UINT8* positionData = meshData->getElementData(VES_POSITION);
+				UINT32 stride = vertexDesc->getVertexStride(0);
+
+				Vector<Vector3> positions(numVertices);
+				for (UINT32 i = 0; i < numVertices; i++)
+					memcpy(&positions[i], positionData + i * stride, sizeof(Vector3));
+
+				// Only triangle lists are pickable
+				Vector<UINT32> indices;
+				const MeshProperties& props = mesh->getProperties();
+				for (UINT32 i = 0; i < props.getNumSubMeshes(); i++)
+				{
+					const SubMesh& subMesh = props.getSubMesh(i);
+					if (subMesh.drawOp != DOT_TRIANGLE_LIST)
+						continue;
+
+					UINT32 end = std::min(subMesh.indexOffset + subMesh.indexCount, meshData->getNumIndices());
+					for (UINT32 j = subMesh.indexOffset; j < end; j++)
+					{
+						if (meshData->getIndexType() == IT_16BIT)
+							indices.push_back(meshData->getIndices16()[j]);
+						else
+							indices.push_back(meshData->getIndices32()[j]);
+					}
+				}
+
+				bvh = bs_shared_ptr_new<TriangleBVH>();
+				bvh->build(positions.data(), numVertices, indices.data(), (UINT32)indices.size());
+			}
+		}
+
+		mMeshBVHs[uuid] = { bvh, version };
+		return bvh;
+	}
+
+	void ScenePicking::onResourceChanged(const String& uuid)
+	{
+		mMeshBVHs.erase(uuid);
+	}
+
 	Vector<HSceneObject> ScenePicking::pickObjects(const SPtr<Camera>& cam, const Vector2I& position, const Vector2I& area, 
 		Vector<HSceneObject>& ignoreRenderables, SnapData* data)
+	{
+		PickRequest request;
+		SPtr<ct::RenderTarget> target = beginPicking(cam, position, area, ignoreRenderables, request);
+
+		AsyncOp op = gCoreThread().queueReturnCommand(std::bind(&ct::ScenePicking::corePickingEnd, mCore, target,
+			cam->getViewport()->getNormArea(), position, area, data != nullptr, false, _1));
+		gCoreThread().submit(true);
+
+		assert(op.hasCompleted());
+
+		PickResults pickResults = op.getReturnValue<PickResults>();
+		if (data != nullptr)
+		{
+			data->pickPosition = cam->screenToWorldPointDeviceDepth(position, pickResults.depth);
+			data->normal = pickResults.normal;
+		}
+
+		return resolveObjects(request, pickResults);
+	}
+
+	void ScenePicking::pickObjectsAsync(const SPtr<Camera>& cam, const Vector2I& position, const Vector2I& area, 
+		Vector<HSceneObject>& ignoreRenderables, const PickCallback& callback, bool gatherSnapData)
+	{
+		PickRequest request;
+		SPtr<ct::RenderTarget> target = beginPicking(cam, position, area, ignoreRenderables, request);
+
+		request.camera = cam;
+		request.position = position;
+		request.gatherSnapData = gatherSnapData;
+		request.callback = callback;
+
+		gCoreThread().queueCommand(std::bind(&ct::ScenePicking::corePickingEnd, mCore, target,
+			cam->getViewport()->getNormArea(), position, area, gatherSnapData, true, request.op));
+
+		mPendingRequests.push_back(request);
+	}
+
+	void ScenePicking::update()
+	{
+		for (auto iter = mPendingRequests.begin(); iter != mPendingRequests.end();)
+		{
+			if (!iter->op.hasCompleted())
+			{
+				++iter;
+				continue;
+			}
+
+			// Erase before triggering the callback, in case the callback issues another request
+			PickRequest request = *iter;
+			iter = mPendingRequests.erase(iter);
+
+			PickResults pickResults = request.op.getReturnValue<PickResults>();
+
+			SnapData snapData;
+			if (request.gatherSnapData)
+			{
+				snapData.pickPosition = request.camera->screenToWorldPointDeviceDepth(request.position, pickResults.depth);
+				snapData.normal = pickResults.normal;
+			}
+
+			request.callback(resolveObjects(request, pickResults), snapData);
+		}
+	}
+
+	SPtr<ct::RenderTarget> ScenePicking::beginPicking(const SPtr<Camera>& cam, const Vector2I& position, 
+		const Vector2I& area, Vector<HSceneObject>& ignoreRenderables, PickRequest& request)
 	{
 		auto comparePickElement = [&] (const ScenePicking::RenderablePickData& a, const ScenePicking::RenderablePickData& b)
 		{
@@ -89,7 +330,7 @@ namespace bs
 
 		const Map<Renderable*, SceneRenderableData>& renderables = SceneManager::instance().getAllRenderables();
 		RenderableSet pickData(comparePickElement);
-		Map<UINT32, HSceneObject> idxToRenderable;
+		Map<UINT32, HSceneObject>& idxToRenderable = request.idxToRenderable;
 
 		for (auto& renderableData : renderables)
 		{
@@ -166,43 +407,33 @@ namespace bs
 
 		SPtr<ct::RenderTarget> target = cam->getViewport()->getTarget()->getCore();
 		gCoreThread().queueCommand(std::bind(&ct::ScenePicking::corePickingBegin, mCore, target,
-			cam->getViewport()->getNormArea(), std::cref(pickData), position, area));
-
-		GizmoManager::instance().renderForPicking(cam, [&](UINT32 inputIdx) { return encodeIndex(firstGizmoIdx + inputIdx); });
-
-		AsyncOp op = gCoreThread().queueReturnCommand(std::bind(&ct::ScenePicking::corePickingEnd, mCore, target,
-			cam->getViewport()->getNormArea(), position, area, data != nullptr, _1));
-		gCoreThread().submit(true);
-
-		assert(op.hasCompleted());
+			cam->getViewport()->getNormArea(), pickData, position, area));
 
-		PickResults pickResults = op.getReturnValue<PickResults>();
-		if (data != nullptr)
+		// Gizmo to scene object mapping changes every frame, so record it in case the results are resolved later
+		GizmoManager::instance().renderForPicking(cam, [&](UINT32 inputIdx)
 		{
-			data->pickPosition = cam->screenToWorldPointDeviceDepth(position, pickResults.depth);
-			data->normal = pickResults.normal;
-		}
+			request.idxToGizmo[firstGizmoIdx + inputIdx] = GizmoManager::instance().getSceneObject(inputIdx);
+			return encodeIndex(firstGizmoIdx + inputIdx);
+		});
 
-		Vector<UINT32> selectedObjects = pickResults.objects;
-		Vector<HSceneObject> results;
+		return target;
+	}
 
-		for (auto& selectedObjectIdx : selectedObjects)
+	Vector<HSceneObject> ScenePicking::resolveObjects(const PickRequest& request, const PickResults& pickResults)
+	{
+		Vector<HSceneObject> results;
+		for (auto& selectedObjectIdx : pickResults.objects)
 		{
-			if (selectedObjectIdx < firstGizmoIdx)
+			auto iterFind = request.idxToRenderable.find(selectedObjectIdx);
+			if (iterFind != request.idxToRenderable.end())
 			{
-				auto iterFind = idxToRenderable.find(selectedObjectIdx);
-
-				if (iterFind != idxToRenderable.end())
-					results.push_back(iterFind->second);
+				results.push_back(iterFind->second);
+				continue;
 			}
-			else
-			{
-				UINT32 gizmoIdx = selectedObjectIdx - firstGizmoIdx;
 
-				HSceneObject so = GizmoManager::instance().getSceneObject(gizmoIdx);
-				if (so)
-					results.push_back(so);
-			}
+			iterFind = request.idxToGizmo.find(selectedObjectIdx);
+			if (iterFind != request.idxToGizmo.end() && iterFind->second)
+				results.push_back(iterFind->second);
 		}
 
 		return results;
@@ -368,7 +599,7 @@ namespace bs
 	}
 
 	void ScenePicking::corePickingEnd(const SPtr<RenderTarget>& target, const Rect2& viewportArea, 
-		const Vector2I& position, const Vector2I& area, bool gatherSnapData, AsyncOp& asyncOp)
+		const Vector2I& position, const Vector2I& area, bool gatherSnapData, bool async, AsyncOp& asyncOp)
 	{
 		const RenderTargetProperties& rtProps = target->getProperties();
 		RenderAPI& rs = RenderAPI::instance();
@@ -385,12 +616,12 @@ namespace bs
 		SPtr<Texture> normalsTexture = mPickingTexture->getColorTexture(1);
 		SPtr<Texture> depthTexture = mPickingTexture->getDepthStencilTexture();
 
+		mPickingTexture = nullptr;
+
 		if (position.x < 0 || position.x >= (INT32)outputTexture->getProperties().getWidth() ||
 			position.y < 0 || position.y >= (INT32)outputTexture->getProperties().getHeight())
 		{
-			mPickingTexture = nullptr;
-
-			asyncOp._completeOperation(Vector<UINT32>());
+			asyncOp._completeOperation(PickResults());
 			return;
 		}
 
@@ -403,13 +634,51 @@ namespace bs
 			depthPixelData = depthTexture->getProperties().allocBuffer(0, 0);
 		}
 
-		outputTexture->readData(*outputPixelData);
+		bool flipY = rtProps.requiresTextureFlipping();
+		if (!async)
+		{
+			outputTexture->readData(*outputPixelData);
 
+			if (gatherSnapData)
+			{
+				depthTexture->readData(*depthPixelData);
+				normalsTexture->readData(*normalsPixelData);
+			}
+
+			asyncOp._completeOperation(resolvePicking(position, area, flipY, outputPixelData, depthPixelData,
+				normalsPixelData));
+			return;
+		}
+
+		// Read back the textures without waiting on the GPU. Reads complete in order, so only the last one needs to 
+		// report back.
+		auto onReadbackComplete = [=]()
+		{
+			AsyncOp op = asyncOp;
+			op._completeOperation(resolvePicking(position, area, flipY, outputPixelData, depthPixelData, 
+				normalsPixelData));
+		};
+
+		GpuReadbackManager& readbackManager = GpuReadbackManager::instance();
+		if (gatherSnapData)
+		{
+			readbackManager.readTexture(outputTexture, outputPixelData);
+			readbackManager.readTexture(depthTexture, depthPixelData);
+			readbackManager.readTexture(normalsTexture, normalsPixelData, 0, 0, onReadbackComplete);
+		}
+		else
+			readbackManager.readTexture(outputTexture, outputPixelData, 0, 0, onReadbackComplete);
+	}
+
+	PickResults ScenePicking::resolvePicking(const Vector2I& position, const Vector2I& area, bool flipY,
+		const SPtr<PixelData>& outputPixelData, const SPtr<PixelData>& depthPixelData, 
+		const SPtr<PixelData>& normalsPixelData)
+	{
 		Map<UINT32, UINT32> selectionScores;
 		UINT32 maxWidth = std::min((UINT32)(position.x + area.x), outputPixelData->getWidth());
 		UINT32 maxHeight = std::min((UINT32)(position.y + area.y), outputPixelData->getHeight());
 
-		if (rtProps.requiresTextureFlipping())
+		if (flipY)
 		{
 			UINT32 vertOffset = outputPixelData->getHeight();
 
@@ -473,19 +742,16 @@ namespace bs
 			objects.push_back(selectedObject.index);
 		
 		PickResults result;
-		if (gatherSnapData)
+		if (depthPixelData != nullptr && normalsPixelData != nullptr)
 		{
-			depthTexture->readData(*depthPixelData);
-			normalsTexture->readData(*normalsPixelData);
-
 			Vector2I samplePixel = position;
-			if (rtProps.requiresTextureFlipping())
+			if (flipY)
 				samplePixel.y = depthPixelData->getHeight() - samplePixel.y;
 
 			float depth = depthPixelData->getDepthAt(samplePixel.x, samplePixel.y);
 			Color normal = normalsPixelData->getColorAt(samplePixel.x, samplePixel.y);
 
-			const RenderAPIInfo& rapiInfo = rs.getAPIInfo();
+			const RenderAPIInfo& rapiInfo = RenderAPI::instance().getAPIInfo();
 			float max = rapiInfo.getMaximumDepthInputValue();
 			float min = rapiInfo.getMinimumDepthInputValue();
 			depth = depth * Math::abs(max - min) + min;
@@ -494,10 +760,8 @@ namespace bs
 			result.normal = Vector3((normal.r * 2) - 1, (normal.g * 2) - 1, (normal.b * 2) - 1);
 		}
 
-		mPickingTexture = nullptr;
-		
 		result.objects = objects;
-		asyncOp._completeOperation(result);
+		return result;
 	}
 	}
 }
@@ -112,7 +112,10 @@ namespace bs
 
 			RenderableAnimType animType = (RenderableAnimType)i;
 			if(animType == RenderableAnimType::Skinned || animType == RenderableAnimType::SkinnedMorph)
+			{
 				params->getBufferParam(GPT_VERTEX_PROGRAM, "boneMatrices", mBoneMatrices[i]);
+				params->getParam(GPT_VERTEX_PROGRAM, "boneOffset", mBoneOffset[i]);
+			}
 
 			params->getParam(GPT_FRAGMENT_PROGRAM, "selColor", mColor[i]);
 		}
@@ -154,6 +157,7 @@ namespace bs
 			mMatWorldViewProj[techniqueIdx].set(worldViewProjMat);
 			mColor[techniqueIdx].set(SELECTION_COLOR);
 			mBoneMatrices[techniqueIdx].set(boneMatrixBuffer);
+			mBoneOffset[techniqueIdx].set((int)renderable->getBoneMatrixOffset());
 
 			gRendererUtility().setPass(mMaterial, 0, techniqueIdx);
 			gRendererUtility().setPassParams(mParams[techniqueIdx], 0);
@@ -6,6 +6,7 @@
 namespace bs
 {
 	const UINT32 UndoRedo::MAX_STACK_ELEMENTS = 1000;
+	const UINT64 UndoRedo::MAX_STACK_MEMORY = 256 * 1024 * 1024;
 
 	UndoRedo::UndoRedo()
 		: mUndoStack(nullptr), mRedoStack(nullptr), mUndoStackPtr(0), mUndoNumElements(0), mRedoStackPtr(0)
@@ -96,6 +97,7 @@ namespace bs
 			existingCommand->onCommandRemoved();
 
 		clearRedoStack();
+		enforceMemoryBudget();
 	}
 
 	UINT32 UndoRedo::getTopCommandId() const
@@ -225,6 +227,42 @@ namespace bs
 			mGroups.pop();
 	}
 
+	void UndoRedo::enforceMemoryBudget()
+	{
+		UINT64 memoryUsage = 0;
+		for (UINT32 i = 0; i < mUndoNumElements; i++)
+		{
+			const SPtr<EditorCommand>& command = mUndoStack[(mUndoStackPtr + MAX_STACK_ELEMENTS - i) % MAX_STACK_ELEMENTS];
+			if (command != nullptr)
+				memoryUsage += command->getMemoryUsage();
+		}
+
+		if (memoryUsage <= MAX_STACK_MEMORY)
+			return;
+
+		// Always keep the most recent command, even if it alone exceeds the budget
+		while (memoryUsage > MAX_STACK_MEMORY && mUndoNumElements > 1)
+		{
+			UINT32 oldestIdx = (mUndoStackPtr + MAX_STACK_ELEMENTS + 1 - mUndoNumElements) % MAX_STACK_ELEMENTS;
+
+			SPtr<EditorCommand> command = mUndoStack[oldestIdx];
+			mUndoStack[oldestIdx] = SPtr<EditorCommand>();
+			mUndoNumElements--;
+
+			if (command != nullptr)
+			{
+				memoryUsage -= command->getMemoryUsage();
+				command->onCommandRemoved();
+			}
+		}
+
+		if (!mGroups.empty())
+		{
+			GroupData& topGroup = mGroups.top();
+			topGroup.numEntries = std::min(topGroup.numEntries, mUndoNumElements);
+		}
+	}
+
 	void UndoRedo::clearRedoStack()
 	{
 		while(mRedoNumElements > 0)
@@ -15,7 +15,13 @@ namespace bs
 	 *  @{
 	 */
 
-	/**	Helper class for immediate drawing of common geometric shapes. */
+	/**
+	 * Helper class for immediate drawing of common geometric shapes.
+	 *
+	 * Shapes that can be expressed as a transformed version of a unit shape (cubes, spheres, cones and discs) are
+	 * generated once per type and quality, and instanced with a per-shape transform and color. Geometry built for a
+	 * set of recorded shapes is re-used for as long as the recorded shapes don't change.
+	 */
 	class BS_EXPORT DrawHelper
 	{
 	public:
@@ -122,6 +128,9 @@ namespace bs
 		 * Generates a set of meshes from all the recorded solid and wireframe shapes. The meshes can be accessed via 
 		 * getMeshes() and released via clearMeshes().
 		 *
+		 * If the recorded shapes and the provided parameters are identical to the ones used during the last call,
+		 * geometry from the last call is re-used and only the meshes are re-allocated.
+		 *
 		 * @param	sorting		(optional) Determines how (and if) should elements be sorted
 		 *						based on their distance from the reference point.
 		 * @param	reference	(optional) Reference point to use for determining distance when
@@ -130,6 +139,7 @@ namespace bs
 		 *						in the mesh. This bitfield will be ANDed with the layer specified when recording the shape.
 		 *
 		 * @note	You must call clearMeshes() when done.
+		 * @note	Mesh data provided to wireMesh() is assumed not to change once recorded.
 		 */
 		void buildMeshes(SortType sorting = SortType::None, const Vector3& reference = Vector3::ZERO, 
 			UINT64 layers = 0xFFFFFFFFFFFFFFFF);
@@ -141,6 +151,29 @@ namespace bs
 		void clearMeshes(const Vector<ShapeMeshData>& meshes);
 
 	private:
+		/** Types of shapes that can be recorded. */
+		enum class ShapeType
+		{
+			Cube, Sphere, WireCube, WireSphere, WireCone, Line, LineList, Frustum, 
+			Cone, Disc, WireDisc, Arc, WireArc, Rectangle, Text, WireMesh
+		};
+
+		/** Geometry of a unit shape, shared by all shapes of the same type and quality. */
+		struct ShapeTemplate
+		{
+			Vector<Vector3> positions;
+			Vector<Vector3> normals;
+			Vector<UINT32> indices;
+		};
+
+		/** Geometry for a single output mesh. */
+		struct BatchData
+		{
+			SPtr<MeshData> meshData;
+			MeshType type;
+			HTexture texture;
+		};
+
 		struct CommonData
 		{
 			Color color;
@@ -228,6 +261,21 @@ namespace bs
 			SPtr<MeshData> meshData;
 		};
 
+		/**
+		 * Returns unit geometry for the specified shape type. Geometry is generated on first use. Only valid for cubes,
+		 * spheres, cones and discs (both solid and wire versions).
+		 */
+		const ShapeTemplate& getShapeTemplate(ShapeType type, UINT32 quality);
+
+		/** Generates geometry for all recorded shapes, grouped into batches, and stores it in mBatches. */
+		void generateBatches(SortType sorting, const Vector3& reference, UINT64 layers);
+
+		/** 
+		 * Writes the contents of all recorded shapes that pass the layer filter, as well as the build parameters, into
+		 * @p output. Two sets of shapes produce the same geometry if their keys are equal.
+		 */
+		void getContentKey(SortType sorting, const Vector3& reference, UINT64 layers, Vector<UINT8>& output) const;
+
 		static const UINT32 VERTEX_BUFFER_GROWTH;
 		static const UINT32 INDEX_BUFFER_GROWTH;
 
@@ -255,6 +303,12 @@ namespace bs
 		Vector<ShapeMeshData> mMeshes;
 		UINT32 mNumActiveMeshes;
 
+		UnorderedMap<UINT64, ShapeTemplate> mShapeTemplates;
+		Vector<BatchData> mBatches;
+		Vector<UINT8> mBatchesKey;
+		Vector<UINT8> mContentKey;
+		bool mBatchesValid;
+
 		SPtr<MeshHeap> mSolidMeshHeap;
 		SPtr<MeshHeap> mWireMeshHeap;
 		SPtr<MeshHeap> mLineMeshHeap;
@@ -132,9 +132,41 @@ namespace bs
 
 			GUILabel* guiName;
 			GUILabel* guiTime;
+			GUILabel* guiDrawCalls;
+			GUILabel* guiPrimitives;
+			GUILabel* guiStateChanges;
+			GUILabel* guiParamBinds;
+			GUILabel* guiBytesWritten;
 
 			HString name;
 			HString time;
+			HString drawCalls;
+			HString primitives;
+			HString stateChanges;
+			HString paramBinds;
+			HString bytesWritten;
+
+			bool disabled;
+		};
+
+		/**	Holds data about GUI elements in a single row of GPU resource statistics. */
+		struct GPUResourceRow
+		{
+			GUILayout* layout;
+
+			GUILabel* guiName;
+			GUILabel* guiCreated;
+			GUILabel* guiDestroyed;
+			GUILabel* guiReads;
+			GUILabel* guiWrites;
+			GUILabel* guiBytesWritten;
+
+			HString name;
+			HString created;
+			HString destroyed;
+			HString reads;
+			HString writes;
+			HString bytesWritten;
 
 			bool disabled;
 		};
@@ -213,6 +245,8 @@ namespace bs
 		GUILayout* mGPULayoutFrameContents = nullptr;
 		GUILayout* mGPULayoutFrameContentsLeft = nullptr;
 		GUILayout* mGPULayoutFrameContentsRight = nullptr;
+		GUILayout* mGPULayoutFrameContentsResources = nullptr;
+		GUILayout* mGPULayoutResourceContents = nullptr;
 		GUILayout* mGPULayoutSamples = nullptr;
 		GUILayout* mGPULayoutSampleContents = nullptr;
 
@@ -234,6 +268,8 @@ namespace bs
 		GUILabel* mGPUParamBindsLbl;
 		GUILabel* mGPUVertexBufferBindsLbl;
 		GUILabel* mGPUIndexBufferBindsLbl;
+		GUILabel* mGPUBytesWrittenLbl;
+		GUILabel* mGPUComputeCallsLbl;
 
 		HString mGPUFrameNumStr;
 		HString mGPUTimeStr;
@@ -253,10 +289,13 @@ namespace bs
 		HString mGPUParamBindsStr;
 		HString mGPUVertexBufferBindsStr;
 		HString mGPUIndexBufferBindsStr;
+		HString mGPUBytesWrittenStr;
+		HString mGPUComputeCallsStr;
 
 		Vector<BasicRow> mBasicRows;
 		Vector<PreciseRow> mPreciseRows;
 		Vector<GPUSampleRow> mGPUSampleRows;
+		Vector<GPUResourceRow> mGPUResourceRows;
 
 		HEvent mTargetResizedConn;
 		bool mIsShown;
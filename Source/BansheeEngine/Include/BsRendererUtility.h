@@ -35,10 +35,13 @@ namespace bs { namespace ct
 		 * @param[in]	material		Material containing the pass.
 		 * @param[in]	passIdx			Index of the pass in the material.
 		 * @param[in]	techniqueIdx	Index of the technique the pass belongs to, if the material has multiple techniques.
+		 * @param[in]	commandBuffer	Optional command buffer to queue the operation on. If not provided the operation
+		 *								is executed immediately.
 		 *
-		 * @note	Core thread.
+		 * @note	Core thread, unless a command buffer is provided.
 		 */
-		void setPass(const SPtr<Material>& material, UINT32 passIdx = 0, UINT32 techniqueIdx = 0);
+		void setPass(const SPtr<Material>& material, UINT32 passIdx = 0, UINT32 techniqueIdx = 0, 
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Activates the specified material pass for compute. Any further dispatch calls will be executed using this pass.
@@ -53,12 +56,15 @@ namespace bs { namespace ct
 		/**
 		 * Sets parameters (textures, samplers, buffers) for the currently active pass.
 		 *
-		 * @param[in]	params		Object containing the parameters.
-		 * @param[in]	passIdx		Pass for which to set the parameters.
+		 * @param[in]	params			Object containing the parameters.
+		 * @param[in]	passIdx			Pass for which to set the parameters.
+		 * @param[in]	commandBuffer	Optional command buffer to queue the operation on. If not provided the operation
+		 *								is executed immediately.
 		 *					
-		 * @note	Core thread.
+		 * @note	Core thread, unless a command buffer is provided.
 		 */
-		void setPassParams(const SPtr<GpuParamsSet>& params, UINT32 passIdx = 0);
+		void setPassParams(const SPtr<GpuParamsSet>& params, UINT32 passIdx = 0, 
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Draws the specified mesh.
@@ -76,10 +82,14 @@ namespace bs { namespace ct
 		 * @param[in]	mesh			Mesh to draw.
 		 * @param[in]	subMesh			Portion of the mesh to draw.
 		 * @param[in]	numInstances	Number of times to draw the mesh using instanced rendering.
+		 * @param[in]	commandBuffer	Optional command buffer to queue the operation on. If not provided the operation
+		 *								is executed immediately. When provided the caller must call 
+		 *								MeshBase::_notifyUsedOnGPU() on the core thread once the buffer is submitted.
 		 *
-		 * @note	Core thread.
+		 * @note	Core thread, unless a command buffer is provided.
 		 */
-		void draw(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, UINT32 numInstances = 1);
+		void draw(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, UINT32 numInstances = 1, 
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Draws the specified mesh with an additional vertex buffer containing morph shape vertices.
@@ -90,11 +100,15 @@ namespace bs { namespace ct
 		 *										Expected to contain the same number of vertices as the source mesh.
 		 * @param[in]	morphVertexDeclaration	Vertex declaration describing vertices of the provided mesh and the vertices
 		 *										provided in the morph vertex buffer.
+		 * @param[in]	commandBuffer			Optional command buffer to queue the operation on. If not provided the 
+		 *										operation is executed immediately. When provided the caller must call 
+		 *										MeshBase::_notifyUsedOnGPU() on the core thread once the buffer is 
+		 *										submitted.
 		 *
-		 * @note	Core thread.
+		 * @note	Core thread, unless a command buffer is provided.
 		 */
 		void drawMorph(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, const SPtr<VertexBuffer>& morphVertices, 
-			const SPtr<VertexDeclaration>& morphVertexDeclaration);
+			const SPtr<VertexDeclaration>& morphVertexDeclaration, const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Blits contents of the provided texture into the currently bound render target. If the provided texture contains
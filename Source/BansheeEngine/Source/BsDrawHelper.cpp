@@ -10,14 +10,29 @@
 #include "BsTextData.h"
 #include "BsVector2.h"
 #include "BsQuaternion.h"
+#include "BsMathBatch.h"
 
 namespace bs
 {
+	/** Appends a block of memory to a content key. */
+	static void appendBytes(Vector<UINT8>& key, const void* data, UINT32 size)
+	{
+		const UINT8* bytes = (const UINT8*)data;
+		key.insert(key.end(), bytes, bytes + size);
+	}
+
+	/** Appends the memory of a plain value (e.g. a vector, a color or a matrix) to a content key. */
+	template<class T>
+	static void appendValue(Vector<UINT8>& key, const T& value)
+	{
+		appendBytes(key, &value, sizeof(value));
+	}
+
 	const UINT32 DrawHelper::VERTEX_BUFFER_GROWTH = 4096;
 	const UINT32 DrawHelper::INDEX_BUFFER_GROWTH = 4096 * 2;
 
 	DrawHelper::DrawHelper()
-		:mLayer(1), mNumActiveMeshes(0)
+		:mLayer(1), mNumActiveMeshes(0), mBatchesValid(false)
 	{
 		mTransform = Matrix4::IDENTITY;
 
@@ -339,11 +354,46 @@ namespace bs
 	{
 		mMeshes.clear();
 
-		enum class ShapeType
+		// Geometry only needs to be regenerated if the recorded shapes changed since the last call
+		getContentKey(sorting, reference, layers, mContentKey);
+		if (!mBatchesValid || mContentKey != mBatchesKey)
 		{
-			Cube, Sphere, WireCube, WireSphere, WireCone, Line, LineList, Frustum, 
-			Cone, Disc, WireDisc, Arc, WireArc, Rectangle, Text, WireMesh
-		};
+			generateBatches(sorting, reference, layers);
+
+			std::swap(mBatchesKey, mContentKey);
+			mBatchesValid = true;
+		}
+
+		for (auto& batch : mBatches)
+		{
+			mMeshes.push_back(ShapeMeshData());
+			ShapeMeshData& newMesh = mMeshes.back();
+			newMesh.type = batch.type;
+			newMesh.texture = batch.texture;
+
+			switch (batch.type)
+			{
+			case MeshType::Solid:
+				newMesh.mesh = mSolidMeshHeap->alloc(batch.meshData, DOT_TRIANGLE_LIST);
+				break;
+			case MeshType::Wire:
+				newMesh.mesh = mWireMeshHeap->alloc(batch.meshData, DOT_TRIANGLE_LIST);
+				break;
+			case MeshType::Line:
+				newMesh.mesh = mLineMeshHeap->alloc(batch.meshData, DOT_LINE_LIST);
+				break;
+			case MeshType::Text:
+				newMesh.mesh = mTextMeshHeap->alloc(batch.meshData, DOT_TRIANGLE_LIST);
+				break;
+			}
+		}
+
+		mNumActiveMeshes += (UINT32)mMeshes.size();
+	}
+
+	void DrawHelper::generateBatches(SortType sorting, const Vector3& reference, UINT64 layers)
+	{
+		mBatches.clear();
 
 		struct RawData
 		{
@@ -827,6 +877,7 @@ namespace bs
 		/************************************************************************/
 		/* 					Generate geometry for each batch                    */
 		/************************************************************************/
+		Vector<Vector3> instancePositions;
 		for (auto& batch : batches)
 		{
 			if (batch.type == MeshType::Solid)
@@ -847,13 +898,16 @@ namespace bs
 					Matrix4* transform = nullptr;
 					RGBA color = 0;
 
+					const ShapeTemplate* shapeTemplate = nullptr;
+					Matrix4 shapeTransform;
+
 					switch (shapeData.shapeType)
 					{
 					case ShapeType::Cube:
 					{
 						CubeData& cubeData = mSolidCubeData[shapeData.idx];
-						AABox box(cubeData.position - cubeData.extents, cubeData.position + cubeData.extents);
-						ShapeMeshes3D::solidAABox(box, meshData, curVertexOffset, curIndexOffet);
+						shapeTemplate = &getShapeTemplate(ShapeType::Cube, 0);
+						shapeTransform = Matrix4::TRS(cubeData.position, Quaternion::IDENTITY, cubeData.extents);
 
 						transform = &cubeData.transform;
 						color = cubeData.color.getAsRGBA();
@@ -862,8 +916,9 @@ namespace bs
 					case ShapeType::Sphere:
 					{
 						SphereData& sphereData = mSolidSphereData[shapeData.idx];
-						Sphere sphere(sphereData.position, sphereData.radius);
-						ShapeMeshes3D::solidSphere(sphere, meshData, curVertexOffset, curIndexOffet, sphereData.quality);
+						shapeTemplate = &getShapeTemplate(ShapeType::Sphere, sphereData.quality);
+						shapeTransform = Matrix4::TRS(sphereData.position, Quaternion::IDENTITY, 
+							Vector3(sphereData.radius, sphereData.radius, sphereData.radius));
 
 						transform = &sphereData.transform;
 						color = sphereData.color.getAsRGBA();
@@ -872,8 +927,10 @@ namespace bs
 					case ShapeType::Cone:
 					{
 						ConeData& coneData = mConeData[shapeData.idx];
-						ShapeMeshes3D::solidCone(coneData.base, coneData.normal, coneData.height, coneData.radius, 
-							coneData.scale, meshData, curVertexOffset, curIndexOffet, coneData.quality);
+						shapeTemplate = &getShapeTemplate(ShapeType::Cone, coneData.quality);
+						shapeTransform = Matrix4::TRS(coneData.base, 
+							Quaternion::getRotationFromTo(Vector3::UNIT_Y, coneData.normal),
+							Vector3(coneData.radius, coneData.height, coneData.radius));
 
 						transform = &coneData.transform;
 						color = coneData.color.getAsRGBA();
@@ -882,8 +939,10 @@ namespace bs
 					case ShapeType::Disc:
 					{
 						DiscData& discData = mDiscData[shapeData.idx];
-						ShapeMeshes3D::solidDisc(discData.position, discData.radius, discData.normal,
-							meshData, curVertexOffset, curIndexOffet, discData.quality);
+						shapeTemplate = &getShapeTemplate(ShapeType::Disc, discData.quality);
+						shapeTransform = Matrix4::TRS(discData.position, 
+							Quaternion::getRotationFromTo(Vector3::UNIT_Y, discData.normal),
+							Vector3(discData.radius, discData.radius, discData.radius));
 
 						transform = &discData.transform;
 						color = discData.color.getAsRGBA();
@@ -901,7 +960,7 @@ namespace bs
 						break;
 					case ShapeType::Rectangle:
 					{
-						Rect3Data rectData = mRect3Data[shapeData.idx];
+						Rect3Data& rectData = mRect3Data[shapeData.idx];
 						ShapeMeshes3D::solidQuad(rectData.area, meshData, curVertexOffset, curIndexOffet);
 
 						transform = &rectData.transform;
@@ -912,25 +971,51 @@ namespace bs
 						break;
 					}
 
-					Matrix4 transformIT = transform->inverseAffine().transpose();
-					for (UINT32 i = 0; i < shapeData.numVertices; i++)
+					if (shapeTemplate != nullptr)
 					{
-						Vector3 worldPos = transform->multiplyAffine(positionIter.getValue());
-						Vector3 worldNormal = transformIT.multiplyAffine(normalIter.getValue());
+						// Instance the unit shape
+						Matrix4 instanceTransform = *transform * shapeTransform;
+						Matrix4 instanceTransformIT = instanceTransform.inverseAffine().transpose();
 
-						positionIter.addValue(worldPos);
-						normalIter.addValue(worldNormal);
-						colorIter.addValue(color);
+						instancePositions.resize(shapeData.numVertices);
+						MathBatch::transformPointsAffine(instanceTransform, shapeTemplate->positions.data(), 
+							instancePositions.data(), shapeData.numVertices);
+
+						for (UINT32 j = 0; j < shapeData.numVertices; j++)
+						{
+							Vector3 worldNormal = instanceTransformIT.multiplyDirection(shapeTemplate->normals[j]);
+
+							positionIter.addValue(instancePositions[j]);
+							normalIter.addValue(Vector3::normalize(worldNormal));
+							colorIter.addValue(color);
+						}
+
+						UINT32* indices = meshData->getIndices32() + curIndexOffet;
+						for (UINT32 j = 0; j < shapeData.numIndices; j++)
+							indices[j] = shapeTemplate->indices[j] + curVertexOffset;
+					}
+					else
+					{
+						Matrix4 transformIT = transform->inverseAffine().transpose();
+						for (UINT32 j = 0; j < shapeData.numVertices; j++)
+						{
+							Vector3 worldPos = transform->multiplyAffine(positionIter.getValue());
+							Vector3 worldNormal = transformIT.multiplyAffine(normalIter.getValue());
+
+							positionIter.addValue(worldPos);
+							normalIter.addValue(worldNormal);
+							colorIter.addValue(color);
+						}
 					}
 
 					curVertexOffset += shapeData.numVertices;
 					curIndexOffet += shapeData.numIndices;
 				}
 
-				mMeshes.push_back(ShapeMeshData());
-				ShapeMeshData& newMesh = mMeshes.back();
-				newMesh.mesh = mSolidMeshHeap->alloc(meshData, DOT_TRIANGLE_LIST);
-				newMesh.type = MeshType::Solid;
+				mBatches.push_back(BatchData());
+				BatchData& newBatch = mBatches.back();
+				newBatch.meshData = meshData;
+				newBatch.type = MeshType::Solid;
 			}
 			else if (batch.type == MeshType::Wire)
 			{
@@ -984,10 +1069,10 @@ namespace bs
 					}
 				}
 
-				mMeshes.push_back(ShapeMeshData());
-				ShapeMeshData& newMesh = mMeshes.back();
-				newMesh.mesh = mWireMeshHeap->alloc(meshData, DOT_TRIANGLE_LIST);
-				newMesh.type = MeshType::Wire;
+				mBatches.push_back(BatchData());
+				BatchData& newBatch = mBatches.back();
+				newBatch.meshData = meshData;
+				newBatch.type = MeshType::Wire;
 			}
 			else if(batch.type == MeshType::Line)
 			{
@@ -1007,14 +1092,16 @@ namespace bs
 					Matrix4* transform = nullptr;
 					RGBA color = 0;
 
+					const ShapeTemplate* shapeTemplate = nullptr;
+					Matrix4 shapeTransform;
+
 					switch (shapeData.shapeType)
 					{
 					case ShapeType::WireCube:
 					{
 						CubeData& cubeData = mWireCubeData[shapeData.idx];
-
-						AABox box(cubeData.position - cubeData.extents, cubeData.position + cubeData.extents);
-						ShapeMeshes3D::wireAABox(box, meshData, curVertexOffset, curIndexOffet);
+						shapeTemplate = &getShapeTemplate(ShapeType::WireCube, 0);
+						shapeTransform = Matrix4::TRS(cubeData.position, Quaternion::IDENTITY, cubeData.extents);
 
 						transform = &cubeData.transform;
 						color = cubeData.color.getAsRGBA();
@@ -1023,9 +1110,9 @@ namespace bs
 					case ShapeType::WireSphere:
 					{
 						SphereData& sphereData = mWireSphereData[shapeData.idx];
-
-						Sphere sphere(sphereData.position, sphereData.radius);
-						ShapeMeshes3D::wireSphere(sphere, meshData, curVertexOffset, curIndexOffet, sphereData.quality);
+						shapeTemplate = &getShapeTemplate(ShapeType::WireSphere, sphereData.quality);
+						shapeTransform = Matrix4::TRS(sphereData.position, Quaternion::IDENTITY,
+							Vector3(sphereData.radius, sphereData.radius, sphereData.radius));
 
 						transform = &sphereData.transform;
 						color = sphereData.color.getAsRGBA();
@@ -1034,8 +1121,10 @@ namespace bs
 					case ShapeType::WireCone:
 					{
 						ConeData& coneData = mWireConeData[shapeData.idx];
-						ShapeMeshes3D::wireCone(coneData.base, coneData.normal, coneData.height, coneData.radius,
-							coneData.scale, meshData, curVertexOffset, curIndexOffet, coneData.quality);
+						shapeTemplate = &getShapeTemplate(ShapeType::WireCone, coneData.quality);
+						shapeTransform = Matrix4::TRS(coneData.base, 
+							Quaternion::getRotationFromTo(Vector3::UNIT_Y, coneData.normal),
+							Vector3(coneData.radius, coneData.height, coneData.radius));
 
 						transform = &coneData.transform;
 						color = coneData.color.getAsRGBA();
@@ -1075,9 +1164,10 @@ namespace bs
 					case ShapeType::WireDisc:
 					{
 						DiscData& discData = mWireDiscData[shapeData.idx];
-
-						ShapeMeshes3D::wireDisc(discData.position, discData.radius, discData.normal,
-							meshData, curVertexOffset, curIndexOffet, discData.quality);
+						shapeTemplate = &getShapeTemplate(ShapeType::WireDisc, discData.quality);
+						shapeTransform = Matrix4::TRS(discData.position,
+							Quaternion::getRotationFromTo(Vector3::UNIT_Y, discData.normal),
+							Vector3(discData.radius, discData.radius, discData.radius));
 
 						transform = &discData.transform;
 						color = discData.color.getAsRGBA();
@@ -1098,22 +1188,44 @@ namespace bs
 						break;
 					}
 
-					for (UINT32 i = 0; i < shapeData.numVertices; i++)
+					if (shapeTemplate != nullptr)
 					{
-						Vector3 worldPos = transform->multiplyAffine(positionIter.getValue());
+						// Instance the unit shape
+						Matrix4 instanceTransform = *transform * shapeTransform;
 
-						positionIter.addValue(worldPos);
-						colorIter.addValue(color);
+						instancePositions.resize(shapeData.numVertices);
+						MathBatch::transformPointsAffine(instanceTransform, shapeTemplate->positions.data(),
+							instancePositions.data(), shapeData.numVertices);
+
+						for (UINT32 j = 0; j < shapeData.numVertices; j++)
+						{
+							positionIter.addValue(instancePositions[j]);
+							colorIter.addValue(color);
+						}
+
+						UINT32* indices = meshData->getIndices32() + curIndexOffet;
+						for (UINT32 j = 0; j < shapeData.numIndices; j++)
+							indices[j] = shapeTemplate->indices[j] + curVertexOffset;
+					}
+					else
+					{
+						for (UINT32 j = 0; j < shapeData.numVertices; j++)
+						{
+							Vector3 worldPos = transform->multiplyAffine(positionIter.getValue());
+
+							positionIter.addValue(worldPos);
+							colorIter.addValue(color);
+						}
 					}
 
 					curVertexOffset += shapeData.numVertices;
 					curIndexOffet += shapeData.numIndices;
 				}
 
-				mMeshes.push_back(ShapeMeshData());
-				ShapeMeshData& newMesh = mMeshes.back();
-				newMesh.mesh = mLineMeshHeap->alloc(meshData, DOT_LINE_LIST);
-				newMesh.type = MeshType::Line;
+				mBatches.push_back(BatchData());
+				BatchData& newBatch = mBatches.back();
+				newBatch.meshData = meshData;
+				newBatch.type = MeshType::Line;
 			}
 			else // Text
 			{
@@ -1189,15 +1301,13 @@ namespace bs
 					curIndexOffet += shapeData.numIndices;
 				}
 
-				mMeshes.push_back(ShapeMeshData());
-				ShapeMeshData& newMesh = mMeshes.back();
-				newMesh.mesh = mTextMeshHeap->alloc(meshData, DOT_TRIANGLE_LIST);
-				newMesh.type = MeshType::Text;
-				newMesh.texture = batch.texture;
+				mBatches.push_back(BatchData());
+				BatchData& newBatch = mBatches.back();
+				newBatch.meshData = meshData;
+				newBatch.type = MeshType::Text;
+				newBatch.texture = batch.texture;
 			}
 		}
-
-		mNumActiveMeshes += (UINT32)mMeshes.size();
 	}
 
 	void DrawHelper::clearMeshes(const Vector<ShapeMeshData>& meshes)
@@ -1216,4 +1326,248 @@ namespace bs
 
 		mNumActiveMeshes -= (UINT32)meshes.size();
 	}
+
+	const DrawHelper::ShapeTemplate& DrawHelper::getShapeTemplate(ShapeType type, UINT32 quality)
+	{
+		UINT64 key = ((UINT64)type << 32) | quality;
+
+		auto iterFind = mShapeTemplates.find(key);
+		if (iterFind != mShapeTemplates.end())
+			return iterFind->second;
+
+		UINT32 numVertices = 0;
+		UINT32 numIndices = 0;
+		bool isSolid = true;
+
+		switch (type)
+		{
+		case ShapeType::Cube:
+			ShapeMeshes3D::getNumElementsAABox(numVertices, numIndices);
+			break;
+		case ShapeType::Sphere:
+			ShapeMeshes3D::getNumElementsSphere(quality, numVertices, numIndices);
+			break;
+		case ShapeType::Cone:
+			ShapeMeshes3D::getNumElementsCone(quality, numVertices, numIndices);
+			break;
+		case ShapeType::Disc:
+			ShapeMeshes3D::getNumElementsDisc(quality, numVertices, numIndices);
+			break;
+		case ShapeType::WireCube:
+			ShapeMeshes3D::getNumElementsWireAABox(numVertices, numIndices);
+			isSolid = false;
+			break;
+		case ShapeType::WireSphere:
+			ShapeMeshes3D::getNumElementsWireSphere(quality, numVertices, numIndices);
+			isSolid = false;
+			break;
+		case ShapeType::WireCone:
+			ShapeMeshes3D::getNumElementsWireCone(quality, numVertices, numIndices);
+			isSolid = false;
+			break;
+		case ShapeType::WireDisc:
+			ShapeMeshes3D::getNumElementsWireDisc(quality, numVertices, numIndices);
+			isSolid = false;
+			break;
+		default:
+			assert(false && "Shape type cannot be instanced.");
+			break;
+		}
+
+		// Unit shapes are centered at origin, with size of one and their normal (if any) pointing along the Y axis
+		const SPtr<VertexDataDesc>& vertexDesc = isSolid ? mSolidVertexDesc : mLineVertexDesc;
+		SPtr<MeshData> meshData = bs_shared_ptr_new<MeshData>(numVertices, numIndices, vertexDesc);
+
+		switch (type)
+		{
+		case ShapeType::Cube:
+			ShapeMeshes3D::solidAABox(AABox(-Vector3::ONE, Vector3::ONE), meshData, 0, 0);
+			break;
+		case ShapeType::Sphere:
+			ShapeMeshes3D::solidSphere(Sphere(Vector3::ZERO, 1.0f), meshData, 0, 0, quality);
+			break;
+		case ShapeType::Cone:
+			ShapeMeshes3D::solidCone(Vector3::ZERO, Vector3::UNIT_Y, 1.0f, 1.0f, Vector2::ONE, meshData, 0, 0, quality);
+			break;
+		case ShapeType::Disc:
+			ShapeMeshes3D::solidDisc(Vector3::ZERO, 1.0f, Vector3::UNIT_Y, meshData, 0, 0, quality);
+			break;
+		case ShapeType::WireCube:
+			ShapeMeshes3D::wireAABox(AABox(-Vector3::ONE, Vector3::ONE), meshData, 0, 0);
+			break;
+		case ShapeType::WireSphere:
+			ShapeMeshes3D::wireSphere(Sphere(Vector3::ZERO, 1.0f), meshData, 0, 0, quality);
+			break;
+		case ShapeType::WireCone:
+			ShapeMeshes3D::wireCone(Vector3::ZERO, Vector3::UNIT_Y, 1.0f, 1.0f, Vector2::ONE, meshData, 0, 0, quality);
+			break;
+		case ShapeType::WireDisc:
+			ShapeMeshes3D::wireDisc(Vector3::ZERO, 1.0f, Vector3::UNIT_Y, meshData, 0, 0, quality);
+			break;
+		default:
+			break;
+		}
+
+		ShapeTemplate& shapeTemplate = mShapeTemplates[key];
+		shapeTemplate.positions.resize(numVertices);
+		shapeTemplate.indices.resize(numIndices);
+
+		auto positionIter = meshData->getVec3DataIter(VES_POSITION);
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			shapeTemplate.positions[i] = positionIter.getValue();
+			positionIter.moveNext();
+		}
+
+		if (isSolid)
+		{
+			shapeTemplate.normals.resize(numVertices);
+
+			auto normalIter = meshData->getVec3DataIter(VES_NORMAL);
+			for (UINT32 i = 0; i < numVertices; i++)
+			{
+				shapeTemplate.normals[i] = normalIter.getValue();
+				normalIter.moveNext();
+			}
+		}
+
+		memcpy(shapeTemplate.indices.data(), meshData->getIndices32(), numIndices * sizeof(UINT32));
+		return shapeTemplate;
+	}
+
+	void DrawHelper::getContentKey(SortType sorting, const Vector3& reference, UINT64 layers, 
+		Vector<UINT8>& output) const
+	{
+		output.clear();
+		appendValue(output, sorting);
+		appendValue(output, layers);
+
+		// Reference point only matters for sorting and for orienting text
+		if (sorting != SortType::None || !mText2DData.empty())
+			appendValue(output, reference);
+
+		// Appends common and type-specific data of all shapes in a list that pass the layer filter
+		auto appendShapes = [&](const auto& shapes, auto appendShape)
+		{
+			UINT32 numShapes = 0;
+			for (auto& entry : shapes)
+			{
+				if ((entry.layer & layers) == 0)
+					continue;
+
+				appendValue(output, entry.color);
+				appendValue(output, entry.transform);
+				appendShape(entry);
+
+				numShapes++;
+			}
+
+			appendValue(output, numShapes);
+		};
+
+		auto appendCube = [&](const CubeData& data)
+		{
+			appendValue(output, data.position);
+			appendValue(output, data.extents);
+		};
+
+		auto appendSphere = [&](const SphereData& data)
+		{
+			appendValue(output, data.position);
+			appendValue(output, data.radius);
+			appendValue(output, data.quality);
+		};
+
+		auto appendCone = [&](const ConeData& data)
+		{
+			appendValue(output, data.base);
+			appendValue(output, data.normal);
+			appendValue(output, data.height);
+			appendValue(output, data.radius);
+			appendValue(output, data.scale);
+			appendValue(output, data.quality);
+		};
+
+		auto appendDisc = [&](const DiscData& data)
+		{
+			appendValue(output, data.position);
+			appendValue(output, data.normal);
+			appendValue(output, data.radius);
+			appendValue(output, data.quality);
+		};
+
+		auto appendArc = [&](const ArcData& data)
+		{
+			appendValue(output, data.position);
+			appendValue(output, data.normal);
+			appendValue(output, data.radius);
+			appendValue(output, data.startAngle.valueDegrees());
+			appendValue(output, data.amountAngle.valueDegrees());
+			appendValue(output, data.quality);
+		};
+
+		appendShapes(mSolidCubeData, appendCube);
+		appendShapes(mWireCubeData, appendCube);
+		appendShapes(mSolidSphereData, appendSphere);
+		appendShapes(mWireSphereData, appendSphere);
+		appendShapes(mConeData, appendCone);
+		appendShapes(mWireConeData, appendCone);
+		appendShapes(mDiscData, appendDisc);
+		appendShapes(mWireDiscData, appendDisc);
+		appendShapes(mArcData, appendArc);
+		appendShapes(mWireArcData, appendArc);
+
+		appendShapes(mLineData, [&](const LineData& data)
+		{
+			appendValue(output, data.start);
+			appendValue(output, data.end);
+		});
+
+		appendShapes(mLineListData, [&](const LineListData& data)
+		{
+			appendValue(output, (UINT32)data.lines.size());
+			appendBytes(output, data.lines.data(), (UINT32)(data.lines.size() * sizeof(Vector3)));
+		});
+
+		appendShapes(mRect3Data, [&](const Rect3Data& data)
+		{
+			appendValue(output, data.area.getCenter());
+			appendValue(output, data.area.getAxisHorz());
+			appendValue(output, data.area.getAxisVert());
+			appendValue(output, data.area.getExtentHorz());
+			appendValue(output, data.area.getExtentVertical());
+		});
+
+		appendShapes(mFrustumData, [&](const FrustumData& data)
+		{
+			appendValue(output, data.position);
+			appendValue(output, data.aspect);
+			appendValue(output, data.FOV.valueDegrees());
+			appendValue(output, data.near);
+			appendValue(output, data.far);
+		});
+
+		appendShapes(mText2DData, [&](const Text2DData& data)
+		{
+			const String& fontUUID = data.font.getUUID();
+
+			appendValue(output, data.position);
+			appendValue(output, (UINT32)data.text.size());
+			appendBytes(output, data.text.data(), (UINT32)(data.text.size() * sizeof(WString::value_type)));
+			appendValue(output, (UINT32)fontUUID.size());
+			appendBytes(output, fontUUID.data(), (UINT32)fontUUID.size());
+			appendValue(output, data.font.isLoaded());
+			appendValue(output, data.size);
+		});
+
+		// Wire mesh data is referenced rather than copied and may be modified in place, so its contents are part of
+		// the key as well
+		appendShapes(mWireMeshData, [&](const WireMeshData& data)
+		{
+			appendValue(output, data.meshData->getNumVertices());
+			appendValue(output, data.meshData->getNumIndices());
+			appendValue(output, data.meshData->getSize());
+			appendBytes(output, data.meshData->getData(), data.meshData->getSize());
+		});
+	}
 }
\ No newline at end of file
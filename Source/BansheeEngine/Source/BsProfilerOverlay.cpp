@@ -254,7 +254,7 @@ namespace bs
 			rows.resize(curIdx);
 		}
 
-		void addData(const String& name, float timeMs)
+		void addData(const GPUProfileSample& sample)
 		{
 			if (curIdx >= rows.size())
 			{
@@ -263,21 +263,121 @@ namespace bs
 				ProfilerOverlayInternal::GPUSampleRow& newRow = rows.back();
 
 				newRow.disabled = false;
-				newRow.name = HEString(L"{1}");
+				newRow.name = HEString(L"{0}");
 				newRow.time = HEString(L"{0}");
+				newRow.drawCalls = HEString(L"{0}");
+				newRow.primitives = HEString(L"{0}");
+				newRow.stateChanges = HEString(L"{0}");
+				newRow.paramBinds = HEString(L"{0}");
+				newRow.bytesWritten = HEString(L"{0}");
 
 				newRow.layout = layout.insertNewElement<GUILayoutX>(layout.getNumChildren());
 
 				newRow.guiName = newRow.layout->addNewElement<GUILabel>(newRow.name, GUIOptions(GUIOption::fixedWidth(100)));
 				newRow.guiTime = newRow.layout->addNewElement<GUILabel>(newRow.time, GUIOptions(GUIOption::fixedWidth(100)));
+				newRow.guiDrawCalls = newRow.layout->addNewElement<GUILabel>(newRow.drawCalls, GUIOptions(GUIOption::fixedWidth(100)));
+				newRow.guiPrimitives = newRow.layout->addNewElement<GUILabel>(newRow.primitives, GUIOptions(GUIOption::fixedWidth(100)));
+				newRow.guiStateChanges = newRow.layout->addNewElement<GUILabel>(newRow.stateChanges, GUIOptions(GUIOption::fixedWidth(100)));
+				newRow.guiParamBinds = newRow.layout->addNewElement<GUILabel>(newRow.paramBinds, GUIOptions(GUIOption::fixedWidth(100)));
+				newRow.guiBytesWritten = newRow.layout->addNewElement<GUILabel>(newRow.bytesWritten, GUIOptions(GUIOption::fixedWidth(100)));
 			}
 
 			ProfilerOverlayInternal::GPUSampleRow& row = rows[curIdx];
-			row.name.setParameter(0, toWString(name));
-			row.time.setParameter(0, toWString(timeMs));
+			row.name.setParameter(0, toWString(sample.name));
+			row.time.setParameter(0, toWString(sample.timeMs));
+			row.drawCalls.setParameter(0, toWString(sample.numDrawCalls));
+			row.primitives.setParameter(0, toWString(sample.numPrimitives));
+			row.stateChanges.setParameter(0, toWString(sample.numPipelineStateChanges));
+			row.paramBinds.setParameter(0, toWString(sample.numGpuParamBinds));
+			row.bytesWritten.setParameter(0, toWString(sample.numBytesWritten));
 
 			row.guiName->setContent(row.name);
 			row.guiTime->setContent(row.time);
+			row.guiDrawCalls->setContent(row.drawCalls);
+			row.guiPrimitives->setContent(row.primitives);
+			row.guiStateChanges->setContent(row.stateChanges);
+			row.guiParamBinds->setContent(row.paramBinds);
+			row.guiBytesWritten->setContent(row.bytesWritten);
+
+			if (row.disabled)
+			{
+				row.layout->setVisible(true);
+				row.disabled = false;
+			}
+
+			curIdx++;
+		}
+	};
+
+	class GPUResourceRowFiller
+	{
+	public:
+		UINT32 curIdx;
+		GUILayout& layout;
+		GUIWidget& widget;
+		Vector<ProfilerOverlayInternal::GPUResourceRow>& rows;
+
+		GPUResourceRowFiller(Vector<ProfilerOverlayInternal::GPUResourceRow>& _rows, GUILayout& _layout, GUIWidget& _widget)
+			:curIdx(0), layout(_layout), widget(_widget), rows(_rows)
+		{ }
+
+		~GPUResourceRowFiller()
+		{
+			UINT32 excessEntries = (UINT32)rows.size() - curIdx;
+			for (UINT32 i = 0; i < excessEntries; i++)
+			{
+				ProfilerOverlayInternal::GPUResourceRow& row = rows[curIdx + i];
+
+				if (!row.disabled)
+				{
+					row.layout->setVisible(false);
+					row.disabled = true;
+				}
+			}
+
+			rows.resize(curIdx);
+		}
+
+		void addData(const GPUProfileResourceSample& sample)
+		{
+			if (curIdx >= rows.size())
+			{
+				rows.push_back(ProfilerOverlayInternal::GPUResourceRow());
+
+				ProfilerOverlayInternal::GPUResourceRow& newRow = rows.back();
+
+				newRow.disabled = false;
+				newRow.name = HEString(L"{0}");
+				newRow.created = HEString(L"{0}");
+				newRow.destroyed = HEString(L"{0}");
+				newRow.reads = HEString(L"{0}");
+				newRow.writes = HEString(L"{0}");
+				newRow.bytesWritten = HEString(L"{0}");
+
+				newRow.layout = layout.insertNewElement<GUILayoutX>(layout.getNumChildren());
+
+				newRow.guiName = newRow.layout->addNewElement<GUILabel>(newRow.name, GUIOptions(GUIOption::fixedWidth(120)));
+				newRow.guiCreated = newRow.layout->addNewElement<GUILabel>(newRow.created, GUIOptions(GUIOption::fixedWidth(60)));
+				newRow.guiDestroyed = newRow.layout->addNewElement<GUILabel>(newRow.destroyed, GUIOptions(GUIOption::fixedWidth(60)));
+				newRow.guiReads = newRow.layout->addNewElement<GUILabel>(newRow.reads, GUIOptions(GUIOption::fixedWidth(60)));
+				newRow.guiWrites = newRow.layout->addNewElement<GUILabel>(newRow.writes, GUIOptions(GUIOption::fixedWidth(60)));
+				newRow.guiBytesWritten = newRow.layout->addNewElement<GUILabel>(newRow.bytesWritten, GUIOptions(GUIOption::fixedWidth(100)));
+			}
+
+			ProfilerOverlayInternal::GPUResourceRow& row = rows[curIdx];
+			row.name.setParameter(0, toWString(sample.name));
+			row.created.setParameter(0, toWString(sample.numCreated));
+			row.destroyed.setParameter(0, toWString(sample.numDestroyed));
+			row.reads.setParameter(0, toWString(sample.numReads));
+			row.writes.setParameter(0, toWString(sample.numWrites));
+			row.bytesWritten.setParameter(0, toWString(sample.numBytesWritten));
+
+			row.guiName->setContent(row.name);
+			row.guiCreated->setContent(row.created);
+			row.guiDestroyed->setContent(row.destroyed);
+			row.guiReads->setContent(row.reads);
+			row.guiWrites->setContent(row.writes);
+			row.guiBytesWritten->setContent(row.bytesWritten);
 
 			if (row.disabled)
 			{
@@ -351,6 +451,9 @@ namespace bs
 
 		if(mWidgetSO)
 			mWidgetSO->destroy();
+
+		if (mIsShown && mType == ProfilerOverlayType::GPUSamples && ProfilerGPU::isStarted())
+			ProfilerGPU::instance().setSamplesEnabled(false);
 	}
 
 	void ProfilerOverlayInternal::setTarget(const SPtr<Camera>& camera)
@@ -436,6 +539,29 @@ namespace bs
 		mGPULayoutFrameContents = mWidget->getPanel()->addNewElement<GUILayoutX>();
 		mGPULayoutFrameContentsLeft = mGPULayoutFrameContents->addNewElement<GUILayoutY>();
 		mGPULayoutFrameContentsRight = mGPULayoutFrameContents->addNewElement<GUILayoutY>();
+		mGPULayoutFrameContentsResources = mGPULayoutFrameContents->addNewElement<GUILayoutY>();
+
+		GUILayout* gpuResourceTitle = mGPULayoutFrameContentsResources->addNewElement<GUILayoutY>();
+		mGPULayoutResourceContents = mGPULayoutFrameContentsResources->addNewElement<GUILayoutY>();
+		mGPULayoutFrameContentsResources->addNewElement<GUIFlexibleSpace>();
+
+		HString gpuResourcesStr(L"__ProfOvGPUResources", L"Resources");
+		gpuResourceTitle->addElement(GUILabel::create(gpuResourcesStr));
+
+		GUILayout* gpuResourceTitleRow = gpuResourceTitle->addNewElement<GUILayoutX>();
+
+		HString gpuResNameStr(L"__ProfOvGPUResName", L"Type");
+		HString gpuResCreatedStr(L"__ProfOvGPUResCreated", L"Created");
+		HString gpuResDestroyedStr(L"__ProfOvGPUResDestroyed", L"Destroyed");
+		HString gpuResReadsStr(L"__ProfOvGPUResReads", L"Reads");
+		HString gpuResWritesStr(L"__ProfOvGPUResWrites", L"Writes");
+		HString gpuResBytesWrittenStr(L"__ProfOvGPUResBytesWritten", L"Bytes written");
+		gpuResourceTitleRow->addElement(GUILabel::create(gpuResNameStr, GUIOptions(GUIOption::fixedWidth(120))));
+		gpuResourceTitleRow->addElement(GUILabel::create(gpuResCreatedStr, GUIOptions(GUIOption::fixedWidth(60))));
+		gpuResourceTitleRow->addElement(GUILabel::create(gpuResDestroyedStr, GUIOptions(GUIOption::fixedWidth(60))));
+		gpuResourceTitleRow->addElement(GUILabel::create(gpuResReadsStr, GUIOptions(GUIOption::fixedWidth(60))));
+		gpuResourceTitleRow->addElement(GUILabel::create(gpuResWritesStr, GUIOptions(GUIOption::fixedWidth(60))));
+		gpuResourceTitleRow->addElement(GUILabel::create(gpuResBytesWrittenStr, GUIOptions(GUIOption::fixedWidth(100))));
 
 		mGPULayoutSamples = mWidget->getPanel()->addNewElement<GUILayoutY>();
 
@@ -451,8 +577,18 @@ namespace bs
 
 		HString gpuSamplesNameStr(L"__ProfOvGPUSampName", L"Name");
 		HString gpuSamplesTimeStr(L"__ProfOvGPUSampTime", L"Time");
+		HString gpuSamplesDrawCallsStr(L"__ProfOvGPUSampDrawCalls", L"Draw calls");
+		HString gpuSamplesPrimitivesStr(L"__ProfOvGPUSampPrimitives", L"Primitives");
+		HString gpuSamplesStateChangesStr(L"__ProfOvGPUSampPSChanges", L"State changes");
+		HString gpuSamplesParamBindsStr(L"__ProfOvGPUSampParamBinds", L"Param. binds");
+		HString gpuSamplesBytesWrittenStr(L"__ProfOvGPUSampBytesWritten", L"Bytes written");
 		gpuSampleTitleRow->addElement(GUILabel::create(gpuSamplesNameStr, GUIOptions(GUIOption::fixedWidth(100))));
 		gpuSampleTitleRow->addElement(GUILabel::create(gpuSamplesTimeStr, GUIOptions(GUIOption::fixedWidth(100))));
+		gpuSampleTitleRow->addElement(GUILabel::create(gpuSamplesDrawCallsStr, GUIOptions(GUIOption::fixedWidth(100))));
+		gpuSampleTitleRow->addElement(GUILabel::create(gpuSamplesPrimitivesStr, GUIOptions(GUIOption::fixedWidth(100))));
+		gpuSampleTitleRow->addElement(GUILabel::create(gpuSamplesStateChangesStr, GUIOptions(GUIOption::fixedWidth(100))));
+		gpuSampleTitleRow->addElement(GUILabel::create(gpuSamplesParamBindsStr, GUIOptions(GUIOption::fixedWidth(100))));
+		gpuSampleTitleRow->addElement(GUILabel::create(gpuSamplesBytesWrittenStr, GUIOptions(GUIOption::fixedWidth(100))));
 
 		mGPUFrameNumStr = HEString(L"__ProfOvFrame", L"Frame #{0}");
 		mGPUTimeStr = HEString(L"__ProfOvTime", L"Time: {0}ms");
@@ -472,6 +608,8 @@ namespace bs
 		mGPUParamBindsStr = HEString(L"__ProfOvGpuParamBinds", L"GPU parameter binds: {0}");
 		mGPUVertexBufferBindsStr = HEString(L"__ProfOvVBBinds", L"VB binds: {0}");
 		mGPUIndexBufferBindsStr = HEString(L"__ProfOvIBBinds", L"IB binds: {0}");
+		mGPUBytesWrittenStr = HEString(L"__ProfOvBytesWritten", L"Bytes written: {0}");
+		mGPUComputeCallsStr = HEString(L"__ProfOvComputeCalls", L"Compute calls: {0}");
 
 		mGPUFrameNumLbl = GUILabel::create(mGPUFrameNumStr, GUIOptions(GUIOption::fixedWidth(200)));
 		mGPUTimeLbl = GUILabel::create(mGPUTimeStr, GUIOptions(GUIOption::fixedWidth(200)));
@@ -491,6 +629,8 @@ namespace bs
 		mGPUParamBindsLbl = GUILabel::create(mGPUParamBindsStr, GUIOptions(GUIOption::fixedWidth(200)));
 		mGPUVertexBufferBindsLbl = GUILabel::create(mGPUVertexBufferBindsStr, GUIOptions(GUIOption::fixedWidth(200)));
 		mGPUIndexBufferBindsLbl = GUILabel::create(mGPUIndexBufferBindsStr, GUIOptions(GUIOption::fixedWidth(200)));
+		mGPUBytesWrittenLbl = GUILabel::create(mGPUBytesWrittenStr, GUIOptions(GUIOption::fixedWidth(200)));
+		mGPUComputeCallsLbl = GUILabel::create(mGPUComputeCallsStr, GUIOptions(GUIOption::fixedWidth(200)));
 
 		mGPULayoutFrameContentsLeft->addElement(mGPUFrameNumLbl);
 		mGPULayoutFrameContentsLeft->addElement(mGPUTimeLbl);
@@ -511,6 +651,8 @@ namespace bs
 		mGPULayoutFrameContentsRight->addElement(mGPUParamBindsLbl);
 		mGPULayoutFrameContentsRight->addElement(mGPUVertexBufferBindsLbl);
 		mGPULayoutFrameContentsRight->addElement(mGPUIndexBufferBindsLbl);
+		mGPULayoutFrameContentsRight->addElement(mGPUBytesWrittenLbl);
+		mGPULayoutFrameContentsRight->addElement(mGPUComputeCallsLbl);
 		mGPULayoutFrameContentsRight->addNewElement<GUIFlexibleSpace>();
 
 		updateCPUSampleAreaSizes();
@@ -548,6 +690,9 @@ namespace bs
 			mPreciseLayoutContents->setVisible(false);
 		}
 
+		// Per-pass GPU samples are only worth recording while they're being displayed
+		ProfilerGPU::instance().setSamplesEnabled(type == ProfilerOverlayType::GPUSamples);
+
 		mType = type;
 		mIsShown = true;
 	}
@@ -560,6 +705,10 @@ namespace bs
 		mPreciseLayoutContents->setVisible(false);
 		mGPULayoutFrameContents->setVisible(false);
 		mGPULayoutSamples->setVisible(false);
+
+		if (mIsShown && mType == ProfilerOverlayType::GPUSamples)
+			ProfilerGPU::instance().setSamplesEnabled(false);
+
 		mIsShown = false;
 	}
 
@@ -744,6 +893,8 @@ namespace bs
 		mGPUParamBindsStr.setParameter(0, toWString(gpuReport.frameSample.numGpuParamBinds));
 		mGPUVertexBufferBindsStr.setParameter(0, toWString(gpuReport.frameSample.numVertexBufferBinds));
 		mGPUIndexBufferBindsStr.setParameter(0, toWString(gpuReport.frameSample.numIndexBufferBinds));
+		mGPUBytesWrittenStr.setParameter(0, toWString(gpuReport.frameSample.numBytesWritten));
+		mGPUComputeCallsStr.setParameter(0, toWString(gpuReport.frameSample.numComputeCalls));
 
 		mGPUFrameNumLbl->setContent(mGPUFrameNumStr);
 		mGPUTimeLbl->setContent(mGPUTimeStr);
@@ -763,11 +914,17 @@ namespace bs
 		mGPUParamBindsLbl->setContent(mGPUParamBindsStr);
 		mGPUVertexBufferBindsLbl->setContent(mGPUVertexBufferBindsStr);
 		mGPUIndexBufferBindsLbl->setContent(mGPUIndexBufferBindsStr);
+		mGPUBytesWrittenLbl->setContent(mGPUBytesWrittenStr);
+		mGPUComputeCallsLbl->setContent(mGPUComputeCallsStr);
+
+		GPUResourceRowFiller resourceRowFiller(mGPUResourceRows, *mGPULayoutResourceContents, *mWidget->_getInternal());
+		for (auto& resource : gpuReport.frameSample.resources)
+			resourceRowFiller.addData(resource);
 
 		GPUSampleRowFiller sampleRowFiller(mGPUSampleRows, *mGPULayoutSampleContents, *mWidget->_getInternal());
 		for (auto& sample : gpuReport.samples)
 		{
-			sampleRowFiller.addData(sample.name, sample.timeMs);
+			sampleRowFiller.addData(sample);
 		}
 	}
 }
\ No newline at end of file
@@ -135,13 +135,14 @@ namespace bs { namespace ct
 		IBLUtility::shutDown();
 	}
 
-	void RendererUtility::setPass(const SPtr<Material>& material, UINT32 passIdx, UINT32 techniqueIdx)
+	void RendererUtility::setPass(const SPtr<Material>& material, UINT32 passIdx, UINT32 techniqueIdx, 
+		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		RenderAPI& rapi = RenderAPI::instance();
 
 		SPtr<Pass> pass = material->getPass(passIdx, techniqueIdx);
-		rapi.setGraphicsPipeline(pass->getGraphicsPipelineState());
-		rapi.setStencilRef(pass->getStencilRefValue());
+		rapi.setGraphicsPipeline(pass->getGraphicsPipelineState(), commandBuffer);
+		rapi.setStencilRef(pass->getStencilRefValue(), commandBuffer);
 	}
 
 	void RendererUtility::setComputePass(const SPtr<Material>& material, UINT32 passIdx)
@@ -152,14 +153,15 @@ namespace bs { namespace ct
 		rapi.setComputePipeline(pass->getComputePipelineState());
 	}
 
-	void RendererUtility::setPassParams(const SPtr<GpuParamsSet>& params, UINT32 passIdx)
+	void RendererUtility::setPassParams(const SPtr<GpuParamsSet>& params, UINT32 passIdx, 
+		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		SPtr<GpuParams> gpuParams = params->getGpuParams(passIdx);
 		if (gpuParams == nullptr)
 			return;
 
 		RenderAPI& rapi = RenderAPI::instance();
-		rapi.setGpuParams(gpuParams);
+		rapi.setGpuParams(gpuParams, commandBuffer);
 	}
 
 	void RendererUtility::draw(const SPtr<MeshBase>& mesh, UINT32 numInstances)
@@ -167,12 +169,13 @@ namespace bs { namespace ct
 		draw(mesh, mesh->getProperties().getSubMesh(0), numInstances);
 	}
 
-	void RendererUtility::draw(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, UINT32 numInstances)
+	void RendererUtility::draw(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, UINT32 numInstances, 
+		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		RenderAPI& rapi = RenderAPI::instance();
 		SPtr<VertexData> vertexData = mesh->getVertexData();
 
-		rapi.setVertexDeclaration(mesh->getVertexData()->vertexDeclaration);
+		rapi.setVertexDeclaration(mesh->getVertexData()->vertexDeclaration, commandBuffer);
 
 		auto& vertexBuffers = vertexData->getBuffers();
 		if (vertexBuffers.size() > 0)
@@ -195,29 +198,31 @@ namespace bs { namespace ct
 				buffers[iter->first - startSlot] = iter->second;
 			}
 
-			rapi.setVertexBuffers(startSlot, buffers, endSlot - startSlot + 1);
+			rapi.setVertexBuffers(startSlot, buffers, endSlot - startSlot + 1, commandBuffer);
 		}
 
 		SPtr<IndexBuffer> indexBuffer = mesh->getIndexBuffer();
-		rapi.setIndexBuffer(indexBuffer);
+		rapi.setIndexBuffer(indexBuffer, commandBuffer);
 
-		rapi.setDrawOperation(subMesh.drawOp);
+		rapi.setDrawOperation(subMesh.drawOp, commandBuffer);
 
 		UINT32 indexCount = subMesh.indexCount;
 		rapi.drawIndexed(subMesh.indexOffset + mesh->getIndexOffset(), indexCount, mesh->getVertexOffset(), 
-			vertexData->vertexCount, numInstances);
+			vertexData->vertexCount, numInstances, commandBuffer);
 
-		mesh->_notifyUsedOnGPU();
+		if (commandBuffer == nullptr)
+			mesh->_notifyUsedOnGPU();
 	}
 
 	void RendererUtility::drawMorph(const SPtr<MeshBase>& mesh, const SubMesh& subMesh, 
-		const SPtr<VertexBuffer>& morphVertices, const SPtr<VertexDeclaration>& morphVertexDeclaration)
+		const SPtr<VertexBuffer>& morphVertices, const SPtr<VertexDeclaration>& morphVertexDeclaration, 
+		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		// Bind buffers and draw
 		RenderAPI& rapi = RenderAPI::instance();
 
 		SPtr<VertexData> vertexData = mesh->getVertexData();
-		rapi.setVertexDeclaration(morphVertexDeclaration);
+		rapi.setVertexDeclaration(morphVertexDeclaration, commandBuffer);
 
 		auto& meshBuffers = vertexData->getBuffers();
 		SPtr<VertexBuffer> allBuffers[BS_MAX_BOUND_VERTEX_BUFFERS];
@@ -240,18 +245,19 @@ namespace bs { namespace ct
 			allBuffers[iter->first - startSlot] = iter->second;
 
 		allBuffers[1] = morphVertices;
-		rapi.setVertexBuffers(startSlot, allBuffers, endSlot - startSlot + 1);
+		rapi.setVertexBuffers(startSlot, allBuffers, endSlot - startSlot + 1, commandBuffer);
 
 		SPtr<IndexBuffer> indexBuffer = mesh->getIndexBuffer();
-		rapi.setIndexBuffer(indexBuffer);
+		rapi.setIndexBuffer(indexBuffer, commandBuffer);
 
-		rapi.setDrawOperation(subMesh.drawOp);
+		rapi.setDrawOperation(subMesh.drawOp, commandBuffer);
 
 		UINT32 indexCount = subMesh.indexCount;
 		rapi.drawIndexed(subMesh.indexOffset + mesh->getIndexOffset(), indexCount, mesh->getVertexOffset(),
-			vertexData->vertexCount, 1);
+			vertexData->vertexCount, 1, commandBuffer);
 
-		mesh->_notifyUsedOnGPU();
+		if (commandBuffer == nullptr)
+			mesh->_notifyUsedOnGPU();
 	}
 
 	void RendererUtility::blit(const SPtr<Texture>& texture, const Rect2I& area, bool flipUV)
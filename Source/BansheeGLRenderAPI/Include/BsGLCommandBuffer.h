@@ -15,12 +15,59 @@ namespace bs { namespace ct
 	/**
 	 * Command buffer implementation for OpenGL, which doesn't support multi-threaded command generation. Instead all
 	 * commands are stored in an internal buffer, and then sent to the actual render API when the buffer is executed.
+	 * Recording a command doesn't touch any render API state, so buffers can be populated on worker threads.
+	 *
+	 * Commands are stored by value in large memory blocks that are reused after the buffer is cleared, so recording a
+	 * command normally doesn't require any heap allocations.
 	 */
 	class GLCommandBuffer : public CommandBuffer
 	{
+		/** Header preceding every command in the command stream. Contains type specific operations on the command. */
+		struct CommandHeader
+		{
+			void(*execute)(void* command);
+			void(*copy)(const void* command, GLCommandBuffer& target);
+			void(*destroy)(void* command);
+		};
+
+		/** Memory block that commands are allocated from. */
+		struct Block
+		{
+			UINT8* data;
+			UINT32 size;
+			UINT32 used;
+		};
+
+		static const UINT32 COMMAND_ALIGNMENT = 16;
+		static const UINT32 HEADER_SIZE = (sizeof(CommandHeader) + COMMAND_ALIGNMENT - 1) & ~(COMMAND_ALIGNMENT - 1);
+		static const UINT32 BLOCK_SIZE = 64 * 1024;
+
 	public:
-		/** Registers a new command in the command buffer. */
-		void queueCommand(const std::function<void()> command);
+		~GLCommandBuffer();
+
+		/**
+		 * Registers a new command in the command buffer. The command can be any callable object with no parameters, and
+		 * is copied into the command stream.
+		 */
+		template<class T>
+		void queueCommand(T&& command)
+		{
+			typedef typename std::decay<T>::type CommandType;
+			static_assert(alignof(CommandType) <= COMMAND_ALIGNMENT, "Command type alignment is not supported.");
+
+			const UINT32 size = HEADER_SIZE +
+				(((UINT32)sizeof(CommandType) + COMMAND_ALIGNMENT - 1) & ~(COMMAND_ALIGNMENT - 1));
+
+			UINT8* data = allocCommand(size);
+
+			CommandHeader* header = (CommandHeader*)data;
+			header->execute = [](void* command) { (*(CommandType*)command)(); };
+			header->copy = [](const void* command, GLCommandBuffer& target) { target.queueCommand(*(const CommandType*)command); };
+			header->destroy = [](void* command) { ((CommandType*)command)->~CommandType(); };
+
+			new (data + HEADER_SIZE) CommandType(std::forward<T>(command));
+			mCommands.push_back(header);
+		}
 
 		/** Appends all commands from the secondary buffer into this command buffer. */
 		void appendSecondary(const SPtr<GLCommandBuffer>& secondaryBuffer);
@@ -37,10 +84,13 @@ namespace bs { namespace ct
 
 		GLCommandBuffer(GpuQueueType type, UINT32 deviceIdx, UINT32 queueIdx, bool secondary);
 
-		Vector<std::function<void()>> mCommands;
+		/** Allocates memory for a new command (including its header) from the command stream. */
+		UINT8* allocCommand(UINT32 size);
 
-		DrawOperationType mCurrentDrawOperation;
+		Vector<CommandHeader*> mCommands;
+		Vector<Block> mBlocks;
+		UINT32 mCurrentBlockIdx;
 	};
 
 	/** @} */
-}}
\ No newline at end of file
+}}
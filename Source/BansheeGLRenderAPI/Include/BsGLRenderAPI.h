@@ -6,6 +6,7 @@
 #include "BsRenderAPI.h"
 #include "BsGLHardwareBufferManager.h"
 #include "BsGLSLProgramFactory.h"
+#include "BsGLStateCache.h"
 #include "BsMatrix4.h"
 
 namespace bs { namespace ct
@@ -119,6 +120,9 @@ namespace bs { namespace ct
 		/**	Returns a support object you may use for creating */
 		GLSupport* getGLSupport() const { return mGLSupport; }
 
+		/** Returns the cache that filters out redundant OpenGL state changes. */
+		GLStateCache& _getStateCache() { return mStateCache; }
+
 	protected:
 		/** @copydoc RenderAPI::initialize */
 		void initialize() override;
@@ -406,8 +410,6 @@ namespace bs { namespace ct
 		SPtr<GLSLGpuProgram> mCurrentDomainProgram;
 		SPtr<GLSLGpuProgram> mCurrentComputeProgram;
 
-		const GLSLProgramPipeline* mActivePipeline;
-
 		std::array<SPtr<VertexBuffer>, MAX_VB_COUNT> mBoundVertexBuffers;
 		SPtr<VertexDeclaration> mBoundVertexDeclaration;
 		SPtr<IndexBuffer> mBoundIndexBuffer;
@@ -419,6 +421,7 @@ namespace bs { namespace ct
 		bool mDrawCallInProgress;
 
 		UINT16 mActiveTextureUnit;
+		GLStateCache mStateCache;
     };
 
 	/** @} */
@@ -0,0 +1,156 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsGLPrerequisites.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup GL
+	 *  @{
+	 */
+
+	/**
+	 * Keeps a shadow copy of the OpenGL context state and filters out calls that wouldn't change it. Every call made
+	 * through the cache is counted as either issued or filtered in the render statistics.
+	 *
+	 * @note
+	 * State that isn't known yet (e.g. after a context switch) is always applied. Any code changing the tracked state
+	 * directly must call invalidate() afterwards.
+	 * @note
+	 * Core thread only.
+	 */
+	class GLStateCache
+	{
+	public:
+		GLStateCache();
+
+		/** Forgets all cached state, so the next call for each piece of state is issued to OpenGL. */
+		void invalidate();
+
+		/** Enables or disables an OpenGL capability (e.g. GL_BLEND). */
+		void setEnabled(GLenum cap, bool enabled);
+
+		/** Checks if an OpenGL capability is enabled. Only queries OpenGL if the state isn't known. */
+		bool isEnabled(GLenum cap);
+
+		/** Sets the RGB and alpha blend factors, as in glBlendFuncSeparate. */
+		void setBlendFunc(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha);
+
+		/** Sets the RGB and alpha blend equations, as in glBlendEquationSeparate. */
+		void setBlendEquation(GLenum modeRGB, GLenum modeAlpha);
+
+		/** Enables or disables writes to individual color channels, as in glColorMask. */
+		void setColorMask(bool red, bool green, bool blue, bool alpha);
+
+		/** Enables or disables depth buffer writes, as in glDepthMask. */
+		void setDepthMask(bool enabled);
+
+		/** Sets the depth comparison function, as in glDepthFunc. */
+		void setDepthFunc(GLenum func);
+
+		/** Sets the depth bias values, as in glPolygonOffset. */
+		void setPolygonOffset(float factor, float units);
+
+		/** Sets the rasterization mode for both faces, as in glPolygonMode. */
+		void setPolygonMode(GLenum mode);
+
+		/** Sets which faces get culled, as in glCullFace. */
+		void setCullFace(GLenum mode);
+
+		/** Sets stencil operations for front (GL_FRONT) or back (GL_BACK) faces, as in glStencilOpSeparate. */
+		void setStencilOp(GLenum face, GLenum stencilFail, GLenum depthFail, GLenum pass);
+
+		/** Sets the stencil test function for front (GL_FRONT) or back (GL_BACK) faces, as in glStencilFuncSeparate. */
+		void setStencilFunc(GLenum face, GLenum func, GLint ref, GLuint mask);
+
+		/** Sets the stencil write mask for both faces, as in glStencilMask. */
+		void setStencilMask(GLuint mask);
+
+		/** Sets the viewport rectangle, as in glViewport. */
+		void setViewport(GLint x, GLint y, GLsizei width, GLsizei height);
+
+		/** Sets the scissor rectangle, as in glScissor. */
+		void setScissor(GLint x, GLint y, GLsizei width, GLsizei height);
+
+		/** Binds a program for rendering, as in glUseProgram. */
+		void useProgram(GLuint program);
+
+		/** Binds a program pipeline, as in glBindProgramPipeline. */
+		void bindProgramPipeline(GLuint pipeline);
+
+		/** Binds a vertex array object, as in glBindVertexArray. */
+		void bindVertexArray(GLuint vao);
+
+		/** Binds a buffer to an indexed GL_UNIFORM_BUFFER or GL_SHADER_STORAGE_BUFFER target, as in glBindBufferBase. */
+		void bindBufferBase(GLenum target, GLuint index, GLuint buffer);
+
+		/**
+		 * Notifies the cache that a buffer object is about to be deleted. Must be called before deleting any buffer that
+		 * could have been bound through the cache, since OpenGL might reuse its name for a new buffer.
+		 */
+		void notifyBufferDestroyed(GLuint buffer);
+
+		/** Assigns a value to an integer uniform (e.g. a sampler unit), as in glProgramUniform1i. */
+		void setProgramUniform(GLSLGpuProgram& program, GLint location, GLint value);
+
+		/** Assigns a binding point to an uniform block of the program, as in glUniformBlockBinding. */
+		void setUniformBlockBinding(GLSLGpuProgram& program, GLuint blockIndex, GLuint binding);
+
+		/** Assigns a binding point to a shader storage block of the program, as in glShaderStorageBlockBinding. */
+		void setStorageBlockBinding(GLSLGpuProgram& program, GLuint blockIndex, GLuint binding);
+
+		/**
+		 * Checks if the provided data differs from the data last uploaded to the program's default uniform block. If it
+		 * does the data is remembered and true is returned, in which case the caller is expected to upload it. The upload
+		 * of @p numUniforms uniforms is counted as issued or filtered, respectively.
+		 */
+		bool updateUniformData(GLSLGpuProgram& program, const UINT8* data, UINT32 size, UINT32 numUniforms);
+
+	private:
+		/** Registers OpenGL calls that were issued. */
+		void notifyIssued(UINT32 count = 1);
+
+		/** Registers OpenGL calls that were filtered out. */
+		void notifyFiltered(UINT32 count = 1);
+
+		/** Returns the index of the capability in the capability state array, or -1 if it's not tracked. */
+		static INT32 getCapIdx(GLenum cap);
+
+		/** Sentinel value used for unknown state. */
+		static const GLuint UNKNOWN = 0xFFFFFFFF;
+
+		static const UINT32 NUM_CAPS = 16;
+		static const UINT32 MAX_BUFFER_BINDINGS = 16;
+
+		INT8 mCaps[NUM_CAPS]; // -1 unknown, 0 disabled, 1 enabled
+
+		GLenum mBlendFunc[4];
+		GLenum mBlendEquation[2];
+		GLuint mColorMask;
+		GLuint mDepthMask;
+		GLenum mDepthFunc;
+		float mPolygonOffset[2];
+		bool mPolygonOffsetKnown;
+		GLenum mPolygonMode;
+		GLenum mCullFace;
+
+		GLenum mStencilOp[2][3];
+		GLenum mStencilFunc[2];
+		GLint mStencilRef[2];
+		GLuint mStencilReadMask[2];
+		UINT64 mStencilWriteMask; // Wider than the mask so all mask values are distinct from the unknown value
+
+		GLint mViewport[4];
+		GLint mScissor[4];
+
+		GLuint mProgram;
+		GLuint mProgramPipeline;
+		GLuint mVertexArray;
+
+		GLuint mUniformBuffers[MAX_BUFFER_BINDINGS];
+		GLuint mStorageBuffers[MAX_BUFFER_BINDINGS];
+	};
+
+	/** @} */
+}}
@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsGLBuffer.h"
 #include "BsGLHardwareBufferManager.h"
+#include "BsGLRenderAPI.h"
 #include "BsException.h"
 
 namespace bs { namespace ct
@@ -21,7 +22,10 @@ namespace bs { namespace ct
 	GLBuffer::~GLBuffer()
 	{
 		if(mBufferId != 0)
+		{
+			static_cast<GLRenderAPI&>(RenderAPI::instance())._getStateCache().notifyBufferDestroyed(mBufferId);
 			glDeleteBuffers(1, &mBufferId);
+		}
 	}
 
 	void GLBuffer::initialize(GLenum target, UINT32 size, GpuBufferUsage usage)
@@ -5,15 +5,18 @@
 namespace bs { namespace ct
 {
 	GLCommandBuffer::GLCommandBuffer(GpuQueueType type, UINT32 deviceIdx, UINT32 queueIdx, bool secondary)
-		: CommandBuffer(type, deviceIdx, queueIdx, secondary), mCurrentDrawOperation(DOT_TRIANGLE_LIST)
+		: CommandBuffer(type, deviceIdx, queueIdx, secondary), mCurrentBlockIdx(0)
 	{
 		if (deviceIdx != 0)
 			BS_EXCEPT(InvalidParametersException, "Only a single device supported on DX11.");
 	}
 
-	void GLCommandBuffer::queueCommand(const std::function<void()> command)
+	GLCommandBuffer::~GLCommandBuffer()
 	{
-		mCommands.push_back(command);
+		clear();
+
+		for (auto& block : mBlocks)
+			bs_free_aligned16(block.data);
 	}
 
 	void GLCommandBuffer::appendSecondary(const SPtr<GLCommandBuffer>& secondaryBuffer)
@@ -33,7 +36,7 @@ namespace bs { namespace ct
 #endif
 
 		for (auto& entry : secondaryBuffer->mCommands)
-			mCommands.push_back(entry);
+			entry->copy((UINT8*)entry + HEADER_SIZE, *this);
 	}
 
 	void GLCommandBuffer::executeCommands()
@@ -47,11 +50,47 @@ namespace bs { namespace ct
 #endif
 
 		for (auto& entry : mCommands)
-			entry();
+			entry->execute((UINT8*)entry + HEADER_SIZE);
 	}
 
 	void GLCommandBuffer::clear()
 	{
+		for (auto& entry : mCommands)
+			entry->destroy((UINT8*)entry + HEADER_SIZE);
+
 		mCommands.clear();
+
+		// Keep the memory blocks around for the next batch of commands
+		for (auto& block : mBlocks)
+			block.used = 0;
+
+		mCurrentBlockIdx = 0;
+	}
+
+	UINT8* GLCommandBuffer::allocCommand(UINT32 size)
+	{
+		while (mCurrentBlockIdx < (UINT32)mBlocks.size())
+		{
+			Block& block = mBlocks[mCurrentBlockIdx];
+			if ((block.used + size) <= block.size)
+			{
+				UINT8* data = block.data + block.used;
+				block.used += size;
+
+				return data;
+			}
+
+			mCurrentBlockIdx++;
+		}
+
+		Block block;
+		block.size = std::max(BLOCK_SIZE, size);
+		block.data = (UINT8*)bs_alloc_aligned16(block.size);
+		block.used = size;
+
+		mBlocks.push_back(block);
+		mCurrentBlockIdx = (UINT32)mBlocks.size() - 1;
+
+		return block.data;
 	}
-}}
\ No newline at end of file
+}}
@@ -1,6 +1,7 @@
 //********************************** Banshee Engine (www.banshee3d.com) **************************************************//
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsGLGpuParamBlockBuffer.h"
+#include "BsGLRenderAPI.h"
 #include "BsRenderStats.h"
 #include "BsException.h"
 
@@ -14,6 +15,7 @@ namespace bs { namespace ct
 
 	GLGpuParamBlockBuffer::~GLGpuParamBlockBuffer()
 	{
+		static_cast<GLRenderAPI&>(RenderAPI::instance())._getStateCache().notifyBufferDestroyed(mGLHandle);
 		glDeleteBuffers(1, &mGLHandle);
 
 		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_GpuParamBuffer);
@@ -42,6 +44,6 @@ namespace bs { namespace ct
 		glBufferSubData(GL_UNIFORM_BUFFER, 0 , mSize, data);
 		glBindBuffer(GL_UNIFORM_BUFFER, 0);
 
-		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuParamBuffer);
+		BS_ADD_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuParamBuffer, mSize);
 	}
 }}
\ No newline at end of file
@@ -54,6 +54,9 @@ namespace bs { namespace ct
 
     GLenum GLHardwareBufferManager::getGLUsage(GpuBufferUsage usage)
     {
+		if(usage & GBU_CPUREADABLE)
+			return GL_DYNAMIC_READ;
+
 		if(usage & GBU_STATIC)
 			return GL_STATIC_DRAW;
 
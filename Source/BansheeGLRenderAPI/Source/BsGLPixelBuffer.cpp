@@ -291,7 +291,7 @@ namespace bs { namespace ct
 		glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
 		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
 
-		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_Texture);
+		BS_ADD_RENDER_STAT_CAT(ResWrite, RenderStatObject_Texture, data.getConsecutiveSize());
 	}
 
 	void GLTextureBuffer::download(const PixelData &data)
@@ -54,7 +54,6 @@ namespace bs { namespace ct
 		, mDepthWrite(true)
 		, mGLSLProgramFactory(nullptr)
 		, mProgramPipelineManager(nullptr)
-		, mActivePipeline(nullptr)
 		, mCurrentDrawOperation(DOT_TRIANGLE_LIST)
 		, mDrawCallInProgress(false)
 		, mActiveTextureUnit(-1)
@@ -107,6 +106,11 @@ namespace bs { namespace ct
 
 		QueryManager::startUp<GLQueryManager>();
 
+		RenderStats& renderStats = RenderStats::instance();
+		renderStats.setResourceTypeName(RenderStatObject_PipelineObject, "PipelineObject");
+		renderStats.setResourceTypeName(RenderStatObject_FrameBufferObject, "FrameBufferObject");
+		renderStats.setResourceTypeName(RenderStatObject_VertexArrayObject, "VertexArrayObject");
+
 		RenderAPI::initialize();
 	}
 
@@ -310,6 +314,8 @@ namespace bs { namespace ct
 				setDepthBufferWriteEnabled(stateProps.getDepthWriteEnable());
 				setDepthBufferFunction(stateProps.getDepthComparisonFunc());
 			}
+
+			BS_INC_RENDER_STAT(NumPipelineStateChanges);
 		};
 
 		if (commandBuffer == nullptr)
@@ -321,8 +327,6 @@ namespace bs { namespace ct
 			SPtr<GLCommandBuffer> cb = std::static_pointer_cast<GLCommandBuffer>(commandBuffer);
 			cb->queueCommand(execute);
 		}
-
-		BS_INC_RENDER_STAT(NumPipelineStateChanges);
 	}
 
 	void GLRenderAPI::setComputePipeline(const SPtr<ComputePipelineState>& pipelineState,
@@ -340,6 +344,8 @@ namespace bs { namespace ct
 				mCurrentComputeProgram = std::static_pointer_cast<GLSLGpuProgram>(program);
 			else
 				mCurrentComputeProgram = nullptr;
+
+			BS_INC_RENDER_STAT(NumPipelineStateChanges);
 		};
 
 		if (commandBuffer == nullptr)
@@ -351,8 +357,6 @@ namespace bs { namespace ct
 			SPtr<GLCommandBuffer> cb = std::static_pointer_cast<GLCommandBuffer>(commandBuffer);
 			cb->queueCommand(execute);
 		}
-
-		BS_INC_RENDER_STAT(NumPipelineStateChanges);
 	}
 
 	void GLRenderAPI::setGpuParams(const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer)
@@ -473,9 +477,7 @@ namespace bs { namespace ct
 							SPtr<GLSLGpuProgram> activeProgram = getActiveProgram(type);
 							if (activeProgram != nullptr)
 							{
-								GLuint glProgram = activeProgram->getGLHandle();
-
-								glProgramUniform1i(glProgram, binding, unit);
+								mStateCache.setProgramUniform(*activeProgram, binding, unit);
 							}
 						}
 						else
@@ -544,9 +546,7 @@ namespace bs { namespace ct
 									SPtr<GLSLGpuProgram> activeProgram = getActiveProgram(type);
 									if (activeProgram != nullptr)
 									{
-										GLuint glProgram = activeProgram->getGLHandle();
-
-										glProgramUniform1i(glProgram, binding, unit);
+										mStateCache.setProgramUniform(*activeProgram, binding, unit);
 									}
 								}
 								else
@@ -564,9 +564,7 @@ namespace bs { namespace ct
 									SPtr<GLSLGpuProgram> activeProgram = getActiveProgram(type);
 									if (activeProgram != nullptr)
 									{
-										GLuint glProgram = activeProgram->getGLHandle();
-
-										glProgramUniform1i(glProgram, binding, unit);
+										mStateCache.setProgramUniform(*activeProgram, binding, unit);
 									}
 								}
 								else
@@ -578,18 +576,16 @@ namespace bs { namespace ct
 								UINT32 unit = getSharedStorageUnit(binding);
 								if (glBuffer != nullptr)
 								{
-									glBindBufferBase(GL_SHADER_STORAGE_BUFFER, unit, glBuffer->getGLBufferId());
+									mStateCache.bindBufferBase(GL_SHADER_STORAGE_BUFFER, unit, glBuffer->getGLBufferId());
 									
 									SPtr<GLSLGpuProgram> activeProgram = getActiveProgram(type);
 									if (activeProgram != nullptr)
 									{
-										GLuint glProgram = activeProgram->getGLHandle();
-
-										glShaderStorageBlockBinding(glProgram, binding, unit);
+										mStateCache.setStorageBlockBinding(*activeProgram, binding, unit);
 									}
 								}
 								else
-									glBindBufferBase(GL_SHADER_STORAGE_BUFFER, unit, 0);
+									mStateCache.bindBufferBase(GL_SHADER_STORAGE_BUFFER, unit, 0);
 							}
 							break;
 						}
@@ -612,9 +608,7 @@ namespace bs { namespace ct
 							SPtr<GLSLGpuProgram> activeProgram = getActiveProgram(type);
 							if (activeProgram != nullptr)
 							{
-								GLuint glProgram = activeProgram->getGLHandle();
-
-								glProgramUniform1i(glProgram, binding, unit);
+								mStateCache.setProgramUniform(*activeProgram, binding, unit);
 							}
 						}
 						else
@@ -640,85 +634,97 @@ namespace bs { namespace ct
 							UINT8* uniformBufferData = (UINT8*)bs_stack_alloc(buffer->getSize());
 							buffer->read(0, uniformBufferData, buffer->getSize());
 
-							for (auto iter = paramDesc->params.begin(); iter != paramDesc->params.end(); ++iter)
+							UINT32 numUniforms = 0;
+							for (auto& paramEntry : paramDesc->params)
 							{
-								const GpuParamDataDesc& param = iter->second;
+								if (paramEntry.second.paramBlockSlot == 0)
+									numUniforms++;
+							}
 
-								if (param.paramBlockSlot != 0) // 0 means uniforms are not in a block
-									continue;
+							// Skip the upload if the program already holds the same values
+							UINT32 dataSize = buffer->getSize();
+							if (mStateCache.updateUniformData(*activeProgram, uniformBufferData, dataSize, numUniforms))
+							{
+								for (auto iter = paramDesc->params.begin(); iter != paramDesc->params.end(); ++iter)
+								{
+									const GpuParamDataDesc& param = iter->second;
 
-								const UINT8* ptrData = uniformBufferData + param.cpuMemOffset * sizeof(UINT32);
+									if (param.paramBlockSlot != 0) // 0 means uniforms are not in a block
+										continue;
 
-								// Note: We don't transpose matrices here even though we don't use column major format
-								// because they are assumed to be pre-transposed in the GpuParams buffer
-								switch (param.type)
-								{
-								case GPDT_FLOAT1:
-									glProgramUniform1fv(glProgram, param.gpuMemOffset, param.arraySize, (GLfloat*)ptrData);
-									break;
-								case GPDT_FLOAT2:
-									glProgramUniform2fv(glProgram, param.gpuMemOffset, param.arraySize, (GLfloat*)ptrData);
-									break;
-								case GPDT_FLOAT3:
-									glProgramUniform3fv(glProgram, param.gpuMemOffset, param.arraySize, (GLfloat*)ptrData);
-									break;
-								case GPDT_FLOAT4:
-									glProgramUniform4fv(glProgram, param.gpuMemOffset, param.arraySize, (GLfloat*)ptrData);
-									break;
-								case GPDT_MATRIX_2X2:
-									glProgramUniformMatrix2fv(glProgram, param.gpuMemOffset, param.arraySize,
-										GL_FALSE, (GLfloat*)ptrData);
-									break;
-								case GPDT_MATRIX_2X3:
-									glProgramUniformMatrix3x2fv(glProgram, param.gpuMemOffset, param.arraySize,
-										GL_FALSE, (GLfloat*)ptrData);
-									break;
-								case GPDT_MATRIX_2X4:
-									glProgramUniformMatrix4x2fv(glProgram, param.gpuMemOffset, param.arraySize,
-										GL_FALSE, (GLfloat*)ptrData);
-									break;
-								case GPDT_MATRIX_3X2:
-									glProgramUniformMatrix2x3fv(glProgram, param.gpuMemOffset, param.arraySize,
-										GL_FALSE, (GLfloat*)ptrData);
-									break;
-								case GPDT_MATRIX_3X3:
-									glProgramUniformMatrix3fv(glProgram, param.gpuMemOffset, param.arraySize,
-										GL_FALSE, (GLfloat*)ptrData);
-									break;
-								case GPDT_MATRIX_3X4:
-									glProgramUniformMatrix4x3fv(glProgram, param.gpuMemOffset, param.arraySize,
-										GL_FALSE, (GLfloat*)ptrData);
-									break;
-								case GPDT_MATRIX_4X2:
-									glProgramUniformMatrix2x4fv(glProgram, param.gpuMemOffset, param.arraySize,
-										GL_FALSE, (GLfloat*)ptrData);
-									break;
-								case GPDT_MATRIX_4X3:
-									glProgramUniformMatrix3x4fv(glProgram, param.gpuMemOffset, param.arraySize,
-										GL_FALSE, (GLfloat*)ptrData);
-									break;
-								case GPDT_MATRIX_4X4:
-									glProgramUniformMatrix4fv(glProgram, param.gpuMemOffset, param.arraySize,
-										GL_FALSE, (GLfloat*)ptrData);
-									break;
-								case GPDT_INT1:
-									glProgramUniform1iv(glProgram, param.gpuMemOffset, param.arraySize, (GLint*)ptrData);
-									break;
-								case GPDT_INT2:
-									glProgramUniform2iv(glProgram, param.gpuMemOffset, param.arraySize, (GLint*)ptrData);
-									break;
-								case GPDT_INT3:
-									glProgramUniform3iv(glProgram, param.gpuMemOffset, param.arraySize, (GLint*)ptrData);
-									break;
-								case GPDT_INT4:
-									glProgramUniform4iv(glProgram, param.gpuMemOffset, param.arraySize, (GLint*)ptrData);
-									break;
-								case GPDT_BOOL:
-									glProgramUniform1uiv(glProgram, param.gpuMemOffset, param.arraySize, (GLuint*)ptrData);
-									break;
-								default:
-								case GPDT_UNKNOWN:
-									break;
+									const UINT8* ptrData = uniformBufferData + param.cpuMemOffset * sizeof(UINT32);
+
+									// Note: We don't transpose matrices here even though we don't use column major format
+									// because they are assumed to be pre-transposed in the GpuParams buffer
+									switch (param.type)
+									{
+									case GPDT_FLOAT1:
+										glProgramUniform1fv(glProgram, param.gpuMemOffset, param.arraySize, (GLfloat*)ptrData);
+										break;
+									case GPDT_FLOAT2:
+										glProgramUniform2fv(glProgram, param.gpuMemOffset, param.arraySize, (GLfloat*)ptrData);
+										break;
+									case GPDT_FLOAT3:
+										glProgramUniform3fv(glProgram, param.gpuMemOffset, param.arraySize, (GLfloat*)ptrData);
+										break;
+									case GPDT_FLOAT4:
+										glProgramUniform4fv(glProgram, param.gpuMemOffset, param.arraySize, (GLfloat*)ptrData);
+										break;
+									case GPDT_MATRIX_2X2:
+										glProgramUniformMatrix2fv(glProgram, param.gpuMemOffset, param.arraySize,
+											GL_FALSE, (GLfloat*)ptrData);
+										break;
+									case GPDT_MATRIX_2X3:
+										glProgramUniformMatrix3x2fv(glProgram, param.gpuMemOffset, param.arraySize,
+											GL_FALSE, (GLfloat*)ptrData);
+										break;
+									case GPDT_MATRIX_2X4:
+										glProgramUniformMatrix4x2fv(glProgram, param.gpuMemOffset, param.arraySize,
+											GL_FALSE, (GLfloat*)ptrData);
+										break;
+									case GPDT_MATRIX_3X2:
+										glProgramUniformMatrix2x3fv(glProgram, param.gpuMemOffset, param.arraySize,
+											GL_FALSE, (GLfloat*)ptrData);
+										break;
+									case GPDT_MATRIX_3X3:
+										glProgramUniformMatrix3fv(glProgram, param.gpuMemOffset, param.arraySize,
+											GL_FALSE, (GLfloat*)ptrData);
+										break;
+									case GPDT_MATRIX_3X4:
+										glProgramUniformMatrix4x3fv(glProgram, param.gpuMemOffset, param.arraySize,
+											GL_FALSE, (GLfloat*)ptrData);
+										break;
+									case GPDT_MATRIX_4X2:
+										glProgramUniformMatrix2x4fv(glProgram, param.gpuMemOffset, param.arraySize,
+											GL_FALSE, (GLfloat*)ptrData);
+										break;
+									case GPDT_MATRIX_4X3:
+										glProgramUniformMatrix3x4fv(glProgram, param.gpuMemOffset, param.arraySize,
+											GL_FALSE, (GLfloat*)ptrData);
+										break;
+									case GPDT_MATRIX_4X4:
+										glProgramUniformMatrix4fv(glProgram, param.gpuMemOffset, param.arraySize,
+											GL_FALSE, (GLfloat*)ptrData);
+										break;
+									case GPDT_INT1:
+										glProgramUniform1iv(glProgram, param.gpuMemOffset, param.arraySize, (GLint*)ptrData);
+										break;
+									case GPDT_INT2:
+										glProgramUniform2iv(glProgram, param.gpuMemOffset, param.arraySize, (GLint*)ptrData);
+										break;
+									case GPDT_INT3:
+										glProgramUniform3iv(glProgram, param.gpuMemOffset, param.arraySize, (GLint*)ptrData);
+										break;
+									case GPDT_INT4:
+										glProgramUniform4iv(glProgram, param.gpuMemOffset, param.arraySize, (GLint*)ptrData);
+										break;
+									case GPDT_BOOL:
+										glProgramUniform1uiv(glProgram, param.gpuMemOffset, param.arraySize, (GLuint*)ptrData);
+										break;
+									default:
+									case GPDT_UNKNOWN:
+										break;
+									}
 								}
 							}
 
@@ -732,8 +738,8 @@ namespace bs { namespace ct
 							const GLGpuParamBlockBuffer* glParamBlockBuffer = static_cast<const GLGpuParamBlockBuffer*>(buffer.get());
 
 							UINT32 unit = getUniformUnit(binding - 1);
-							glUniformBlockBinding(glProgram, binding - 1, unit);
-							glBindBufferBase(GL_UNIFORM_BUFFER, unit, glParamBlockBuffer->getGLHandle());
+							mStateCache.setUniformBlockBinding(*activeProgram, binding - 1, unit);
+							mStateCache.bindBufferBase(GL_UNIFORM_BUFFER, unit, glParamBlockBuffer->getGLHandle());
 						}
 					}
 				}
@@ -741,6 +747,8 @@ namespace bs { namespace ct
 			bs_frame_clear();
 
 			activateGLTextureUnit(0);
+
+			BS_INC_RENDER_STAT(NumGpuParamBinds);
 		};
 
 		if (commandBuffer == nullptr)
@@ -752,8 +760,6 @@ namespace bs { namespace ct
 			SPtr<GLCommandBuffer> cb = std::static_pointer_cast<GLCommandBuffer>(commandBuffer);
 			cb->queueCommand(execute);
 		}
-
-		BS_INC_RENDER_STAT(NumGpuParamBinds);
 	}
 
 	void GLRenderAPI::setStencilRef(UINT32 stencilRefValue, const SPtr<CommandBuffer>& commandBuffer)
@@ -830,14 +836,16 @@ namespace bs { namespace ct
 
 				// Enable / disable sRGB states
 				if (target->getProperties().isHwGammaEnabled())
-					glEnable(GL_FRAMEBUFFER_SRGB);
+					mStateCache.setEnabled(GL_FRAMEBUFFER_SRGB, true);
 				else
-					glDisable(GL_FRAMEBUFFER_SRGB);
+					mStateCache.setEnabled(GL_FRAMEBUFFER_SRGB, false);
 			}
 			else
 				glBindFramebuffer(GL_FRAMEBUFFER, 0);
 
 			applyViewport();
+
+			BS_INC_RENDER_STAT(NumRenderTargetChanges);
 		};
 
 		if (commandBuffer == nullptr)
@@ -849,8 +857,6 @@ namespace bs { namespace ct
 			SPtr<GLCommandBuffer> cb = std::static_pointer_cast<GLCommandBuffer>(commandBuffer);
 			cb->queueCommand(execute);
 		}
-
-		BS_INC_RENDER_STAT(NumRenderTargetChanges);
 	}
 
 	void GLRenderAPI::setVertexBuffers(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers, 
@@ -882,7 +888,12 @@ namespace bs { namespace ct
 			executeRef(index, buffers, numBuffers);
 		else
 		{
-			auto execute = [=]() { executeRef(index, buffers, numBuffers); };
+			// Caller's array isn't guaranteed to be alive when the command executes, so copy it
+			std::array<SPtr<VertexBuffer>, MAX_VB_COUNT> bufferCopies;
+			for (UINT32 i = 0; i < numBuffers; i++)
+				bufferCopies[i] = buffers[i];
+
+			auto execute = [=]() mutable { executeRef(index, bufferCopies.data(), numBuffers); };
 
 			SPtr<GLCommandBuffer> cb = std::static_pointer_cast<GLCommandBuffer>(commandBuffer);
 			cb->queueCommand(execute);
@@ -927,8 +938,6 @@ namespace bs { namespace ct
 
 			SPtr<GLCommandBuffer> cb = std::static_pointer_cast<GLCommandBuffer>(commandBuffer);
 			cb->queueCommand(execute);
-
-			cb->mCurrentDrawOperation = op;
 		}
 	}
 
@@ -959,6 +968,10 @@ namespace bs { namespace ct
 		{
 			THROW_IF_NOT_CORE_THREAD;
 
+			BS_INC_RENDER_STAT(NumDrawCalls);
+			BS_ADD_RENDER_STAT(NumVertices, vertexCount);
+			BS_ADD_RENDER_STAT(NumPrimitives, vertexCountToPrimCount(mCurrentDrawOperation, vertexCount));
+
 			// Find the correct type to render
 			GLint primType = getGLDrawMode();
 			beginDraw();
@@ -971,26 +984,15 @@ namespace bs { namespace ct
 			endDraw();
 		};
 
-		UINT32 primCount;
 		if (commandBuffer == nullptr)
-		{
 			executeRef(vertexOffset, vertexCount, instanceCount);
-
-			primCount = vertexCountToPrimCount(mCurrentDrawOperation, vertexCount);
-		}
 		else
 		{
 			auto execute = [=]() { executeRef(vertexOffset, vertexCount, instanceCount); };
 
 			SPtr<GLCommandBuffer> cb = std::static_pointer_cast<GLCommandBuffer>(commandBuffer);
 			cb->queueCommand(execute);
-
-			primCount = vertexCountToPrimCount(cb->mCurrentDrawOperation, vertexCount);
 		}
-
-		BS_INC_RENDER_STAT(NumDrawCalls);
-		BS_ADD_RENDER_STAT(NumVertices, vertexCount);
-		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
 	}
 
 	void GLRenderAPI::drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
@@ -1001,6 +1003,11 @@ namespace bs { namespace ct
 		{
 			THROW_IF_NOT_CORE_THREAD;
 
+			BS_INC_RENDER_STAT(NumDrawCalls);
+			BS_ADD_RENDER_STAT(NumVertices, vertexCount);
+			BS_ADD_RENDER_STAT(NumPrimitives, vertexCountToPrimCount(mCurrentDrawOperation, vertexCount));
+			BS_INC_RENDER_STAT(NumIndexBufferBinds);
+
 			if (mBoundIndexBuffer == nullptr)
 			{
 				LOGWRN("Cannot draw indexed because index buffer is not set.");
@@ -1032,28 +1039,15 @@ namespace bs { namespace ct
 			endDraw();
 		};
 
-		UINT32 primCount;
 		if (commandBuffer == nullptr)
-		{
 			executeRef(startIndex, indexCount, vertexOffset, vertexCount, instanceCount);
-
-			primCount = vertexCountToPrimCount(mCurrentDrawOperation, vertexCount);
-		}
 		else
 		{
 			auto execute = [=]() { executeRef(startIndex, indexCount, vertexOffset, vertexCount, instanceCount); };
 
 			SPtr<GLCommandBuffer> cb = std::static_pointer_cast<GLCommandBuffer>(commandBuffer);
 			cb->queueCommand(execute);
-
-			primCount = vertexCountToPrimCount(cb->mCurrentDrawOperation, vertexCount);
 		}
-
-		BS_INC_RENDER_STAT(NumDrawCalls);
-		BS_ADD_RENDER_STAT(NumVertices, vertexCount);
-		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
-
-		BS_INC_RENDER_STAT(NumIndexBufferBinds);
 	}
 
 	void GLRenderAPI::dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ, 
@@ -1063,13 +1057,15 @@ namespace bs { namespace ct
 		{
 			THROW_IF_NOT_CORE_THREAD;
 
+			BS_INC_RENDER_STAT(NumComputeCalls);
+
 			if (mCurrentComputeProgram == nullptr)
 			{
 				LOGWRN("Cannot dispatch compute without a set compute program.");
 				return;
 			}
 
-			glUseProgram(mCurrentComputeProgram->getGLHandle());
+			mStateCache.useProgram(mCurrentComputeProgram->getGLHandle());
 			glDispatchCompute(numGroupsX, numGroupsY, numGroupsZ);
 		};
 
@@ -1082,8 +1078,6 @@ namespace bs { namespace ct
 			SPtr<GLCommandBuffer> cb = std::static_pointer_cast<GLCommandBuffer>(commandBuffer);
 			cb->queueCommand(execute);
 		}
-
-		BS_INC_RENDER_STAT(NumComputeCalls);
 	}
 
 	void GLRenderAPI::setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom, 
@@ -1194,7 +1188,7 @@ namespace bs { namespace ct
 		|| !mColorWrite[2] || !mColorWrite[3]; 
 
 		// Disable scissor test as we want to clear the entire render surface
-		GLboolean scissorTestEnabled = glIsEnabled(GL_SCISSOR_TEST);
+		bool scissorTestEnabled = mStateCache.isEnabled(GL_SCISSOR_TEST);
 		UINT32 oldScissorTop = mScissorTop;
 		UINT32 oldScissorBottom = mScissorBottom;
 		UINT32 oldScissorLeft = mScissorLeft;
@@ -1202,7 +1196,7 @@ namespace bs { namespace ct
 
 		if (scissorTestEnabled)
 		{
-			glDisable(GL_SCISSOR_TEST);
+			mStateCache.setEnabled(GL_SCISSOR_TEST, false);
 		}
 
 		const RenderTargetProperties& rtProps = mActiveRenderTarget->getProperties();
@@ -1220,18 +1214,18 @@ namespace bs { namespace ct
 		{
 			// Enable buffer for writing if it isn't
 			if (colorMask)
-				glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+				mStateCache.setColorMask(true, true, true, true);
 		}
 		if (buffers & FBT_DEPTH)
 		{
 			// Enable buffer for writing if it isn't
 			if (!mDepthWrite)
-				glDepthMask(GL_TRUE);
+				mStateCache.setDepthMask(true);
 		}
 		if (buffers & FBT_STENCIL)
 		{
 			// Enable buffer for writing if it isn't
-			glStencilMask(0xFFFFFFFF);
+			mStateCache.setStencilMask(0xFFFFFFFF);
 		}
 
 		if (targetMask == 0xFF)
@@ -1301,7 +1295,7 @@ namespace bs { namespace ct
 		// Restore scissor test
 		if (scissorTestEnabled)
 		{
-			glEnable(GL_SCISSOR_TEST);
+			mStateCache.setEnabled(GL_SCISSOR_TEST, true);
 
 			mScissorTop = oldScissorTop;
 			mScissorBottom = oldScissorBottom;
@@ -1312,15 +1306,15 @@ namespace bs { namespace ct
 		// Reset buffer write state
 		if (!mDepthWrite && (buffers & FBT_DEPTH))
 		{
-			glDepthMask(GL_FALSE);
+			mStateCache.setDepthMask(false);
 		}
 		if (colorMask && (buffers & FBT_COLOR))
 		{
-			glColorMask(mColorWrite[0], mColorWrite[1], mColorWrite[2], mColorWrite[3]);
+			mStateCache.setColorMask(mColorWrite[0], mColorWrite[1], mColorWrite[2], mColorWrite[3]);
 		}
 		if (buffers & FBT_STENCIL)
 		{
-			glStencilMask(mStencilWriteMask);
+			mStateCache.setStencilMask(mStencilWriteMask);
 		}
 
 		BS_INC_RENDER_STAT(NumClears);
@@ -1354,12 +1348,12 @@ namespace bs { namespace ct
 		GLint destBlend = getBlendMode(destFactor);
 		if(sourceFactor == BF_ONE && destFactor == BF_ZERO)
 		{
-			glDisable(GL_BLEND);
+			mStateCache.setEnabled(GL_BLEND, false);
 		}
 		else
 		{
-			glEnable(GL_BLEND);
-			glBlendFunc(sourceBlend, destBlend);
+			mStateCache.setEnabled(GL_BLEND, true);
+			mStateCache.setBlendFunc(sourceBlend, destBlend, sourceBlend, destBlend);
 		}
 
 		GLint func = GL_FUNC_ADD;
@@ -1384,7 +1378,7 @@ namespace bs { namespace ct
 
 		if(GLEW_VERSION_1_4 || GLEW_ARB_imaging)
 		{
-			glBlendEquation(func);
+			mStateCache.setBlendEquation(func, func);
 		}
 		else if(GLEW_EXT_blend_minmax && (func == GL_MIN || func == GL_MAX))
 		{
@@ -1404,12 +1398,12 @@ namespace bs { namespace ct
 		if(sourceFactor == BF_ONE && destFactor == BF_ZERO && 
 			sourceFactorAlpha == BF_ONE && destFactorAlpha == BF_ZERO)
 		{
-			glDisable(GL_BLEND);
+			mStateCache.setEnabled(GL_BLEND, false);
 		}
 		else
 		{
-			glEnable(GL_BLEND);
-			glBlendFuncSeparate(sourceBlend, destBlend, sourceBlendAlpha, destBlendAlpha);
+			mStateCache.setEnabled(GL_BLEND, true);
+			mStateCache.setBlendFunc(sourceBlend, destBlend, sourceBlendAlpha, destBlendAlpha);
 		}
 
 		GLint func = GL_FUNC_ADD, alphaFunc = GL_FUNC_ADD;
@@ -1453,7 +1447,7 @@ namespace bs { namespace ct
 		}
 
 		if(GLEW_VERSION_2_0) {
-			glBlendEquationSeparate(func, alphaFunc);
+			mStateCache.setBlendEquation(func, alphaFunc);
 		}
 		else if(GLEW_EXT_blend_equation_separate) {
 			glBlendEquationSeparateEXT(func, alphaFunc);
@@ -1475,17 +1469,7 @@ namespace bs { namespace ct
 
 	void GLRenderAPI::setAlphaToCoverage(bool enable)
 	{
-		static bool lasta2c = false;
-
-		if (enable != lasta2c)
-		{
-			if (enable)
-				glEnable(GL_SAMPLE_ALPHA_TO_COVERAGE);
-			else
-				glDisable(GL_SAMPLE_ALPHA_TO_COVERAGE);
-
-			lasta2c = enable;
-		}
+		mStateCache.setEnabled(GL_SAMPLE_ALPHA_TO_COVERAGE, enable);
 	}
 
 	void GLRenderAPI::setScissorTestEnable(bool enable)
@@ -1504,7 +1488,7 @@ namespace bs { namespace ct
 
 		if (enable)
 		{
-			glEnable(GL_SCISSOR_TEST);
+			mStateCache.setEnabled(GL_SCISSOR_TEST, true);
 			// GL uses width / height rather than right / bottom
 			x = mScissorLeft;
 
@@ -1516,11 +1500,11 @@ namespace bs { namespace ct
 			w = mScissorRight - mScissorLeft;
 			h = mScissorBottom - mScissorTop;
 
-			glScissor(x, y, w, h);
+			mStateCache.setScissor(x, y, w, h);
 		}
 		else
 		{
-			glDisable(GL_SCISSOR_TEST);
+			mStateCache.setEnabled(GL_SCISSOR_TEST, false);
 
 			// GL requires you to reset the scissor when disabling
 			w = mViewportWidth;
@@ -1528,7 +1512,7 @@ namespace bs { namespace ct
 			x = mViewportLeft;
 			y = mViewportTop; 
 
-			glScissor(x, y, w, h);
+			mStateCache.setScissor(x, y, w, h);
 		}
 
 		mScissorEnabled = enable;
@@ -1536,26 +1520,17 @@ namespace bs { namespace ct
 
 	void GLRenderAPI::setMultisamplingEnable(bool enable)
 	{
-		if (enable)
-			glEnable(GL_MULTISAMPLE);
-		else
-			glDisable(GL_MULTISAMPLE);
+		mStateCache.setEnabled(GL_MULTISAMPLE, enable);
 	}
 
 	void GLRenderAPI::setDepthClipEnable(bool enable)
 	{
-		if (enable)
-			glEnable(GL_DEPTH_CLAMP);
-		else
-			glDisable(GL_DEPTH_CLAMP);
+		mStateCache.setEnabled(GL_DEPTH_CLAMP, enable);
 	}
 
 	void GLRenderAPI::setAntialiasedLineEnable(bool enable)
 	{
-		if (enable)
-			glEnable(GL_LINE_SMOOTH);
-		else
-			glDisable(GL_LINE_SMOOTH);
+		mStateCache.setEnabled(GL_LINE_SMOOTH, enable);
 	}
 
 
@@ -1566,7 +1541,7 @@ namespace bs { namespace ct
 		switch( mode )
 		{
 		case CULL_NONE:
-			glDisable(GL_CULL_FACE);
+			mStateCache.setEnabled(GL_CULL_FACE, false);
 			return;
 		default:
 		case CULL_CLOCKWISE:
@@ -1577,8 +1552,8 @@ namespace bs { namespace ct
 			break;
 		}
 
-		glEnable(GL_CULL_FACE);
-		glCullFace(cullMode);
+		mStateCache.setEnabled(GL_CULL_FACE, true);
+		mStateCache.setCullFace(cullMode);
 	}
 
 	void GLRenderAPI::setDepthBufferCheckEnabled(bool enabled)
@@ -1586,49 +1561,48 @@ namespace bs { namespace ct
 		if (enabled)
 		{
 			glClearDepth(1.0f);
-			glEnable(GL_DEPTH_TEST);
+			mStateCache.setEnabled(GL_DEPTH_TEST, true);
 		}
 		else
 		{
-			glDisable(GL_DEPTH_TEST);
+			mStateCache.setEnabled(GL_DEPTH_TEST, false);
 		}
 	}
 
 	void GLRenderAPI::setDepthBufferWriteEnabled(bool enabled)
 	{
-		GLboolean flag = enabled ? GL_TRUE : GL_FALSE;
-		glDepthMask(flag);  
+		mStateCache.setDepthMask(enabled);
 
 		mDepthWrite = enabled;
 	}
 
 	void GLRenderAPI::setDepthBufferFunction(CompareFunction func)
 	{
-		glDepthFunc(convertCompareFunction(func));
+		mStateCache.setDepthFunc(convertCompareFunction(func));
 	}
 
 	void GLRenderAPI::setDepthBias(float constantBias, float slopeScaleBias)
 	{
 		if (constantBias != 0 || slopeScaleBias != 0)
 		{
-			glEnable(GL_POLYGON_OFFSET_FILL);
-			glEnable(GL_POLYGON_OFFSET_POINT);
-			glEnable(GL_POLYGON_OFFSET_LINE);
+			mStateCache.setEnabled(GL_POLYGON_OFFSET_FILL, true);
+			mStateCache.setEnabled(GL_POLYGON_OFFSET_POINT, true);
+			mStateCache.setEnabled(GL_POLYGON_OFFSET_LINE, true);
 
 			float scaledConstantBias = -constantBias * float((1 << 24) - 1); // Note: Assumes 24-bit depth buffer
-			glPolygonOffset(slopeScaleBias, scaledConstantBias);
+			mStateCache.setPolygonOffset(slopeScaleBias, scaledConstantBias);
 		}
 		else
 		{
-			glDisable(GL_POLYGON_OFFSET_FILL);
-			glDisable(GL_POLYGON_OFFSET_POINT);
-			glDisable(GL_POLYGON_OFFSET_LINE);
+			mStateCache.setEnabled(GL_POLYGON_OFFSET_FILL, false);
+			mStateCache.setEnabled(GL_POLYGON_OFFSET_POINT, false);
+			mStateCache.setEnabled(GL_POLYGON_OFFSET_LINE, false);
 		}
 	}
 
 	void GLRenderAPI::setColorBufferWriteEnabled(bool red, bool green, bool blue, bool alpha)
 	{
-		glColorMask(red, green, blue, alpha);
+		mStateCache.setColorMask(red, green, blue, alpha);
 		// record this
 		mColorWrite[0] = red;
 		mColorWrite[1] = blue;
@@ -1649,15 +1623,12 @@ namespace bs { namespace ct
 			glmode = GL_FILL;
 			break;
 		}
-		glPolygonMode(GL_FRONT_AND_BACK, glmode);
+		mStateCache.setPolygonMode(glmode);
 	}
 
 	void GLRenderAPI::setStencilCheckEnabled(bool enabled)
 	{
-		if (enabled)
-			glEnable(GL_STENCIL_TEST);
-		else
-			glDisable(GL_STENCIL_TEST);
+		mStateCache.setEnabled(GL_STENCIL_TEST, enabled);
 	}
 
 	void GLRenderAPI::setStencilBufferOperations(StencilOperation stencilFailOp,
@@ -1665,14 +1636,14 @@ namespace bs { namespace ct
 	{
 		if (front)
 		{
-			glStencilOpSeparate(GL_FRONT, 
+			mStateCache.setStencilOp(GL_FRONT, 
 				convertStencilOp(stencilFailOp),
 				convertStencilOp(depthFailOp), 
 				convertStencilOp(passOp));
 		}
 		else
 		{
-			glStencilOpSeparate(GL_BACK, 
+			mStateCache.setStencilOp(GL_BACK, 
 				convertStencilOp(stencilFailOp, true), 
 				convertStencilOp(depthFailOp, true), 
 				convertStencilOp(passOp, true));
@@ -1686,19 +1657,21 @@ namespace bs { namespace ct
 		if(front)
 		{
 			mStencilCompareFront = func;
-			glStencilFuncSeparate(GL_FRONT, convertCompareFunction(mStencilCompareFront), mStencilRefValue, mStencilReadMask);
+			mStateCache.setStencilFunc(GL_FRONT, convertCompareFunction(mStencilCompareFront), mStencilRefValue,
+				mStencilReadMask);
 		}
 		else
 		{
 			mStencilCompareBack = func;
-			glStencilFuncSeparate(GL_BACK, convertCompareFunction(mStencilCompareBack), mStencilRefValue, mStencilReadMask);
+			mStateCache.setStencilFunc(GL_BACK, convertCompareFunction(mStencilCompareBack), mStencilRefValue,
+				mStencilReadMask);
 		}
 	}
 
 	void GLRenderAPI::setStencilBufferWriteMask(UINT32 mask)
 	{
 		mStencilWriteMask = mask;
-		glStencilMask(mask);
+		mStateCache.setStencilMask(mask);
 	}
 
 	void GLRenderAPI::setStencilRefValue(UINT32 refValue)
@@ -1707,8 +1680,10 @@ namespace bs { namespace ct
 
 		mStencilRefValue = refValue;
 
-		glStencilFuncSeparate(GL_FRONT, convertCompareFunction(mStencilCompareFront), mStencilRefValue, mStencilReadMask);
-		glStencilFuncSeparate(GL_BACK, convertCompareFunction(mStencilCompareBack), mStencilRefValue, mStencilReadMask);
+		mStateCache.setStencilFunc(GL_FRONT, convertCompareFunction(mStencilCompareFront), mStencilRefValue,
+			mStencilReadMask);
+		mStateCache.setStencilFunc(GL_BACK, convertCompareFunction(mStencilCompareBack), mStencilRefValue,
+			mStencilReadMask);
 	}
 
 	void GLRenderAPI::setTextureFiltering(UINT16 unit, FilterType ftype, FilterOptions fo)
@@ -1819,16 +1794,12 @@ namespace bs { namespace ct
 		const GLSLProgramPipeline* pipeline = mProgramPipelineManager->getPipeline(mCurrentVertexProgram.get(), 
 			mCurrentFragmentProgram.get(), mCurrentGeometryProgram.get(), mCurrentHullProgram.get(), mCurrentDomainProgram.get());
 
-		glUseProgram(0);
-		if(mActivePipeline != pipeline)
-		{
-			glBindProgramPipeline(pipeline->glHandle);
-			mActivePipeline = pipeline;
-		}
+		mStateCache.useProgram(0);
+		mStateCache.bindProgramPipeline(pipeline->glHandle);
 
 		const GLVertexArrayObject& vao = GLVertexArrayObjectManager::instance().getVAO(mCurrentVertexProgram, 
 			mBoundVertexDeclaration, mBoundVertexBuffers);
-		glBindVertexArray(vao.getGLHandle()); 
+		mStateCache.bindVertexArray(vao.getGLHandle());
 
 		BS_INC_RENDER_STAT(NumVertexBufferBinds);
 	}
@@ -2108,12 +2079,15 @@ namespace bs { namespace ct
 		mCurrentContext = context;
 		mCurrentContext->setCurrent();
 
+		// State of the new context is unknown
+		mStateCache.invalidate();
+
 		// Must reset depth/colour write mask to according with user desired, otherwise,
 		// clearFrameBuffer would be wrong because the value we are recorded may be
 		// difference with the really state stored in GL context.
-		glDepthMask(mDepthWrite);
-		glColorMask(mColorWrite[0], mColorWrite[1], mColorWrite[2], mColorWrite[3]);
-		glStencilMask(mStencilWriteMask);
+		mStateCache.setDepthMask(mDepthWrite);
+		mStateCache.setColorMask(mColorWrite[0], mColorWrite[1], mColorWrite[2], mColorWrite[3]);
+		mStateCache.setStencilMask(mStencilWriteMask);
 	}
 
 	void GLRenderAPI::initCapabilities(RenderAPICapabilities& caps) const
@@ -2291,13 +2265,13 @@ namespace bs { namespace ct
 			mViewportTop = rtProps.getHeight() - (mViewportTop + mViewportHeight);
 		}
 
-		glViewport(mViewportLeft, mViewportTop, mViewportWidth, mViewportHeight);
+		mStateCache.setViewport(mViewportLeft, mViewportTop, mViewportWidth, mViewportHeight);
 
 		// Configure the viewport clipping
 		if (!mScissorEnabled)
 		{
-			glEnable(GL_SCISSOR_TEST);
-			glScissor(mViewportLeft, mViewportTop, mViewportWidth, mViewportHeight);
+			mStateCache.setEnabled(GL_SCISSOR_TEST, true);
+			mStateCache.setScissor(mViewportLeft, mViewportTop, mViewportWidth, mViewportHeight);
 		}
 	}
 
@@ -0,0 +1,463 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsGLStateCache.h"
+#include "BsGLSLGpuProgram.h"
+#include "BsRenderStats.h"
+
+namespace bs { namespace ct
+{
+	/** Capabilities whose state is tracked by the cache. */
+	static const GLenum TRACKED_CAPS[] =
+	{
+		GL_BLEND, GL_SAMPLE_ALPHA_TO_COVERAGE, GL_SCISSOR_TEST, GL_MULTISAMPLE, GL_DEPTH_CLAMP, GL_LINE_SMOOTH,
+		GL_CULL_FACE, GL_DEPTH_TEST, GL_STENCIL_TEST, GL_POLYGON_OFFSET_FILL, GL_POLYGON_OFFSET_LINE,
+		GL_POLYGON_OFFSET_POINT, GL_FRAMEBUFFER_SRGB
+	};
+
+	GLStateCache::GLStateCache()
+	{
+		static_assert(sizeof(TRACKED_CAPS) / sizeof(TRACKED_CAPS[0]) <= NUM_CAPS, "Too many tracked capabilities.");
+
+		invalidate();
+	}
+
+	void GLStateCache::invalidate()
+	{
+		for (UINT32 i = 0; i < NUM_CAPS; i++)
+			mCaps[i] = -1;
+
+		for (UINT32 i = 0; i < 4; i++)
+			mBlendFunc[i] = UNKNOWN;
+
+		mBlendEquation[0] = mBlendEquation[1] = UNKNOWN;
+		mColorMask = UNKNOWN;
+		mDepthMask = UNKNOWN;
+		mDepthFunc = UNKNOWN;
+		mPolygonOffset[0] = mPolygonOffset[1] = 0.0f;
+		mPolygonOffsetKnown = false;
+		mPolygonMode = UNKNOWN;
+		mCullFace = UNKNOWN;
+
+		for (UINT32 i = 0; i < 2; i++)
+		{
+			mStencilOp[i][0] = mStencilOp[i][1] = mStencilOp[i][2] = UNKNOWN;
+			mStencilFunc[i] = UNKNOWN;
+			mStencilRef[i] = 0;
+			mStencilReadMask[i] = 0;
+		}
+
+		mStencilWriteMask = (UINT64)-1;
+
+		for (UINT32 i = 0; i < 4; i++)
+		{
+			mViewport[i] = -1;
+			mScissor[i] = -1;
+		}
+
+		mProgram = UNKNOWN;
+		mProgramPipeline = UNKNOWN;
+		mVertexArray = UNKNOWN;
+
+		for (UINT32 i = 0; i < MAX_BUFFER_BINDINGS; i++)
+		{
+			mUniformBuffers[i] = UNKNOWN;
+			mStorageBuffers[i] = UNKNOWN;
+		}
+	}
+
+	void GLStateCache::setEnabled(GLenum cap, bool enabled)
+	{
+		INT32 capIdx = getCapIdx(cap);
+		if (capIdx != -1)
+		{
+			if (mCaps[capIdx] == (INT8)enabled)
+			{
+				notifyFiltered();
+				return;
+			}
+
+			mCaps[capIdx] = (INT8)enabled;
+		}
+
+		if (enabled)
+			glEnable(cap);
+		else
+			glDisable(cap);
+
+		notifyIssued();
+	}
+
+	bool GLStateCache::isEnabled(GLenum cap)
+	{
+		INT32 capIdx = getCapIdx(cap);
+		if (capIdx != -1 && mCaps[capIdx] != -1)
+			return mCaps[capIdx] != 0;
+
+		bool enabled = glIsEnabled(cap) == GL_TRUE;
+		if (capIdx != -1)
+			mCaps[capIdx] = (INT8)enabled;
+
+		return enabled;
+	}
+
+	void GLStateCache::setBlendFunc(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+	{
+		if (mBlendFunc[0] == srcRGB && mBlendFunc[1] == dstRGB && mBlendFunc[2] == srcAlpha && mBlendFunc[3] == dstAlpha)
+		{
+			notifyFiltered();
+			return;
+		}
+
+		mBlendFunc[0] = srcRGB;
+		mBlendFunc[1] = dstRGB;
+		mBlendFunc[2] = srcAlpha;
+		mBlendFunc[3] = dstAlpha;
+
+		glBlendFuncSeparate(srcRGB, dstRGB, srcAlpha, dstAlpha);
+		notifyIssued();
+	}
+
+	void GLStateCache::setBlendEquation(GLenum modeRGB, GLenum modeAlpha)
+	{
+		if (mBlendEquation[0] == modeRGB && mBlendEquation[1] == modeAlpha)
+		{
+			notifyFiltered();
+			return;
+		}
+
+		mBlendEquation[0] = modeRGB;
+		mBlendEquation[1] = modeAlpha;
+
+		glBlendEquationSeparate(modeRGB, modeAlpha);
+		notifyIssued();
+	}
+
+	void GLStateCache::setColorMask(bool red, bool green, bool blue, bool alpha)
+	{
+		GLuint mask = (red ? 0x1 : 0) | (green ? 0x2 : 0) | (blue ? 0x4 : 0) | (alpha ? 0x8 : 0);
+		if (mColorMask == mask)
+		{
+			notifyFiltered();
+			return;
+		}
+
+		mColorMask = mask;
+
+		glColorMask(red, green, blue, alpha);
+		notifyIssued();
+	}
+
+	void GLStateCache::setDepthMask(bool enabled)
+	{
+		if (mDepthMask == (GLuint)enabled)
+		{
+			notifyFiltered();
+			return;
+		}
+
+		mDepthMask = (GLuint)enabled;
+
+		glDepthMask(enabled ? GL_TRUE : GL_FALSE);
+		notifyIssued();
+	}
+
+	void GLStateCache::setDepthFunc(GLenum func)
+	{
+		if (mDepthFunc == func)
+		{
+			notifyFiltered();
+			return;
+		}
+
+		mDepthFunc = func;
+
+		glDepthFunc(func);
+		notifyIssued();
+	}
+
+	void GLStateCache::setPolygonOffset(float factor, float units)
+	{
+		if (mPolygonOffsetKnown && mPolygonOffset[0] == factor && mPolygonOffset[1] == units)
+		{
+			notifyFiltered();
+			return;
+		}
+
+		mPolygonOffset[0] = factor;
+		mPolygonOffset[1] = units;
+		mPolygonOffsetKnown = true;
+
+		glPolygonOffset(factor, units);
+		notifyIssued();
+	}
+
+	void GLStateCache::setPolygonMode(GLenum mode)
+	{
+		if (mPolygonMode == mode)
+		{
+			notifyFiltered();
+			return;
+		}
+
+		mPolygonMode = mode;
+
+		glPolygonMode(GL_FRONT_AND_BACK, mode);
+		notifyIssued();
+	}
+
+	void GLStateCache::setCullFace(GLenum mode)
+	{
+		if (mCullFace == mode)
+		{
+			notifyFiltered();
+			return;
+		}
+
+		mCullFace = mode;
+
+		glCullFace(mode);
+		notifyIssued();
+	}
+
+	void GLStateCache::setStencilOp(GLenum face, GLenum stencilFail, GLenum depthFail, GLenum pass)
+	{
+		GLenum* ops = mStencilOp[face == GL_BACK ? 1 : 0];
+		if (ops[0] == stencilFail && ops[1] == depthFail && ops[2] == pass)
+		{
+			notifyFiltered();
+			return;
+		}
+
+		ops[0] = stencilFail;
+		ops[1] = depthFail;
+		ops[2] = pass;
+
+		glStencilOpSeparate(face, stencilFail, depthFail, pass);
+		notifyIssued();
+	}
+
+	void GLStateCache::setStencilFunc(GLenum face, GLenum func, GLint ref, GLuint mask)
+	{
+		UINT32 faceIdx = face == GL_BACK ? 1 : 0;
+		if (mStencilFunc[faceIdx] == func && mStencilRef[faceIdx] == ref && mStencilReadMask[faceIdx] == mask)
+		{
+			notifyFiltered();
+			return;
+		}
+
+		mStencilFunc[faceIdx] = func;
+		mStencilRef[faceIdx] = ref;
+		mStencilReadMask[faceIdx] = mask;
+
+		glStencilFuncSeparate(face, func, ref, mask);
+		notifyIssued();
+	}
+
+	void GLStateCache::setStencilMask(GLuint mask)
+	{
+		if (mStencilWriteMask == (UINT64)mask)
+		{
+			notifyFiltered();
+			return;
+		}
+
+		mStencilWriteMask = mask;
+
+		glStencilMask(mask);
+		notifyIssued();
+	}
+
+	void GLStateCache::setViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+	{
+		if (mViewport[0] == x && mViewport[1] == y && mViewport[2] == width && mViewport[3] == height)
+		{
+			notifyFiltered();
+			return;
+		}
+
+		mViewport[0] = x;
+		mViewport[1] = y;
+		mViewport[2] = width;
+		mViewport[3] = height;
+
+		glViewport(x, y, width, height);
+		notifyIssued();
+	}
+
+	void GLStateCache::setScissor(GLint x, GLint y, GLsizei width, GLsizei height)
+	{
+		if (mScissor[0] == x && mScissor[1] == y && mScissor[2] == width && mScissor[3] == height)
+		{
+			notifyFiltered();
+			return;
+		}
+
+		mScissor[0] = x;
+		mScissor[1] = y;
+		mScissor[2] = width;
+		mScissor[3] = height;
+
+		glScissor(x, y, width, height);
+		notifyIssued();
+	}
+
+	void GLStateCache::useProgram(GLuint program)
+	{
+		if (mProgram == program)
+		{
+			notifyFiltered();
+			return;
+		}
+
+		mProgram = program;
+
+		glUseProgram(program);
+		notifyIssued();
+	}
+
+	void GLStateCache::bindProgramPipeline(GLuint pipeline)
+	{
+		if (mProgramPipeline == pipeline)
+		{
+			notifyFiltered();
+			return;
+		}
+
+		mProgramPipeline = pipeline;
+
+		glBindProgramPipeline(pipeline);
+		notifyIssued();
+	}
+
+	void GLStateCache::bindVertexArray(GLuint vao)
+	{
+		if (mVertexArray == vao)
+		{
+			notifyFiltered();
+			return;
+		}
+
+		mVertexArray = vao;
+
+		glBindVertexArray(vao);
+		notifyIssued();
+	}
+
+	void GLStateCache::bindBufferBase(GLenum target, GLuint index, GLuint buffer)
+	{
+		GLuint* bindings = nullptr;
+		if (target == GL_UNIFORM_BUFFER)
+			bindings = mUniformBuffers;
+		else if (target == GL_SHADER_STORAGE_BUFFER)
+			bindings = mStorageBuffers;
+
+		if (bindings != nullptr && index < MAX_BUFFER_BINDINGS)
+		{
+			if (bindings[index] == buffer)
+			{
+				notifyFiltered();
+				return;
+			}
+
+			bindings[index] = buffer;
+		}
+
+		glBindBufferBase(target, index, buffer);
+		notifyIssued();
+	}
+
+	void GLStateCache::notifyBufferDestroyed(GLuint buffer)
+	{
+		// Deleting a bound buffer resets its bindings to zero
+		for (UINT32 i = 0; i < MAX_BUFFER_BINDINGS; i++)
+		{
+			if (mUniformBuffers[i] == buffer)
+				mUniformBuffers[i] = 0;
+
+			if (mStorageBuffers[i] == buffer)
+				mStorageBuffers[i] = 0;
+		}
+	}
+
+	void GLStateCache::setProgramUniform(GLSLGpuProgram& program, GLint location, GLint value)
+	{
+		auto iterFind = program.mCachedUniforms.find(location);
+		if (iterFind != program.mCachedUniforms.end() && iterFind->second == value)
+		{
+			notifyFiltered();
+			return;
+		}
+
+		program.mCachedUniforms[location] = value;
+
+		glProgramUniform1i(program.getGLHandle(), location, value);
+		notifyIssued();
+	}
+
+	void GLStateCache::setUniformBlockBinding(GLSLGpuProgram& program, GLuint blockIndex, GLuint binding)
+	{
+		auto iterFind = program.mCachedUniformBlockBindings.find(blockIndex);
+		if (iterFind != program.mCachedUniformBlockBindings.end() && iterFind->second == binding)
+		{
+			notifyFiltered();
+			return;
+		}
+
+		program.mCachedUniformBlockBindings[blockIndex] = binding;
+
+		glUniformBlockBinding(program.getGLHandle(), blockIndex, binding);
+		notifyIssued();
+	}
+
+	void GLStateCache::setStorageBlockBinding(GLSLGpuProgram& program, GLuint blockIndex, GLuint binding)
+	{
+		auto iterFind = program.mCachedStorageBlockBindings.find(blockIndex);
+		if (iterFind != program.mCachedStorageBlockBindings.end() && iterFind->second == binding)
+		{
+			notifyFiltered();
+			return;
+		}
+
+		program.mCachedStorageBlockBindings[blockIndex] = binding;
+
+		glShaderStorageBlockBinding(program.getGLHandle(), blockIndex, binding);
+		notifyIssued();
+	}
+
+	bool GLStateCache::updateUniformData(GLSLGpuProgram& program, const UINT8* data, UINT32 size, UINT32 numUniforms)
+	{
+		Vector<UINT8>& cachedData = program.mCachedUniformData;
+		if (cachedData.size() == size && memcmp(cachedData.data(), data, size) == 0)
+		{
+			notifyFiltered(numUniforms);
+			return false;
+		}
+
+		cachedData.assign(data, data + size);
+		notifyIssued(numUniforms);
+
+		return true;
+	}
+
+	void GLStateCache::notifyIssued(UINT32 count)
+	{
+		BS_ADD_RENDER_STAT(NumStateCalls, count);
+	}
+
+	void GLStateCache::notifyFiltered(UINT32 count)
+	{
+		BS_ADD_RENDER_STAT(NumFilteredStateCalls, count);
+	}
+
+	INT32 GLStateCache::getCapIdx(GLenum cap)
+	{
+		const UINT32 numCaps = sizeof(TRACKED_CAPS) / sizeof(TRACKED_CAPS[0]);
+		for (UINT32 i = 0; i < numCaps; i++)
+		{
+			if (TRACKED_CAPS[i] == cap)
+				return (INT32)i;
+		}
+
+		return -1;
+	}
+}}
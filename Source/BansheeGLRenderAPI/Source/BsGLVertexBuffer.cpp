@@ -45,6 +45,18 @@ namespace bs { namespace ct
 
 	void* GLVertexBuffer::map(UINT32 offset, UINT32 length, GpuLockOptions options, UINT32 deviceIdx, UINT32 queueIdx)
     {
+#if BS_PROFILING_ENABLED
+		if (options == GBL_READ_ONLY || options == GBL_READ_WRITE)
+		{
+			BS_INC_RENDER_STAT_CAT(ResRead, RenderStatObject_VertexBuffer);
+		}
+
+		if (options == GBL_READ_WRITE || options == GBL_WRITE_ONLY || options == GBL_WRITE_ONLY_DISCARD || options == GBL_WRITE_ONLY_NO_OVERWRITE)
+		{
+			BS_ADD_RENDER_STAT_CAT(ResWrite, RenderStatObject_VertexBuffer, length);
+		}
+#endif
+
 		return mBuffer.lock(offset, length, options);
     }
 
@@ -56,12 +68,16 @@ namespace bs { namespace ct
 	void GLVertexBuffer::readData(UINT32 offset, UINT32 length, void* dest, UINT32 deviceIdx, UINT32 queueIdx)
     {
 		mBuffer.readData(offset, length, dest);
+
+		BS_INC_RENDER_STAT_CAT(ResRead, RenderStatObject_VertexBuffer);
     }
 
 	void GLVertexBuffer::writeData(UINT32 offset, UINT32 length,
 		const void* pSource, BufferWriteType writeFlags, UINT32 queueIdx)
     {
 		mBuffer.writeData(offset, length, pSource, writeFlags);
+
+		BS_ADD_RENDER_STAT_CAT(ResWrite, RenderStatObject_VertexBuffer, length);
     }
 
 	void GLVertexBuffer::copyData(HardwareBuffer& srcBuffer, UINT32 srcOffset,
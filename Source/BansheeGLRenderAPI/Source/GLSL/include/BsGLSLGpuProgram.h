@@ -28,6 +28,7 @@ namespace bs { namespace ct
 
 	private:
 		friend class GLSLProgramFactory;
+		friend class GLStateCache;
 
 		GLSLGpuProgram(const GPU_PROGRAM_DESC& desc, GpuDeviceFlags deviceMask);
 
@@ -38,6 +39,12 @@ namespace bs { namespace ct
 		UINT32 mProgramID;
 		GLuint mGLHandle;
 
+		// Program state last set through GLStateCache
+		UnorderedMap<GLint, GLint> mCachedUniforms;
+		UnorderedMap<GLuint, GLuint> mCachedUniformBlockBindings;
+		UnorderedMap<GLuint, GLuint> mCachedStorageBlockBindings;
+		Vector<UINT8> mCachedUniformData;
+
 		static UINT32 mVertexShaderCount;
 		static UINT32 mFragmentShaderCount;
 		static UINT32 mGeometryShaderCount;
@@ -4,6 +4,7 @@ set(BS_BANSHEEUTILITY_INC_THREADING
 	"Include/BsSpinLock.h"
 	"Include/BsThreadPool.h"
 	"Include/BsTaskScheduler.h"
+	"Include/BsLockFreeQueue.h"
 )
 
 set(BS_BANSHEEUTILITY_SRC_THIRDPARTY
@@ -161,6 +162,8 @@ set(BS_BANSHEEUTILITY_SRC_MATH
 	"Source/BsVector4.cpp"
 	"Source/BsBounds.cpp"
 	"Source/BsConvexVolume.cpp"
+	"Source/BsMathBatch.cpp"
+	"Source/BsTriangleBVH.cpp"
 	"Source/BsTorus.cpp"
 	"Source/BsRect3.cpp"
 	"Source/BsRect2.cpp"
@@ -171,17 +174,33 @@ set(BS_BANSHEEUTILITY_SRC_MATH
 )
 
 set(BS_BANSHEEUTILITY_INC_TESTING
+	"Include/BsBinaryDeltaTestSuite.h"
 	"Include/BsFileSystemTestSuite.h"
+	"Include/BsMathTestSuite.h"
+	"Include/BsStringTestSuite.h"
+	"Include/BsTextureAtlasLayoutTestSuite.h"
 	"Include/BsTestSuite.h"
 	"Include/BsTestOutput.h"
 	"Include/BsConsoleTestOutput.h"
+	"Include/BsBenchmarkSuite.h"
+	"Include/BsBenchmarkOutput.h"
+	"Include/BsSerializationBenchmarkSuite.h"
+	"Include/BsUtilityBenchmarkSuite.h"
 )
 
 set(BS_BANSHEEUTILITY_SRC_TESTING
+	"Source/BsBinaryDeltaTestSuite.cpp"
 	"Source/BsFileSystemTestSuite.cpp"
+	"Source/BsMathTestSuite.cpp"
+	"Source/BsStringTestSuite.cpp"
+	"Source/BsTextureAtlasLayoutTestSuite.cpp"
 	"Source/BsTestSuite.cpp"
 	"Source/BsTestOutput.cpp"
 	"Source/BsConsoleTestOutput.cpp"
+	"Source/BsBenchmarkSuite.cpp"
+	"Source/BsBenchmarkOutput.cpp"
+	"Source/BsSerializationBenchmarkSuite.cpp"
+	"Source/BsUtilityBenchmarkSuite.cpp"
 )
 
 set(BS_BANSHEEUTILITY_SRC_SERIALIZATION
@@ -189,6 +208,7 @@ set(BS_BANSHEEUTILITY_SRC_SERIALIZATION
 	"Source/BsFileSerializer.cpp"
 	"Source/BsBinarySerializer.cpp"
 	"Source/BsBinaryDiff.cpp"
+	"Source/BsBinaryDelta.cpp"
 	"Source/BsSerializedObject.cpp"
 	"Source/BsBinaryCloner.cpp"
 )
@@ -210,6 +230,9 @@ set(BS_BANSHEEUTILITY_INC_MATH
 	"Include/BsVector4.h"
 	"Include/BsBounds.h"
 	"Include/BsConvexVolume.h"
+	"Include/BsSIMD.h"
+	"Include/BsMathBatch.h"
+	"Include/BsTriangleBVH.h"
 	"Include/BsTorus.h"
 	"Include/BsLineSegment3.h"
 	"Include/BsRect3.h"
@@ -231,6 +254,7 @@ set(BS_BANSHEEUTILITY_INC_SERIALIZATION
 	"Include/BsFileSerializer.h"
 	"Include/BsMemorySerializer.h"
 	"Include/BsBinaryDiff.h"
+	"Include/BsBinaryDelta.h"
 	"Include/BsSerializedObject.h"
 	"Include/BsBinaryCloner.h"
 )
@@ -0,0 +1,56 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+#include "BsBenchmarkSuite.h"
+
+namespace bs
+{
+	/** @addtogroup Testing
+	 *  @{
+	 */
+
+	/** Abstract interface used for outputting benchmark results. */
+	class BS_UTILITY_EXPORT BenchmarkOutput
+	{
+	public:
+		virtual ~BenchmarkOutput() {}
+
+		/** Triggered when a benchmark finishes executing. */
+		virtual void outputResult(const BenchmarkStats& stats) = 0;
+	};
+
+	/** Outputs benchmark results to stdout, as a human readable table. */
+	class BS_UTILITY_EXPORT ConsoleBenchmarkOutput : public BenchmarkOutput
+	{
+	public:
+		/** @copydoc BenchmarkOutput::outputResult */
+		void outputResult(const BenchmarkStats& stats) final override;
+
+	private:
+		bool mHeaderPrinted = false;
+	};
+
+	/**
+	 * Collects benchmark results and writes them to a JSON file, so they can be compared between runs by external tools.
+	 * Forwards the results to another output as they arrive, if one is provided.
+	 */
+	class BS_UTILITY_EXPORT JSONBenchmarkOutput : public BenchmarkOutput
+	{
+	public:
+		JSONBenchmarkOutput(BenchmarkOutput* forwardTo = nullptr);
+
+		/** @copydoc BenchmarkOutput::outputResult */
+		void outputResult(const BenchmarkStats& stats) final override;
+
+		/** Writes all the results received so far to the file at the provided path. */
+		void save(const Path& path) const;
+
+	private:
+		BenchmarkOutput* mForwardTo;
+		Vector<BenchmarkStats> mResults;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,172 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+
+#if BS_COMPILER == BS_COMPILER_MSVC
+#	include <intrin.h>
+#endif
+
+namespace bs
+{
+	class BenchmarkOutput;
+
+	/** @addtogroup Testing
+	 *  @{
+	 */
+
+	/** Settings that control how are benchmarks in a BenchmarkSuite executed. */
+	struct BENCHMARK_SUITE_DESC
+	{
+		/** Number of repetitions to run and discard before measuring, in order to warm up caches and allocators. */
+		UINT32 numWarmupRepetitions = 3;
+
+		/** Number of measured repetitions. Statistics are calculated over the times of individual repetitions. */
+		UINT32 numRepetitions = 20;
+
+		/**
+		 * Minimum time a single repetition should take, in milliseconds. Operations that are faster than this are
+		 * executed multiple times per repetition, so that the timer resolution doesn't affect the results.
+		 */
+		float minRepetitionTimeMs = 5.0f;
+
+		/** If not empty, only benchmarks whose name contains this string are executed. */
+		String filter;
+	};
+
+	/** Statistical summary of the measurements of a single benchmark. All times are per operation, in nanoseconds. */
+	struct BenchmarkStats
+	{
+		String name; /**< Name of the benchmark. */
+		UINT32 numRepetitions = 0; /**< Number of measured repetitions. */
+		UINT64 numOpsPerRepetition = 0; /**< Number of times the operation was executed in a single repetition. */
+
+		double minNs = 0.0;
+		double maxNs = 0.0;
+		double meanNs = 0.0;
+		double medianNs = 0.0;
+		double stdDevNs = 0.0;
+
+		/** Amount of data processed by a single operation, in bytes. Zero if the benchmark doesn't report throughput. */
+		UINT64 bytesPerOp = 0;
+
+		/** Returns the median throughput in megabytes per second, or zero if the benchmark doesn't report throughput. */
+		double getThroughputMBs() const;
+	};
+
+	/**
+	 * Primary class for micro-benchmarking. Override and register benchmarks in the constructor, then run them using the
+	 * desired method of output. Each registered method should perform a single operation, which the suite then times
+	 * over a number of repetitions.
+	 */
+	class BS_UTILITY_EXPORT BenchmarkSuite
+	{
+	public:
+		typedef void(BenchmarkSuite::*Func)();
+
+	private:
+		/** Contains data about a single benchmark. */
+		struct BenchmarkEntry
+		{
+			BenchmarkEntry(Func benchmark, const String& name, UINT64 bytesPerOp);
+
+			Func benchmark;
+			String name;
+			UINT64 bytesPerOp;
+		};
+
+	public:
+		virtual ~BenchmarkSuite() {}
+
+		/** Runs all the benchmarks in the suite (and sub-suites). Results are reported to the provided output class. */
+		void run(BenchmarkOutput& output, const BENCHMARK_SUITE_DESC& desc = BENCHMARK_SUITE_DESC());
+
+		/** Adds a new child suite to this suite. This method allows you to group suites and execute them all at once. */
+		void add(const SPtr<BenchmarkSuite>& suite);
+
+		/**
+		 * Runs the provided suite with settings parsed from the command line, and outputs the results to the console.
+		 * Meant to be called from the main() function of benchmark executables. Supports the following options:
+		 *  --filter <text>		Only runs benchmarks whose name contains the provided text.
+		 *  --repetitions <n>	Number of measured repetitions per benchmark.
+		 *  --json <path>		Also writes the results to a JSON file at the provided path.
+		 *
+		 * @param[in]	suite	Suite to run.
+		 * @param[in]	argc	Number of command line arguments, as provided to main().
+		 * @param[in]	argv	Command line arguments, as provided to main().
+		 * @return				Exit code for the process. Non-zero if the command line was invalid.
+		 */
+		static int runFromCommandLine(const SPtr<BenchmarkSuite>& suite, int argc, char* argv[]);
+
+		/**	Creates a new suite of a particular type. */
+		template <class T>
+		static SPtr<BenchmarkSuite> create()
+		{
+			static_assert((std::is_base_of<BenchmarkSuite, T>::value),
+				"Invalid benchmark suite type. It needs to derive from bs::BenchmarkSuite.");
+
+			return std::static_pointer_cast<BenchmarkSuite>(bs_shared_ptr_new<T>());
+		}
+
+	protected:
+		BenchmarkSuite() {}
+
+		/** Called right before any benchmarks are ran. Expensive set up of benchmark data should be done here. */
+		virtual void startUp() {}
+
+		/**	Called after all benchmarks and child suite's benchmarks are ran. */
+		virtual void shutDown() {}
+
+		/**
+		 * Registers a new benchmark.
+		 *
+		 * @param[in]	benchmark	Function that performs a single operation to be measured.
+		 * @param[in]	name		Name of the benchmark, used for filtering and reporting.
+		 * @param[in]	bytesPerOp	Optional amount of data processed by a single operation, in bytes. When provided the
+		 *							results will also report throughput.
+		 */
+		void addBenchmark(Func benchmark, const String& name, UINT64 bytesPerOp = 0);
+
+		/**
+		 * Makes sure the compiler cannot optimize away the computation of the provided value. Should be called on the
+		 * results of the measured operation.
+		 */
+		template<class T>
+		static void doNotOptimize(const T& value)
+		{
+#if BS_COMPILER == BS_COMPILER_MSVC
+			// No inline assembly, so pass the value's address to a function the optimizer can't see into instead
+			escape(&reinterpret_cast<const volatile char&>(value));
+			_ReadWriteBarrier();
+#else
+			// Tells the compiler the value's memory is read by code it can't see, so it must be computed and stored
+			asm volatile("" : : "g"(&value) : "memory");
+#endif
+		}
+
+		Vector<BenchmarkEntry> mBenchmarks;
+		Vector<SPtr<BenchmarkSuite>> mSuites;
+
+	private:
+		/** Executes a single benchmark and calculates statistics from its measurements. */
+		BenchmarkStats measure(const BenchmarkEntry& entry, const BENCHMARK_SUITE_DESC& desc);
+
+		/** Executes the benchmark the specified number of times and returns the elapsed time in nanoseconds. */
+		UINT64 runBatch(Func benchmark, UINT64 numOps);
+
+		/** Does nothing, but is never inlined so the compiler must assume the provided memory is read. */
+		static void escape(const volatile char* data);
+	};
+
+/** Registers a new benchmark within an implementation of BenchmarkSuite. */
+#define BS_ADD_BENCHMARK(func) addBenchmark(static_cast<Func>(&func), #func);
+
+/**
+ * Registers a new benchmark within an implementation of BenchmarkSuite, that processes the specified number of bytes
+ * per operation.
+ */
+#define BS_ADD_BENCHMARK_BYTES(func, bytes) addBenchmark(static_cast<Func>(&func), #func, bytes);
+
+	/** @} */
+}
@@ -0,0 +1,62 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+
+namespace bs
+{
+	/** @addtogroup Internal-Utility
+	 *  @{
+	 */
+
+	/** @addtogroup Serialization-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Encodes a block of bytes as a delta against another, similar block of bytes. The delta consists of ranges copied
+	 * from the base block and literal bytes that don't appear in it. Unlike BinaryDiff it works on raw bytes and doesn't
+	 * need to know anything about the encoded objects, which makes it suitable for storing multiple serialized versions of
+	 * the same object compactly.
+	 */
+	class BS_UTILITY_EXPORT BinaryDelta
+	{
+	public:
+		/**
+		 * Generates a delta that transforms @p base into @p target.
+		 *
+		 * @param[in]	base		Data to encode the delta against.
+		 * @param[in]	baseSize	Size of @p base, in bytes.
+		 * @param[in]	target		Data to encode.
+		 * @param[in]	targetSize	Size of @p target, in bytes.
+		 * @param[out]	deltaSize	Size of the returned delta, in bytes.
+		 * @return					Buffer containing the delta. Caller must free it using bs_free().
+		 */
+		static UINT8* encode(const UINT8* base, UINT32 baseSize, const UINT8* target, UINT32 targetSize,
+			UINT32& deltaSize);
+
+		/**
+		 * Applies a delta generated by encode() to the same base it was encoded against. The target size stored in the
+		 * delta is validated before any memory is allocated, so malformed deltas fail without large allocations.
+		 *
+		 * @param[in]	base			Data the delta was encoded against.
+		 * @param[in]	baseSize		Size of @p base, in bytes.
+		 * @param[in]	delta			Delta returned by encode().
+		 * @param[in]	deltaSize		Size of @p delta, in bytes.
+		 * @param[out]	targetSize		Size of the returned data, in bytes.
+		 * @param[in]	maxTargetSize	Largest target size the caller expects. Deltas describing larger data are rejected.
+		 * @return						Buffer containing the original target data, or null if the delta is malformed.
+		 *								Caller must free it using bs_free().
+		 */
+		static UINT8* decode(const UINT8* base, UINT32 baseSize, const UINT8* delta, UINT32 deltaSize,
+			UINT32& targetSize, UINT32 maxTargetSize = std::numeric_limits<UINT32>::max());
+
+	private:
+		/** Size of the blocks used for finding matching ranges. Shorter matches are stored as literals. */
+		static const UINT32 BLOCK_SIZE = 16;
+	};
+
+	/** @} */
+	/** @} */
+}
@@ -0,0 +1,21 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsTestSuite.h"
+
+namespace bs
+{
+	class BS_UTILITY_EXPORT BinaryDeltaTestSuite : public TestSuite
+	{
+	public:
+		BinaryDeltaTestSuite();
+
+	private:
+		void testIdentical();
+		void testGrown();
+		void testShrunk();
+		void testDifferent();
+		void testMalformed();
+	};
+}
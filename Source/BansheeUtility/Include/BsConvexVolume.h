@@ -44,6 +44,24 @@ namespace bs
 		 */
 		bool intersects(const Sphere& sphere) const;
 
+		/**
+		 * Checks which of the provided boxes intersect the volume. Faster than testing the boxes one by one.
+		 *
+		 * @param[in]	boxes	Boxes to test.
+		 * @param[in]	count	Number of entries in @p boxes.
+		 * @param[out]	output	Array of @p count elements, set to true for each box that intersects the volume.
+		 */
+		void intersects(const AABox* boxes, UINT32 count, bool* output) const;
+
+		/**
+		 * Checks which of the provided spheres intersect the volume. Faster than testing the spheres one by one.
+		 *
+		 * @param[in]	spheres	Spheres to test.
+		 * @param[in]	count	Number of entries in @p spheres.
+		 * @param[out]	output	Array of @p count elements, set to true for each sphere that intersects the volume.
+		 */
+		void intersects(const Sphere* spheres, UINT32 count, bool* output) const;
+
 		/**
 		 * Checks if the convex volume contains the provided point.
 		 * 
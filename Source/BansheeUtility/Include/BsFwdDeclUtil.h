@@ -62,6 +62,7 @@ namespace bs
 	class Rect2I;
 	class Rect2;
 	class Rect3;
+	class TriangleBVH;
 	class Color;
 	class DynLib;
 	class DynLibManager;
@@ -119,6 +120,7 @@ namespace bs
 		TID_UnorderedSet = 66,
 		TID_SerializedDataBlock = 67,
 		TID_Flags = 68,
-		TID_IReflectable = 69
+		TID_IReflectable = 69,
+		TID_BenchmarkObject = 70
 	};
 }
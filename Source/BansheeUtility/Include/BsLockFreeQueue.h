@@ -0,0 +1,88 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+#include <atomic>
+
+namespace bs
+{
+	/** @addtogroup Threading
+	 *  @{
+	 */
+
+	/**
+	 * Fixed size ring buffer that allows a single producer thread to push elements and a single consumer thread to pop
+	 * them, without either thread ever blocking.
+	 *
+	 * @tparam	T			Type of the stored elements. Must be default constructible and copy assignable.
+	 * @tparam	Capacity	Maximum number of elements the queue can hold. Must be a power of two.
+	 *
+	 * @note
+	 * push() may only be called from one thread, and pop() may only be called from one (other) thread. Use a mutex or
+	 * a different container if more threads need to access the queue.
+	 */
+	template<class T, UINT32 Capacity>
+	class TLockFreeQueue
+	{
+		static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Queue capacity must be a power of two.");
+
+	public:
+		TLockFreeQueue()
+			:mHead(0), mTail(0)
+		{ }
+
+		/**
+		 * Pushes a new element to the back of the queue. Returns false if the queue is full, in which case the element
+		 * is not added. Must only be called from the producer thread.
+		 */
+		bool push(const T& value)
+		{
+			UINT32 tail = mTail.load(std::memory_order_relaxed);
+			if ((tail - mHead.load(std::memory_order_acquire)) >= Capacity)
+				return false;
+
+			mElements[tail & (Capacity - 1)] = value;
+			mTail.store(tail + 1, std::memory_order_release);
+
+			return true;
+		}
+
+		/**
+		 * Removes the element from the front of the queue and outputs it in @p value. Returns false if the queue is
+		 * empty. Must only be called from the consumer thread.
+		 */
+		bool pop(T& value)
+		{
+			UINT32 head = mHead.load(std::memory_order_relaxed);
+			if (head == mTail.load(std::memory_order_acquire))
+				return false;
+
+			value = mElements[head & (Capacity - 1)];
+			mHead.store(head + 1, std::memory_order_release);
+
+			return true;
+		}
+
+		/**
+		 * Returns the number of elements currently in the queue. Only an estimate if called while the other thread is
+		 * modifying the queue.
+		 */
+		UINT32 size() const
+		{
+			return mTail.load(std::memory_order_acquire) - mHead.load(std::memory_order_acquire);
+		}
+
+		/** Checks is the queue empty. Only an estimate if called while the other thread is modifying the queue. */
+		bool isEmpty() const { return size() == 0; }
+
+	private:
+		T mElements[Capacity];
+
+		// Kept on separate cache lines so the producer and the consumer don't keep invalidating each other's cache
+		alignas(64) std::atomic<UINT32> mHead;
+		alignas(64) std::atomic<UINT32> mTail;
+	};
+
+	/** @} */
+}
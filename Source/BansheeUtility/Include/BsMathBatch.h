@@ -0,0 +1,57 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+
+namespace bs
+{
+	/** @addtogroup Math
+	 *  @{
+	 */
+
+	/**
+	 * Utility class providing math operations on arrays of objects. Operations are implemented using SIMD instructions
+	 * where available, and produce the same results as calling the equivalent per-object methods.
+	 */
+	class BS_UTILITY_EXPORT MathBatch
+	{
+	public:
+		/**
+		 * Transforms an array of points by an affine matrix. Equivalent to calling Matrix4::multiplyAffine() for each point.
+		 * @p input and @p output may point to the same array.
+		 */
+		static void transformPointsAffine(const Matrix4& matrix, const Vector3* input, Vector3* output, UINT32 count);
+
+		/**
+		 * Multiplies pairs of matrices, such that output[i] = lhs[i] * rhs[i]. @p output may point to the same array as
+		 * either of the inputs.
+		 */
+		static void multiply(const Matrix4* lhs, const Matrix4* rhs, Matrix4* output, UINT32 count);
+
+		/** Multiplies an array of matrices with a single matrix, such that output[i] = lhs * rhs[i]. */
+		static void multiply(const Matrix4& lhs, const Matrix4* rhs, Matrix4* output, UINT32 count);
+
+		/**
+		 * Checks which of the provided spheres intersect the volume formed by the provided planes. A sphere is considered
+		 * intersecting unless it lies fully on the negative side of at least one plane. Equivalent to calling
+		 * ConvexVolume::intersects(const Sphere&) for each sphere.
+		 */
+		static void intersects(const Plane* planes, UINT32 numPlanes, const Sphere* spheres, UINT32 count, bool* output);
+
+		/**
+		 * Checks which of the provided boxes intersect the volume formed by the provided planes. A box is considered
+		 * intersecting unless it lies fully on the negative side of at least one plane. Equivalent to calling
+		 * ConvexVolume::intersects(const AABox&) for each box.
+		 */
+		static void intersects(const Plane* planes, UINT32 numPlanes, const AABox* boxes, UINT32 count, bool* output);
+
+		/** Checks does a single sphere intersect the volume formed by the provided planes. */
+		static bool intersects(const Plane* planes, UINT32 numPlanes, const Sphere& sphere);
+
+		/** Checks does a single box intersect the volume formed by the provided planes. */
+		static bool intersects(const Plane* planes, UINT32 numPlanes, const AABox& box);
+	};
+
+	/** @} */
+}
@@ -0,0 +1,23 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsTestSuite.h"
+
+namespace bs
+{
+	class BS_UTILITY_EXPORT MathTestSuite : public TestSuite
+	{
+	public:
+		MathTestSuite();
+
+	private:
+		void testMatrix4Multiply();
+		void testQuaternionMultiply();
+		void testAABoxTransformAffine();
+		void testTransformPointsAffine();
+		void testIntersectsSpheres();
+		void testIntersectsBoxes();
+		void testTriangleBVH();
+	};
+}
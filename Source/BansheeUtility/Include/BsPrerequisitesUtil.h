@@ -97,6 +97,10 @@
  *  Utility functionality that doesn't fit in any other category.
  */
 
+/** @defgroup Math-Internal Math
+ *  Low level math primitives, like SIMD wrappers.
+ */
+
 /** @defgroup Memory-Internal Memory
  *  Allocators, deallocators and memory manipulation.
  */
@@ -5,6 +5,7 @@
 #include "BsPrerequisitesUtil.h"
 #include "BsMath.h"
 #include "BsVector3.h"
+#include "BsSIMD.h"
 
 namespace bs 
 {
@@ -207,13 +208,22 @@ namespace bs
 
 		Quaternion operator* (const Quaternion& rhs) const
 		{
-			return Quaternion
-			(
-				w * rhs.w - x * rhs.x - y * rhs.y - z * rhs.z,
-				w * rhs.x + x * rhs.w + y * rhs.z - z * rhs.y,
-				w * rhs.y + y * rhs.w + z * rhs.x - x * rhs.z,
-				w * rhs.z + z * rhs.w + x * rhs.y - y * rhs.x
-			);
+			// Components are stored in (x, y, z, w) order. Each component of this quaternion scales a permutation of rhs
+			// components, with signs flipped as required by the Hamilton product.
+			simd::float4 r = simd::load(&rhs.x);
+
+			simd::float4 output = simd::mul(simd::splat(w), r);
+			output = simd::madd(simd::splat(x), 
+				simd::mul(simd::shuffle<3, 2, 1, 0>(r), simd::set(1.0f, -1.0f, 1.0f, -1.0f)), output);
+			output = simd::madd(simd::splat(y), 
+				simd::mul(simd::shuffle<2, 3, 0, 1>(r), simd::set(1.0f, 1.0f, -1.0f, -1.0f)), output);
+			output = simd::madd(simd::splat(z), 
+				simd::mul(simd::shuffle<1, 0, 3, 2>(r), simd::set(-1.0f, 1.0f, 1.0f, -1.0f)), output);
+
+			Quaternion result;
+			simd::store(&result.x, output);
+
+			return result;
 		}
 
 		Quaternion operator* (float rhs) const
@@ -258,15 +268,7 @@ namespace bs
 
 		Quaternion& operator*= (const Quaternion& rhs)
 		{
-			float newW = w * rhs.w - x * rhs.x - y * rhs.y - z * rhs.z;
-			float newX = w * rhs.x + x * rhs.w + y * rhs.z - z * rhs.y;
-			float newY = w * rhs.y + y * rhs.w + z * rhs.x - x * rhs.z;
-			float newZ = w * rhs.z + z * rhs.w + x * rhs.y - y * rhs.x;
-
-			w = newW;
-			x = newX;
-			y = newY;
-			z = newZ;
+			*this = *this * rhs;
 
 			return *this;
 		}
@@ -0,0 +1,229 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPlatformDefines.h"
+
+#include <cmath>
+
+// Pick the instruction set to use. Define BS_DISABLE_SIMD (DISABLE_SIMD CMake option) to force the scalar fallback.
+#if !defined(BS_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#	define BS_SIMD_SSE 1
+#	include <emmintrin.h>
+#elif !defined(BS_DISABLE_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#	define BS_SIMD_NEON 1
+#	include <arm_neon.h>
+#else
+#	define BS_SIMD_SCALAR 1
+#endif
+
+namespace bs
+{
+	/** @addtogroup Math-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Thin wrappers around four-wide SIMD float operations. Maps to SSE2 or NEON intrinsics depending on the target, or to
+	 * plain scalar code if neither is available.
+	 */
+	namespace simd
+	{
+#if BS_SIMD_SSE
+		typedef __m128 float4;
+#elif BS_SIMD_NEON
+		typedef float32x4_t float4;
+#else
+		struct float4 { float v[4]; };
+#endif
+
+		/** Loads four floats from memory. Memory doesn't need to be aligned. */
+		inline float4 load(const float* data)
+		{
+#if BS_SIMD_SSE
+			return _mm_loadu_ps(data);
+#elif BS_SIMD_NEON
+			return vld1q_f32(data);
+#else
+			return { { data[0], data[1], data[2], data[3] } };
+#endif
+		}
+
+		/** Stores four floats to memory. Memory doesn't need to be aligned. */
+		inline void store(float* data, const float4& a)
+		{
+#if BS_SIMD_SSE
+			_mm_storeu_ps(data, a);
+#elif BS_SIMD_NEON
+			vst1q_f32(data, a);
+#else
+			data[0] = a.v[0]; data[1] = a.v[1]; data[2] = a.v[2]; data[3] = a.v[3];
+#endif
+		}
+
+		/** Creates a vector from four values. */
+		inline float4 set(float x, float y, float z, float w)
+		{
+#if BS_SIMD_SSE
+			return _mm_setr_ps(x, y, z, w);
+#else
+			float data[4] = { x, y, z, w };
+			return load(data);
+#endif
+		}
+
+		/** Creates a vector with all four components set to the same value. */
+		inline float4 splat(float value)
+		{
+#if BS_SIMD_SSE
+			return _mm_set1_ps(value);
+#elif BS_SIMD_NEON
+			return vdupq_n_f32(value);
+#else
+			return { { value, value, value, value } };
+#endif
+		}
+
+		/** Returns a vector whose components are selected from the provided vector, using the provided indices. */
+		template<int X, int Y, int Z, int W>
+		inline float4 shuffle(const float4& a)
+		{
+#if BS_SIMD_SSE
+			return _mm_shuffle_ps(a, a, _MM_SHUFFLE(W, Z, Y, X));
+#else
+			float data[4];
+			store(data, a);
+
+			return set(data[X], data[Y], data[Z], data[W]);
+#endif
+		}
+
+		/** Returns a vector with all components set to the component at index @p I in the provided vector. */
+		template<int I>
+		inline float4 splat(const float4& a)
+		{
+			return shuffle<I, I, I, I>(a);
+		}
+
+		/** Adds two vectors, per component. */
+		inline float4 add(const float4& a, const float4& b)
+		{
+#if BS_SIMD_SSE
+			return _mm_add_ps(a, b);
+#elif BS_SIMD_NEON
+			return vaddq_f32(a, b);
+#else
+			return { { a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3] } };
+#endif
+		}
+
+		/** Subtracts two vectors, per component. */
+		inline float4 sub(const float4& a, const float4& b)
+		{
+#if BS_SIMD_SSE
+			return _mm_sub_ps(a, b);
+#elif BS_SIMD_NEON
+			return vsubq_f32(a, b);
+#else
+			return { { a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3] } };
+#endif
+		}
+
+		/** Multiplies two vectors, per component. */
+		inline float4 mul(const float4& a, const float4& b)
+		{
+#if BS_SIMD_SSE
+			return _mm_mul_ps(a, b);
+#elif BS_SIMD_NEON
+			return vmulq_f32(a, b);
+#else
+			return { { a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3] } };
+#endif
+		}
+
+		/**
+		 * Returns a * b + c, per component. Performs a separate multiply and add so results match scalar code exactly.
+		 */
+		inline float4 madd(const float4& a, const float4& b, const float4& c)
+		{
+			return add(mul(a, b), c);
+		}
+
+		/** Returns the smaller of each component of the two vectors. */
+		inline float4 min(const float4& a, const float4& b)
+		{
+#if BS_SIMD_SSE
+			return _mm_min_ps(a, b);
+#elif BS_SIMD_NEON
+			return vminq_f32(a, b);
+#else
+			return { { std::fmin(a.v[0], b.v[0]), std::fmin(a.v[1], b.v[1]), std::fmin(a.v[2], b.v[2]),
+				std::fmin(a.v[3], b.v[3]) } };
+#endif
+		}
+
+		/** Returns the larger of each component of the two vectors. */
+		inline float4 max(const float4& a, const float4& b)
+		{
+#if BS_SIMD_SSE
+			return _mm_max_ps(a, b);
+#elif BS_SIMD_NEON
+			return vmaxq_f32(a, b);
+#else
+			return { { std::fmax(a.v[0], b.v[0]), std::fmax(a.v[1], b.v[1]), std::fmax(a.v[2], b.v[2]),
+				std::fmax(a.v[3], b.v[3]) } };
+#endif
+		}
+
+		/** Returns the absolute value of each component. */
+		inline float4 abs(const float4& a)
+		{
+#if BS_SIMD_SSE
+			return _mm_andnot_ps(_mm_set1_ps(-0.0f), a);
+#elif BS_SIMD_NEON
+			return vabsq_f32(a);
+#else
+			return { { std::fabs(a.v[0]), std::fabs(a.v[1]), std::fabs(a.v[2]), std::fabs(a.v[3]) } };
+#endif
+		}
+
+		/**
+		 * Compares each component of the two vectors and returns a bit mask, where bit N is set if component N of @p a is
+		 * less than component N of @p b.
+		 */
+		inline int lessMask(const float4& a, const float4& b)
+		{
+#if BS_SIMD_SSE
+			return _mm_movemask_ps(_mm_cmplt_ps(a, b));
+#elif BS_SIMD_NEON
+			uint32x4_t cmp = vshrq_n_u32(vcltq_f32(a, b), 31);
+			return (int)(vgetq_lane_u32(cmp, 0) | (vgetq_lane_u32(cmp, 1) << 1) | (vgetq_lane_u32(cmp, 2) << 2) |
+				(vgetq_lane_u32(cmp, 3) << 3));
+#else
+			return (a.v[0] < b.v[0] ? 1 : 0) | (a.v[1] < b.v[1] ? 2 : 0) | (a.v[2] < b.v[2] ? 4 : 0) |
+				(a.v[3] < b.v[3] ? 8 : 0);
+#endif
+		}
+
+		/** Transposes a 4x4 matrix whose rows are stored in the provided vectors. */
+		inline void transpose(float4& row0, float4& row1, float4& row2, float4& row3)
+		{
+#if BS_SIMD_SSE
+			_MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+#else
+			float m[4][4];
+			store(m[0], row0);
+			store(m[1], row1);
+			store(m[2], row2);
+			store(m[3], row3);
+
+			row0 = set(m[0][0], m[1][0], m[2][0], m[3][0]);
+			row1 = set(m[0][1], m[1][1], m[2][1], m[3][1]);
+			row2 = set(m[0][2], m[1][2], m[2][2], m[3][2]);
+			row3 = set(m[0][3], m[1][3], m[2][3], m[3][3]);
+#endif
+		}
+	}
+
+	/** @} */
+}
@@ -0,0 +1,41 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsBenchmarkSuite.h"
+
+namespace bs
+{
+	struct BenchmarkObject;
+
+	/** Measures the performance of object serialization and data compression. */
+	class BS_UTILITY_EXPORT SerializationBenchmarkSuite : public BenchmarkSuite
+	{
+	public:
+		SerializationBenchmarkSuite();
+
+	protected:
+		/** @copydoc BenchmarkSuite::startUp */
+		void startUp() override;
+
+		/** @copydoc BenchmarkSuite::shutDown */
+		void shutDown() override;
+
+	private:
+		void benchBinarySerializerEncode();
+		void benchBinarySerializerDecode();
+		void benchMemorySerializerEncode();
+		void benchMemorySerializerDecode();
+		void benchCompress();
+		void benchDecompress();
+
+		SPtr<BenchmarkObject> mObject;
+		Vector<UINT8> mEncodeBuffer;
+
+		UINT8* mEncodedObject = nullptr;
+		UINT32 mEncodedObjectSize = 0;
+
+		SPtr<DataStream> mUncompressedData;
+		SPtr<DataStream> mCompressedData;
+	};
+}
@@ -147,6 +147,30 @@ namespace bs
 		/** @copydoc match(const String&, const String&, bool) */
         static bool match(const WString& str, const WString& pattern, bool caseSensitive = true);
 
+		/**
+		 * Splits a pattern at every "*" wildcard, so it can be matched against many strings using matchTokens() without
+		 * parsing it every time. The result always contains one token more than there are wildcards in the pattern, and
+		 * tokens can be empty (e.g. for a pattern starting with a wildcard).
+		 *
+		 * @param[in]	pattern		Pattern to split.
+		 */
+		static Vector<String> tokenizePattern(const String& pattern);
+
+		/** @copydoc tokenizePattern(const String&) */
+		static Vector<WString> tokenizePattern(const WString& pattern);
+
+		/**
+		 * Returns true if the string matches a pattern split by tokenizePattern(). The first token must match the start
+		 * of the string, the last token its end, and tokens in between must appear in order. Comparison is case sensitive.
+		 *
+		 * @param[in]	str		The string to test.
+		 * @param[in]	tokens	Pattern tokens returned by tokenizePattern().
+		 */
+		static bool matchTokens(const String& str, const Vector<String>& tokens);
+
+		/** @copydoc matchTokens(const String&, const Vector<String>&) */
+		static bool matchTokens(const WString& str, const Vector<WString>& tokens);
+
 		/**
 		 * Replace all instances of a substring with a another substring.
 		 *
@@ -413,6 +437,65 @@ namespace bs
 				return false;
 		}
 
+		template <class T>
+		static Vector<BasicString<T>> tokenizePatternInternal(const BasicString<T>& pattern)
+		{
+			Vector<BasicString<T>> tokens;
+
+			size_t tokenStart = 0;
+			while (true)
+			{
+				size_t wildcardPos = pattern.find((T)'*', tokenStart);
+				tokens.push_back(pattern.substr(tokenStart, wildcardPos - tokenStart));
+
+				if (wildcardPos == BasicString<T>::npos)
+					break;
+
+				tokenStart = wildcardPos + 1;
+			}
+
+			return tokens;
+		}
+
+		template <class T>
+		static bool matchTokensInternal(const BasicString<T>& str, const Vector<BasicString<T>>& tokens)
+		{
+			if (tokens.empty())
+				return str.empty();
+
+			if (tokens.size() == 1)
+				return str == tokens[0];
+
+			const BasicString<T>& first = tokens.front();
+			const BasicString<T>& last = tokens.back();
+			if (str.size() < first.size() + last.size())
+				return false;
+
+			if (str.compare(0, first.size(), first) != 0)
+				return false;
+
+			size_t end = str.size() - last.size();
+			if (str.compare(end, last.size(), last) != 0)
+				return false;
+
+			// Matching each token at its first occurrence leaves the most room for the tokens that follow
+			size_t pos = first.size();
+			for (size_t i = 1; i < tokens.size() - 1; i++)
+			{
+				const BasicString<T>& token = tokens[i];
+				if (token.empty())
+					continue;
+
+				size_t foundPos = str.find(token, pos);
+				if (foundPos == BasicString<T>::npos || (foundPos + token.size()) > end)
+					return false;
+
+				pos = foundPos + token.size();
+			}
+
+			return true;
+		}
+
 		template <class T>
 		static BasicString<T> replaceAllInternal(const BasicString<T>& source, 
 			const BasicString<T>& replaceWhat, const BasicString<T>& replaceWithWhat)
@@ -11,22 +11,31 @@ namespace bs
 	 *  @{
 	 */
 
-	/** Organizes a set of textures into a single larger texture (an atlas) by minimizing empty space. */
+	/** 
+	 * Organizes a set of textures into a single larger texture (an atlas) by minimizing empty space. 
+	 *
+	 * Free space in the atlas is tracked as a list of rectangles, which get split in two whenever an element is placed
+	 * in them. Elements can also be removed individually, in which case their space is returned to the free list and
+	 * merged with neighboring free space. This allows long-lived atlases to be updated incrementally, instead of being
+	 * re-packed from scratch whenever their contents change. 
+	 */
 	class BS_UTILITY_EXPORT TextureAtlasLayout
 	{
-		/** Represent a single node in the texture atlas binary tree. */
-		class TexAtlasNode
+		/** Rectangular area within the atlas. */
+		struct Area
 		{
-		public:
-			TexAtlasNode();
-			TexAtlasNode(UINT32 x, UINT32 y, UINT32 width, UINT32 height);
-
 			UINT32 x, y, width, height;
-			UINT32 children[2];
-			bool nodeFull;
 		};
 
 	public:
+		/** Information about an element that was relocated by defragment(). */
+		struct MovedElement
+		{
+			UINT32 width, height;
+			UINT32 oldX, oldY;
+			UINT32 newX, newY;
+		};
+
 		TextureAtlasLayout();
 
 		/**
@@ -52,11 +61,37 @@ namespace bs
 		 */
 		bool addElement(UINT32 width, UINT32 height, UINT32& x, UINT32& y);
 
+		/** 
+		 * Removes an element previously added through addElement(). The space used by the element becomes available
+		 * for new elements.
+		 *
+		 * @param[in]	x	Horizontal position of the element, as returned by addElement().
+		 * @param[in]	y	Vertical position of the element, as returned by addElement().
+		 * @return			True if an element was found at the provided position and removed.
+		 *
+		 * @note	Elements with zero width or height are not tracked by the layout, and cannot be removed.
+		 */
+		bool removeElement(UINT32 x, UINT32 y);
+
+		/**
+		 * Re-packs all the elements currently in the layout, from largest to smallest. Should be called occasionally 
+		 * on layouts that have had many elements removed, since free space left behind by removed elements can't
+		 * always be merged back together. If the elements cannot be re-packed the layout is left unchanged.
+		 *
+		 * @param[out]	movedElements	Information about all the elements whose position changed. Contents of the atlas
+		 *								texture need to be moved accordingly.
+		 * @return						True if the layout was re-packed.
+		 */
+		bool defragment(Vector<MovedElement>& movedElements);
+
 		/** Removes all entries from the layout. */
 		void clear();
 
 		/** Checks have any elements been added to the layout. */
-		bool isEmpty() const { return mNodes.size() == 1; }
+		bool isEmpty() const { return mElements.empty(); }
+
+		/** Returns the number of elements in the layout. */
+		UINT32 getNumElements() const { return (UINT32)mElements.size(); }
 
 		/** Returns the width of the atlas texture, in pixels. */
 		UINT32 getWidth() const { return mWidth; }
@@ -65,20 +100,28 @@ namespace bs
 		UINT32 getHeight() const { return mHeight; }
 
 	private:
-		/* 
-		 * Attempts to add a new element to the specified layout node. 
-		 * 
-		 * @param[in]	nodeIdx			Index of the node to which to add the element.
-		 * @param[in]	width			Width of the new element, in pixels.
-		 * @param[in]	height			Height of the new element, in pixels.
-		 * @param[out]	x				Horizontal position of the new element within the atlas. Only valid if method
-		 *								returns true.
-		 * @param[out]	y				Vertical position of the new element within the atlas. Only valid if method returns
-		 *								true.
+		/** 
+		 * Finds the free area best suited for an element of the provided size.
+		 *
+		 * @param[in]	width			Width of the element, in pixels.
+		 * @param[in]	height			Height of the element, in pixels.
 		 * @param[in]	allowGrowth		When true, the width/height of the atlas will be allowed to grow to fit the element.
-		 * @return						True if the element was added to the atlas, false if the element doesn't fit.
+		 *								Areas requiring the least amount of growth are preferred.
+		 * @return						Index of the free area in mFreeAreas, or -1 if the element doesn't fit.
+		 */
+		UINT32 findFreeArea(UINT32 width, UINT32 height, bool allowGrowth) const;
+
+		/** 
+		 * Places an element in the top-left corner of the specified free area, and splits the remaining space of the 
+		 * area in two. 
 		 */
-		bool addToNode(UINT32 nodeIdx, UINT32 width, UINT32 height, UINT32& x, UINT32& y, bool allowGrowth);
+		void placeElement(UINT32 freeAreaIdx, UINT32 width, UINT32 height);
+
+		/** Registers a new free area, merging it with any neighboring free areas it shares an entire edge with. */
+		void addFreeArea(Area area);
+
+		/** Returns the atlas size required for holding an element that ends at the provided position. */
+		void getRequiredSize(UINT32 right, UINT32 bottom, UINT32& width, UINT32& height) const;
 
 		UINT32 mInitialWidth;
 		UINT32 mInitialHeight;
@@ -88,7 +131,8 @@ namespace bs
 		UINT32 mMaxHeight;
 		bool mPow2;
 
-		Vector<TexAtlasNode> mNodes;
+		Vector<Area> mFreeAreas;
+		UnorderedMap<UINT64, Area> mElements; // Keyed by element position
 	};
 
 	/** Utility class used for texture atlas layouts. */
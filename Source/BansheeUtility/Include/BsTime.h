@@ -78,6 +78,15 @@ namespace bs
 		/** Called every frame. Should only be called by Application. */
 		void _update();
 
+		/**
+		 * Makes every following frame advance the time by exactly the provided amount, regardless of how long the frame
+		 * actually took. Used for deterministic playback of recorded sessions. Provide zero to switch back to measuring
+		 * real time. Time keeps advancing from where the fixed time left off.
+		 *
+		 * @param[in]	delta	Frame delta in seconds, or zero to disable.
+		 */
+		void _setFixedFrameDelta(float delta);
+
 		/** @} */
 
 		/** Multiply with time in microseconds to get a time in seconds. */
@@ -89,6 +98,8 @@ namespace bs
 
 		UINT64 mAppStartTime; /**< Time the application started, in microseconds */
 		UINT64 mLastFrameTime; /**< Time since last runOneFrame call, In microseconds */
+		UINT64 mFixedFrameDelta; /**< Fixed frame delta in microseconds, or zero if using real time */
+		INT64 mTimeOffset; /**< Difference between reported and real time accumulated while using a fixed delta, in microseconds */
 		std::atomic<unsigned long> mCurrentFrame;
 
 		Timer* mTimer;
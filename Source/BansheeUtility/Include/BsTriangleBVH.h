@@ -0,0 +1,87 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+#include "BsVector3.h"
+#include "BsAABox.h"
+
+namespace bs
+{
+	/** @addtogroup Math
+	 *  @{
+	 */
+
+	/**
+	 * Bounding volume hierarchy built over a triangle mesh. Allows for fast ray queries against meshes with a large
+	 * number of triangles.
+	 */
+	class BS_UTILITY_EXPORT TriangleBVH
+	{
+		/** Single node in the hierarchy. Leaf nodes reference a range of triangles. */
+		struct Node
+		{
+			AABox bounds;
+
+			/** Index of the first triangle if leaf, or index of the second child otherwise. First child follows the node. */
+			UINT32 offset;
+
+			/** Number of triangles if leaf, or 0 otherwise. */
+			UINT32 numTriangles;
+		};
+
+		/** Triangle data used during hierarchy construction. */
+		struct BuildTriangle
+		{
+			AABox bounds;
+			Vector3 center;
+			UINT32 index;
+		};
+
+	public:
+		TriangleBVH() { }
+
+		/**
+		 * Builds the hierarchy from the provided triangle list.
+		 *
+		 * @param[in]	positions		Vertex positions.
+		 * @param[in]	numVertices		Number of entries in @p positions.
+		 * @param[in]	indices			Vertex indices, three per triangle.
+		 * @param[in]	numIndices		Number of entries in @p indices.
+		 */
+		void build(const Vector3* positions, UINT32 numVertices, const UINT32* indices, UINT32 numIndices);
+
+		/**
+		 * Finds the closest triangle intersected by the provided ray. Both triangle sides are considered.
+		 *
+		 * @param[in]	ray			Ray to test, in the same space as the triangles.
+		 * @param[out]	distance	Distance along the ray to the intersection point.
+		 * @param[out]	normal		Normalized normal of the intersected triangle, facing the side the ray hit.
+		 * @param[out]	triangleIdx	Index of the intersected triangle, in the order the triangles were provided in.
+		 * @return					True if the ray intersected any triangle.
+		 */
+		bool intersects(const Ray& ray, float& distance, Vector3& normal, UINT32& triangleIdx) const;
+
+		/** Returns bounds of all the triangles in the hierarchy. */
+		AABox getBounds() const { return mNodes.empty() ? AABox::BOX_EMPTY : mNodes[0].bounds; }
+
+		/** Returns the number of triangles in the hierarchy. */
+		UINT32 getNumTriangles() const { return (UINT32)mTriangleIndices.size(); }
+
+	private:
+		/** Builds a node for the provided range of triangles, and recursively builds its children. */
+		void buildNode(Vector<BuildTriangle>& triangles, UINT32 start, UINT32 end, UINT32 depth);
+
+		/** Maximum number of triangles in a leaf node. */
+		static const UINT32 MAX_LEAF_TRIANGLES = 4;
+
+		/** Maximum depth of the hierarchy. Nodes at this depth become leaves regardless of triangle count. */
+		static const UINT32 MAX_DEPTH = 32;
+
+		Vector<Node> mNodes;
+		Vector<Vector3> mVertices; // Three per triangle, in leaf order
+		Vector<UINT32> mTriangleIndices; // Maps triangles in leaf order to original triangle indices
+	};
+
+	/** @} */
+}
@@ -26,6 +26,12 @@ namespace bs
 	/**	Generates an MD5 hash string for the provided source string. */
 	String BS_UTILITY_EXPORT md5(const String& source);
 
+	/** 
+	 * Generates an MD5 hash string for all data remaining in the provided stream. Data is read in fixed size chunks, so
+	 * the stream contents never need to be fully loaded in memory.
+	 */
+	String BS_UTILITY_EXPORT md5(const SPtr<DataStream>& stream);
+
 	/** Sets contents of a struct to zero. */
 	template<class T>
 	void bs_zero_out(T& s)
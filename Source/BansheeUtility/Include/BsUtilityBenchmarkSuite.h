@@ -0,0 +1,53 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsBenchmarkSuite.h"
+#include "BsConvexVolume.h"
+#include "BsAABox.h"
+#include "BsSphere.h"
+#include "BsPath.h"
+
+namespace bs
+{
+	/** Measures the performance of commonly used utility functionality: culling, allocators, tasks, paths and strings. */
+	class BS_UTILITY_EXPORT UtilityBenchmarkSuite : public BenchmarkSuite
+	{
+	public:
+		UtilityBenchmarkSuite();
+
+	protected:
+		/** @copydoc BenchmarkSuite::startUp */
+		void startUp() override;
+
+		/** @copydoc BenchmarkSuite::shutDown */
+		void shutDown() override;
+
+	private:
+		void benchConvexVolumeIntersectsBox();
+		void benchConvexVolumeIntersectsSphere();
+		void benchConvexVolumeIntersectsBoxBatch();
+		void benchConvexVolumeIntersectsSphereBatch();
+		void benchFrameAlloc();
+		void benchTaskScheduler();
+		void benchPathParse();
+		void benchPathToString();
+		void benchPathAppend();
+		void benchStringSplit();
+		void benchStringToLowerCase();
+		void benchStringNumberConversion();
+
+		ConvexVolume mFrustum;
+		Vector<AABox> mBoxes;
+		Vector<Sphere> mSpheres;
+		bool* mCullingOutput = nullptr;
+
+		FrameAlloc* mFrameAlloc = nullptr;
+
+		Path mPath;
+		String mPathString;
+		String mText;
+
+		bool mOwnsTaskScheduler = false;
+	};
+}
@@ -5,6 +5,7 @@
 #include "BsPlane.h"
 #include "BsSphere.h"
 #include "BsMath.h"
+#include "BsSIMD.h"
 
 namespace bs
 {
@@ -175,13 +176,28 @@ namespace bs
 		Vector3 centre = getCenter();
 		Vector3 halfSize = getHalfSize();
 
-		Vector3 newCentre = m.multiplyAffine(centre);
-		Vector3 newHalfSize(
-			Math::abs(m[0][0]) * halfSize.x + Math::abs(m[0][1]) * halfSize.y + Math::abs(m[0][2]) * halfSize.z, 
-			Math::abs(m[1][0]) * halfSize.x + Math::abs(m[1][1]) * halfSize.y + Math::abs(m[1][2]) * halfSize.z,
-			Math::abs(m[2][0]) * halfSize.x + Math::abs(m[2][1]) * halfSize.y + Math::abs(m[2][2]) * halfSize.z);
+		// Transform the center by the full matrix, and the extents by the absolute value of the rotation/scale part
+		simd::float4 col0 = simd::load(m[0].ptr());
+		simd::float4 col1 = simd::load(m[1].ptr());
+		simd::float4 col2 = simd::load(m[2].ptr());
+		simd::float4 col3 = simd::load(m[3].ptr());
+		simd::transpose(col0, col1, col2, col3);
 
-		setExtents(newCentre - newHalfSize, newCentre + newHalfSize);
+		simd::float4 newCentre = simd::mul(col0, simd::splat(centre.x));
+		newCentre = simd::madd(col1, simd::splat(centre.y), newCentre);
+		newCentre = simd::madd(col2, simd::splat(centre.z), newCentre);
+		newCentre = simd::add(newCentre, col3);
+
+		simd::float4 newHalfSize = simd::mul(simd::abs(col0), simd::splat(halfSize.x));
+		newHalfSize = simd::madd(simd::abs(col1), simd::splat(halfSize.y), newHalfSize);
+		newHalfSize = simd::madd(simd::abs(col2), simd::splat(halfSize.z), newHalfSize);
+
+		float min[4];
+		float max[4];
+		simd::store(min, simd::sub(newCentre, newHalfSize));
+		simd::store(max, simd::add(newCentre, newHalfSize));
+
+		setExtents(Vector3(min[0], min[1], min[2]), Vector3(max[0], max[1], max[2]));
 	}
 
 	bool AABox::intersects(const AABox& b2) const
@@ -0,0 +1,88 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsBenchmarkOutput.h"
+#include "BsFileSystem.h"
+#include "BsDataStream.h"
+
+#include <iostream>
+
+namespace bs
+{
+	void ConsoleBenchmarkOutput::outputResult(const BenchmarkStats& stats)
+	{
+		if (!mHeaderPrinted)
+		{
+			std::cout << std::left << std::setw(60) << "Benchmark" << std::right
+				<< std::setw(14) << "Median (ns)" << std::setw(14) << "Mean (ns)" << std::setw(14) << "Min (ns)"
+				<< std::setw(14) << "Max (ns)" << std::setw(12) << "Std. dev." << std::setw(14) << "MB/s" << std::endl;
+
+			mHeaderPrinted = true;
+		}
+
+		std::cout << std::left << std::setw(60) << stats.name << std::right << std::fixed << std::setprecision(1)
+			<< std::setw(14) << stats.medianNs << std::setw(14) << stats.meanNs << std::setw(14) << stats.minNs
+			<< std::setw(14) << stats.maxNs << std::setw(12) << stats.stdDevNs;
+
+		if (stats.bytesPerOp > 0)
+			std::cout << std::setw(14) << stats.getThroughputMBs();
+
+		std::cout << std::endl;
+	}
+
+	JSONBenchmarkOutput::JSONBenchmarkOutput(BenchmarkOutput* forwardTo)
+		:mForwardTo(forwardTo)
+	{ }
+
+	void JSONBenchmarkOutput::outputResult(const BenchmarkStats& stats)
+	{
+		mResults.push_back(stats);
+
+		if (mForwardTo != nullptr)
+			mForwardTo->outputResult(stats);
+	}
+
+	void JSONBenchmarkOutput::save(const Path& path) const
+	{
+		// Written by hand as the output is flat, so the utility layer doesn't need to depend on a JSON library
+		StringStream output;
+		output << std::setprecision(10);
+		output << "{\n\t\"benchmarks\": [";
+
+		for (UINT32 i = 0; i < (UINT32)mResults.size(); i++)
+		{
+			const BenchmarkStats& entry = mResults[i];
+
+			String name = StringUtil::replaceAll(entry.name, "\\", "\\\\");
+			name = StringUtil::replaceAll(name, "\"", "\\\"");
+
+			output << (i > 0 ? ",\n" : "\n");
+			output << "\t\t{\n";
+			output << "\t\t\t\"name\": \"" << name << "\",\n";
+			output << "\t\t\t\"repetitions\": " << entry.numRepetitions << ",\n";
+			output << "\t\t\t\"opsPerRepetition\": " << entry.numOpsPerRepetition << ",\n";
+			output << "\t\t\t\"medianNs\": " << entry.medianNs << ",\n";
+			output << "\t\t\t\"meanNs\": " << entry.meanNs << ",\n";
+			output << "\t\t\t\"minNs\": " << entry.minNs << ",\n";
+			output << "\t\t\t\"maxNs\": " << entry.maxNs << ",\n";
+			output << "\t\t\t\"stdDevNs\": " << entry.stdDevNs;
+
+			if (entry.bytesPerOp > 0)
+			{
+				output << ",\n";
+				output << "\t\t\t\"bytesPerOp\": " << entry.bytesPerOp << ",\n";
+				output << "\t\t\t\"throughputMBs\": " << entry.getThroughputMBs();
+			}
+
+			output << "\n\t\t}";
+		}
+
+		output << "\n\t]\n}\n";
+
+		if (FileSystem::exists(path))
+			FileSystem::remove(path);
+
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+		stream->writeString(output.str());
+		stream->close();
+	}
+}
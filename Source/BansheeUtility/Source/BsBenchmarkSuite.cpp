@@ -0,0 +1,165 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsBenchmarkSuite.h"
+#include "BsBenchmarkOutput.h"
+#include "BsMath.h"
+#include "BsMemStack.h"
+
+#include <iostream>
+
+namespace bs
+{
+	double BenchmarkStats::getThroughputMBs() const
+	{
+		if (bytesPerOp == 0 || medianNs <= 0.0)
+			return 0.0;
+
+		return (bytesPerOp / (1024.0 * 1024.0)) / (medianNs * 1e-9);
+	}
+
+	BenchmarkSuite::BenchmarkEntry::BenchmarkEntry(Func benchmark, const String& name, UINT64 bytesPerOp)
+		:benchmark(benchmark), name(name), bytesPerOp(bytesPerOp)
+	{ }
+
+	void BenchmarkSuite::run(BenchmarkOutput& output, const BENCHMARK_SUITE_DESC& desc)
+	{
+		startUp();
+
+		for (auto& entry : mBenchmarks)
+		{
+			if (!desc.filter.empty() && entry.name.find(desc.filter) == String::npos)
+				continue;
+
+			output.outputResult(measure(entry, desc));
+		}
+
+		for (auto& suite : mSuites)
+			suite->run(output, desc);
+
+		shutDown();
+	}
+
+	int BenchmarkSuite::runFromCommandLine(const SPtr<BenchmarkSuite>& suite, int argc, char* argv[])
+	{
+		BENCHMARK_SUITE_DESC desc;
+		Path jsonPath;
+
+		for (int i = 1; i < argc; i++)
+		{
+			String arg = argv[i];
+			if ((i + 1) >= argc)
+			{
+				std::cerr << "Missing value for option: " << arg << std::endl;
+				return 2;
+			}
+
+			String value = argv[++i];
+			if (arg == "--filter")
+				desc.filter = value;
+			else if (arg == "--repetitions")
+				desc.numRepetitions = parseUINT32(value, desc.numRepetitions);
+			else if (arg == "--json")
+				jsonPath = value;
+			else
+			{
+				std::cerr << "Unknown option: " << arg << std::endl;
+				return 2;
+			}
+		}
+
+		MemStack::beginThread();
+
+		ConsoleBenchmarkOutput consoleOutput;
+		JSONBenchmarkOutput jsonOutput(&consoleOutput);
+		suite->run(jsonOutput, desc);
+
+		if (!jsonPath.isEmpty())
+			jsonOutput.save(jsonPath);
+
+		MemStack::endThread();
+		return 0;
+	}
+
+	void BenchmarkSuite::add(const SPtr<BenchmarkSuite>& suite)
+	{
+		mSuites.push_back(suite);
+	}
+
+	void BenchmarkSuite::addBenchmark(Func benchmark, const String& name, UINT64 bytesPerOp)
+	{
+		mBenchmarks.push_back(BenchmarkEntry(benchmark, name, bytesPerOp));
+	}
+
+	BenchmarkStats BenchmarkSuite::measure(const BenchmarkEntry& entry, const BENCHMARK_SUITE_DESC& desc)
+	{
+		static const UINT64 MAX_OPS_PER_REPETITION = 1ULL << 30;
+
+		// Find out how many operations need to be executed so a repetition takes at least the minimum time. This also
+		// serves as the first part of the warmup.
+		UINT64 minRepetitionTimeNs = (UINT64)(desc.minRepetitionTimeMs * 1000000.0);
+		UINT64 numOps = 1;
+		while (numOps < MAX_OPS_PER_REPETITION)
+		{
+			UINT64 elapsedNs = runBatch(entry.benchmark, numOps);
+			if (elapsedNs >= minRepetitionTimeNs)
+				break;
+
+			// Overshoot slightly so the next attempt is likely to be the last, but don't trust estimates from tiny batches
+			UINT64 estimate = elapsedNs > 0 ? (UINT64)(numOps * 1.2 * minRepetitionTimeNs / elapsedNs) : numOps * 10;
+			numOps = Math::clamp(estimate, numOps * 2, numOps * 10);
+		}
+
+		numOps = std::min(numOps, MAX_OPS_PER_REPETITION);
+
+		for (UINT32 i = 0; i < desc.numWarmupRepetitions; i++)
+			runBatch(entry.benchmark, numOps);
+
+		UINT32 numRepetitions = std::max(desc.numRepetitions, 1U);
+
+		Vector<double> times(numRepetitions);
+		for (UINT32 i = 0; i < numRepetitions; i++)
+			times[i] = runBatch(entry.benchmark, numOps) / (double)numOps;
+
+		std::sort(times.begin(), times.end());
+
+		BenchmarkStats stats;
+		stats.name = entry.name;
+		stats.numRepetitions = numRepetitions;
+		stats.numOpsPerRepetition = numOps;
+		stats.bytesPerOp = entry.bytesPerOp;
+		stats.minNs = times.front();
+		stats.maxNs = times.back();
+
+		if ((numRepetitions % 2) == 0)
+			stats.medianNs = (times[numRepetitions / 2 - 1] + times[numRepetitions / 2]) * 0.5;
+		else
+			stats.medianNs = times[numRepetitions / 2];
+
+		double sum = 0.0;
+		for (auto& time : times)
+			sum += time;
+
+		stats.meanNs = sum / numRepetitions;
+
+		double sumSqrDiff = 0.0;
+		for (auto& time : times)
+			sumSqrDiff += (time - stats.meanNs) * (time - stats.meanNs);
+
+		stats.stdDevNs = numRepetitions > 1 ? std::sqrt(sumSqrDiff / (numRepetitions - 1)) : 0.0;
+		return stats;
+	}
+
+	void BenchmarkSuite::escape(const volatile char* data)
+	{ }
+
+	UINT64 BenchmarkSuite::runBatch(Func benchmark, UINT64 numOps)
+	{
+		auto start = std::chrono::high_resolution_clock::now();
+
+		for (UINT64 i = 0; i < numOps; i++)
+			(this->*benchmark)();
+
+		auto end = std::chrono::high_resolution_clock::now();
+		return (UINT64)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+	}
+}
@@ -0,0 +1,206 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsBinaryDelta.h"
+#include "BsDebug.h"
+
+namespace bs
+{
+	/** Multiplier used by the rolling block hash. */
+	static const UINT32 HASH_PRIME = 16777619;
+
+	/** Appends an unsigned integer to the output, using as few bytes as possible. */
+	static void writeVarInt(Vector<UINT8>& output, UINT32 value)
+	{
+		while (value >= 0x80)
+		{
+			output.push_back((UINT8)(value | 0x80));
+			value >>= 7;
+		}
+
+		output.push_back((UINT8)value);
+	}
+
+	/** Reads an integer written by writeVarInt() and advances the data pointer. Returns false if the data is malformed. */
+	static bool readVarInt(const UINT8*& data, const UINT8* end, UINT32& value)
+	{
+		value = 0;
+		for (UINT32 shift = 0; shift < 32; shift += 7)
+		{
+			if (data >= end)
+				return false;
+
+			UINT8 byte = *data++;
+			value |= (UINT32)(byte & 0x7F) << shift;
+
+			if ((byte & 0x80) == 0)
+				return true;
+		}
+
+		return false;
+	}
+
+	/** Calculates a hash of a single block. Matches the rolling hash calculated in BinaryDelta::encode(). */
+	static UINT32 hashBlock(const UINT8* data, UINT32 size)
+	{
+		UINT32 hash = 0;
+		for (UINT32 i = 0; i < size; i++)
+			hash = hash * HASH_PRIME + data[i];
+
+		return hash;
+	}
+
+	UINT8* BinaryDelta::encode(const UINT8* base, UINT32 baseSize, const UINT8* target, UINT32 targetSize,
+		UINT32& deltaSize)
+	{
+		// Index the base data block by block. Matches can start anywhere in the target, but only at block boundaries in
+		// the base, which keeps the index small.
+		UINT32 numBlocks = baseSize / BLOCK_SIZE;
+
+		UnorderedMap<UINT32, UINT32> blocks;
+		blocks.reserve(numBlocks);
+
+		for (UINT32 i = 0; i < numBlocks; i++)
+			blocks.insert(std::make_pair(hashBlock(base + i * BLOCK_SIZE, BLOCK_SIZE), i * BLOCK_SIZE));
+
+		// Weight of the first byte in a block hash, so it can be removed when rolling the hash forward
+		UINT32 firstByteWeight = 1;
+		for (UINT32 i = 1; i < BLOCK_SIZE; i++)
+			firstByteWeight *= HASH_PRIME;
+
+		// Delta is a list of commands, each consisting of a literal byte range followed by a range copied from the base
+		Vector<UINT8> output;
+		writeVarInt(output, targetSize);
+
+		UINT32 literalStart = 0;
+		UINT32 pos = 0;
+		UINT32 hash = 0;
+		bool hashValid = false;
+		while ((pos + BLOCK_SIZE) <= targetSize)
+		{
+			if (!hashValid)
+			{
+				hash = hashBlock(target + pos, BLOCK_SIZE);
+				hashValid = true;
+			}
+
+			auto iterFind = blocks.find(hash);
+			if (iterFind != blocks.end() && memcmp(base + iterFind->second, target + pos, BLOCK_SIZE) == 0)
+			{
+				UINT32 copyStart = iterFind->second;
+				UINT32 copyEnd = copyStart + BLOCK_SIZE;
+				UINT32 matchStart = pos;
+				UINT32 matchEnd = pos + BLOCK_SIZE;
+
+				// Grow the match in both directions, as far as the data allows
+				while (copyEnd < baseSize && matchEnd < targetSize && base[copyEnd] == target[matchEnd])
+				{
+					copyEnd++;
+					matchEnd++;
+				}
+
+				while (copyStart > 0 && matchStart > literalStart && base[copyStart - 1] == target[matchStart - 1])
+				{
+					copyStart--;
+					matchStart--;
+				}
+
+				writeVarInt(output, matchStart - literalStart);
+				output.insert(output.end(), target + literalStart, target + matchStart);
+				writeVarInt(output, copyStart);
+				writeVarInt(output, copyEnd - copyStart);
+
+				pos = matchEnd;
+				literalStart = matchEnd;
+				hashValid = false;
+				continue;
+			}
+
+			if ((pos + BLOCK_SIZE) < targetSize)
+				hash = (hash - target[pos] * firstByteWeight) * HASH_PRIME + target[pos + BLOCK_SIZE];
+
+			pos++;
+		}
+
+		if (literalStart < targetSize)
+		{
+			writeVarInt(output, targetSize - literalStart);
+			output.insert(output.end(), target + literalStart, target + targetSize);
+			writeVarInt(output, 0);
+			writeVarInt(output, 0);
+		}
+
+		deltaSize = (UINT32)output.size();
+
+		UINT8* delta = (UINT8*)bs_alloc(deltaSize);
+		memcpy(delta, output.data(), deltaSize);
+
+		return delta;
+	}
+
+	UINT8* BinaryDelta::decode(const UINT8* base, UINT32 baseSize, const UINT8* delta, UINT32 deltaSize,
+		UINT32& targetSize, UINT32 maxTargetSize)
+	{
+		const UINT8* end = delta + deltaSize;
+
+		UINT32 size;
+		if (!readVarInt(delta, end, size))
+		{
+			LOGERR("Unable to decode binary delta. The data is malformed.");
+
+			targetSize = 0;
+			return nullptr;
+		}
+
+		// Each command encodes at least three bytes (literal size, copy offset and copy size), its literal bytes and a
+		// copy of at most the entire base. Anything larger than that can't be produced by the remaining commands.
+		UINT64 remaining = (UINT64)(end - delta);
+		UINT64 maxSize = remaining + (remaining / 3) * baseSize;
+		if (size > maxSize || size > maxTargetSize)
+		{
+			LOGERR("Unable to decode binary delta. Target size is out of range.");
+
+			targetSize = 0;
+			return nullptr;
+		}
+
+		UINT8* output = (UINT8*)bs_alloc(size);
+		UINT32 writePos = 0;
+		while (writePos < size)
+		{
+			UINT32 literalSize;
+			if (!readVarInt(delta, end, literalSize) || literalSize > (UINT32)(end - delta) ||
+				literalSize > (size - writePos))
+				break;
+
+			memcpy(output + writePos, delta, literalSize);
+			delta += literalSize;
+			writePos += literalSize;
+
+			UINT32 copyOffset, copySize;
+			if (!readVarInt(delta, end, copyOffset) || !readVarInt(delta, end, copySize))
+				break;
+
+			if (copyOffset > baseSize || copySize > (baseSize - copyOffset) || copySize > (size - writePos))
+				break;
+
+			// Empty commands only appear at the end
+			if (literalSize == 0 && copySize == 0)
+				break;
+
+			memcpy(output + writePos, base + copyOffset, copySize);
+			writePos += copySize;
+		}
+
+		if (writePos != size)
+		{
+			LOGERR("Unable to decode binary delta. The data is malformed or doesn't match the provided base.");
+
+			bs_free(output);
+			targetSize = 0;
+			return nullptr;
+		}
+
+		targetSize = size;
+		return output;
+	}
+}
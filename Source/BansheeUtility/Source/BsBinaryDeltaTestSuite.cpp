@@ -0,0 +1,205 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsBinaryDeltaTestSuite.h"
+#include "BsBinaryDelta.h"
+
+namespace bs
+{
+	/** Size of the base data used by the tests, in bytes. */
+	static const UINT32 TEST_DATA_SIZE = 4096;
+
+	/** Fills the provided buffer with deterministic pseudo-random bytes, so test failures are reproducible. */
+	Vector<UINT8> generateDeltaTestData(UINT32 size, UINT32 seed)
+	{
+		Vector<UINT8> output(size);
+
+		UINT32 state = seed;
+		for (UINT32 i = 0; i < size; i++)
+		{
+			state = state * 1664525u + 1013904223u;
+			output[i] = (UINT8)(state >> 24);
+		}
+
+		return output;
+	}
+
+	/** 
+	 * Encodes @p target against @p base, decodes it back and checks the result matches @p target. Optionally returns the
+	 * size of the encoded delta.
+	 */
+	bool deltaRoundTrip(const Vector<UINT8>& base, const Vector<UINT8>& target, UINT32* outDeltaSize = nullptr)
+	{
+		UINT32 deltaSize = 0;
+		UINT8* delta = BinaryDelta::encode(base.data(), (UINT32)base.size(), target.data(), (UINT32)target.size(),
+			deltaSize);
+
+		UINT32 decodedSize = 0;
+		UINT8* decoded = BinaryDelta::decode(base.data(), (UINT32)base.size(), delta, deltaSize, decodedSize);
+
+		bool matches = decoded != nullptr && decodedSize == (UINT32)target.size() &&
+			(decodedSize == 0 || memcmp(decoded, target.data(), decodedSize) == 0);
+
+		if (outDeltaSize != nullptr)
+			*outDeltaSize = deltaSize;
+
+		bs_free(delta);
+
+		if (decoded != nullptr)
+			bs_free(decoded);
+
+		return matches;
+	}
+
+	BinaryDeltaTestSuite::BinaryDeltaTestSuite()
+	{
+		BS_ADD_TEST(BinaryDeltaTestSuite::testIdentical);
+		BS_ADD_TEST(BinaryDeltaTestSuite::testGrown);
+		BS_ADD_TEST(BinaryDeltaTestSuite::testShrunk);
+		BS_ADD_TEST(BinaryDeltaTestSuite::testDifferent);
+		BS_ADD_TEST(BinaryDeltaTestSuite::testMalformed);
+	}
+
+	void BinaryDeltaTestSuite::testIdentical()
+	{
+		Vector<UINT8> base = generateDeltaTestData(TEST_DATA_SIZE, 1);
+
+		// Whole buffer should be encoded as a single copy
+		UINT32 deltaSize = 0;
+		BS_TEST_ASSERT(deltaRoundTrip(base, base, &deltaSize));
+		BS_TEST_ASSERT(deltaSize < 16);
+
+		// Both buffers empty
+		Vector<UINT8> empty;
+		BS_TEST_ASSERT(deltaRoundTrip(empty, empty));
+	}
+
+	void BinaryDeltaTestSuite::testGrown()
+	{
+		Vector<UINT8> base = generateDeltaTestData(TEST_DATA_SIZE, 2);
+		Vector<UINT8> extra = generateDeltaTestData(100, 3);
+
+		// Data appended to the end
+		Vector<UINT8> appended = base;
+		appended.insert(appended.end(), extra.begin(), extra.end());
+
+		UINT32 deltaSize = 0;
+		BS_TEST_ASSERT(deltaRoundTrip(base, appended, &deltaSize));
+		BS_TEST_ASSERT(deltaSize < (UINT32)extra.size() + 32);
+
+		// Data inserted in the middle, shifting the rest of the buffer to an offset that isn't block aligned
+		Vector<UINT8> inserted = base;
+		inserted.insert(inserted.begin() + 1001, extra.begin(), extra.end());
+
+		BS_TEST_ASSERT(deltaRoundTrip(base, inserted, &deltaSize));
+		BS_TEST_ASSERT(deltaSize < (UINT32)extra.size() + 32);
+
+		// Growing from nothing
+		Vector<UINT8> empty;
+		BS_TEST_ASSERT(deltaRoundTrip(empty, base));
+	}
+
+	void BinaryDeltaTestSuite::testShrunk()
+	{
+		Vector<UINT8> base = generateDeltaTestData(TEST_DATA_SIZE, 4);
+
+		// Data removed from the end
+		Vector<UINT8> truncated(base.begin(), base.begin() + TEST_DATA_SIZE / 2);
+
+		UINT32 deltaSize = 0;
+		BS_TEST_ASSERT(deltaRoundTrip(base, truncated, &deltaSize));
+		BS_TEST_ASSERT(deltaSize < 16);
+
+		// Data removed from the middle
+		Vector<UINT8> removed = base;
+		removed.erase(removed.begin() + 777, removed.begin() + 1777);
+
+		BS_TEST_ASSERT(deltaRoundTrip(base, removed, &deltaSize));
+		BS_TEST_ASSERT(deltaSize < 32);
+
+		// Shrinking to nothing
+		Vector<UINT8> empty;
+		BS_TEST_ASSERT(deltaRoundTrip(base, empty));
+	}
+
+	void BinaryDeltaTestSuite::testDifferent()
+	{
+		Vector<UINT8> base = generateDeltaTestData(TEST_DATA_SIZE, 5);
+		Vector<UINT8> target = generateDeltaTestData(TEST_DATA_SIZE, 6);
+
+		// Nothing to share, everything must be stored as literals
+		UINT32 deltaSize = 0;
+		BS_TEST_ASSERT(deltaRoundTrip(base, target, &deltaSize));
+		BS_TEST_ASSERT(deltaSize >= TEST_DATA_SIZE);
+
+		// Target smaller than a single block
+		Vector<UINT8> small(base.begin(), base.begin() + 5);
+		BS_TEST_ASSERT(deltaRoundTrip(target, small));
+	}
+
+	void BinaryDeltaTestSuite::testMalformed()
+	{
+		Vector<UINT8> base = generateDeltaTestData(TEST_DATA_SIZE, 7);
+		Vector<UINT8> target = base;
+
+		Vector<UINT8> extra = generateDeltaTestData(200, 8);
+		target.insert(target.begin() + 2000, extra.begin(), extra.end());
+
+		UINT32 deltaSize = 0;
+		UINT8* delta = BinaryDelta::encode(base.data(), (UINT32)base.size(), target.data(), (UINT32)target.size(),
+			deltaSize);
+
+		// Truncated delta
+		UINT32 decodedSize = 1;
+		UINT8* decoded = BinaryDelta::decode(base.data(), (UINT32)base.size(), delta, deltaSize / 2, decodedSize);
+		BS_TEST_ASSERT(decoded == nullptr);
+		BS_TEST_ASSERT(decodedSize == 0);
+
+		// Empty delta
+		decodedSize = 1;
+		decoded = BinaryDelta::decode(base.data(), (UINT32)base.size(), delta, 0, decodedSize);
+		BS_TEST_ASSERT(decoded == nullptr);
+		BS_TEST_ASSERT(decodedSize == 0);
+
+		// Delta applied to a base shorter than the one it was encoded against, so copies point outside of it
+		decodedSize = 1;
+		decoded = BinaryDelta::decode(base.data(), 1000, delta, deltaSize, decodedSize);
+		BS_TEST_ASSERT(decoded == nullptr);
+		BS_TEST_ASSERT(decodedSize == 0);
+
+		// Target larger than the caller expects
+		decodedSize = 1;
+		decoded = BinaryDelta::decode(base.data(), (UINT32)base.size(), delta, deltaSize, decodedSize,
+			(UINT32)target.size() - 1);
+		BS_TEST_ASSERT(decoded == nullptr);
+		BS_TEST_ASSERT(decodedSize == 0);
+
+		decoded = BinaryDelta::decode(base.data(), (UINT32)base.size(), delta, deltaSize, decodedSize,
+			(UINT32)target.size());
+		BS_TEST_ASSERT(decoded != nullptr);
+		BS_TEST_ASSERT(decodedSize == (UINT32)target.size());
+		bs_free(decoded);
+
+		bs_free(delta);
+
+		// Unterminated size
+		UINT8 badSize[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+		decodedSize = 1;
+		decoded = BinaryDelta::decode(base.data(), (UINT32)base.size(), badSize, sizeof(badSize), decodedSize);
+		BS_TEST_ASSERT(decoded == nullptr);
+		BS_TEST_ASSERT(decodedSize == 0);
+
+		// Size larger than the remaining commands could produce, followed by a single empty command
+		UINT8 hugeSize[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0, 0, 0 };
+		decodedSize = 1;
+		decoded = BinaryDelta::decode(base.data(), (UINT32)base.size(), hugeSize, sizeof(hugeSize), decodedSize);
+		BS_TEST_ASSERT(decoded == nullptr);
+		BS_TEST_ASSERT(decodedSize == 0);
+
+		// Literal running past the end of the delta: size 16, literal of 16 bytes with only 2 present
+		UINT8 badLiteral[] = { 16, 16, 1, 2 };
+		decodedSize = 1;
+		decoded = BinaryDelta::decode(base.data(), (UINT32)base.size(), badLiteral, sizeof(badLiteral), decodedSize);
+		BS_TEST_ASSERT(decoded == nullptr);
+		BS_TEST_ASSERT(decodedSize == 0);
+	}
+}
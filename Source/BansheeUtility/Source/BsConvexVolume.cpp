@@ -5,6 +5,7 @@
 #include "BsSphere.h"
 #include "BsPlane.h"
 #include "BsMath.h"
+#include "BsMathBatch.h"
 
 namespace bs
 {
@@ -94,39 +95,22 @@ namespace bs
 
 	bool ConvexVolume::intersects(const AABox& box) const
 	{
-		Vector3 center = box.getCenter();
-		Vector3 extents = box.getHalfSize();
-		Vector3 absExtents(Math::abs(extents.x), Math::abs(extents.y), Math::abs(extents.z));
-
-		for (auto& plane : mPlanes)
-		{
-			float dist = center.dot(plane.normal) - plane.d;
-
-			float effectiveRadius = absExtents.x * Math::abs(plane.normal.x);
-			effectiveRadius += absExtents.y * Math::abs(plane.normal.y);
-			effectiveRadius += absExtents.z * Math::abs(plane.normal.z);
-
-			if (dist < -effectiveRadius)
-				return false;
-		}
-
-		return true;
+		return MathBatch::intersects(mPlanes.data(), (UINT32)mPlanes.size(), box);
 	}
 
 	bool ConvexVolume::intersects(const Sphere& sphere) const
 	{
-		Vector3 center = sphere.getCenter();
-		float radius = sphere.getRadius();
-
-		for (auto& plane : mPlanes)
-		{
-			float dist = center.dot(plane.normal) - plane.d;
+		return MathBatch::intersects(mPlanes.data(), (UINT32)mPlanes.size(), sphere);
+	}
 
-			if (dist < -radius)
-				return false;
-		}
+	void ConvexVolume::intersects(const AABox* boxes, UINT32 count, bool* output) const
+	{
+		MathBatch::intersects(mPlanes.data(), (UINT32)mPlanes.size(), boxes, count, output);
+	}
 
-		return true;
+	void ConvexVolume::intersects(const Sphere* spheres, UINT32 count, bool* output) const
+	{
+		MathBatch::intersects(mPlanes.data(), (UINT32)mPlanes.size(), spheres, count, output);
 	}
 
 	bool ConvexVolume::contains(const Vector3& p, float expand) const
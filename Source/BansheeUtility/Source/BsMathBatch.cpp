@@ -0,0 +1,240 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsMathBatch.h"
+#include "BsMatrix4.h"
+#include "BsVector3.h"
+#include "BsPlane.h"
+#include "BsSphere.h"
+#include "BsAABox.h"
+#include "BsMath.h"
+#include "BsSIMD.h"
+
+namespace bs
+{
+	static_assert(sizeof(Plane) == sizeof(float) * 4, "Plane is expected to be tightly packed as (normal, d).");
+
+	/** Checks is a volume with the provided center and radius fully on the negative side of the plane. */
+	static bool isOutside(const Plane& plane, const Vector3& center, float radius)
+	{
+		float dist = center.dot(plane.normal) - plane.d;
+		return dist < -radius;
+	}
+
+	/** Returns the radius of the box projected onto the plane normal. */
+	static float getEffectiveRadius(const Plane& plane, const Vector3& absExtents)
+	{
+		float effectiveRadius = absExtents.x * Math::abs(plane.normal.x);
+		effectiveRadius += absExtents.y * Math::abs(plane.normal.y);
+		effectiveRadius += absExtents.z * Math::abs(plane.normal.z);
+
+		return effectiveRadius;
+	}
+
+	/** Loads four planes and transposes them so each vector contains one of the plane components for all planes. */
+	static void loadPlanes(const Plane* planes, simd::float4& nx, simd::float4& ny, simd::float4& nz, simd::float4& d)
+	{
+		nx = simd::load(&planes[0].normal.x);
+		ny = simd::load(&planes[1].normal.x);
+		nz = simd::load(&planes[2].normal.x);
+		d = simd::load(&planes[3].normal.x);
+
+		simd::transpose(nx, ny, nz, d);
+	}
+
+	void MathBatch::transformPointsAffine(const Matrix4& matrix, const Vector3* input, Vector3* output, UINT32 count)
+	{
+		simd::float4 col0 = simd::load(matrix[0].ptr());
+		simd::float4 col1 = simd::load(matrix[1].ptr());
+		simd::float4 col2 = simd::load(matrix[2].ptr());
+		simd::float4 col3 = simd::load(matrix[3].ptr());
+		simd::transpose(col0, col1, col2, col3);
+
+		for (UINT32 i = 0; i < count; i++)
+		{
+			const Vector3& point = input[i];
+
+			simd::float4 result = simd::mul(col0, simd::splat(point.x));
+			result = simd::madd(col1, simd::splat(point.y), result);
+			result = simd::madd(col2, simd::splat(point.z), result);
+			result = simd::add(result, col3);
+
+			float data[4];
+			simd::store(data, result);
+
+			output[i] = Vector3(data[0], data[1], data[2]);
+		}
+	}
+
+	void MathBatch::multiply(const Matrix4* lhs, const Matrix4* rhs, Matrix4* output, UINT32 count)
+	{
+		for (UINT32 i = 0; i < count; i++)
+			output[i] = lhs[i] * rhs[i];
+	}
+
+	void MathBatch::multiply(const Matrix4& lhs, const Matrix4* rhs, Matrix4* output, UINT32 count)
+	{
+		for (UINT32 i = 0; i < count; i++)
+			output[i] = lhs * rhs[i];
+	}
+
+	void MathBatch::intersects(const Plane* planes, UINT32 numPlanes, const Sphere* spheres, UINT32 count, bool* output)
+	{
+		// Test four spheres against one plane at a time
+		UINT32 i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			const Vector3& c0 = spheres[i + 0].getCenter();
+			const Vector3& c1 = spheres[i + 1].getCenter();
+			const Vector3& c2 = spheres[i + 2].getCenter();
+			const Vector3& c3 = spheres[i + 3].getCenter();
+
+			simd::float4 cx = simd::set(c0.x, c1.x, c2.x, c3.x);
+			simd::float4 cy = simd::set(c0.y, c1.y, c2.y, c3.y);
+			simd::float4 cz = simd::set(c0.z, c1.z, c2.z, c3.z);
+			simd::float4 negRadius = simd::set(-spheres[i + 0].getRadius(), -spheres[i + 1].getRadius(),
+				-spheres[i + 2].getRadius(), -spheres[i + 3].getRadius());
+
+			int outsideMask = 0;
+			for (UINT32 j = 0; j < numPlanes && outsideMask != 0xF; j++)
+			{
+				const Plane& plane = planes[j];
+
+				simd::float4 dist = simd::mul(cx, simd::splat(plane.normal.x));
+				dist = simd::madd(cy, simd::splat(plane.normal.y), dist);
+				dist = simd::madd(cz, simd::splat(plane.normal.z), dist);
+				dist = simd::sub(dist, simd::splat(plane.d));
+
+				outsideMask |= simd::lessMask(dist, negRadius);
+			}
+
+			for (UINT32 j = 0; j < 4; j++)
+				output[i + j] = (outsideMask & (1 << j)) == 0;
+		}
+
+		for (; i < count; i++)
+			output[i] = intersects(planes, numPlanes, spheres[i]);
+	}
+
+	void MathBatch::intersects(const Plane* planes, UINT32 numPlanes, const AABox* boxes, UINT32 count, bool* output)
+	{
+		// Test four boxes against one plane at a time
+		UINT32 i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			Vector3 centers[4];
+			Vector3 extents[4];
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				centers[j] = boxes[i + j].getCenter();
+				extents[j] = boxes[i + j].getHalfSize();
+			}
+
+			simd::float4 cx = simd::set(centers[0].x, centers[1].x, centers[2].x, centers[3].x);
+			simd::float4 cy = simd::set(centers[0].y, centers[1].y, centers[2].y, centers[3].y);
+			simd::float4 cz = simd::set(centers[0].z, centers[1].z, centers[2].z, centers[3].z);
+			simd::float4 ex = simd::abs(simd::set(extents[0].x, extents[1].x, extents[2].x, extents[3].x));
+			simd::float4 ey = simd::abs(simd::set(extents[0].y, extents[1].y, extents[2].y, extents[3].y));
+			simd::float4 ez = simd::abs(simd::set(extents[0].z, extents[1].z, extents[2].z, extents[3].z));
+
+			int outsideMask = 0;
+			for (UINT32 j = 0; j < numPlanes && outsideMask != 0xF; j++)
+			{
+				const Plane& plane = planes[j];
+
+				simd::float4 dist = simd::mul(cx, simd::splat(plane.normal.x));
+				dist = simd::madd(cy, simd::splat(plane.normal.y), dist);
+				dist = simd::madd(cz, simd::splat(plane.normal.z), dist);
+				dist = simd::sub(dist, simd::splat(plane.d));
+
+				simd::float4 radius = simd::mul(ex, simd::splat(Math::abs(plane.normal.x)));
+				radius = simd::madd(ey, simd::splat(Math::abs(plane.normal.y)), radius);
+				radius = simd::madd(ez, simd::splat(Math::abs(plane.normal.z)), radius);
+
+				outsideMask |= simd::lessMask(dist, simd::sub(simd::splat(0.0f), radius));
+			}
+
+			for (UINT32 j = 0; j < 4; j++)
+				output[i + j] = (outsideMask & (1 << j)) == 0;
+		}
+
+		for (; i < count; i++)
+			output[i] = intersects(planes, numPlanes, boxes[i]);
+	}
+
+	bool MathBatch::intersects(const Plane* planes, UINT32 numPlanes, const Sphere& sphere)
+	{
+		const Vector3& center = sphere.getCenter();
+		float radius = sphere.getRadius();
+
+		// Test against four planes at a time
+		simd::float4 cx = simd::splat(center.x);
+		simd::float4 cy = simd::splat(center.y);
+		simd::float4 cz = simd::splat(center.z);
+		simd::float4 negRadius = simd::splat(-radius);
+
+		UINT32 i = 0;
+		for (; i + 4 <= numPlanes; i += 4)
+		{
+			simd::float4 nx, ny, nz, d;
+			loadPlanes(&planes[i], nx, ny, nz, d);
+
+			simd::float4 dist = simd::mul(cx, nx);
+			dist = simd::madd(cy, ny, dist);
+			dist = simd::madd(cz, nz, dist);
+			dist = simd::sub(dist, d);
+
+			if (simd::lessMask(dist, negRadius) != 0)
+				return false;
+		}
+
+		for (; i < numPlanes; i++)
+		{
+			if (isOutside(planes[i], center, radius))
+				return false;
+		}
+
+		return true;
+	}
+
+	bool MathBatch::intersects(const Plane* planes, UINT32 numPlanes, const AABox& box)
+	{
+		Vector3 center = box.getCenter();
+		Vector3 extents = box.getHalfSize();
+		Vector3 absExtents(Math::abs(extents.x), Math::abs(extents.y), Math::abs(extents.z));
+
+		// Test against four planes at a time
+		simd::float4 cx = simd::splat(center.x);
+		simd::float4 cy = simd::splat(center.y);
+		simd::float4 cz = simd::splat(center.z);
+		simd::float4 ex = simd::splat(absExtents.x);
+		simd::float4 ey = simd::splat(absExtents.y);
+		simd::float4 ez = simd::splat(absExtents.z);
+
+		UINT32 i = 0;
+		for (; i + 4 <= numPlanes; i += 4)
+		{
+			simd::float4 nx, ny, nz, d;
+			loadPlanes(&planes[i], nx, ny, nz, d);
+
+			simd::float4 dist = simd::mul(cx, nx);
+			dist = simd::madd(cy, ny, dist);
+			dist = simd::madd(cz, nz, dist);
+			dist = simd::sub(dist, d);
+
+			simd::float4 radius = simd::mul(ex, simd::abs(nx));
+			radius = simd::madd(ey, simd::abs(ny), radius);
+			radius = simd::madd(ez, simd::abs(nz), radius);
+
+			if (simd::lessMask(dist, simd::sub(simd::splat(0.0f), radius)) != 0)
+				return false;
+		}
+
+		for (; i < numPlanes; i++)
+		{
+			if (isOutside(planes[i], center, getEffectiveRadius(planes[i], absExtents)))
+				return false;
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,337 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsMathTestSuite.h"
+
+#include "BsMath.h"
+#include "BsMatrix4.h"
+#include "BsQuaternion.h"
+#include "BsAABox.h"
+#include "BsSphere.h"
+#include "BsConvexVolume.h"
+#include "BsMathBatch.h"
+#include "BsTriangleBVH.h"
+#include "BsRay.h"
+
+namespace bs
+{
+	/** Deterministic pseudo-random number generator, so test failures are reproducible. */
+	class TestRandom
+	{
+	public:
+		/** Returns a value in range [min, max]. */
+		float get(float min, float max)
+		{
+			mState = mState * 1664525u + 1013904223u;
+			return min + (max - min) * ((mState >> 8) / (float)(1 << 24));
+		}
+
+		Vector3 getVector(float min, float max)
+		{
+			float x = get(min, max);
+			float y = get(min, max);
+			float z = get(min, max);
+
+			return Vector3(x, y, z);
+		}
+
+		Quaternion getRotation()
+		{
+			float x = get(0.0f, 360.0f);
+			float y = get(0.0f, 360.0f);
+			float z = get(0.0f, 360.0f);
+
+			return Quaternion(Degree(x), Degree(y), Degree(z));
+		}
+
+	private:
+		UINT32 mState = 12345;
+	};
+
+	/** Reference matrix multiplication, using plain scalar code. */
+	Matrix4 referenceMultiply(const Matrix4& lhs, const Matrix4& rhs)
+	{
+		Matrix4 output;
+		for (UINT32 row = 0; row < 4; row++)
+		{
+			for (UINT32 col = 0; col < 4; col++)
+			{
+				output[row][col] = lhs[row][0] * rhs[0][col] + lhs[row][1] * rhs[1][col] + lhs[row][2] * rhs[2][col] +
+					lhs[row][3] * rhs[3][col];
+			}
+		}
+
+		return output;
+	}
+
+	/** Reference quaternion multiplication, using plain scalar code. */
+	Quaternion referenceMultiply(const Quaternion& lhs, const Quaternion& rhs)
+	{
+		return Quaternion(
+			lhs.w * rhs.w - lhs.x * rhs.x - lhs.y * rhs.y - lhs.z * rhs.z,
+			lhs.w * rhs.x + lhs.x * rhs.w + lhs.y * rhs.z - lhs.z * rhs.y,
+			lhs.w * rhs.y + lhs.y * rhs.w + lhs.z * rhs.x - lhs.x * rhs.z,
+			lhs.w * rhs.z + lhs.z * rhs.w + lhs.x * rhs.y - lhs.y * rhs.x);
+	}
+
+	/** Reference sphere/volume intersection test, using plain scalar code. */
+	bool referenceIntersects(const Vector<Plane>& planes, const Sphere& sphere)
+	{
+		for (auto& plane : planes)
+		{
+			float dist = sphere.getCenter().dot(plane.normal) - plane.d;
+			if (dist < -sphere.getRadius())
+				return false;
+		}
+
+		return true;
+	}
+
+	/** Reference box/volume intersection test, using plain scalar code. */
+	bool referenceIntersects(const Vector<Plane>& planes, const AABox& box)
+	{
+		Vector3 center = box.getCenter();
+		Vector3 extents = box.getHalfSize();
+
+		for (auto& plane : planes)
+		{
+			float dist = center.dot(plane.normal) - plane.d;
+
+			float effectiveRadius = Math::abs(extents.x) * Math::abs(plane.normal.x);
+			effectiveRadius += Math::abs(extents.y) * Math::abs(plane.normal.y);
+			effectiveRadius += Math::abs(extents.z) * Math::abs(plane.normal.z);
+
+			if (dist < -effectiveRadius)
+				return false;
+		}
+
+		return true;
+	}
+
+	/** Creates a volume with six planes, so both the four-wide and the remainder paths get tested. */
+	Vector<Plane> createTestPlanes()
+	{
+		ConvexVolume frustum(Matrix4::projectionPerspective(Degree(90.0f), 1.5f, 0.1f, 100.0f));
+		return frustum.getPlanes();
+	}
+
+	MathTestSuite::MathTestSuite()
+	{
+		BS_ADD_TEST(MathTestSuite::testMatrix4Multiply);
+		BS_ADD_TEST(MathTestSuite::testQuaternionMultiply);
+		BS_ADD_TEST(MathTestSuite::testAABoxTransformAffine);
+		BS_ADD_TEST(MathTestSuite::testTransformPointsAffine);
+		BS_ADD_TEST(MathTestSuite::testIntersectsSpheres);
+		BS_ADD_TEST(MathTestSuite::testIntersectsBoxes);
+		BS_ADD_TEST(MathTestSuite::testTriangleBVH);
+	}
+
+	void MathTestSuite::testMatrix4Multiply()
+	{
+		TestRandom random;
+		for (UINT32 i = 0; i < 100; i++)
+		{
+			Matrix4 lhs = Matrix4::TRS(random.getVector(-10.0f, 10.0f), random.getRotation(), random.getVector(0.1f, 5.0f));
+			Matrix4 rhs = Matrix4::TRS(random.getVector(-10.0f, 10.0f), random.getRotation(), random.getVector(0.1f, 5.0f));
+
+			// Operations are performed in the same order as the scalar code, so results must match exactly
+			BS_TEST_ASSERT(lhs * rhs == referenceMultiply(lhs, rhs));
+
+			Matrix4 batchOutput;
+			MathBatch::multiply(&lhs, &rhs, &batchOutput, 1);
+			BS_TEST_ASSERT(batchOutput == referenceMultiply(lhs, rhs));
+		}
+	}
+
+	void MathTestSuite::testQuaternionMultiply()
+	{
+		TestRandom random;
+		for (UINT32 i = 0; i < 100; i++)
+		{
+			Quaternion lhs = random.getRotation();
+			Quaternion rhs = random.getRotation();
+
+			Quaternion output = lhs * rhs;
+			Quaternion expected = referenceMultiply(lhs, rhs);
+
+			// Terms are summed in a different order than the scalar code, so allow for rounding differences
+			BS_TEST_ASSERT(Math::approxEquals(output.w, expected.w, 1e-5f));
+			BS_TEST_ASSERT(Math::approxEquals(output.x, expected.x, 1e-5f));
+			BS_TEST_ASSERT(Math::approxEquals(output.y, expected.y, 1e-5f));
+			BS_TEST_ASSERT(Math::approxEquals(output.z, expected.z, 1e-5f));
+
+			Quaternion compound = lhs;
+			compound *= rhs;
+			BS_TEST_ASSERT(compound == output);
+		}
+	}
+
+	void MathTestSuite::testAABoxTransformAffine()
+	{
+		TestRandom random;
+		for (UINT32 i = 0; i < 100; i++)
+		{
+			Vector3 min = random.getVector(-10.0f, 0.0f);
+			Vector3 max = random.getVector(0.0f, 10.0f);
+			Matrix4 tfrm = Matrix4::TRS(random.getVector(-10.0f, 10.0f), random.getRotation(), random.getVector(0.1f, 5.0f));
+
+			AABox box(min, max);
+			box.transformAffine(tfrm);
+
+			Vector3 centre = (min + max) * 0.5f;
+			Vector3 halfSize = (max - min) * 0.5f;
+			Vector3 expectedCentre = tfrm.multiplyAffine(centre);
+			Vector3 expectedHalfSize(
+				Math::abs(tfrm[0][0]) * halfSize.x + Math::abs(tfrm[0][1]) * halfSize.y + Math::abs(tfrm[0][2]) * halfSize.z,
+				Math::abs(tfrm[1][0]) * halfSize.x + Math::abs(tfrm[1][1]) * halfSize.y + Math::abs(tfrm[1][2]) * halfSize.z,
+				Math::abs(tfrm[2][0]) * halfSize.x + Math::abs(tfrm[2][1]) * halfSize.y + Math::abs(tfrm[2][2]) * halfSize.z);
+
+			BS_TEST_ASSERT(box.getMin() == expectedCentre - expectedHalfSize);
+			BS_TEST_ASSERT(box.getMax() == expectedCentre + expectedHalfSize);
+		}
+	}
+
+	void MathTestSuite::testTransformPointsAffine()
+	{
+		TestRandom random;
+		Matrix4 tfrm = Matrix4::TRS(random.getVector(-10.0f, 10.0f), random.getRotation(), random.getVector(0.1f, 5.0f));
+
+		Vector<Vector3> points(37);
+		for (auto& entry : points)
+			entry = random.getVector(-100.0f, 100.0f);
+
+		Vector<Vector3> output(points.size());
+		MathBatch::transformPointsAffine(tfrm, points.data(), output.data(), (UINT32)points.size());
+
+		for (UINT32 i = 0; i < (UINT32)points.size(); i++)
+			BS_TEST_ASSERT(output[i] == tfrm.multiplyAffine(points[i]));
+	}
+
+	void MathTestSuite::testIntersectsSpheres()
+	{
+		TestRandom random;
+		Vector<Plane> planes = createTestPlanes();
+		ConvexVolume volume(planes);
+
+		// Odd count so the remainder path is exercised
+		Vector<Sphere> spheres(103);
+		for (auto& entry : spheres)
+			entry = Sphere(random.getVector(-100.0f, 100.0f), random.get(0.0f, 20.0f));
+
+		bool* output = (bool*)bs_alloc(sizeof(bool) * spheres.size());
+		volume.intersects(spheres.data(), (UINT32)spheres.size(), output);
+
+		UINT32 numIntersecting = 0;
+		for (UINT32 i = 0; i < (UINT32)spheres.size(); i++)
+		{
+			bool expected = referenceIntersects(planes, spheres[i]);
+
+			BS_TEST_ASSERT(output[i] == expected);
+			BS_TEST_ASSERT(volume.intersects(spheres[i]) == expected);
+
+			if (expected)
+				numIntersecting++;
+		}
+
+		// Make sure the test data covers both outcomes
+		BS_TEST_ASSERT(numIntersecting > 0 && numIntersecting < (UINT32)spheres.size());
+		bs_free(output);
+	}
+
+	void MathTestSuite::testIntersectsBoxes()
+	{
+		TestRandom random;
+		Vector<Plane> planes = createTestPlanes();
+		ConvexVolume volume(planes);
+
+		Vector<AABox> boxes(103);
+		for (auto& entry : boxes)
+		{
+			Vector3 center = random.getVector(-100.0f, 100.0f);
+			Vector3 halfSize = random.getVector(0.0f, 20.0f);
+
+			entry = AABox(center - halfSize, center + halfSize);
+		}
+
+		bool* output = (bool*)bs_alloc(sizeof(bool) * boxes.size());
+		volume.intersects(boxes.data(), (UINT32)boxes.size(), output);
+
+		UINT32 numIntersecting = 0;
+		for (UINT32 i = 0; i < (UINT32)boxes.size(); i++)
+		{
+			bool expected = referenceIntersects(planes, boxes[i]);
+
+			BS_TEST_ASSERT(output[i] == expected);
+			BS_TEST_ASSERT(volume.intersects(boxes[i]) == expected);
+
+			if (expected)
+				numIntersecting++;
+		}
+
+		BS_TEST_ASSERT(numIntersecting > 0 && numIntersecting < (UINT32)boxes.size());
+		bs_free(output);
+	}
+
+	void MathTestSuite::testTriangleBVH()
+	{
+		TestRandom random;
+
+		const UINT32 NUM_TRIANGLES = 500;
+		Vector<Vector3> positions(NUM_TRIANGLES * 3);
+		Vector<UINT32> indices(NUM_TRIANGLES * 3);
+		for (UINT32 i = 0; i < NUM_TRIANGLES; i++)
+		{
+			Vector3 center = random.getVector(-50.0f, 50.0f);
+			for (UINT32 j = 0; j < 3; j++)
+			{
+				positions[i * 3 + j] = center + random.getVector(-5.0f, 5.0f);
+				indices[i * 3 + j] = i * 3 + j;
+			}
+		}
+
+		TriangleBVH bvh;
+		bvh.build(positions.data(), (UINT32)positions.size(), indices.data(), (UINT32)indices.size());
+		BS_TEST_ASSERT(bvh.getNumTriangles() == NUM_TRIANGLES);
+
+		UINT32 numHits = 0;
+		for (UINT32 i = 0; i < 200; i++)
+		{
+			Ray ray(random.getVector(-100.0f, 100.0f), Vector3::normalize(random.getVector(-1.0f, 1.0f)));
+
+			// Brute force reference
+			bool expectedHit = false;
+			float expectedDistance = std::numeric_limits<float>::max();
+			UINT32 expectedTriangle = 0;
+			for (UINT32 j = 0; j < NUM_TRIANGLES; j++)
+			{
+				const Vector3& a = positions[j * 3 + 0];
+				const Vector3& b = positions[j * 3 + 1];
+				const Vector3& c = positions[j * 3 + 2];
+
+				std::pair<bool, float> hit = ray.intersects(a, b, c, (b - a).cross(c - a));
+				if (hit.first && hit.second < expectedDistance)
+				{
+					expectedHit = true;
+					expectedDistance = hit.second;
+					expectedTriangle = j;
+				}
+			}
+
+			float distance;
+			Vector3 normal;
+			UINT32 triangleIdx;
+			bool hit = bvh.intersects(ray, distance, normal, triangleIdx);
+
+			BS_TEST_ASSERT(hit == expectedHit);
+			if (hit && expectedHit)
+			{
+				BS_TEST_ASSERT(distance == expectedDistance);
+				BS_TEST_ASSERT(triangleIdx == expectedTriangle);
+				BS_TEST_ASSERT(normal.dot(ray.getDirection()) <= 0.0f);
+
+				numHits++;
+			}
+		}
+
+		BS_TEST_ASSERT(numHits > 0);
+	}
+}
@@ -0,0 +1,209 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsSerializationBenchmarkSuite.h"
+#include "BsIReflectable.h"
+#include "BsRTTIType.h"
+#include "BsBinarySerializer.h"
+#include "BsMemorySerializer.h"
+#include "BsCompression.h"
+#include "BsDataStream.h"
+
+namespace bs
+{
+	static const UINT32 COMPRESSION_DATA_SIZE = 1024 * 1024;
+
+	/** Object with a mix of plain fields, arrays and child objects, representative of typical serialized resources. */
+	struct BenchmarkObject : IReflectable
+	{
+		UINT32 intValue = 0;
+		float floatValue = 0.0f;
+		String name;
+		Vector<float> values;
+		Vector<SPtr<BenchmarkObject>> children;
+
+		/************************************************************************/
+		/* 								RTTI		                     		*/
+		/************************************************************************/
+	public:
+		friend class BenchmarkObjectRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override;
+	};
+
+	class BenchmarkObjectRTTI : public RTTIType<BenchmarkObject, IReflectable, BenchmarkObjectRTTI>
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN(intValue, 0)
+			BS_RTTI_MEMBER_PLAIN(floatValue, 1)
+			BS_RTTI_MEMBER_PLAIN(name, 2)
+			BS_RTTI_MEMBER_PLAIN_ARRAY(values, 3)
+			BS_RTTI_MEMBER_REFLPTR_ARRAY(children, 4)
+		BS_END_RTTI_MEMBERS
+
+	public:
+		BenchmarkObjectRTTI()
+			:mInitMembers(this)
+		{ }
+
+		const String& getRTTIName() override
+		{
+			static String name = "BenchmarkObject";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_BenchmarkObject;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return bs_shared_ptr_new<BenchmarkObject>();
+		}
+	};
+
+	RTTITypeBase* BenchmarkObject::getRTTIStatic()
+	{
+		return BenchmarkObjectRTTI::instance();
+	}
+
+	RTTITypeBase* BenchmarkObject::getRTTI() const
+	{
+		return BenchmarkObject::getRTTIStatic();
+	}
+
+	/** Creates a hierarchy of objects with the specified number of children per level. */
+	SPtr<BenchmarkObject> createBenchmarkObject(UINT32 depth, UINT32 numChildren, UINT32& id)
+	{
+		SPtr<BenchmarkObject> object = bs_shared_ptr_new<BenchmarkObject>();
+		object->intValue = id++;
+		object->floatValue = object->intValue * 0.5f;
+		object->name = "Object" + toString(object->intValue);
+
+		object->values.resize(16);
+		for (UINT32 i = 0; i < (UINT32)object->values.size(); i++)
+			object->values[i] = (float)(object->intValue + i);
+
+		if (depth > 0)
+		{
+			for (UINT32 i = 0; i < numChildren; i++)
+				object->children.push_back(createBenchmarkObject(depth - 1, numChildren, id));
+		}
+
+		return object;
+	}
+
+	SerializationBenchmarkSuite::SerializationBenchmarkSuite()
+	{
+		BS_ADD_BENCHMARK(SerializationBenchmarkSuite::benchBinarySerializerEncode);
+		BS_ADD_BENCHMARK(SerializationBenchmarkSuite::benchBinarySerializerDecode);
+		BS_ADD_BENCHMARK(SerializationBenchmarkSuite::benchMemorySerializerEncode);
+		BS_ADD_BENCHMARK(SerializationBenchmarkSuite::benchMemorySerializerDecode);
+
+		// Compression reports throughput, as it's the only one where the size of the input is fixed up front
+		BS_ADD_BENCHMARK_BYTES(SerializationBenchmarkSuite::benchCompress, COMPRESSION_DATA_SIZE);
+		BS_ADD_BENCHMARK_BYTES(SerializationBenchmarkSuite::benchDecompress, COMPRESSION_DATA_SIZE);
+	}
+
+	void SerializationBenchmarkSuite::startUp()
+	{
+		// 1 + 4 + 16 + 64 + 256 objects
+		UINT32 id = 0;
+		mObject = createBenchmarkObject(4, 4, id);
+
+		mEncodeBuffer.resize(1024 * 1024);
+
+		MemorySerializer serializer;
+		mEncodedObject = serializer.encode(mObject.get(), mEncodedObjectSize);
+
+		// Repeating but not entirely uniform data, so the compressor has some work to do
+		SPtr<MemoryDataStream> uncompressedData = bs_shared_ptr_new<MemoryDataStream>(COMPRESSION_DATA_SIZE);
+
+		UINT32 state = 12345;
+		UINT8* data = uncompressedData->getPtr();
+		for (UINT32 i = 0; i < COMPRESSION_DATA_SIZE; i++)
+		{
+			state = state * 1664525u + 1013904223u;
+			data[i] = (UINT8)((i / 64) + ((state >> 24) & 0x7));
+		}
+
+		mUncompressedData = uncompressedData;
+		mCompressedData = Compression::compress(mUncompressedData);
+	}
+
+	void SerializationBenchmarkSuite::shutDown()
+	{
+		if (mEncodedObject != nullptr)
+		{
+			bs_free(mEncodedObject);
+			mEncodedObject = nullptr;
+		}
+
+		mObject = nullptr;
+		mUncompressedData = nullptr;
+		mCompressedData = nullptr;
+		mEncodeBuffer.clear();
+	}
+
+	void SerializationBenchmarkSuite::benchBinarySerializerEncode()
+	{
+		UINT32 bytesWritten = 0;
+		auto flushBuffer = [&](UINT8*, UINT32, UINT32& newBufferSize)
+		{
+			// Buffer is large enough to never need a flush, just continue from the start if it does
+			newBufferSize = (UINT32)mEncodeBuffer.size();
+			return mEncodeBuffer.data();
+		};
+
+		BinarySerializer serializer;
+		serializer.encode(mObject.get(), mEncodeBuffer.data(), (UINT32)mEncodeBuffer.size(), &bytesWritten, flushBuffer);
+
+		doNotOptimize(bytesWritten);
+	}
+
+	void SerializationBenchmarkSuite::benchBinarySerializerDecode()
+	{
+		SPtr<DataStream> stream = bs_shared_ptr_new<MemoryDataStream>(mEncodedObject, mEncodedObjectSize, false);
+
+		BinarySerializer serializer;
+		SPtr<IReflectable> object = serializer.decode(stream, mEncodedObjectSize);
+
+		doNotOptimize(object);
+	}
+
+	void SerializationBenchmarkSuite::benchMemorySerializerEncode()
+	{
+		UINT32 bytesWritten = 0;
+
+		MemorySerializer serializer;
+		UINT8* buffer = serializer.encode(mObject.get(), bytesWritten);
+
+		doNotOptimize(buffer);
+		bs_free(buffer);
+	}
+
+	void SerializationBenchmarkSuite::benchMemorySerializerDecode()
+	{
+		MemorySerializer serializer;
+		SPtr<IReflectable> object = serializer.decode(mEncodedObject, mEncodedObjectSize);
+
+		doNotOptimize(object);
+	}
+
+	void SerializationBenchmarkSuite::benchCompress()
+	{
+		mUncompressedData->seek(0);
+		SPtr<MemoryDataStream> output = Compression::compress(mUncompressedData);
+
+		doNotOptimize(output);
+	}
+
+	void SerializationBenchmarkSuite::benchDecompress()
+	{
+		mCompressedData->seek(0);
+		SPtr<MemoryDataStream> output = Compression::decompress(mCompressedData);
+
+		doNotOptimize(output);
+	}
+}
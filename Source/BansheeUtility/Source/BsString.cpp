@@ -114,6 +114,26 @@ namespace bs
 		return matchInternal<wchar_t>(str, pattern, caseSensitive);
 	}
 
+	Vector<String> StringUtil::tokenizePattern(const String& pattern)
+	{
+		return tokenizePatternInternal<char>(pattern);
+	}
+
+	Vector<WString> StringUtil::tokenizePattern(const WString& pattern)
+	{
+		return tokenizePatternInternal<wchar_t>(pattern);
+	}
+
+	bool StringUtil::matchTokens(const String& str, const Vector<String>& tokens)
+	{
+		return matchTokensInternal<char>(str, tokens);
+	}
+
+	bool StringUtil::matchTokens(const WString& str, const Vector<WString>& tokens)
+	{
+		return matchTokensInternal<wchar_t>(str, tokens);
+	}
+
 	const String StringUtil::replaceAll(const String& source, const String& replaceWhat, const String& replaceWithWhat)
 	{
 		return replaceAllInternal<char>(source, replaceWhat, replaceWithWhat);
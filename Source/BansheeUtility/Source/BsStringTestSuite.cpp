@@ -0,0 +1,78 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsStringTestSuite.h"
+
+namespace bs
+{
+	/** Splits the pattern into tokens and matches the string against them. */
+	bool matchPattern(const WString& str, const WString& pattern)
+	{
+		return StringUtil::matchTokens(str, StringUtil::tokenizePattern(pattern));
+	}
+
+	StringTestSuite::StringTestSuite()
+	{
+		BS_ADD_TEST(StringTestSuite::testTokenizePattern);
+		BS_ADD_TEST(StringTestSuite::testMatchTokens);
+	}
+
+	void StringTestSuite::testTokenizePattern()
+	{
+		Vector<WString> tokens = StringUtil::tokenizePattern(WString(L"abc"));
+		BS_TEST_ASSERT(tokens.size() == 1 && tokens[0] == L"abc");
+
+		tokens = StringUtil::tokenizePattern(WString(L"*"));
+		BS_TEST_ASSERT(tokens.size() == 2 && tokens[0].empty() && tokens[1].empty());
+
+		tokens = StringUtil::tokenizePattern(WString(L"ab*cd**ef*"));
+		BS_TEST_ASSERT(tokens.size() == 5);
+		BS_TEST_ASSERT(tokens[0] == L"ab" && tokens[1] == L"cd" && tokens[2].empty() && tokens[3] == L"ef");
+		BS_TEST_ASSERT(tokens[4].empty());
+
+		tokens = StringUtil::tokenizePattern(WString());
+		BS_TEST_ASSERT(tokens.size() == 1 && tokens[0].empty());
+
+		Vector<String> narrowTokens = StringUtil::tokenizePattern(String("*.png"));
+		BS_TEST_ASSERT(narrowTokens.size() == 2 && narrowTokens[0].empty() && narrowTokens[1] == ".png");
+	}
+
+	void StringTestSuite::testMatchTokens()
+	{
+		// No wildcards, must match exactly
+		BS_TEST_ASSERT(matchPattern(L"texture", L"texture"));
+		BS_TEST_ASSERT(!matchPattern(L"texture2", L"texture"));
+		BS_TEST_ASSERT(!matchPattern(L"Texture", L"texture"));
+		BS_TEST_ASSERT(matchPattern(L"", L""));
+
+		// Lone wildcard matches everything
+		BS_TEST_ASSERT(matchPattern(L"texture", L"*"));
+		BS_TEST_ASSERT(matchPattern(L"", L"*"));
+		BS_TEST_ASSERT(matchPattern(L"texture", L"**"));
+
+		// Prefix and suffix
+		BS_TEST_ASSERT(matchPattern(L"texture.png", L"tex*"));
+		BS_TEST_ASSERT(!matchPattern(L"mytexture.png", L"tex*"));
+		BS_TEST_ASSERT(matchPattern(L"texture.png", L"*.png"));
+		BS_TEST_ASSERT(!matchPattern(L"texture.png.meta", L"*.png"));
+		BS_TEST_ASSERT(matchPattern(L"texture.png", L"tex*.png"));
+
+		// Prefix and suffix can't overlap
+		BS_TEST_ASSERT(!matchPattern(L"aba", L"ab*ba"));
+		BS_TEST_ASSERT(matchPattern(L"abba", L"ab*ba"));
+
+		// Substrings must appear in order, between the prefix and the suffix
+		BS_TEST_ASSERT(matchPattern(L"my_texture_normal.png", L"*texture*"));
+		BS_TEST_ASSERT(matchPattern(L"my_texture_normal.png", L"my*tex*norm*.png"));
+		BS_TEST_ASSERT(!matchPattern(L"my_texture_normal.png", L"my*norm*tex*.png"));
+		BS_TEST_ASSERT(!matchPattern(L"my_texture.png", L"my*.png*.png"));
+		BS_TEST_ASSERT(!matchPattern(L"mesh.fbx", L"*texture*"));
+
+		// Substring overlapping the suffix doesn't count
+		BS_TEST_ASSERT(!matchPattern(L"abc", L"*bc*c"));
+		BS_TEST_ASSERT(matchPattern(L"abcc", L"*bc*c"));
+
+		// Narrow strings
+		BS_TEST_ASSERT(StringUtil::matchTokens(String("shader.bsl"), StringUtil::tokenizePattern(String("*.bsl"))));
+		BS_TEST_ASSERT(!StringUtil::matchTokens(String("shader.bsi"), StringUtil::tokenizePattern(String("*.bsl"))));
+	}
+}
@@ -6,13 +6,11 @@
 
 namespace bs
 {
-	TextureAtlasLayout::TexAtlasNode::TexAtlasNode()
-		:x(0), y(0), width(0), height(0), children{ (UINT32)-1, (UINT32)-1 }, nodeFull(false)
-	{ }
-
-	TextureAtlasLayout::TexAtlasNode::TexAtlasNode(UINT32 x, UINT32 y, UINT32 width, UINT32 height)
-		: x(x), y(y), width(width), height(height), children{ (UINT32)-1, (UINT32)-1 }, nodeFull(false)
-	{ }
+	/** Generates a key used for looking up elements by their position. */
+	static UINT64 getElementKey(UINT32 x, UINT32 y)
+	{
+		return ((UINT64)x << 32) | y;
+	}
 
 	TextureAtlasLayout::TextureAtlasLayout()
 		: mInitialWidth(0), mInitialHeight(0), mWidth(0), mHeight(0), mMaxWidth(0), mMaxHeight(0), mPow2(false)
@@ -22,7 +20,7 @@ namespace bs
 		: mInitialWidth(width), mInitialHeight(height), mWidth(width), mHeight(height), mMaxWidth(maxWidth)
 		, mMaxHeight(maxHeight), mPow2(pow2)
 	{
-		mNodes.push_back(TexAtlasNode(0, 0, maxWidth, maxHeight));
+		mFreeAreas.push_back({ 0, 0, maxWidth, maxHeight });
 	}
 
 	bool TextureAtlasLayout::addElement(UINT32 width, UINT32 height, UINT32& x, UINT32& y)
@@ -35,92 +33,245 @@ namespace bs
 		}
 
 		// Try adding without expanding, if that fails try to expand
-		if(!addToNode(0, width, height, x, y, false))
+		UINT32 freeAreaIdx = findFreeArea(width, height, false);
+		if(freeAreaIdx == (UINT32)-1)
 		{
-			if (!addToNode(0, width, height, x, y, true))
+			freeAreaIdx = findFreeArea(width, height, true);
+			if (freeAreaIdx == (UINT32)-1)
 				return false;
 		}
 
-		// Update size to cover all nodes
-		if(mPow2)
+		x = mFreeAreas[freeAreaIdx].x;
+		y = mFreeAreas[freeAreaIdx].y;
+
+		placeElement(freeAreaIdx, width, height);
+		mElements[getElementKey(x, y)] = { x, y, width, height };
+
+		// Update size to cover all elements
+		UINT32 requiredWidth, requiredHeight;
+		getRequiredSize(x + width, y + height, requiredWidth, requiredHeight);
+
+		mWidth = std::max(mWidth, requiredWidth);
+		mHeight = std::max(mHeight, requiredHeight);
+
+		return true;
+	}
+
+	bool TextureAtlasLayout::removeElement(UINT32 x, UINT32 y)
+	{
+		auto iterFind = mElements.find(getElementKey(x, y));
+		if (iterFind == mElements.end())
+			return false;
+
+		Area area = iterFind->second;
+		mElements.erase(iterFind);
+
+		if(mElements.empty())
 		{
-			mWidth = std::max(mWidth, Bitwise::nextPow2(x + width));
-			mHeight = std::max(mHeight, Bitwise::nextPow2(y + height));
+			clear();
+			return true;
 		}
-		else
+
+		addFreeArea(area);
+
+		// Shrink the size to cover the remaining elements
+		mWidth = mInitialWidth;
+		mHeight = mInitialHeight;
+
+		for(auto& entry : mElements)
 		{
-			mWidth = std::max(mWidth, x + width);
-			mHeight = std::max(mHeight, y + height);
+			const Area& element = entry.second;
+
+			UINT32 requiredWidth, requiredHeight;
+			getRequiredSize(element.x + element.width, element.y + element.height, requiredWidth, requiredHeight);
+
+			mWidth = std::max(mWidth, requiredWidth);
+			mHeight = std::max(mHeight, requiredHeight);
 		}
 
 		return true;
 	}
 
+	bool TextureAtlasLayout::defragment(Vector<MovedElement>& movedElements)
+	{
+		Vector<Area> elements;
+		elements.reserve(mElements.size());
+
+		for (auto& entry : mElements)
+			elements.push_back(entry.second);
+
+		std::sort(elements.begin(), elements.end(), 
+			[](const Area& a, const Area& b)
+		{
+			UINT32 areaA = a.width * a.height;
+			UINT32 areaB = b.width * b.height;
+
+			if (areaA != areaB)
+				return areaA > areaB;
+
+			// Keep the order deterministic, since the source map is unordered
+			return getElementKey(a.x, a.y) < getElementKey(b.x, b.y);
+		});
+
+		TextureAtlasLayout packed(mInitialWidth, mInitialHeight, mMaxWidth, mMaxHeight, mPow2);
+
+		Vector<MovedElement> moves;
+		for (auto& element : elements)
+		{
+			UINT32 x, y;
+			if (!packed.addElement(element.width, element.height, x, y))
+				return false;
+
+			if (x != element.x || y != element.y)
+				moves.push_back({ element.width, element.height, element.x, element.y, x, y });
+		}
+
+		*this = std::move(packed);
+		movedElements.insert(movedElements.end(), moves.begin(), moves.end());
+
+		return true;
+	}
+
 	void TextureAtlasLayout::clear()
 	{
-		mNodes.clear();
-		mNodes.push_back(TexAtlasNode(0, 0, mWidth, mHeight));
+		mFreeAreas.clear();
+		mFreeAreas.push_back({ 0, 0, mMaxWidth, mMaxHeight });
+		mElements.clear();
 
 		mWidth = mInitialWidth;
 		mHeight = mInitialHeight;
 	}
 
-	bool TextureAtlasLayout::addToNode(UINT32 nodeIdx, UINT32 width, UINT32 height, UINT32& x, UINT32& y, bool allowGrowth)
+	UINT32 TextureAtlasLayout::findFreeArea(UINT32 width, UINT32 height, bool allowGrowth) const
 	{
-		TexAtlasNode* node = &mNodes[nodeIdx];
-		float aspect = node->width / (float)node->height;
-
-		if (node->children[0] != -1)
-		{
-			if (addToNode(node->children[0], width, height, x, y, allowGrowth))
-				return true;
+		UINT32 bestIdx = (UINT32)-1;
+		UINT64 bestGrownSize = std::numeric_limits<UINT64>::max();
+		UINT32 bestShortSide = std::numeric_limits<UINT32>::max();
 
-			return addToNode(node->children[1], width, height, x, y, allowGrowth);
-		}
-		else
+		for(UINT32 i = 0; i < (UINT32)mFreeAreas.size(); i++)
 		{
-			if (node->nodeFull)
-				return false;
-
-			if (width > node->width || height > node->height)
-				return false;
+			const Area& area = mFreeAreas[i];
+			if (width > area.width || height > area.height)
+				continue;
 
+			UINT64 grownSize = 0;
 			if(!allowGrowth)
 			{
-				if (node->x + width > mWidth || node->y + height > mHeight)
-					return false;
+				if (area.x + width > mWidth || area.y + height > mHeight)
+					continue;
 			}
-
-			if (width == node->width && height == node->height)
+			else
 			{
-				x = node->x;
-				y = node->y;
-				node->nodeFull = true;
+				UINT32 requiredWidth, requiredHeight;
+				getRequiredSize(area.x + width, area.y + height, requiredWidth, requiredHeight);
 
-				return true;
+				grownSize = (UINT64)std::max(mWidth, requiredWidth) * std::max(mHeight, requiredHeight);
 			}
 
-			float dw = (float)(node->width - width);
-			float dh = (node->height - height) * aspect;
-
-			UINT32 nextChildIdx = (UINT32)mNodes.size();
-			node->children[0] = nextChildIdx;
-			node->children[1] = nextChildIdx + 1;
-
-			TexAtlasNode nodeCopy = *node;
-			node = nullptr; // Undefined past this point
-			if (dw > dh)
+			// Prefer areas that require the least growth, and then areas that leave the least space unused along the 
+			// shorter side
+			UINT32 shortSide = std::min(area.width - width, area.height - height);
+			if(grownSize < bestGrownSize || (grownSize == bestGrownSize && shortSide < bestShortSide))
 			{
-				mNodes.emplace_back(nodeCopy.x, nodeCopy.y, width, nodeCopy.height);
-				mNodes.emplace_back(nodeCopy.x + width, nodeCopy.y, nodeCopy.width - width, nodeCopy.height);
+				bestIdx = i;
+				bestGrownSize = grownSize;
+				bestShortSide = shortSide;
 			}
-			else
+		}
+
+		return bestIdx;
+	}
+
+	void TextureAtlasLayout::placeElement(UINT32 freeAreaIdx, UINT32 width, UINT32 height)
+	{
+		Area area = mFreeAreas[freeAreaIdx];
+
+		mFreeAreas[freeAreaIdx] = mFreeAreas.back();
+		mFreeAreas.pop_back();
+
+		UINT32 remainingWidth = area.width - width;
+		UINT32 remainingHeight = area.height - height;
+
+		// Split along the shorter remaining axis, so the larger of the two remaining areas is as large as possible
+		Area right, bottom;
+		if(remainingWidth < remainingHeight)
+		{
+			right = { area.x + width, area.y, remainingWidth, height };
+			bottom = { area.x, area.y + height, area.width, remainingHeight };
+		}
+		else
+		{
+			right = { area.x + width, area.y, remainingWidth, area.height };
+			bottom = { area.x, area.y + height, width, remainingHeight };
+		}
+
+		if (right.width > 0 && right.height > 0)
+			mFreeAreas.push_back(right);
+
+		if (bottom.width > 0 && bottom.height > 0)
+			mFreeAreas.push_back(bottom);
+	}
+
+	void TextureAtlasLayout::addFreeArea(Area area)
+	{
+		// Keep merging until no neighbors share an entire edge with the area
+		bool merged = true;
+		while(merged)
+		{
+			merged = false;
+			for(UINT32 i = 0; i < (UINT32)mFreeAreas.size(); i++)
 			{
-				mNodes.emplace_back(nodeCopy.x, nodeCopy.y, nodeCopy.width, height);
-				mNodes.emplace_back(nodeCopy.x, nodeCopy.y + height, nodeCopy.width, nodeCopy.height - height);
+				const Area& other = mFreeAreas[i];
+
+				bool sameColumn = other.x == area.x && other.width == area.width;
+				bool sameRow = other.y == area.y && other.height == area.height;
+
+				if(sameColumn && other.y + other.height == area.y)
+				{
+					area.y = other.y;
+					area.height += other.height;
+					merged = true;
+				}
+				else if(sameColumn && area.y + area.height == other.y)
+				{
+					area.height += other.height;
+					merged = true;
+				}
+				else if(sameRow && other.x + other.width == area.x)
+				{
+					area.x = other.x;
+					area.width += other.width;
+					merged = true;
+				}
+				else if(sameRow && area.x + area.width == other.x)
+				{
+					area.width += other.width;
+					merged = true;
+				}
+
+				if(merged)
+				{
+					mFreeAreas[i] = mFreeAreas.back();
+					mFreeAreas.pop_back();
+					break;
+				}
 			}
+		}
+
+		mFreeAreas.push_back(area);
+	}
 
-			return addToNode(nodeCopy.children[0], width, height, x, y, allowGrowth);
+	void TextureAtlasLayout::getRequiredSize(UINT32 right, UINT32 bottom, UINT32& width, UINT32& height) const
+	{
+		if(mPow2)
+		{
+			width = Bitwise::nextPow2(right);
+			height = Bitwise::nextPow2(bottom);
+		}
+		else
+		{
+			width = right;
+			height = bottom;
 		}
 	}
 
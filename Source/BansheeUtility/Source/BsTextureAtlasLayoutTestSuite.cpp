@@ -0,0 +1,211 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsTextureAtlasLayoutTestSuite.h"
+#include "BsTextureAtlasLayout.h"
+#include "BsBitwise.h"
+
+namespace bs
+{
+	/** Position and size of an element added to the layout. */
+	struct TestAtlasElement
+	{
+		UINT32 x, y;
+		UINT32 width, height;
+	};
+
+	/** Deterministic pseudo-random number generator, so test failures are reproducible. */
+	class TestAtlasRandom
+	{
+	public:
+		/** Returns a value in range [min, max]. */
+		UINT32 get(UINT32 min, UINT32 max)
+		{
+			mState = mState * 1664525u + 1013904223u;
+			return min + (mState >> 8) % (max - min + 1);
+		}
+
+	private:
+		UINT32 mState = 12345;
+	};
+
+	/** Checks that no two elements overlap, and that all of them lie within the atlas. */
+	bool isLayoutValid(const Vector<TestAtlasElement>& elements, const TextureAtlasLayout& layout)
+	{
+		for (UINT32 i = 0; i < (UINT32)elements.size(); i++)
+		{
+			const TestAtlasElement& a = elements[i];
+			if (a.x + a.width > layout.getWidth() || a.y + a.height > layout.getHeight())
+				return false;
+
+			for (UINT32 j = i + 1; j < (UINT32)elements.size(); j++)
+			{
+				const TestAtlasElement& b = elements[j];
+
+				bool overlaps = a.x < b.x + b.width && b.x < a.x + a.width && a.y < b.y + b.height && b.y < a.y + a.height;
+				if (overlaps)
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+	/** Adds a number of randomly sized elements to the layout, and records the elements that were added. */
+	UINT32 addRandomElements(TextureAtlasLayout& layout, TestAtlasRandom& random, UINT32 count,
+		Vector<TestAtlasElement>& elements)
+	{
+		UINT32 numAdded = 0;
+		for (UINT32 i = 0; i < count; i++)
+		{
+			TestAtlasElement element;
+			element.width = random.get(4, 48);
+			element.height = random.get(4, 48);
+
+			if (!layout.addElement(element.width, element.height, element.x, element.y))
+				continue;
+
+			elements.push_back(element);
+			numAdded++;
+		}
+
+		return numAdded;
+	}
+
+	TextureAtlasLayoutTestSuite::TextureAtlasLayoutTestSuite()
+	{
+		BS_ADD_TEST(TextureAtlasLayoutTestSuite::testAddElements);
+		BS_ADD_TEST(TextureAtlasLayoutTestSuite::testRemoveAndReAdd);
+		BS_ADD_TEST(TextureAtlasLayoutTestSuite::testDefragment);
+	}
+
+	void TextureAtlasLayoutTestSuite::testAddElements()
+	{
+		TestAtlasRandom random;
+		TextureAtlasLayout layout(64, 64, 512, 512, true);
+
+		Vector<TestAtlasElement> elements;
+		UINT32 numAdded = addRandomElements(layout, random, 100, elements);
+
+		BS_TEST_ASSERT(numAdded > 0);
+		BS_TEST_ASSERT(layout.getNumElements() == numAdded);
+		BS_TEST_ASSERT(isLayoutValid(elements, layout));
+		BS_TEST_ASSERT(Bitwise::isPow2(layout.getWidth()) && Bitwise::isPow2(layout.getHeight()));
+		BS_TEST_ASSERT(layout.getWidth() <= 512 && layout.getHeight() <= 512);
+
+		// Element larger than the maximum size must be rejected
+		UINT32 x, y;
+		BS_TEST_ASSERT(!layout.addElement(513, 16, x, y));
+		BS_TEST_ASSERT(layout.getNumElements() == numAdded);
+	}
+
+	void TextureAtlasLayoutTestSuite::testRemoveAndReAdd()
+	{
+		TestAtlasRandom random;
+		TextureAtlasLayout layout(64, 64, 512, 512);
+
+		Vector<TestAtlasElement> elements;
+		addRandomElements(layout, random, 80, elements);
+
+		// Remove every other element
+		Vector<TestAtlasElement> remaining;
+		for (UINT32 i = 0; i < (UINT32)elements.size(); i++)
+		{
+			if ((i % 2) == 0)
+			{
+				BS_TEST_ASSERT(layout.removeElement(elements[i].x, elements[i].y));
+			}
+			else
+				remaining.push_back(elements[i]);
+		}
+
+		BS_TEST_ASSERT(layout.getNumElements() == (UINT32)remaining.size());
+
+		// Removing an element twice must fail, and must not affect other elements
+		BS_TEST_ASSERT(!layout.removeElement(elements[0].x, elements[0].y));
+		BS_TEST_ASSERT(layout.getNumElements() == (UINT32)remaining.size());
+
+		// Freed space must be re-usable, without new elements overlapping the elements that remained
+		for (UINT32 i = 0; i < 3; i++)
+		{
+			UINT32 numAdded = addRandomElements(layout, random, 40, remaining);
+			BS_TEST_ASSERT(numAdded > 0);
+			BS_TEST_ASSERT(layout.getNumElements() == (UINT32)remaining.size());
+			BS_TEST_ASSERT(isLayoutValid(remaining, layout));
+
+			// Remove a third of the elements before the next round
+			for (INT32 j = (INT32)remaining.size() - 1; j >= 0; j -= 3)
+			{
+				BS_TEST_ASSERT(layout.removeElement(remaining[j].x, remaining[j].y));
+				remaining.erase(remaining.begin() + j);
+			}
+
+			BS_TEST_ASSERT(layout.getNumElements() == (UINT32)remaining.size());
+		}
+
+		// Removing all elements must leave the layout empty
+		for (auto& element : remaining)
+			BS_TEST_ASSERT(layout.removeElement(element.x, element.y));
+
+		BS_TEST_ASSERT(layout.isEmpty());
+	}
+
+	void TextureAtlasLayoutTestSuite::testDefragment()
+	{
+		TestAtlasRandom random;
+		TextureAtlasLayout layout(64, 64, 512, 512);
+
+		Vector<TestAtlasElement> elements;
+		addRandomElements(layout, random, 120, elements);
+
+		// Leave holes behind, so there is something to defragment
+		Vector<TestAtlasElement> remaining;
+		for (UINT32 i = 0; i < (UINT32)elements.size(); i++)
+		{
+			if ((i % 3) == 0)
+				layout.removeElement(elements[i].x, elements[i].y);
+			else
+				remaining.push_back(elements[i]);
+		}
+
+		Vector<TextureAtlasLayout::MovedElement> movedElements;
+		bool defragmented = layout.defragment(movedElements);
+		BS_TEST_ASSERT(defragmented);
+		BS_TEST_ASSERT(!movedElements.empty());
+		BS_TEST_ASSERT(layout.getNumElements() == (UINT32)remaining.size());
+
+		// Every reported move must start from an existing element of the same size, and each element can only move once
+		Vector<bool> isMoved(remaining.size(), false);
+		Vector<TestAtlasElement> defragmentedElements = remaining;
+		for (auto& move : movedElements)
+		{
+			bool found = false;
+			for (UINT32 i = 0; i < (UINT32)remaining.size(); i++)
+			{
+				const TestAtlasElement& element = remaining[i];
+				if (element.x != move.oldX || element.y != move.oldY)
+					continue;
+
+				BS_TEST_ASSERT(element.width == move.width && element.height == move.height);
+				BS_TEST_ASSERT(!isMoved[i]);
+
+				isMoved[i] = true;
+				defragmentedElements[i].x = move.newX;
+				defragmentedElements[i].y = move.newY;
+				found = true;
+				break;
+			}
+
+			BS_TEST_ASSERT(found);
+			BS_TEST_ASSERT(move.oldX != move.newX || move.oldY != move.newY);
+		}
+
+		// Elements must all be within the atlas and not overlap once the moves have been applied
+		BS_TEST_ASSERT(isLayoutValid(defragmentedElements, layout));
+
+		// Layout must track the elements at the reported positions
+		for (auto& element : defragmentedElements)
+			BS_TEST_ASSERT(layout.removeElement(element.x, element.y));
+
+		BS_TEST_ASSERT(layout.isEmpty());
+	}
+}
@@ -9,7 +9,7 @@ namespace bs
 
 	Time::Time()
 		:mFrameDelta(0.0f), mTimeSinceStart(0.0f), mTimeSinceStartMs(0), mAppStartTime(0), mLastFrameTime(0), 
-		mCurrentFrame(0UL)
+		mFixedFrameDelta(0), mTimeOffset(0), mCurrentFrame(0UL)
 	{
 		mTimer = bs_new<Timer>();
 		mAppStartTime = mTimer->getStartMs();
@@ -23,7 +23,16 @@ namespace bs
 
 	void Time::_update()
 	{
-		UINT64 currentFrameTime = mTimer->getMicroseconds();
+		UINT64 realFrameTime = mTimer->getMicroseconds();
+
+		UINT64 currentFrameTime;
+		if (mFixedFrameDelta > 0)
+		{
+			currentFrameTime = mLastFrameTime + mFixedFrameDelta;
+			mTimeOffset = (INT64)currentFrameTime - (INT64)realFrameTime;
+		}
+		else
+			currentFrameTime = (UINT64)((INT64)realFrameTime + mTimeOffset);
 
 		mFrameDelta = (float)((currentFrameTime - mLastFrameTime) * MICROSEC_TO_SEC);
 		mTimeSinceStartMs = (UINT64)(currentFrameTime / 1000);
@@ -34,6 +43,11 @@ namespace bs
 		mCurrentFrame.fetch_add(1, std::memory_order_relaxed);
 	}
 
+	void Time::_setFixedFrameDelta(float delta)
+	{
+		mFixedFrameDelta = (UINT64)(std::max(delta, 0.0f) / MICROSEC_TO_SEC);
+	}
+
 	UINT64 Time::getTimePrecise() const
 	{
 		return mTimer->getMicroseconds();
@@ -0,0 +1,161 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsTriangleBVH.h"
+#include "BsRay.h"
+
+namespace bs
+{
+	void TriangleBVH::build(const Vector3* positions, UINT32 numVertices, const UINT32* indices, UINT32 numIndices)
+	{
+		mNodes.clear();
+		mVertices.clear();
+		mTriangleIndices.clear();
+
+		UINT32 numTriangles = numIndices / 3;
+		Vector<BuildTriangle> triangles;
+		triangles.reserve(numTriangles);
+
+		for (UINT32 i = 0; i < numTriangles; i++)
+		{
+			UINT32 idx0 = indices[i * 3 + 0];
+			UINT32 idx1 = indices[i * 3 + 1];
+			UINT32 idx2 = indices[i * 3 + 2];
+
+			if (idx0 >= numVertices || idx1 >= numVertices || idx2 >= numVertices)
+				continue;
+
+			BuildTriangle triangle;
+			triangle.bounds = AABox(positions[idx0], positions[idx0]);
+			triangle.bounds.merge(positions[idx1]);
+			triangle.bounds.merge(positions[idx2]);
+			triangle.center = triangle.bounds.getCenter();
+			triangle.index = i;
+
+			triangles.push_back(triangle);
+		}
+
+		if (triangles.empty())
+			return;
+
+		mVertices.reserve(triangles.size() * 3);
+		mTriangleIndices.reserve(triangles.size());
+
+		buildNode(triangles, 0, (UINT32)triangles.size(), 0);
+
+		for (auto& entry : mTriangleIndices)
+		{
+			UINT32 idx = entry * 3;
+
+			mVertices.push_back(positions[indices[idx + 0]]);
+			mVertices.push_back(positions[indices[idx + 1]]);
+			mVertices.push_back(positions[indices[idx + 2]]);
+		}
+	}
+
+	void TriangleBVH::buildNode(Vector<BuildTriangle>& triangles, UINT32 start, UINT32 end, UINT32 depth)
+	{
+		UINT32 nodeIdx = (UINT32)mNodes.size();
+		mNodes.push_back(Node());
+
+		AABox bounds = triangles[start].bounds;
+		AABox centerBounds(triangles[start].center, triangles[start].center);
+		for (UINT32 i = start + 1; i < end; i++)
+		{
+			bounds.merge(triangles[i].bounds);
+			centerBounds.merge(triangles[i].center);
+		}
+
+		mNodes[nodeIdx].bounds = bounds;
+
+		UINT32 count = end - start;
+		if (count <= MAX_LEAF_TRIANGLES || depth >= MAX_DEPTH)
+		{
+			mNodes[nodeIdx].offset = (UINT32)mTriangleIndices.size();
+			mNodes[nodeIdx].numTriangles = count;
+
+			for (UINT32 i = start; i < end; i++)
+				mTriangleIndices.push_back(triangles[i].index);
+
+			return;
+		}
+
+		// Split at the median along the longest axis of the triangle centers
+		Vector3 size = centerBounds.getSize();
+		UINT32 axis = 0;
+		if (size.y > size[axis]) axis = 1;
+		if (size.z > size[axis]) axis = 2;
+
+		UINT32 mid = start + count / 2;
+		std::nth_element(triangles.begin() + start, triangles.begin() + mid, triangles.begin() + end,
+			[axis](const BuildTriangle& a, const BuildTriangle& b)
+		{
+			return a.center[axis] < b.center[axis];
+		});
+
+		buildNode(triangles, start, mid, depth + 1);
+
+		mNodes[nodeIdx].offset = (UINT32)mNodes.size();
+		mNodes[nodeIdx].numTriangles = 0;
+
+		buildNode(triangles, mid, end, depth + 1);
+	}
+
+	bool TriangleBVH::intersects(const Ray& ray, float& distance, Vector3& normal, UINT32& triangleIdx) const
+	{
+		if (mNodes.empty())
+			return false;
+
+		bool hit = false;
+		float closest = std::numeric_limits<float>::max();
+
+		// Each level pushes two children and pops one, so the stack never grows past the maximum depth plus one
+		UINT32 stack[MAX_DEPTH + 2];
+		UINT32 stackSize = 0;
+		stack[stackSize++] = 0;
+
+		while (stackSize > 0)
+		{
+			UINT32 nodeIdx = stack[--stackSize];
+			const Node& node = mNodes[nodeIdx];
+
+			std::pair<bool, float> boundsHit = node.bounds.intersects(ray);
+			if (!boundsHit.first || boundsHit.second > closest)
+				continue;
+
+			if (node.numTriangles == 0)
+			{
+				stack[stackSize++] = node.offset;
+				stack[stackSize++] = nodeIdx + 1;
+				continue;
+			}
+
+			for (UINT32 i = 0; i < node.numTriangles; i++)
+			{
+				UINT32 triIdx = node.offset + i;
+
+				const Vector3& a = mVertices[triIdx * 3 + 0];
+				const Vector3& b = mVertices[triIdx * 3 + 1];
+				const Vector3& c = mVertices[triIdx * 3 + 2];
+
+				Vector3 triNormal = (b - a).cross(c - a);
+				std::pair<bool, float> triHit = ray.intersects(a, b, c, triNormal);
+
+				if (triHit.first && triHit.second < closest)
+				{
+					hit = true;
+					closest = triHit.second;
+					triangleIdx = mTriangleIndices[triIdx];
+
+					normal = Vector3::normalize(triNormal);
+					if (normal.dot(ray.getDirection()) > 0.0f)
+						normal = -normal;
+				}
+			}
+		}
+
+		if (hit)
+			distance = closest;
+
+		return hit;
+	}
+}
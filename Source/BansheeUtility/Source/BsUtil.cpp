@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsPrerequisitesUtil.h"
 #include "ThirdParty/md5.h"
+#include "BsDataStream.h"
 
 namespace bs
 {
@@ -38,4 +39,31 @@ namespace bs
 
 		return String(buf);
 	}
+
+	String md5(const SPtr<DataStream>& stream)
+	{
+		MD5 md5;
+
+		UINT8 chunk[16 * 1024];
+		while (!stream->eof())
+		{
+			size_t numRead = stream->read(chunk, sizeof(chunk));
+			if (numRead == 0)
+				break;
+
+			md5.update(chunk, (UINT32)numRead);
+		}
+
+		md5.finalize();
+
+		UINT8 digest[16];
+		md5.decdigest(digest, sizeof(digest));
+
+		char buf[33];
+		for (int i = 0; i < 16; i++)
+			sprintf(buf + i * 2, "%02x", digest[i]);
+		buf[32] = 0;
+
+		return String(buf);
+	}
 }
\ No newline at end of file
@@ -0,0 +1,15 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsSerializationBenchmarkSuite.h"
+#include "BsUtilityBenchmarkSuite.h"
+
+using namespace bs;
+
+/** Runs the utility benchmarks. See BenchmarkSuite::runFromCommandLine() for supported options. */
+int main(int argc, char* argv[])
+{
+	SPtr<BenchmarkSuite> benchmarks = BenchmarkSuite::create<SerializationBenchmarkSuite>();
+	benchmarks->add(BenchmarkSuite::create<UtilityBenchmarkSuite>());
+
+	return BenchmarkSuite::runFromCommandLine(benchmarks, argc, argv);
+}
@@ -0,0 +1,202 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsUtilityBenchmarkSuite.h"
+#include "BsMatrix4.h"
+#include "BsDegree.h"
+#include "BsFrameAlloc.h"
+#include "BsThreadPool.h"
+#include "BsTaskScheduler.h"
+
+namespace bs
+{
+	static const UINT32 NUM_CULLING_OBJECTS = 1024;
+	static const UINT32 NUM_FRAME_ALLOCATIONS = 256;
+	static const UINT32 NUM_TASKS = 64;
+
+	UtilityBenchmarkSuite::UtilityBenchmarkSuite()
+	{
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchConvexVolumeIntersectsBox);
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchConvexVolumeIntersectsSphere);
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchConvexVolumeIntersectsBoxBatch);
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchConvexVolumeIntersectsSphereBatch);
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchFrameAlloc);
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchTaskScheduler);
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchPathParse);
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchPathToString);
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchPathAppend);
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchStringSplit);
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchStringToLowerCase);
+		BS_ADD_BENCHMARK(UtilityBenchmarkSuite::benchStringNumberConversion);
+	}
+
+	void UtilityBenchmarkSuite::startUp()
+	{
+		Matrix4 projection = Matrix4::projectionPerspective(Degree(90.0f), 16.0f / 9.0f, 0.1f, 100.0f);
+		mFrustum = ConvexVolume(projection);
+
+		// Deterministic spread of objects, roughly half of which are inside the frustum
+		UINT32 state = 12345;
+		auto random = [&state](float min, float max)
+		{
+			state = state * 1664525u + 1013904223u;
+			return min + (max - min) * ((state >> 8) / (float)(1 << 24));
+		};
+
+		mBoxes.resize(NUM_CULLING_OBJECTS);
+		mSpheres.resize(NUM_CULLING_OBJECTS);
+		for (UINT32 i = 0; i < NUM_CULLING_OBJECTS; i++)
+		{
+			Vector3 center(random(-100.0f, 100.0f), random(-100.0f, 100.0f), random(-100.0f, 0.0f));
+			Vector3 halfSize(random(0.1f, 5.0f), random(0.1f, 5.0f), random(0.1f, 5.0f));
+
+			mBoxes[i] = AABox(center - halfSize, center + halfSize);
+			mSpheres[i] = Sphere(center, halfSize.x);
+		}
+
+		mCullingOutput = (bool*)bs_alloc(sizeof(bool) * NUM_CULLING_OBJECTS);
+
+		mFrameAlloc = bs_new<FrameAlloc>();
+
+		mPathString = "C:/Projects/Banshee/Data/Textures/Environment/Ground/GroundAlbedo.png";
+		mPath = mPathString;
+
+		mText = "The Quick Brown Fox\tJumps Over The Lazy Dog\nLorem Ipsum Dolor Sit Amet Consectetur Adipiscing Elit";
+
+		if (!TaskScheduler::isStarted())
+		{
+			ThreadPool::startUp<TThreadPool<ThreadNoPolicy>>(BS_THREAD_HARDWARE_CONCURRENCY + 1);
+			TaskScheduler::startUp();
+
+			mOwnsTaskScheduler = true;
+		}
+	}
+
+	void UtilityBenchmarkSuite::shutDown()
+	{
+		if (mOwnsTaskScheduler)
+		{
+			TaskScheduler::shutDown();
+			ThreadPool::shutDown();
+
+			mOwnsTaskScheduler = false;
+		}
+
+		bs_delete(mFrameAlloc);
+		mFrameAlloc = nullptr;
+
+		bs_free(mCullingOutput);
+		mCullingOutput = nullptr;
+
+		mBoxes.clear();
+		mSpheres.clear();
+	}
+
+	void UtilityBenchmarkSuite::benchConvexVolumeIntersectsBox()
+	{
+		UINT32 numVisible = 0;
+		for (auto& box : mBoxes)
+		{
+			if (mFrustum.intersects(box))
+				numVisible++;
+		}
+
+		doNotOptimize(numVisible);
+	}
+
+	void UtilityBenchmarkSuite::benchConvexVolumeIntersectsSphere()
+	{
+		UINT32 numVisible = 0;
+		for (auto& sphere : mSpheres)
+		{
+			if (mFrustum.intersects(sphere))
+				numVisible++;
+		}
+
+		doNotOptimize(numVisible);
+	}
+
+	void UtilityBenchmarkSuite::benchConvexVolumeIntersectsBoxBatch()
+	{
+		mFrustum.intersects(mBoxes.data(), (UINT32)mBoxes.size(), mCullingOutput);
+		doNotOptimize(mCullingOutput[0]);
+	}
+
+	void UtilityBenchmarkSuite::benchConvexVolumeIntersectsSphereBatch()
+	{
+		mFrustum.intersects(mSpheres.data(), (UINT32)mSpheres.size(), mCullingOutput);
+		doNotOptimize(mCullingOutput[0]);
+	}
+
+	void UtilityBenchmarkSuite::benchFrameAlloc()
+	{
+		mFrameAlloc->markFrame();
+
+		for (UINT32 i = 0; i < NUM_FRAME_ALLOCATIONS; i++)
+		{
+			UINT8* data = mFrameAlloc->alloc(16 + (i % 16) * 16);
+			doNotOptimize(data);
+		}
+
+		mFrameAlloc->clear();
+	}
+
+	void UtilityBenchmarkSuite::benchTaskScheduler()
+	{
+		std::atomic<UINT32> counter(0);
+
+		SPtr<Task> tasks[NUM_TASKS];
+		for (UINT32 i = 0; i < NUM_TASKS; i++)
+		{
+			tasks[i] = Task::create("Benchmark", [&counter]() { counter++; });
+			TaskScheduler::instance().addTask(tasks[i]);
+		}
+
+		for (UINT32 i = 0; i < NUM_TASKS; i++)
+			tasks[i]->wait();
+
+		doNotOptimize(counter);
+	}
+
+	void UtilityBenchmarkSuite::benchPathParse()
+	{
+		Path path(mPathString);
+		doNotOptimize(path);
+	}
+
+	void UtilityBenchmarkSuite::benchPathToString()
+	{
+		String pathString = mPath.toString();
+		doNotOptimize(pathString);
+	}
+
+	void UtilityBenchmarkSuite::benchPathAppend()
+	{
+		Path path = mPath.getParent();
+		path.append("Variants/GroundAlbedoWet.png");
+
+		doNotOptimize(path);
+	}
+
+	void UtilityBenchmarkSuite::benchStringSplit()
+	{
+		Vector<String> words = StringUtil::split(mText);
+		doNotOptimize(words);
+	}
+
+	void UtilityBenchmarkSuite::benchStringToLowerCase()
+	{
+		String text = mText;
+		StringUtil::toLowerCase(text);
+
+		doNotOptimize(text);
+	}
+
+	void UtilityBenchmarkSuite::benchStringNumberConversion()
+	{
+		float total = 0.0f;
+		for (UINT32 i = 0; i < 16; i++)
+			total += parseFloat(toString(i * 1.25f));
+
+		doNotOptimize(total);
+	}
+}
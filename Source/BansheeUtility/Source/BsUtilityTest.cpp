@@ -1,6 +1,10 @@
 //********************************** Banshee Engine (www.banshee3d.com) **************************************************//
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsBinaryDeltaTestSuite.h"
 #include "BsFileSystemTestSuite.h"
+#include "BsMathTestSuite.h"
+#include "BsStringTestSuite.h"
+#include "BsTextureAtlasLayoutTestSuite.h"
 #include "BsConsoleTestOutput.h"
 
 using namespace bs;
@@ -8,6 +12,11 @@ using namespace bs;
 int main()
 {
 	SPtr<TestSuite> tests = FileSystemTestSuite::create<FileSystemTestSuite>();
+	tests->add(MathTestSuite::create<MathTestSuite>());
+	tests->add(TextureAtlasLayoutTestSuite::create<TextureAtlasLayoutTestSuite>());
+	tests->add(BinaryDeltaTestSuite::create<BinaryDeltaTestSuite>());
+	tests->add(StringTestSuite::create<StringTestSuite>());
+
 	ConsoleTestOutput testOutput;
 	tests->run(testOutput);
 
@@ -120,8 +120,13 @@ namespace bs { namespace ct
 		/** Ends command buffer command recording (as started with begin()). */
 		void end();
 
-		/** Begins render pass recording. Must be called within begin()/end() calls. */
-		void beginRenderPass();
+		/** 
+		 * Begins render pass recording. Must be called within begin()/end() calls. 
+		 *
+		 * @param[in]	contents	Determines if the render pass commands will be recorded directly in this buffer, or
+		 *							executed from secondary command buffers. See executeCommands().
+		 */
+		void beginRenderPass(VkSubpassContents contents = VK_SUBPASS_CONTENTS_INLINE);
 
 		/** Ends render pass recording (as started with beginRenderPass(). */
 		void endRenderPass();
@@ -138,6 +143,14 @@ namespace bs { namespace ct
 		 */
 		void submit(VulkanQueue* queue, UINT32 queueIdx, UINT32 syncMask);
 
+		/** 
+		 * Appends the commands recorded in the provided secondary command buffer to this (primary) command buffer. The
+		 * secondary buffer must be done recording, and must have been recorded with the same render target as is
+		 * currently bound on this buffer. Once appended the secondary buffer is owned by this buffer, and will be reset
+		 * together with it.
+		 */
+		void executeCommands(VulkanCmdBuffer& secondary);
+
 		/** Returns the handle to the internal Vulkan command buffer wrapped by this object. */
 		VkCommandBuffer getHandle() const { return mCmdBuffer; }
 
@@ -180,6 +193,9 @@ namespace bs { namespace ct
 		/** Returns true if the command buffer is currently recording a render pass. */
 		bool isInRenderPass() const { return mState == State::RecordingRenderPass; }
 
+		/** Returns true if the command buffer can only be executed as a part of a primary command buffer. */
+		bool isSecondary() const { return mIsSecondary; }
+
 		/** 
 		 * Checks the internal fence if done executing. 
 		 * 
@@ -251,6 +267,10 @@ namespace bs { namespace ct
 		/** 
 		 * Assigns a render target the the command buffer. This render target's framebuffer and render pass will be used
 		 * when beginRenderPass() is called. Command buffer must not be currently recording a render pass.
+		 * 
+		 * Secondary command buffers always record within the render pass of the primary buffer they are executed in, and
+		 * need to know which one that is before they start recording. Therefore their render target must be set before 
+		 * any other commands are recorded, and it can only be set once.
 		 */
 		void setRenderTarget(const SPtr<RenderTarget>& rt, UINT32 readOnlyFlags, RenderSurfaceMask loadMask);
 
@@ -401,6 +421,33 @@ namespace bs { namespace ct
 		/** Marks the command buffer as submitted on a queue. */
 		void setIsSubmitted() { mState = State::Submitted; }
 
+		/** 
+		 * Starts recording on a secondary command buffer, continuing the render pass of the currently bound render
+		 * target, if any. 
+		 */
+		void beginSecondary();
+
+		/** 
+		 * Ends the current render pass if it was started for executing secondary command buffers, and begins a new one
+		 * that allows commands to be recorded directly in this buffer.
+		 */
+		void restartInlineRenderPass();
+
+		/** 
+		 * Makes sure the next render pass loads the current contents of all render target surfaces. Used when a render
+		 * pass needs to be restarted on the same render target.
+		 */
+		void loadRenderTargetContents();
+
+		/** Registers all resources used by the provided secondary command buffer with this command buffer. */
+		void registerSecondaryResources(const VulkanCmdBuffer& secondary);
+
+		/** 
+		 * Notifies all resources registered with this command buffer that they are no longer bound to it, and clears
+		 * the registrations.
+		 */
+		void releaseResources();
+
 		/** Binds the current graphics pipeline to the command buffer. Returns true if bind was successful. */
 		bool bindGraphicsPipeline();
 
@@ -484,6 +531,9 @@ namespace bs { namespace ct
 		bool mStencilRefRequiresBind : 1;
 		bool mScissorRequiresBind : 1;
 		bool mBoundParamsDirty : 1;
+		bool mIsSecondary : 1;
+		bool mSecondaryBegun : 1;
+		bool mSecondaryContents : 1;
 		DescriptorSetBindFlags mDescriptorSetsBindState;
 		SPtr<VulkanGpuParams> mBoundParams;
 
@@ -501,6 +551,7 @@ namespace bs { namespace ct
 		Vector<VulkanEvent*> mQueuedEvents;
 		Vector<VulkanQuery*> mQueuedQueryResets;
 		UnorderedSet<VulkanSwapChain*> mSwapChains;
+		Vector<VulkanCmdBuffer*> mSecondaryBuffers;
 	};
 
 	/** CommandBuffer implementation for Vulkan. */
@@ -515,6 +566,12 @@ namespace bs { namespace ct
 		 */
 		void submit(UINT32 syncMask);
 
+		/** 
+		 * Appends the commands recorded in the provided secondary command buffer to this command buffer. The secondary
+		 * buffer can be used for recording new commands after this call.
+		 */
+		void executeCommands(VulkanCommandBuffer& secondary);
+
 		/** 
 		 * Returns the internal command buffer. 
 		 * 
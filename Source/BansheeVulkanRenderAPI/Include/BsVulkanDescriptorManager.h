@@ -87,7 +87,7 @@ namespace bs { namespace ct
 		/** Attempts to find an existing one, or allocates a new descriptor set layout from the provided set of bindings. */
 		VulkanDescriptorLayout* getLayout(VkDescriptorSetLayoutBinding* bindings, UINT32 numBindings);
 
-		/** Allocates a new empty descriptor set matching the provided layout. */
+		/** Allocates a new empty descriptor set matching the provided layout. Thread safe. */
 		VulkanDescriptorSet* createSet(VulkanDescriptorLayout* layout);
 
 		/** Attempts to find an existing one, or allocates a new pipeline layout based on the provided descriptor layouts. */
@@ -99,6 +99,7 @@ namespace bs { namespace ct
 		UnorderedSet<VulkanLayoutKey> mLayouts; 
 		UnorderedMap<VulkanPipelineLayoutKey, VkPipelineLayout> mPipelineLayouts;
 		Vector<VulkanDescriptorPool*> mPools;
+		Mutex mMutex;
 	};
 
 	/** @} */
@@ -82,10 +82,13 @@ namespace bs { namespace ct
 											  const SPtr<VertexDeclaration>& shaderDecl);
 
 	private:
-		/**	Creates a vertex input using the specified parameters and stores it in the input layout map. */
+		/** 
+		 * Creates a vertex input using the specified parameters and stores it in the input layout map. Caller must hold
+		 * the manager's mutex.
+		 */
 		void addNew(const SPtr<VertexDeclaration>& vbDecl, const SPtr<VertexDeclaration>& shaderDecl);
 
-		/**	Removes the least used vertex input. */
+		/**	Removes the least used vertex input. Caller must hold the manager's mutex. */
 		void removeLeastUsed();
 
 	private:
@@ -75,13 +75,25 @@ namespace bs { namespace ct
 		for(auto& entry : mPools)
 		{
 			PoolInfo& poolInfo = entry.second;
+
+			// Primary buffers reset any secondary buffers they executed when destroyed, so destroy them first
 			for (UINT32 i = 0; i < BS_MAX_VULKAN_CB_PER_QUEUE_FAMILY; i++)
 			{
 				VulkanCmdBuffer* buffer = poolInfo.buffers[i];
 				if (buffer == nullptr)
 					break;
 
+				if (buffer->isSecondary())
+					continue;
+
 				bs_delete(buffer);
+				poolInfo.buffers[i] = nullptr;
+			}
+
+			for (UINT32 i = 0; i < BS_MAX_VULKAN_CB_PER_QUEUE_FAMILY; i++)
+			{
+				if (poolInfo.buffers[i] != nullptr)
+					bs_delete(poolInfo.buffers[i]);
 			}
 
 			vkDestroyCommandPool(mDevice.getLogical(), poolInfo.pool, gVulkanAllocator);
@@ -102,7 +114,7 @@ namespace bs { namespace ct
 			if (buffers[i] == nullptr)
 				break;
 
-			if(buffers[i]->mState == VulkanCmdBuffer::State::Ready)
+			if(buffers[i]->mState == VulkanCmdBuffer::State::Ready && buffers[i]->mIsSecondary == secondary)
 			{
 				buffers[i]->begin();
 				return buffers[i];
@@ -126,7 +138,22 @@ namespace bs { namespace ct
 
 		const PoolInfo& poolInfo = iterFind->second;
 
-		return bs_new<VulkanCmdBuffer>(mDevice, mNextId++, poolInfo.pool, poolInfo.queueFamily, secondary);
+		// Secondary buffers are meant to be recorded on worker threads, while command pools require external 
+		// synchronization. Therefore each secondary buffer gets its own pool, which it destroys along with itself.
+		VkCommandPool pool = poolInfo.pool;
+		if (secondary)
+		{
+			VkCommandPoolCreateInfo poolCI;
+			poolCI.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+			poolCI.pNext = nullptr;
+			poolCI.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+			poolCI.queueFamilyIndex = poolInfo.queueFamily;
+
+			VkResult result = vkCreateCommandPool(mDevice.getLogical(), &poolCI, gVulkanAllocator, &pool);
+			assert(result == VK_SUCCESS);
+		}
+
+		return bs_new<VulkanCmdBuffer>(mDevice, mNextId++, pool, poolInfo.queueFamily, secondary);
 	}
 
 	VulkanCmdBuffer::VulkanCmdBuffer(VulkanDevice& device, UINT32 id, VkCommandPool pool, UINT32 queueFamily, bool secondary)
@@ -137,7 +164,8 @@ namespace bs { namespace ct
 		, mViewport(0.0f, 0.0f, 1.0f, 1.0f), mScissor(0, 0, 0, 0), mStencilRef(0), mDrawOp(DOT_TRIANGLE_LIST)
 		, mNumBoundDescriptorSets(0), mGfxPipelineRequiresBind(true), mCmpPipelineRequiresBind(true)
 		, mViewportRequiresBind(true), mStencilRefRequiresBind(true), mScissorRequiresBind(true), mBoundParamsDirty(false)
-		, mClearValues(), mClearMask(), mSemaphoresTemp(BS_MAX_UNIQUE_QUEUES), mVertexBuffersTemp()
+		, mIsSecondary(secondary), mSecondaryBegun(false), mSecondaryContents(false), mClearValues(), mClearMask()
+		, mSemaphoresTemp(BS_MAX_UNIQUE_QUEUES), mVertexBuffersTemp()
 		, mVertexBufferOffsetsTemp()
 	{
 		UINT32 maxBoundDescriptorSets = device.getDeviceProperties().limits.maxBoundDescriptorSets;
@@ -166,7 +194,8 @@ namespace bs { namespace ct
 	{
 		VkDevice device = mDevice.getLogical();
 
-		if(mState == State::Submitted)
+		// Secondary buffers are never submitted on their own, and their resources were handed over to the primary buffer
+		if(mState == State::Submitted && !mIsSecondary)
 		{
 			// Wait 1s
 			UINT64 waitTime = 1000 * 1000 * 1000;
@@ -222,6 +251,9 @@ namespace bs { namespace ct
 		vkDestroyFence(device, mFence, gVulkanAllocator);
 		vkFreeCommandBuffers(device, mPool, 1, &mCmdBuffer);
 
+		if (mIsSecondary)
+			vkDestroyCommandPool(device, mPool, gVulkanAllocator);
+
 		bs_free(mDescriptorSetsTemp);
 	}
 
@@ -234,6 +266,24 @@ namespace bs { namespace ct
 	{
 		assert(mState == State::Ready);
 
+		// Secondary buffers need to know the render pass they'll be executed in before they start recording, so the
+		// actual begin is delayed until a render target is set (see setRenderTarget())
+		if (mIsSecondary)
+		{
+			// Secondary buffers are never submitted, so clear the state left over from their previous use here instead
+			mGraphicsPipeline = nullptr;
+			mComputePipeline = nullptr;
+			mGfxPipelineRequiresBind = true;
+			mCmpPipelineRequiresBind = true;
+			mFramebuffer = nullptr;
+			mDescriptorSetsBindState = DescriptorSetBindFlag::Graphics | DescriptorSetBindFlag::Compute;
+			mQueuedLayoutTransitions.clear();
+			mBoundParams = nullptr;
+
+			mState = State::Recording;
+			return;
+		}
+
 		VkCommandBufferBeginInfo beginInfo;
 		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
 		beginInfo.pNext = nullptr;
@@ -248,11 +298,22 @@ namespace bs { namespace ct
 
 	void VulkanCmdBuffer::end()
 	{
-		assert(mState == State::Recording);
+		if (mIsSecondary)
+		{
+			// Render pass (if any) belongs to the primary buffer, and clears are always executed as attachment clears
+			assert(mState == State::Recording || mState == State::RecordingRenderPass);
 
-		// If a clear is queued, execute the render pass with no additional instructions
-		if (mClearMask)
-			executeClearPass();
+			if (!mSecondaryBegun)
+				beginSecondary();
+		}
+		else
+		{
+			assert(mState == State::Recording);
+
+			// If a clear is queued, execute the render pass with no additional instructions
+			if (mClearMask)
+				executeClearPass();
+		}
 
 		VkResult result = vkEndCommandBuffer(mCmdBuffer);
 		assert(result == VK_SUCCESS);
@@ -260,9 +321,44 @@ namespace bs { namespace ct
 		mState = State::RecordingDone;
 	}
 
-	void VulkanCmdBuffer::beginRenderPass()
+	void VulkanCmdBuffer::beginSecondary()
 	{
-		assert(mState == State::Recording);
+		assert(mIsSecondary && !mSecondaryBegun);
+
+		VkCommandBufferInheritanceInfo inheritanceInfo;
+		inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+		inheritanceInfo.pNext = nullptr;
+		inheritanceInfo.renderPass = VK_NULL_HANDLE;
+		inheritanceInfo.subpass = 0;
+		inheritanceInfo.framebuffer = VK_NULL_HANDLE;
+		inheritanceInfo.occlusionQueryEnable = VK_FALSE;
+		inheritanceInfo.queryFlags = 0;
+		inheritanceInfo.pipelineStatistics = 0;
+
+		VkCommandBufferBeginInfo beginInfo;
+		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		beginInfo.pNext = nullptr;
+		beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+		beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+		// The exact render pass variant the primary buffer will use isn't known yet, but any compatible render pass can be
+		// provided here. Load/store operations and layouts don't affect compatibility, so the default variant is used.
+		if (mFramebuffer != nullptr)
+		{
+			inheritanceInfo.renderPass = mFramebuffer->getRenderPass(RT_NONE, RT_NONE, CLEAR_NONE);
+			beginInfo.flags |= VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+		}
+
+		VkResult result = vkBeginCommandBuffer(mCmdBuffer, &beginInfo);
+		assert(result == VK_SUCCESS);
+
+		mSecondaryBegun = true;
+		mState = mFramebuffer != nullptr ? State::RecordingRenderPass : State::Recording;
+	}
+
+	void VulkanCmdBuffer::beginRenderPass(VkSubpassContents contents)
+	{
+		assert(mState == State::Recording && !mIsSecondary);
 
 		if (mFramebuffer == nullptr)
 		{
@@ -333,15 +429,16 @@ namespace bs { namespace ct
 		renderPassBeginInfo.clearValueCount = mFramebuffer->getNumClearEntries(mClearMask);
 		renderPassBeginInfo.pClearValues = mClearValues.data();
 
-		vkCmdBeginRenderPass(mCmdBuffer, &renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
+		vkCmdBeginRenderPass(mCmdBuffer, &renderPassBeginInfo, contents);
 
 		mClearMask = CLEAR_NONE;
+		mSecondaryContents = contents == VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS;
 		mState = State::RecordingRenderPass;
 	}
 
 	void VulkanCmdBuffer::endRenderPass()
 	{
-		assert(mState == State::RecordingRenderPass);
+		assert(mState == State::RecordingRenderPass && !mIsSecondary);
 
 		vkCmdEndRenderPass(mCmdBuffer);
 
@@ -364,9 +461,26 @@ namespace bs { namespace ct
 
 		updateFinalLayouts();
 
+		mSecondaryContents = false;
 		mState = State::Recording;
 	}
 
+	void VulkanCmdBuffer::restartInlineRenderPass()
+	{
+		if (!isInRenderPass() || !mSecondaryContents)
+			return;
+
+		endRenderPass();
+		loadRenderTargetContents();
+		beginRenderPass();
+	}
+
+	void VulkanCmdBuffer::loadRenderTargetContents()
+	{
+		mRenderTargetLoadMask = RT_ALL | RT_DEPTH;
+		registerResource(mFramebuffer, mRenderTargetLoadMask, VulkanUseFlag::Write);
+	}
+
 	void VulkanCmdBuffer::allocateSemaphores(VkSemaphore* semaphores)
 	{
 		if (mIntraQueueSemaphore != nullptr)
@@ -709,6 +823,109 @@ namespace bs { namespace ct
 		mSwapChains.clear();
 	}
 
+	void VulkanCmdBuffer::executeCommands(VulkanCmdBuffer& secondary)
+	{
+		assert(!mIsSecondary && secondary.mIsSecondary && secondary.isReadyForSubmit());
+		assert(mState == State::Recording || mState == State::RecordingRenderPass);
+
+		if (mFramebuffer == nullptr || secondary.mFramebuffer != mFramebuffer)
+		{
+			LOGERR("Cannot execute a secondary command buffer that was recorded for a different render target than the "
+				"one currently bound.");
+
+			secondary.reset();
+			return;
+		}
+
+		// Commands recorded directly in this buffer and secondary buffers can't be mixed in the same render pass
+		bool loadContents = false;
+		if (isInRenderPass() && !mSecondaryContents)
+		{
+			endRenderPass();
+			loadContents = true;
+		}
+
+		// Take over the resources used by the secondary buffer, so their layout transitions, queue ownership and lifetime
+		// are handled as if the commands were recorded in this buffer
+		bool wasInRenderPass = isInRenderPass();
+		registerSecondaryResources(secondary);
+
+		// Registration might require layout transitions, or a switch to read-only attachments, which can only happen
+		// between render passes. Ending the render pass resets per-pass image state, so register again after.
+		if (wasInRenderPass && (!isInRenderPass() || !mQueuedLayoutTransitions.empty()))
+		{
+			if (isInRenderPass())
+				endRenderPass();
+
+			registerSecondaryResources(secondary);
+			loadContents = true;
+		}
+
+		if (!isInRenderPass())
+		{
+			if (loadContents)
+				loadRenderTargetContents();
+
+			beginRenderPass(VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+		}
+
+		VkCommandBuffer secondaryHandle = secondary.getHandle();
+		vkCmdExecuteCommands(mCmdBuffer, 1, &secondaryHandle);
+
+		secondary.releaseResources();
+		secondary.setIsSubmitted();
+
+		mSecondaryBuffers.push_back(&secondary);
+	}
+
+	void VulkanCmdBuffer::registerSecondaryResources(const VulkanCmdBuffer& secondary)
+	{
+		for (auto& entry : secondary.mImages)
+		{
+			VulkanImage* image = static_cast<VulkanImage*>(entry.first);
+			const ImageInfo& imageInfo = secondary.mImageInfos[entry.second];
+
+			const ImageSubresourceInfo* subresourceInfos = &secondary.mSubresourceInfos[imageInfo.subresourceInfoIdx];
+			for (UINT32 i = 0; i < imageInfo.numSubresourceInfos; i++)
+			{
+				// Secondary buffers never execute layout transitions, so the required layout is the one they expect
+				const ImageSubresourceInfo& subresourceInfo = subresourceInfos[i];
+				registerResource(image, subresourceInfo.range, subresourceInfo.requiredLayout, subresourceInfo.finalLayout,
+					imageInfo.useHandle.flags, subresourceInfo.isFBAttachment);
+			}
+		}
+
+		for (auto& entry : secondary.mBuffers)
+		{
+			const BufferInfo& bufferInfo = entry.second;
+			registerResource(static_cast<VulkanBuffer*>(entry.first), bufferInfo.accessFlags, bufferInfo.useHandle.flags);
+		}
+
+		for (auto& entry : secondary.mResources)
+			registerResource(entry.first, entry.second.flags);
+
+		mSwapChains.insert(secondary.mSwapChains.begin(), secondary.mSwapChains.end());
+	}
+
+	void VulkanCmdBuffer::releaseResources()
+	{
+		for (auto& entry : mResources)
+			entry.first->notifyUnbound();
+
+		for (auto& entry : mImages)
+			entry.first->notifyUnbound();
+
+		for (auto& entry : mBuffers)
+			entry.first->notifyUnbound();
+
+		mResources.clear();
+		mImages.clear();
+		mBuffers.clear();
+		mImageInfos.clear();
+		mSubresourceInfos.clear();
+		mSwapChains.clear();
+	}
+
 	bool VulkanCmdBuffer::checkFenceStatus(bool block) const
 	{
 		VkResult result = vkWaitForFences(mDevice.getLogical(), 1, &mFence, true, block ? 1'000'000'000 : 0);
@@ -722,8 +939,14 @@ namespace bs { namespace ct
 		bool wasSubmitted = mState == State::Submitted;
 
 		mState = State::Ready;
+		mSecondaryBegun = false;
 		vkResetCommandBuffer(mCmdBuffer, VK_COMMAND_BUFFER_RESET_RELEASE_RESOURCES_BIT); // Note: Maybe better not to release resources?
 
+		for (auto& entry : mSecondaryBuffers)
+			entry->reset();
+
+		mSecondaryBuffers.clear();
+
 		if (wasSubmitted)
 		{
 			for (auto& entry : mResources)
@@ -800,10 +1023,21 @@ namespace bs { namespace ct
 			newFB = nullptr;
 		}
 
-		if (mFramebuffer == newFB && mRenderTargetReadOnlyFlags == readOnlyFlags && mRenderTargetLoadMask == loadMask)
+		bool needsBegin = mIsSecondary && !mSecondaryBegun;
+		if (!needsBegin && mFramebuffer == newFB && mRenderTargetReadOnlyFlags == readOnlyFlags && 
+			mRenderTargetLoadMask == loadMask)
 			return;
 
-		if (isInRenderPass())
+		if (mIsSecondary)
+		{
+			if (!needsBegin)
+			{
+				LOGERR("Render target of a secondary command buffer can only be set once, before any other commands are "
+					"recorded.");
+				return;
+			}
+		}
+		else if (isInRenderPass())
 			endRenderPass();
 		else
 		{
@@ -839,6 +1073,9 @@ namespace bs { namespace ct
 			registerResource(mFramebuffer, loadMask, VulkanUseFlag::Write);
 
 		mGfxPipelineRequiresBind = true;
+
+		if (needsBegin)
+			beginSecondary();
 	}
 
 	void VulkanCmdBuffer::clearViewport(const Rect2I& area, UINT32 buffers, const Color& color, float depth, UINT16 stencil,
@@ -847,6 +1084,8 @@ namespace bs { namespace ct
 		if (buffers == 0 || mFramebuffer == nullptr)
 			return;
 
+		restartInlineRenderPass();
+
 		// Add clear command if currently in render pass
 		if (isInRenderPass())
 		{
@@ -1099,6 +1338,14 @@ namespace bs { namespace ct
 		if (numBuffers == 0)
 			return;
 
+		if (mIsSecondary && !mSecondaryBegun)
+		{
+			LOGERR("A render target must be set on a secondary command buffer before recording any commands.");
+			return;
+		}
+
+		restartInlineRenderPass();
+
 		for(UINT32 i = 0; i < numBuffers; i++)
 		{
 			VulkanVertexBuffer* vertexBuffer = static_cast<VulkanVertexBuffer*>(buffers[i].get());
@@ -1124,6 +1371,14 @@ namespace bs { namespace ct
 
 	void VulkanCmdBuffer::setIndexBuffer(const SPtr<IndexBuffer>& buffer)
 	{
+		if (mIsSecondary && !mSecondaryBegun)
+		{
+			LOGERR("A render target must be set on a secondary command buffer before recording any commands.");
+			return;
+		}
+
+		restartInlineRenderPass();
+
 		VulkanIndexBuffer* indexBuffer = static_cast<VulkanIndexBuffer*>(buffer.get());
 
 		VkBuffer vkBuffer = VK_NULL_HANDLE;
@@ -1392,6 +1647,8 @@ namespace bs { namespace ct
 		if (!isReadyForRender())
 			return;
 
+		restartInlineRenderPass();
+
 		// Note: Must begin render pass before binding GPU params as some GPU param related data gets cleared on begin, and
 		// we don't want to clear the currently used one
 		if (!isInRenderPass())
@@ -1429,6 +1686,8 @@ namespace bs { namespace ct
 		if (!isReadyForRender())
 			return;
 
+		restartInlineRenderPass();
+
 		// Note: Must begin render pass before binding GPU params as some GPU param related data gets cleared on begin, and
 		// we don't want to clear the currently used one
 		if (!isInRenderPass())
@@ -1466,6 +1725,12 @@ namespace bs { namespace ct
 		if (mComputePipeline == nullptr)
 			return;
 
+		if (mIsSecondary && isInRenderPass())
+		{
+			LOGERR("Dispatch commands cannot be recorded on a secondary command buffer with a bound render target.");
+			return;
+		}
+
 		bindGpuParams();
 
 		if (isInRenderPass())
@@ -1684,8 +1949,9 @@ namespace bs { namespace ct
 						bool requiresReadOnlyFB = updateSubresourceInfo(res, imageInfoIdx, subresources[i], newLayout,
 																		finalLayout, flags, isFBAttachment);
 
-						// If we need to switch frame-buffers, end current render pass
-						if (requiresReadOnlyFB && isInRenderPass())
+						// If we need to switch frame-buffers, end current render pass (secondary buffers don't own the
+						// render pass, the primary buffer will handle the switch when executing them)
+						if (requiresReadOnlyFB && isInRenderPass() && !mIsSecondary)
 							endRenderPass();
 
 						foundRange = true;
@@ -1980,8 +2246,9 @@ namespace bs { namespace ct
 			}
 		}
 
-		// If we need to switch frame-buffers, end current render pass
-		if (requiresReadOnlyFB && isInRenderPass())
+		// If we need to switch frame-buffers, end current render pass (secondary buffers don't own the render pass, the
+		// primary buffer will handle the switch when executing them)
+		if (requiresReadOnlyFB && isInRenderPass() && !mIsSecondary)
 			endRenderPass();
 		else 
 		{
@@ -2077,12 +2344,22 @@ namespace bs { namespace ct
 		VulkanCmdBufferPool& pool = mDevice.getCmdBufferPool();
 
 		if (mBuffer != nullptr)
-			assert(mBuffer->isSubmitted());
+			assert(mBuffer->isSubmitted() || mBuffer->mState == VulkanCmdBuffer::State::Ready);
 
 		UINT32 queueFamily = mDevice.getQueueFamily(mType);
 		mBuffer = pool.getBuffer(queueFamily, mIsSecondary);
 	}
 
+	void VulkanCommandBuffer::executeCommands(VulkanCommandBuffer& secondary)
+	{
+		VulkanCmdBuffer* secondaryBuffer = secondary.mBuffer;
+		if (secondaryBuffer->isRecording() || secondaryBuffer->isInRenderPass())
+			secondaryBuffer->end();
+
+		mBuffer->executeCommands(*secondaryBuffer);
+		secondary.acquireNewBuffer();
+	}
+
 	void VulkanCommandBuffer::submit(UINT32 syncMask)
 	{
 		// Ignore myself
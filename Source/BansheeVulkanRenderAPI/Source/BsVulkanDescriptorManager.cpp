@@ -119,6 +119,9 @@ namespace bs { namespace ct
 		// a major resource waste.
 		VkDescriptorSetLayout setLayout = layout->getHandle();
 
+		// Sets can be allocated from multiple threads when recording command buffers in parallel
+		Lock lock(mMutex);
+
 		VkDescriptorSetAllocateInfo allocateInfo;
 		allocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
 		allocateInfo.pNext = nullptr;
@@ -57,7 +57,7 @@ namespace bs { namespace ct
 
 		if (options == GBL_READ_WRITE || options == GBL_WRITE_ONLY || options == GBL_WRITE_ONLY_DISCARD || options == GBL_WRITE_ONLY_NO_OVERWRITE)
 		{
-			BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuBuffer);
+			BS_ADD_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuBuffer, length);
 		}
 #endif
 
@@ -81,7 +81,7 @@ namespace bs { namespace ct
 	{
 		mBuffer->writeData(offset, length, source, writeFlags, queueIdx);
 
-		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuBuffer);
+		BS_ADD_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuBuffer, length);
 	}
 
 	void VulkanGpuBuffer::copyData(HardwareBuffer& srcBuffer, UINT32 srcOffset, UINT32 dstOffset, UINT32 length, 
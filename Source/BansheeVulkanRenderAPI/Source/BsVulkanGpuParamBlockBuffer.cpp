@@ -34,7 +34,7 @@ namespace bs { namespace ct
 	{
 		mBuffer->writeData(0, mSize, data, BWT_DISCARD, queueIdx);
 
-		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuParamBuffer);
+		BS_ADD_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuParamBuffer, mSize);
 	}
 
 	VulkanBuffer* VulkanGpuParamBlockBuffer::getResource(UINT32 deviceIdx) const
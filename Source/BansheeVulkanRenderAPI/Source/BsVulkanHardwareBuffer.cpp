@@ -85,7 +85,7 @@ namespace bs { namespace ct
 		UINT32 size, GpuDeviceFlags deviceMask)
 		: HardwareBuffer(size), mBuffers(), mStagingBuffer(nullptr), mStagingMemory(nullptr), mMappedDeviceIdx(-1)
 		, mMappedGlobalQueueIdx(-1), mMappedOffset(0), mMappedSize(0), mMappedLockOptions(GBL_WRITE_ONLY)
-		, mDirectlyMappable((usage & GBU_DYNAMIC) != 0), mSupportsGPUWrites(type == BT_STORAGE), mRequiresView(false)
+		, mDirectlyMappable((usage & (GBU_DYNAMIC | GBU_CPUREADABLE)) != 0), mSupportsGPUWrites(type == BT_STORAGE), mRequiresView(false)
 		, mIsMapped(false)
 	{
 		VkBufferUsageFlags usageFlags = 0;
@@ -273,6 +273,8 @@ namespace bs { namespace ct
 		GpuProgramManager::instance().addFactory(mGLSLFactory);
 
 		initCapabilites();
+
+		RenderStats::instance().setResourceTypeName(RenderStatObject_PipelineState, "PipelineState");
 		
 		RenderAPI::initialize();
 	}
@@ -528,7 +530,18 @@ namespace bs { namespace ct
 
 	void VulkanRenderAPI::addCommands(const SPtr<CommandBuffer>& commandBuffer, const SPtr<CommandBuffer>& secondary)
 	{
-		BS_EXCEPT(NotImplementedException, "Secondary command buffers not implemented");
+		THROW_IF_NOT_CORE_THREAD;
+
+		VulkanCommandBuffer* cb = getCB(commandBuffer);
+		VulkanCommandBuffer* secondaryCB = static_cast<VulkanCommandBuffer*>(secondary.get());
+
+		if (secondaryCB == nullptr || !secondaryCB->isSecondary() || cb->isSecondary())
+		{
+			LOGERR("Commands can only be added from a secondary command buffer into a primary command buffer.");
+			return;
+		}
+
+		cb->executeCommands(*secondaryCB);
 	}
 
 	void VulkanRenderAPI::submitCommandBuffer(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask)
@@ -564,7 +577,8 @@ namespace bs { namespace ct
 								  RenderAPIFeatureFlag::NDCYAxisDown |
 								  RenderAPIFeatureFlag::ColumnMajorMatrices |
 								  RenderAPIFeatureFlag::MultiThreadedCB |
-								  RenderAPIFeatureFlag::MSAAImageStores);
+								  RenderAPIFeatureFlag::MSAAImageStores |
+								  RenderAPIFeatureFlag::ParallelCBRecording);
 
 		return info;
 	}
@@ -41,7 +41,7 @@ namespace bs { namespace ct
 		Lock lock(mMutex);
 		assert(useFlags != VulkanUseFlag::None);
 
-		if(isUsed() && mState == State::Normal) // Used without support for concurrency
+		if(mNumUsedHandles > 0 && mState == State::Normal) // Used without support for concurrency
 		{
 			assert(mQueueFamily == queueFamily &&
 				"Vulkan resource without concurrency support can only be used by one queue family at once.");
@@ -85,7 +85,7 @@ namespace bs { namespace ct
 				mWriteUses[globalQueueIdx]--;
 			}
 
-			destroy = !isBound() && mState == State::Destroyed; // Queued for destruction
+			destroy = mNumBoundHandles == 0 && mState == State::Destroyed; // Queued for destruction
 		}
 
 		// (Safe to check outside of mutex as we guarantee that once queued for destruction, state cannot be changed)
@@ -100,7 +100,7 @@ namespace bs { namespace ct
 			Lock lock(mMutex);
 			mNumBoundHandles--;
 
-			destroy = !isBound() && mState == State::Destroyed; // Queued for destruction
+			destroy = mNumBoundHandles == 0 && mState == State::Destroyed; // Queued for destruction
 		}
 
 		// (Safe to check outside of mutex as we guarantee that once queued for destruction, state cannot be changed)
@@ -143,7 +143,7 @@ namespace bs { namespace ct
 			mState = State::Destroyed;
 
 			// If not bound anyhwere, destroy right away, otherwise check when it is reported as finished on the device
-			destroy = !isBound();
+			destroy = mNumBoundHandles == 0;
 		}
 
 		// (Safe to check outside of mutex as we guarantee that once queued for destruction, state cannot be changed)
@@ -130,6 +130,8 @@ namespace bs { namespace ct
 
 	VkImageView VulkanImage::getView(const TextureSurface& surface, bool framebuffer) const
 	{
+		Lock lock(mMutex);
+
 		for(auto& entry : mImageInfos)
 		{
 			if (surface.mipLevel == entry.surface.mipLevel &&
@@ -978,6 +980,10 @@ namespace bs { namespace ct
 			return PixelData();
 		}
 
+		UINT32 mipWidth = std::max(1u, props.getWidth() >> mipLevel);
+		UINT32 mipHeight = std::max(1u, props.getHeight() >> mipLevel);
+		UINT32 mipDepth = std::max(1u, props.getDepth() >> mipLevel);
+
 #if BS_PROFILING_ENABLED
 		if (options == GBL_READ_ONLY || options == GBL_READ_WRITE)
 		{
@@ -986,14 +992,11 @@ namespace bs { namespace ct
 
 		if (options == GBL_READ_WRITE || options == GBL_WRITE_ONLY || options == GBL_WRITE_ONLY_DISCARD || options == GBL_WRITE_ONLY_NO_OVERWRITE)
 		{
-			BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_Texture);
+			BS_ADD_RENDER_STAT_CAT(ResWrite, RenderStatObject_Texture,
+				PixelUtil::getMemorySize(mipWidth, mipHeight, mipDepth, props.getFormat()));
 		}
 #endif
 
-		UINT32 mipWidth = std::max(1u, props.getWidth() >> mipLevel);
-		UINT32 mipHeight = std::max(1u, props.getHeight() >> mipLevel);
-		UINT32 mipDepth = std::max(1u, props.getDepth() >> mipLevel);
-
 		PixelData lockedArea(mipWidth, mipHeight, mipDepth, mInternalFormats[deviceIdx]);
 
 		VulkanImage* image = mImages[deviceIdx];
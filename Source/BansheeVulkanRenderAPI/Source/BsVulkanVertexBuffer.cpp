@@ -36,7 +36,7 @@ namespace bs { namespace ct
 
 		if (options == GBL_READ_WRITE || options == GBL_WRITE_ONLY || options == GBL_WRITE_ONLY_DISCARD || options == GBL_WRITE_ONLY_NO_OVERWRITE)
 		{
-			BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_VertexBuffer);
+			BS_ADD_RENDER_STAT_CAT(ResWrite, RenderStatObject_VertexBuffer, length);
 		}
 #endif
 
@@ -60,7 +60,7 @@ namespace bs { namespace ct
 	{
 		mBuffer->writeData(offset, length, source, writeFlags, queueIdx);
 
-		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_VertexBuffer);
+		BS_ADD_RENDER_STAT_CAT(ResWrite, RenderStatObject_VertexBuffer, length);
 	}
 
 	void VulkanVertexBuffer::copyData(HardwareBuffer& srcBuffer, UINT32 srcOffset,
@@ -54,7 +54,7 @@ namespace bs { namespace ct
 	SPtr<VulkanVertexInput> VulkanVertexInputManager::getVertexInfo(
 		const SPtr<VertexDeclaration>& vbDecl, const SPtr<VertexDeclaration>& shaderDecl)
 	{
-		Lock(mMutex);
+		Lock lock(mMutex);
 
 		VertexDeclarationKey pair;
 		pair.bufferDeclId = vbDecl->getId();
@@ -182,7 +182,6 @@ namespace bs { namespace ct
 		pair.bufferDeclId = vbDecl->getId();
 		pair.shaderDeclId = shaderInputDecl->getId();
 
-		Lock(mMutex);
 		newEntry.vertexInput = bs_shared_ptr_new<VulkanVertexInput>(mNextId++, vertexInputCI);
 		newEntry.lastUsedIdx = ++mLastUsedCounter;
 
@@ -191,8 +190,6 @@ namespace bs { namespace ct
 
 	void VulkanVertexInputManager::removeLeastUsed()
 	{
-		Lock(mMutex);
-
 		if (!mWarningShown)
 		{
 			LOGWRN("Vertex input buffer is full, pruning last " + toString(NUM_ELEMENTS_TO_PRUNE) + " elements. This is "
@@ -62,7 +62,8 @@ namespace BansheeEditor
         }
 
         /// <summary>
-        /// Attempts to select a scene object in the specified area.
+        /// Attempts to select a scene object in the specified area. The selection is applied once the picking results 
+        /// are read back from the GPU, usually a frame or two later.
         /// </summary>
         /// <param name="pointerPos">Position of the pointer relative to the scene camera viewport.</param>
         /// <param name="area">Size of the in which objects will be selected, in pixels and relative to 
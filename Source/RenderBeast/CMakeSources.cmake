@@ -16,6 +16,11 @@ set(BS_RENDERBEAST_INC_NOFILTER
 	"Include/BsShadowRendering.h"
 	"Include/BsRendererScene.h"
 	"Include/BsStandardDeferredLighting.h"
+	"Include/BsRenderGraph.h"
+)
+
+set(BS_RENDERBEAST_INC_TESTING
+	"Include/BsRenderBeastTestSuite.h"
 )
 
 set(BS_RENDERBEAST_SRC_NOFILTER
@@ -35,12 +40,21 @@ set(BS_RENDERBEAST_SRC_NOFILTER
 	"Source/BsShadowRendering.cpp"
 	"Source/BsRendererScene.cpp"
 	"Source/BsStandardDeferredLighting.cpp"
+	"Source/BsRenderGraph.cpp"
+)
+
+set(BS_RENDERBEAST_SRC_TESTING
+	"Source/BsRenderBeastTestSuite.cpp"
 )
 
 source_group("Header Files" FILES ${BS_RENDERBEAST_INC_NOFILTER})
 source_group("Source Files" FILES ${BS_RENDERBEAST_SRC_NOFILTER})
+source_group("Header Files\\Testing" FILES ${BS_RENDERBEAST_INC_TESTING})
+source_group("Source Files\\Testing" FILES ${BS_RENDERBEAST_SRC_TESTING})
 
 set(BS_RENDERBEAST_SRC
 	${BS_RENDERBEAST_INC_NOFILTER}
 	${BS_RENDERBEAST_SRC_NOFILTER}
+	${BS_RENDERBEAST_INC_TESTING}
+	${BS_RENDERBEAST_SRC_TESTING}
 )
\ No newline at end of file
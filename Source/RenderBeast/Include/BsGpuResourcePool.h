@@ -14,8 +14,98 @@ namespace bs { namespace ct
 	 */
 
 	class GpuResourcePool;
-	struct POOLED_RENDER_TEXTURE_DESC;
-	struct POOLED_STORAGE_BUFFER_DESC;
+
+	/** Structure used for creating a new pooled render texture. */
+	struct POOLED_RENDER_TEXTURE_DESC
+	{
+	public:
+		POOLED_RENDER_TEXTURE_DESC() {}
+
+		/**
+		 * Creates a descriptor for a two dimensional render texture.
+		 *
+		 * @param[in]	format		Pixel format used by the texture surface.
+		 * @param[in]	width		Width of the render texture, in pixels.
+		 * @param[in]	height		Height of the render texture, in pixels.
+		 * @param[in]	usage		Usage flags that control in which way is the texture going to be used.
+		 * @param[in]	samples		If higher than 1, texture containing multiple samples per pixel is created.
+		 * @param[in]	hwGamma		Should the written pixels be gamma corrected.
+		 * @param[in]	arraySize	Number of textures in a texture array. Specify 1 for no array.
+		 * @return					Descriptor that is accepted by RenderTexturePool.
+		 */
+		static POOLED_RENDER_TEXTURE_DESC create2D(PixelFormat format, UINT32 width, UINT32 height, 
+			INT32 usage = TU_STATIC, UINT32 samples = 0, bool hwGamma = false, UINT32 arraySize = 1);
+
+		/**
+		 * Creates a descriptor for a three dimensional render texture.
+		 *
+		 * @param[in]	format		Pixel format used by the texture surface.
+		 * @param[in]	width		Width of the render texture, in pixels.
+		 * @param[in]	height		Height of the render texture, in pixels.
+		 * @param[in]	depth		Depth of the render texture, in pixels.
+		 * @param[in]	usage		Usage flags that control in which way is the texture going to be used.
+		 * @return					Descriptor that is accepted by RenderTexturePool.
+		 */
+		static POOLED_RENDER_TEXTURE_DESC create3D(PixelFormat format, UINT32 width, UINT32 height, UINT32 depth,
+			INT32 usage = TU_STATIC);
+
+		/**
+		 * Creates a descriptor for a cube render texture.
+		 *
+		 * @param[in]	format		Pixel format used by the texture surface.
+		 * @param[in]	width		Width of the render texture, in pixels.
+		 * @param[in]	height		Height of the render texture, in pixels.
+		 * @param[in]	usage		Usage flags that control in which way is the texture going to be used.
+		 * @param[in]	arraySize	Number of textures in a texture array. Specify 1 for no array.
+		 * @return					Descriptor that is accepted by RenderTexturePool.
+		 */
+		static POOLED_RENDER_TEXTURE_DESC createCube(PixelFormat format, UINT32 width, UINT32 height,
+			INT32 usage = TU_STATIC, UINT32 arraySize = 1);
+
+	private:
+		friend class GpuResourcePool;
+
+		UINT32 width;
+		UINT32 height;
+		UINT32 depth;
+		UINT32 numSamples;
+		PixelFormat format;
+		TextureUsage flag;
+		TextureType type;
+		bool hwGamma;
+		UINT32 arraySize;
+	};
+
+	/** Structure used for describing a pooled storage buffer. */
+	struct POOLED_STORAGE_BUFFER_DESC
+	{
+	public:
+		POOLED_STORAGE_BUFFER_DESC() {}
+
+		/**
+		 * Creates a descriptor for a storage buffer containing primitive data types.
+		 *
+		 * @param[in]	format		Format of individual buffer entries.
+		 * @param[in]	numElements	Number of elements in the buffer.
+		 */
+		static POOLED_STORAGE_BUFFER_DESC createStandard(GpuBufferFormat format, UINT32 numElements);
+
+		/**
+		 * Creates a descriptor for a storage buffer containing structures.
+		 *
+		 * @param[in]	elementSize		Size of a single structure in the buffer.
+		 * @param[in]	numElements		Number of elements in the buffer.
+		 */
+		static POOLED_STORAGE_BUFFER_DESC createStructured(UINT32 elementSize, UINT32 numElements);
+
+	private:
+		friend class GpuResourcePool;
+
+		GpuBufferType type;
+		GpuBufferFormat format;
+		UINT32 numElements;
+		UINT32 elementSize;
+	};
 
 	/**	Contains data about a single render texture in the GPU resource pool. */
 	struct PooledRenderTexture
@@ -31,6 +121,8 @@ namespace bs { namespace ct
 
 		GpuResourcePool* mPool;
 		bool mIsFree;
+		size_t mDescHash;
+		POOLED_RENDER_TEXTURE_DESC mDesc;
 	};
 
 	/**	Contains data about a single storage buffer in the GPU resource pool. */
@@ -46,6 +138,8 @@ namespace bs { namespace ct
 
 		GpuResourcePool* mPool;
 		bool mIsFree;
+		size_t mDescHash;
+		POOLED_STORAGE_BUFFER_DESC mDesc;
 	};
 
 	/** 
@@ -55,7 +149,7 @@ namespace bs { namespace ct
 	class GpuResourcePool : public Module<GpuResourcePool>
 	{
 	public:
-		~GpuResourcePool();
+		virtual ~GpuResourcePool();
 
 		/**
 		 * Attempts to find the unused render texture with the specified parameters in the pool, or creates a new texture
@@ -93,6 +187,13 @@ namespace bs { namespace ct
 		 */
 		void release(const SPtr<PooledStorageBuffer>& buffer);
 
+	protected:
+		/** Creates the GPU texture (and the render texture, if required) for a newly pooled texture. */
+		virtual void allocate(PooledRenderTexture& texture, const POOLED_RENDER_TEXTURE_DESC& desc);
+
+		/** Creates the GPU buffer for a newly pooled buffer. */
+		virtual void allocate(PooledStorageBuffer& buffer, const POOLED_STORAGE_BUFFER_DESC& desc);
+
 	private:
 		friend struct PooledRenderTexture;
 		friend struct PooledStorageBuffer;
@@ -110,115 +211,35 @@ namespace bs { namespace ct
 		void _unregisterBuffer(PooledStorageBuffer* buffer);
 
 		/**
-		 * Checks does the provided texture match the parameters.
+		 * Checks do two texture descriptors describe the same texture.
 		 * 
-		 * @param[in]	desc	Descriptor structure that describes what kind of texture to match.
-		 * @return				True if the texture matches the descriptor, false otherwise.
+		 * @param[in]	a	First descriptor to compare.
+		 * @param[in]	b	Second descriptor to compare.
+		 * @return			True if a texture created from one descriptor can be used in place of the other.
 		 */
-		static bool matches(const SPtr<Texture>& texture, const POOLED_RENDER_TEXTURE_DESC& desc);
+		static bool matches(const POOLED_RENDER_TEXTURE_DESC& a, const POOLED_RENDER_TEXTURE_DESC& b);
 
 		/**
-		 * Checks does the provided buffer match the parameters.
+		 * Checks do two buffer descriptors describe the same buffer.
 		 * 
-		 * @param[in]	desc	Descriptor structure that describes what kind of buffer to match.
-		 * @return				True if the buffer matches the descriptor, false otherwise.
+		 * @param[in]	a	First descriptor to compare.
+		 * @param[in]	b	Second descriptor to compare.
+		 * @return			True if a buffer created from one descriptor can be used in place of the other.
 		 */
-		static bool matches(const SPtr<GpuBuffer>& buffer, const POOLED_STORAGE_BUFFER_DESC& desc);
+		static bool matches(const POOLED_STORAGE_BUFFER_DESC& a, const POOLED_STORAGE_BUFFER_DESC& b);
 
-		Map<PooledRenderTexture*, std::weak_ptr<PooledRenderTexture>> mTextures;
-		Map<PooledStorageBuffer*, std::weak_ptr<PooledStorageBuffer>> mBuffers;
-	};
-
-	/** Structure used for creating a new pooled render texture. */
-	struct POOLED_RENDER_TEXTURE_DESC
-	{
-	public:
-		POOLED_RENDER_TEXTURE_DESC() {}
+		/** Generates a hash from the texture descriptor. Textures with the same hash are stored in the same free list. */
+		static size_t getHash(const POOLED_RENDER_TEXTURE_DESC& desc);
 
-		/**
-		 * Creates a descriptor for a two dimensional render texture.
-		 *
-		 * @param[in]	format		Pixel format used by the texture surface.
-		 * @param[in]	width		Width of the render texture, in pixels.
-		 * @param[in]	height		Height of the render texture, in pixels.
-		 * @param[in]	usage		Usage flags that control in which way is the texture going to be used.
-		 * @param[in]	samples		If higher than 1, texture containing multiple samples per pixel is created.
-		 * @param[in]	hwGamma		Should the written pixels be gamma corrected.
-		 * @param[in]	arraySize	Number of textures in a texture array. Specify 1 for no array.
-		 * @return					Descriptor that is accepted by RenderTexturePool.
-		 */
-		static POOLED_RENDER_TEXTURE_DESC create2D(PixelFormat format, UINT32 width, UINT32 height, 
-			INT32 usage = TU_STATIC, UINT32 samples = 0, bool hwGamma = false, UINT32 arraySize = 1);
+		/** Generates a hash from the buffer descriptor. Buffers with the same hash are stored in the same free list. */
+		static size_t getHash(const POOLED_STORAGE_BUFFER_DESC& desc);
 
-		/**
-		 * Creates a descriptor for a three dimensional render texture.
-		 *
-		 * @param[in]	format		Pixel format used by the texture surface.
-		 * @param[in]	width		Width of the render texture, in pixels.
-		 * @param[in]	height		Height of the render texture, in pixels.
-		 * @param[in]	depth		Depth of the render texture, in pixels.
-		 * @param[in]	usage		Usage flags that control in which way is the texture going to be used.
-		 * @return					Descriptor that is accepted by RenderTexturePool.
-		 */
-		static POOLED_RENDER_TEXTURE_DESC create3D(PixelFormat format, UINT32 width, UINT32 height, UINT32 depth,
-			INT32 usage = TU_STATIC);
-
-		/**
-		 * Creates a descriptor for a cube render texture.
-		 *
-		 * @param[in]	format		Pixel format used by the texture surface.
-		 * @param[in]	width		Width of the render texture, in pixels.
-		 * @param[in]	height		Height of the render texture, in pixels.
-		 * @param[in]	usage		Usage flags that control in which way is the texture going to be used.
-		 * @param[in]	arraySize	Number of textures in a texture array. Specify 1 for no array.
-		 * @return					Descriptor that is accepted by RenderTexturePool.
-		 */
-		static POOLED_RENDER_TEXTURE_DESC createCube(PixelFormat format, UINT32 width, UINT32 height,
-			INT32 usage = TU_STATIC, UINT32 arraySize = 1);
-
-	private:
-		friend class GpuResourcePool;
-
-		UINT32 width;
-		UINT32 height;
-		UINT32 depth;
-		UINT32 numSamples;
-		PixelFormat format;
-		TextureUsage flag;
-		TextureType type;
-		bool hwGamma;
-		UINT32 arraySize;
-	};
-
-	/** Structure used for describing a pooled storage buffer. */
-	struct POOLED_STORAGE_BUFFER_DESC
-	{
-	public:
-		POOLED_STORAGE_BUFFER_DESC() {}
-
-		/**
-		 * Creates a descriptor for a storage buffer containing primitive data types.
-		 *
-		 * @param[in]	format		Format of individual buffer entries.
-		 * @param[in]	numElements	Number of elements in the buffer.
-		 */
-		static POOLED_STORAGE_BUFFER_DESC createStandard(GpuBufferFormat format, UINT32 numElements);
-
-		/**
-		 * Creates a descriptor for a storage buffer containing structures.
-		 *
-		 * @param[in]	elementSize		Size of a single structure in the buffer.
-		 * @param[in]	numElements		Number of elements in the buffer.
-		 */
-		static POOLED_STORAGE_BUFFER_DESC createStructured(UINT32 elementSize, UINT32 numElements);
-
-	private:
-		friend class GpuResourcePool;
+		Map<PooledRenderTexture*, std::weak_ptr<PooledRenderTexture>> mTextures;
+		Map<PooledStorageBuffer*, std::weak_ptr<PooledStorageBuffer>> mBuffers;
 
-		GpuBufferType type;
-		GpuBufferFormat format;
-		UINT32 numElements;
-		UINT32 elementSize;
+		// Released resources, grouped by the hash of the descriptor they were created with, for fast lookup
+		UnorderedMap<size_t, Vector<PooledRenderTexture*>> mFreeTextures;
+		UnorderedMap<size_t, Vector<PooledStorageBuffer*>> mFreeBuffers;
 	};
 
 	/** @} */
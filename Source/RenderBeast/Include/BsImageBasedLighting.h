@@ -46,12 +46,14 @@ namespace bs { namespace ct
 		/** Returns the number of reflection probes in the probe buffer. */
 		UINT32 getNumProbes() const { return mNumProbes; }
 
+		/** Returns a CPU copy of the data in the probe buffer. */
+		const Vector<ReflProbeData>& getProbeData() const { return mReflProbeData; }
+
 	private:
 		SPtr<GpuBuffer> mProbeBuffer;
 		UINT32 mNumProbes;
 
-		// Helper to avoid memory allocations
-		Vector<ReflProbeData> mReflProbeDataTemp;
+		Vector<ReflProbeData> mReflProbeData;
 	};
 
 	BS_PARAM_BLOCK_BEGIN(ReflProbeParamsParamDef)
@@ -11,6 +11,8 @@ namespace bs { namespace ct
 {
 	class VisibleReflProbeData;
 	class VisibleLightData;
+	struct LightData;
+	struct ReflProbeData;
 
 	/** @addtogroup RenderBeast
 	 *  @{
@@ -118,6 +120,112 @@ namespace bs { namespace ct
 		Vector3I mGridSize;
 	};
 
+	/** Information about the view required for assigning lights to light grid cells on the CPU. */
+	struct LightGridViewInfo
+	{
+		Matrix4 viewTransform;
+		Matrix4 projTransform;
+		Matrix4 invProjTransform;
+		Vector2 nearFar;
+
+		/** Values used for converting view space depth to NDC depth, as returned by RendererView::getNDCZToViewZ(). */
+		Vector2 NDCZToViewZ;
+	};
+
+	/** 
+	 * Assigns lights and reflection probes to light grid cells on the CPU. Produces output in the same format as 
+	 * LightGridLLReductionMat, so it can be used on devices that don't support compute shaders. 
+	 *
+	 * Cells are tested against bounding spheres four at a time using the wrappers in BsSIMD.h, with view space bounds 
+	 * stored in structure of arrays format. Spot lights that pass the sphere test are then tested against their cone.
+	 * Depth slices of the grid are distributed between worker threads.
+	 */
+	class LightGridCPU
+	{
+	public:
+		/**
+		 * Assigns lights and reflection probes to grid cells. Blocks until assignment is done.
+		 *
+		 * @param[in]	gridSize		Number of cells in the grid, along each dimension.
+		 * @param[in]	maxPerCell		Maximum number of lights or probes that can be assigned to a single cell.
+		 * @param[in]	view			Information about the view the grid is generated for.
+		 * @param[in]	lights			Light data, as stored in the lights GPU buffer.
+		 * @param[in]	lightCounts		Number of lights per type (directional, radial, spot), as stored in @p lights.
+		 * @param[in]	probes			Reflection probe data, as stored in the probes GPU buffer.
+		 * @param[in]	numProbes		Number of entries in @p probes.
+		 */
+		void assign(const Vector3I& gridSize, UINT32 maxPerCell, const LightGridViewInfo& view, const LightData* lights, 
+			const Vector3I& lightCounts, const ReflProbeData* probes, UINT32 numProbes);
+
+		/** 
+		 * Returns per-cell light offsets and counts, four values per cell: offset into the light indices array, number of 
+		 * radial lights, number of spot lights, and an unused value. 
+		 */
+		const Vector<UINT32>& getLightOffsetsAndSize() const { return mLightOffsetsAndSize; }
+
+		/** Returns indices of lights in each cell. Radial lights of a cell are placed before its spot lights. */
+		const Vector<UINT32>& getLightIndices() const { return mLightIndices; }
+
+		/** 
+		 * Returns per-cell reflection probe offsets and counts, two values per cell: offset into the probe indices array, 
+		 * and number of probes.
+		 */
+		const Vector<UINT32>& getProbeOffsetsAndSize() const { return mProbeOffsetsAndSize; }
+
+		/** Returns indices of reflection probes in each cell. */
+		const Vector<UINT32>& getProbeIndices() const { return mProbeIndices; }
+
+		/** Calculates the view space axis aligned bounds of a single grid cell. */
+		static void calcCellBounds(const Vector3I& gridSize, const LightGridViewInfo& view, const Vector3I& cell, 
+			Vector3& center, Vector3& extent);
+
+	private:
+		/** Bounding spheres (and optionally cones) in view space, stored as arrays padded to a multiple of four. */
+		struct BoundsSoA
+		{
+			/** Resizes the arrays so they can hold @p count elements, padded to a multiple of four. */
+			void resize(UINT32 count, bool cones);
+
+			Vector<float> x, y, z, radius;
+			Vector<float> tipX, tipY, tipZ, dirX, dirY, dirZ, cosAngle, sinAngle, range;
+
+			UINT32 count = 0;
+		};
+
+		/** 
+		 * Assigns lights and probes to cells in the provided range of depth slices. Indices are written to scratch
+		 * buffers, with each cell reserving @p maxPerCell entries.
+		 */
+		void assignSlices(UINT32 startZ, UINT32 endZ);
+
+		/** 
+		 * Tests the bounding box against the provided bounds and appends indices of all intersecting entries to 
+		 * @p output. Returns the number of appended entries, up to @p maxCount.
+		 */
+		static UINT32 findIntersecting(const Vector3& center, const Vector3& extent, const BoundsSoA& bounds,
+			bool testCones, UINT32 indexOffset, UINT32* output, UINT32 maxCount);
+
+		Vector3I mGridSize;
+		UINT32 mMaxPerCell = 0;
+		LightGridViewInfo mView;
+
+		UINT32 mRadialOffset = 0;
+		UINT32 mSpotOffset = 0;
+		BoundsSoA mRadialBounds;
+		BoundsSoA mSpotBounds;
+		BoundsSoA mProbeBounds;
+
+		Vector<UINT32> mLightCountsTemp;
+		Vector<UINT32> mLightIndicesTemp;
+		Vector<UINT32> mProbeCountsTemp;
+		Vector<UINT32> mProbeIndicesTemp;
+
+		Vector<UINT32> mLightOffsetsAndSize;
+		Vector<UINT32> mLightIndices;
+		Vector<UINT32> mProbeOffsetsAndSize;
+		Vector<UINT32> mProbeIndices;
+	};
+
 	/**	
 	 * Helper class that is used for generating a grid in view space, whose cells contain information about lights 
 	 * affecting them. Used for forward rendering. 
@@ -131,6 +239,12 @@ namespace bs { namespace ct
 		void updateGrid(const RendererView& view, const VisibleLightData& lightData, const VisibleReflProbeData& probeData, 
 			bool noLighting);
 
+		/** 
+		 * Determines should lights be assigned to grid cells on the CPU, instead of on the GPU. The CPU path is always 
+		 * used if the render API doesn't support compute shaders.
+		 */
+		void setUseCPU(bool useCPU) { mUseCPU = useCPU; }
+
 		/** 
 		 * Returns the buffers containing light indices per grid cell and global grid parameters. 
 		 *
@@ -152,10 +266,23 @@ namespace bs { namespace ct
 			SPtr<GpuParamBlockBuffer>& gridParams) const;
 
 	private:
+		/** Creates or resizes the buffers used for storing the output of the CPU assignment path. */
+		void createCPUBuffers(UINT32 numCells);
+
 		LightGridLLCreationMat mLLCreationMat;
 		LightGridLLReductionMat mLLReductionMat;
 
 		SPtr<GpuParamBlockBuffer> mGridParamBuffer;
+
+		bool mUseCPU = false;
+		bool mLastUpdateOnCPU = false;
+		LightGridCPU mCPUAssignment;
+
+		SPtr<GpuBuffer> mCPULightOffsetsAndSize;
+		SPtr<GpuBuffer> mCPULightIndices;
+		SPtr<GpuBuffer> mCPUProbeOffsetsAndSize;
+		SPtr<GpuBuffer> mCPUProbeIndices;
+		UINT32 mCPUBufferNumCells = 0;
 	};
 
 	/** @} */
@@ -113,6 +113,12 @@ namespace bs { namespace ct
 
 		/** Returns a list of all visible lights of the specified type. */
 		const Vector<const RendererLight*>& getLights(LightType type) const { return mVisibleLights[(UINT32)type]; }
+
+		/** 
+		 * Returns a CPU copy of the data in the lights buffer. Lights are ordered the same as in the GPU buffer, by type
+		 * first, directional lights followed by radial and then spot lights.
+		 */
+		const Vector<LightData>& getLightData() const { return mLightData; }
 	private:
 		SPtr<GpuBuffer> mLightBuffer;
 
@@ -121,9 +127,7 @@ namespace bs { namespace ct
 
 		// These are rebuilt every call to setLights()
 		Vector<const RendererLight*> mVisibleLights[(UINT32)LightType::Count];
-
-		// Helpers to avoid memory allocations
-		Vector<LightData> mLightDataTemp;
+		Vector<LightData> mLightData;
 	};
 
 	BS_PARAM_BLOCK_BEGIN(TiledLightingParamDef)
@@ -6,6 +6,7 @@
 #include "BsRendererMaterial.h"
 #include "BsParamBlocks.h"
 #include "BsGpuResourcePool.h"
+#include "BsRenderGraph.h"
 #include "BsStandardPostProcessSettings.h"
 
 namespace bs { namespace ct
@@ -20,9 +21,6 @@ namespace bs { namespace ct
 		SPtr<StandardPostProcessSettings> settings;
 		bool settingDirty = true;
 
-		SPtr<PooledRenderTexture> downsampledSceneTex;
-		SPtr<PooledRenderTexture> histogramTex;
-		SPtr<PooledRenderTexture> histogramReduceTex;
 		SPtr<PooledRenderTexture> eyeAdaptationTex[2];
 		SPtr<PooledRenderTexture> colorLUT;
 		INT32 lastEyeAdaptationTex = 0;
@@ -43,19 +41,16 @@ namespace bs { namespace ct
 		DownsampleMat();
 
 		/** Renders the post-process effect with the provided parameters. */
-		void execute(const SPtr<Texture>& target, PostProcessInfo& ppInfo);
+		void execute(const SPtr<Texture>& input, const SPtr<RenderTexture>& output);
 
-		/** Releases the output render target. */
-		void release(PostProcessInfo& ppInfo);
+		/** Returns the descriptor of the texture the effect should output to, when downsampling the provided texture. */
+		static POOLED_RENDER_TEXTURE_DESC getOutputDesc(const SPtr<Texture>& input);
 
-		/** Returns the render texture where the output will be written. */
-		SPtr<RenderTexture> getOutput() const { return mOutput; }
+		/** Returns the size of the texture the effect outputs to, when downsampling the provided texture. */
+		static Vector2I getOutputSize(const SPtr<Texture>& input);
 	private:
 		SPtr<GpuParamBlockBuffer> mParamBuffer;
 		GpuParamTexture mInputTexture;
-
-		POOLED_RENDER_TEXTURE_DESC mOutputDesc;
-		SPtr<RenderTexture> mOutput;
 	};
 
 	BS_PARAM_BLOCK_BEGIN(EyeAdaptHistogramParamDef)
@@ -75,16 +70,13 @@ namespace bs { namespace ct
 		EyeAdaptHistogramMat();
 
 		/** Executes the post-process effect with the provided parameters. */
-		void execute(PostProcessInfo& ppInfo);
-
-		/** Releases the output render target. */
-		void release(PostProcessInfo& ppInfo);
+		void execute(const SPtr<Texture>& input, const SPtr<Texture>& output, const PostProcessInfo& ppInfo);
 
-		/** Returns the render texture where the output was written. */
-		SPtr<RenderTexture> getOutput() const { return mOutput; }
+		/** Returns the descriptor of the texture the effect should output to, when processing a texture of the provided size. */
+		static POOLED_RENDER_TEXTURE_DESC getOutputDesc(UINT32 inputWidth, UINT32 inputHeight);
 
-		/** Calculates the number of thread groups that need to execute to cover the provided render target. */
-		static Vector2I getThreadGroupCount(const SPtr<RenderTexture>& target);
+		/** Calculates the number of thread groups that need to execute to cover a texture of the provided size. */
+		static Vector2I getThreadGroupCount(UINT32 width, UINT32 height);
 
 		/** 
 		 * Returns a vector containing scale and offset (in that order) that will be applied to luminance values
@@ -101,9 +93,6 @@ namespace bs { namespace ct
 		GpuParamTexture mSceneColor;
 		GpuParamLoadStoreTexture mOutputTex;
 
-		POOLED_RENDER_TEXTURE_DESC mOutputDesc;
-		SPtr<RenderTexture> mOutput;
-
 		static const UINT32 LOOP_COUNT_X = 8;
 		static const UINT32 LOOP_COUNT_Y = 8;
 	};
@@ -122,22 +111,24 @@ namespace bs { namespace ct
 	public:
 		EyeAdaptHistogramReduceMat();
 
-		/** Executes the post-process effect with the provided parameters. */
-		void execute(PostProcessInfo& ppInfo);
-
-		/** Releases the output render target. */
-		void release(PostProcessInfo& ppInfo);
+		/** 
+		 * Executes the post-process effect with the provided parameters. 
+		 *
+		 * @param[in]	sceneColor	Downsampled scene color texture the histogram was generated from.
+		 * @param[in]	histogram	Histogram texture output by EyeAdaptHistogramMat.
+		 * @param[in]	output		Render target to write the reduced histogram to.
+		 * @param[in]	ppInfo		Post-processing information for the current view.
+		 */
+		void execute(const SPtr<Texture>& sceneColor, const SPtr<Texture>& histogram, 
+			const SPtr<RenderTexture>& output, const PostProcessInfo& ppInfo);
 
-		/** Returns the render texture where the output was written. */
-		SPtr<RenderTexture> getOutput() const { return mOutput; }
+		/** Returns the descriptor of the texture the effect should output to. */
+		static POOLED_RENDER_TEXTURE_DESC getOutputDesc();
 	private:
 		SPtr<GpuParamBlockBuffer> mParamBuffer;
 
 		GpuParamTexture mHistogramTex;
 		GpuParamTexture mEyeAdaptationTex;
-
-		POOLED_RENDER_TEXTURE_DESC mOutputDesc;
-		SPtr<RenderTexture> mOutput;
 	};
 
 	BS_PARAM_BLOCK_BEGIN(EyeAdaptationParamDef)
@@ -154,8 +145,14 @@ namespace bs { namespace ct
 	public:
 		EyeAdaptationMat();
 
-		/** Executes the post-process effect with the provided parameters. */
-		void execute(PostProcessInfo& ppInfo, float frameDelta);
+		/** 
+		 * Executes the post-process effect with the provided parameters. Output is written to the eye adaptation texture 
+		 * in @p ppInfo, which must be allocated before calling.
+		 */
+		void execute(const SPtr<Texture>& reducedHistogram, PostProcessInfo& ppInfo, float frameDelta);
+
+		/** Returns the descriptor of the texture the effect outputs to. */
+		static POOLED_RENDER_TEXTURE_DESC getOutputDesc();
 	private:
 		SPtr<GpuParamBlockBuffer> mParamBuffer;
 		GpuParamTexture mReducedHistogramTex;
@@ -191,11 +188,14 @@ namespace bs { namespace ct
 	public:
 		CreateTonemapLUTMat();
 
-		/** Executes the post-process effect with the provided parameters. */
+		/** 
+		 * Executes the post-process effect with the provided parameters. Output is written to the color LUT texture in
+		 * @p ppInfo, which must be allocated before calling.
+		 */
 		void execute(PostProcessInfo& ppInfo);
 
-		/** Releases the output render target. */
-		void release(PostProcessInfo& ppInfo);
+		/** Returns the descriptor of the texture the effect outputs to. */
+		static POOLED_RENDER_TEXTURE_DESC getOutputDesc();
 
 		/** Size of the 3D color lookup table. */
 		static const UINT32 LUT_SIZE = 32;
@@ -250,6 +250,8 @@ namespace bs { namespace ct
 		void postProcess(RendererView* viewInfo, const SPtr<Texture>& sceneColor, float frameDelta);
 		
 	private:
+		RenderGraph mRenderGraph;
+
 		DownsampleMat mDownsample;
 		EyeAdaptHistogramMat mEyeAdaptHistogram;
 		EyeAdaptHistogramReduceMat mEyeAdaptHistogramReduce;
@@ -12,6 +12,7 @@
 #include "BsRendererView.h"
 #include "BsRendererObject.h"
 #include "BsRendererScene.h"
+#include "BsInputSampler.h"
 
 namespace bs 
 { 
@@ -130,12 +131,24 @@ namespace bs
 		/**
 		 * Performs rendering over all camera proxies.
 		 *
-		 * @param[in]	time	Current frame time in milliseconds.
-		 * @param[in]	delta	Time elapsed since the last frame.
+		 * @param[in]	time			Current frame time in milliseconds.
+		 * @param[in]	delta			Time elapsed since the last frame.
+		 * @param[in]	inputSampler	Sampler polling input on a separate thread, if any. Used for late latching look
+		 *								input.
+		 * @param[in]	consumedLook	Look input totals that were processed by the simulation thread for this frame.
 		 *
 		 * @note	Core thread only.
 		 */
-		void renderAllCore(float time, float delta);
+		void renderAllCore(float time, float delta, const SPtr<InputSampler>& inputSampler, 
+			const LookInput& consumedLook);
+
+		/**
+		 * Rotates views of cameras with late latching enabled by the look input received since the simulation thread
+		 * processed input for this frame.
+		 *
+		 * @note	Core thread only.
+		 */
+		void applyLateLatchedInput(const LookInput& lookDelta);
 
 		/**
 		 * Renders all views in the provided view group.
@@ -165,9 +178,32 @@ namespace bs
 		 * @param[in]	passIdx		Index of the material pass to render the element with.
 		 * @param[in]	bindPass	If true the material pass will be bound for rendering, if false it is assumed it is
 		 *							already bound.
-		 * @param[in]	viewProj	View projection matrix of the camera the element is being rendered with.
+		 * @param[in]	viewProj		View projection matrix of the camera the element is being rendered with.
+		 * @param[in]	commandBuffer	Optional command buffer to record the element into. If not provided the element
+		 *								is rendered immediately.
+		 */
+		void renderElement(const BeastRenderableElement& element, UINT32 passIdx, bool bindPass, const Matrix4& viewProj,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
+
+		/**
+		 * Renders all elements of a sorted render queue. If enabled in the options and supported by the render API, large
+		 * queues are split into ranges that are recorded into secondary command buffers on worker threads, and then
+		 * executed in the original order.
+		 *
+		 * @param[in]	elements		Sorted render queue elements to render.
+		 * @param[in]	viewProj		View projection matrix of the camera the elements are being rendered with.
+		 * @param[in]	target			Render target the elements are rendered to. Must be the currently bound target.
+		 * @param[in]	readOnlyFlags	Read-only flags the target was bound with.
+		 */
+		void renderQueue(const Vector<RenderQueueElement>& elements, const Matrix4& viewProj, 
+			const SPtr<RenderTarget>& target, UINT32 readOnlyFlags);
+
+		/** 
+		 * Records render queue elements in range [@p start, @p end) into the provided command buffer. The pass of the
+		 * first element is always bound.
 		 */
-		void renderElement(const BeastRenderableElement& element, UINT32 passIdx, bool bindPass, const Matrix4& viewProj);
+		void recordQueueRange(const Vector<RenderQueueElement>& elements, UINT32 start, UINT32 end, 
+			const Matrix4& viewProj, const SPtr<CommandBuffer>& commandBuffer);
 
 		/** 
 		 * Captures the scene at the specified location into a cubemap. 
@@ -228,6 +264,7 @@ namespace bs
 
 		// Helpers to avoid memory allocations
 		RendererViewGroup mMainViewGroup;
+		UnorderedMap<const Texture*, float> mTextureUsage;
 
 		// Sim thread only fields
 		SPtr<RenderBeastOptions> mOptions;
@@ -51,6 +51,25 @@ namespace bs { namespace ct
 		 * quality shadows. Valid range is [1, 4].
 		 */
 		UINT32 shadowFilteringQuality = 4;
+
+		/**
+		 * If true, lights and reflection probes are assigned to light grid cells used for forward rendering on the CPU,
+		 * instead of through compute shaders. CPU assignment is always used if the render API doesn't support compute
+		 * shaders.
+		 */
+		bool cpuLightGrid = false;
+
+		/**
+		 * If true, large render queues are recorded into command buffers on multiple threads, as long as the render API
+		 * supports it. Otherwise all draw calls are issued from the core thread.
+		 */
+		bool parallelRecording = true;
+
+		/**
+		 * Minimum number of render queue elements recorded by a single thread when #parallelRecording is enabled. Queues
+		 * smaller than twice this value are always recorded on the core thread.
+		 */
+		UINT32 minElementsPerRecordingThread = 256;
 	};
 
 	/** @} */
@@ -0,0 +1,26 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsRenderBeastPrerequisites.h"
+#include "BsTestSuite.h"
+
+namespace bs { namespace ct
+{
+	/** Tests renderer systems that can run without a render API. */
+	class RenderBeastTestSuite : public TestSuite
+	{
+	public:
+		RenderBeastTestSuite();
+
+	protected:
+		void startUp() override;
+		void shutDown() override;
+
+	private:
+		void testRenderGraphAliasing();
+		void testLightGridAssignment();
+
+		bool mOwnsTaskScheduler = false;
+	};
+}}
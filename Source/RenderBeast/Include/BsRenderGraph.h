@@ -0,0 +1,165 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsRenderBeastPrerequisites.h"
+#include "BsGpuResourcePool.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup RenderBeast
+	 *  @{
+	 */
+
+	class RenderGraph;
+
+	/** Identifies a texture or a buffer registered with a RenderGraph. */
+	struct RenderGraphResource
+	{
+		RenderGraphResource() {}
+		explicit RenderGraphResource(UINT32 id) :id(id) {}
+
+		/** Checks does the handle point to a registered resource. */
+		bool isValid() const { return id != (UINT32)-1; }
+
+		UINT32 id = (UINT32)-1;
+	};
+
+	/** Callback that performs the rendering operations of a single render graph pass. */
+	typedef std::function<void(const RenderGraph&)> RenderGraphPassCallback;
+
+	/**
+	 * Describes rendering operations for a single frame as a set of passes, where each pass declares which resources it
+	 * reads from and writes to. Once all the passes have been registered, the graph:
+	 *  - Culls passes whose outputs are not used by any other pass, unless they write to imported resources or are
+	 *    marked as having side effects.
+	 *  - Determines the lifetime of each transient resource, as the range between the first and the last pass using it.
+	 *  - Allocates transient resources right before their first use and returns them to the GpuResourcePool right after
+	 *    their last use, so resources with non-overlapping lifetimes end up sharing the same GPU memory.
+	 *
+	 * The pool only holds weak references to the resources it hands out, so the graph keeps released transient resources
+	 * alive itself. Resources not requested by the graph for MAX_UNUSED_EXECUTIONS executions are freed.
+	 *
+	 * @note	Core thread only.
+	 */
+	class RenderGraph
+	{
+		/** Number of executions after which an unused transient resource is no longer kept alive by the graph. */
+		static const UINT32 MAX_UNUSED_EXECUTIONS = 8;
+
+		/** Information about a single resource used by the graph. */
+		struct ResourceInfo
+		{
+			String name;
+			bool isTexture = true;
+			bool isImported = false;
+
+			POOLED_RENDER_TEXTURE_DESC textureDesc;
+			POOLED_STORAGE_BUFFER_DESC bufferDesc;
+
+			SPtr<PooledRenderTexture> texture;
+			SPtr<PooledStorageBuffer> buffer;
+
+			UINT32 firstPass = (UINT32)-1;
+			UINT32 lastPass = (UINT32)-1;
+		};
+
+		/** Information about a single pass registered with the graph. */
+		struct PassInfo
+		{
+			String name;
+			Vector<UINT32> reads;
+			Vector<UINT32> writes;
+			RenderGraphPassCallback callback;
+			bool hasSideEffects = false;
+			bool isCulled = false;
+		};
+
+		/** Transient resource kept alive by the graph after it has been returned to the pool. */
+		template<class T>
+		struct RetainedResource
+		{
+			SPtr<T> resource;
+			UINT64 lastUsed;
+		};
+
+	public:
+		/**
+		 * Registers a transient texture with the graph. The texture will only be allocated while passes that use it
+		 * are executing.
+		 */
+		RenderGraphResource createTexture(const String& name, const POOLED_RENDER_TEXTURE_DESC& desc);
+
+		/**
+		 * Registers a transient storage buffer with the graph. The buffer will only be allocated while passes that use it
+		 * are executing.
+		 */
+		RenderGraphResource createBuffer(const String& name, const POOLED_STORAGE_BUFFER_DESC& desc);
+
+		/**
+		 * Registers a texture whose lifetime is managed outside of the graph. Such textures are considered externally
+		 * visible, meaning passes that write to them are never culled.
+		 */
+		RenderGraphResource importTexture(const String& name, const SPtr<PooledRenderTexture>& texture);
+
+		/**
+		 * Registers a buffer whose lifetime is managed outside of the graph. Such buffers are considered externally
+		 * visible, meaning passes that write to them are never culled.
+		 */
+		RenderGraphResource importBuffer(const String& name, const SPtr<PooledStorageBuffer>& buffer);
+
+		/**
+		 * Registers a new pass with the graph. Passes are executed in the order they are registered in.
+		 *
+		 * @param[in]	name			Name of the pass, used for identification during debugging.
+		 * @param[in]	reads			Resources the pass reads from.
+		 * @param[in]	writes			Resources the pass writes to.
+		 * @param[in]	callback		Callback that performs the rendering operations of the pass. Resources can be
+		 *								retrieved from the provided graph through getTexture() and getBuffer().
+		 * @param[in]	hasSideEffects	If true, the pass will never be culled, even if none of the resources it writes to
+		 *								are used. Use this for passes that write to targets not registered with the graph.
+		 */
+		void addPass(const String& name, const Vector<RenderGraphResource>& reads,
+			const Vector<RenderGraphResource>& writes, const RenderGraphPassCallback& callback,
+			bool hasSideEffects = false);
+
+		/**
+		 * Culls unused passes, determines resource lifetimes and executes all the remaining passes. All passes and
+		 * resources are unregistered once done, so the graph can be rebuilt for the next frame.
+		 */
+		void execute();
+
+		/** Returns the texture for the provided resource. Only valid during execution of a pass that uses it. */
+		const SPtr<PooledRenderTexture>& getTexture(RenderGraphResource resource) const;
+
+		/** Returns the buffer for the provided resource. Only valid during execution of a pass that uses it. */
+		const SPtr<PooledStorageBuffer>& getBuffer(RenderGraphResource resource) const;
+
+		/** Returns the number of passes that were culled during the last call to execute(). */
+		UINT32 getNumCulledPasses() const { return mNumCulledPasses; }
+
+	private:
+		/** Marks passes that don't contribute to any externally visible resource as culled. */
+		void cullPasses();
+
+		/** Calculates the range of passes each resource is used in. */
+		void calculateLifetimes();
+
+		/** Returns a transient resource to the pool and keeps it alive so the pool can hand it out again. */
+		void release(ResourceInfo& resource);
+
+		/** Unregisters all passes and resources, releasing any transient resources that are still allocated. */
+		void clear();
+
+		Vector<ResourceInfo> mResources;
+		Vector<PassInfo> mPasses;
+
+		UnorderedMap<PooledRenderTexture*, RetainedResource<PooledRenderTexture>> mRetainedTextures;
+		UnorderedMap<PooledStorageBuffer*, RetainedResource<PooledStorageBuffer>> mRetainedBuffers;
+
+		UINT64 mNumExecutions = 0;
+		UINT32 mNumCulledPasses = 0;
+	};
+
+	/** @} */
+}}
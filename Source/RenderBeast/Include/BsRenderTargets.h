@@ -68,6 +68,9 @@ namespace bs { namespace ct
 		/**	Binds the GBuffer render target for rendering. */
 		void bindGBuffer();
 
+		/** Returns the render target bound by bindGBuffer(). */
+		SPtr<RenderTexture> getGBufferRT() const;
+
 		/**	Returns the first color texture of the gbuffer as a bindable texture. */
 		SPtr<Texture> getGBufferA() const;
 
@@ -80,6 +83,9 @@ namespace bs { namespace ct
 		/**	Binds the scene color render target for rendering. */
 		void bindSceneColor(bool readOnlyDepthStencil);
 
+		/** Returns the render target bound by bindSceneColor(). */
+		SPtr<RenderTexture> getSceneColorRT() const;
+
 		/** Binds the light accumulation render target for rendering. */
 		void bindLightAccumulation();
 
@@ -21,6 +21,7 @@ namespace bs { namespace ct
 		BS_PARAM_BLOCK_ENTRY(Matrix4, gMatWorldNoScale)
 		BS_PARAM_BLOCK_ENTRY(Matrix4, gMatInvWorldNoScale)
 		BS_PARAM_BLOCK_ENTRY(float, gWorldDeterminantSign)
+		BS_PARAM_BLOCK_ENTRY(INT32, gBoneOffset)
 	BS_PARAM_BLOCK_END
 
 	extern PerObjectParamDef gPerObjectParamDef;
@@ -100,6 +101,18 @@ namespace bs { namespace ct
 
 		/** Version of the morph shape vertices in the buffer. */
 		mutable UINT32 morphShapeVersion;
+
+		/** 
+		 * Textures used by the element's material whose mip levels could be streamed. Cached so material parameters don't
+		 * need to be looked up every frame when calculating texture usage.
+		 */
+		Vector<const Texture*> streamableTextures;
+
+		/** Material parameters that #streamableTextures was built from. */
+		const MaterialParams* streamableTexturesParams = nullptr;
+
+		/** Version of the material parameters that #streamableTextures was built from. */
+		UINT64 streamableTexturesVersion = 0;
 	};
 
 	 /** Contains information about a Renderable, used by the Renderer. */
@@ -267,6 +267,19 @@ namespace bs { namespace ct
 		/** Returns the visibility mask calculated with the last call to determineVisible(). */
 		const VisibilityInfo& getVisibilityMasks() const { return mVisibility; }
 
+		/**
+		 * Determines how large the textures used by the visible renderable objects appear in this view. For each texture
+		 * the approximate number of pixels covered by the object using it (along one dimension) is written in the
+		 * provided map. If the texture already has an entry the larger of the two values is kept, which allows the same
+		 * map to be provided to multiple views. Must be called after determineVisible().
+		 *
+		 * @param[in]	renderables		A set of renderable objects, same as provided to determineVisible().
+		 * @param[in]	cullInfos		Bounds of the renderable objects, same as provided to determineVisible().
+		 * @param[out]	usage			Map of textures and their approximate size on screen, in pixels.
+		 */
+		void calculateTextureUsage(const Vector<RendererObject*>& renderables, const Vector<CullInfo>& cullInfos,
+			UnorderedMap<const Texture*, float>& usage) const;
+
 		/** 
 		 * Returns a structure containing information about post-processing effects. This structure will be modified and
 		 * maintained by the post-processing system.
@@ -312,6 +312,7 @@ namespace bs { namespace ct
 		float depthRange; /**< Length of the range covered by the shadow caster volume. */
 
 		UINT32 cascadeIdx; /**< Index of a cascade. Only relevant for CSM. */
+		bool isCached; /**< True if the shadow map is stored in a ShadowCachedMap instead of a per-frame texture. */
 
 		/** View-projection matrix from the shadow casters point of view. */
 		Matrix4 shadowVPTransform; 
@@ -411,6 +412,37 @@ namespace bs { namespace ct
 		SPtr<RenderTexture> getTarget() const;
 	};
 
+	/** 
+	 * Contains a shadow map for an immovable light that persists between frames. Only casters that are not allowed to 
+	 * move are rendered into the map, so it only needs to be re-rendered when such a caster within the light's influence
+	 * changes.
+	 */
+	class ShadowCachedMap : public ShadowMapBase
+	{
+	public:
+		ShadowCachedMap(UINT32 size, bool cube);
+		~ShadowCachedMap();
+
+		/** Returns a render target encompassing the entire shadow map (all faces, in case of a cubemap). */
+		SPtr<RenderTexture> getTarget() const;
+
+		/** Returns true if the contents of the shadow map are out of date and need to be re-rendered. */
+		bool isDirty() const { return mIsDirty; }
+
+		/** Marks the shadow map contents as out of date. */
+		void markDirty() { mIsDirty = true; }
+
+		/** Provides information about the shadow rendered in the map and marks the map contents as up to date. */
+		void setShadowInfo(const ShadowInfo& info) { mShadowInfo = info; mIsDirty = false; }
+
+		/** @copydoc setShadowInfo */
+		const ShadowInfo& getShadowInfo() const { return mShadowInfo; }
+
+	private:
+		ShadowInfo mShadowInfo;
+		bool mIsDirty;
+	};
+
 	/** Contains a texture required for rendering cascaded shadow maps. */
 	class ShadowCascadedMap : public ShadowMapBase
 	{
@@ -448,6 +480,14 @@ namespace bs { namespace ct
 			UINT32 startIdx;
 			UINT32 numShadows;
 		};
+
+		/** Determines which shadow casters are rendered into a shadow map. */
+		enum class ShadowCasters
+		{
+			All, /**< All casters are rendered into a per-frame shadow map. */
+			Static, /**< Only casters that cannot move are rendered, into a shadow map cached between frames. */
+			Dynamic /**< Only casters that can move are rendered, into a per-frame shadow map. */
+		};
 	public:
 		ShadowRendering(UINT32 shadowMapSize);
 
@@ -463,17 +503,56 @@ namespace bs { namespace ct
 
 		/** Changes the default shadow map size. Will cause all shadow maps to be rebuilt. */
 		void setShadowMapSize(UINT32 size);
+
+		/** 
+		 * Notifies the system that a light was added, removed or modified. Any cached shadow map for the light will be 
+		 * discarded.
+		 */
+		void notifyLightChanged(const Light* light);
+
+		/**
+		 * Notifies the system that a shadow caster was added, removed or modified. Cached shadow maps of all lights
+		 * influencing the provided area will be re-rendered.
+		 */
+		void notifyCasterChanged(const Sphere& bounds);
+
+		/** 
+		 * Checks if the renderable is guaranteed to cast the same shadow every frame, allowing it to be rendered into a
+		 * cached shadow map.
+		 */
+		static bool isStaticCaster(const Renderable& renderable);
 	private:
 		/** Renders cascaded shadow maps for the provided directional light viewed from the provided view. */
 		void renderCascadedShadowMaps(UINT32 viewIdx, UINT32 lightIdx, RendererScene& scene, const FrameInfo& frameInfo);
 
-		/** Renders shadow maps for the provided spot light. */
-		void renderSpotShadowMap(const RendererLight& light, const ShadowMapOptions& options, RendererScene& scene,
-			const FrameInfo& frameInfo);
+		/** 
+		 * Renders shadow maps for the provided spot light. Only casters of the specified type will be rendered. If no
+		 * dynamic casters are found when @p casters is ShadowCasters::Dynamic, no shadow map is generated.
+		 */
+		void renderSpotShadowMap(const RendererLight& light, const ShadowMapOptions& options, ShadowCasters casters,
+			RendererScene& scene, const FrameInfo& frameInfo);
+
+		/** 
+		 * Renders shadow maps for the provided radial light. Only casters of the specified type will be rendered. If no
+		 * dynamic casters are found when @p casters is ShadowCasters::Dynamic, no shadow map is generated.
+		 */
+		void renderRadialShadowMap(const RendererLight& light, const ShadowMapOptions& options, ShadowCasters casters,
+			RendererScene& scene, const FrameInfo& frameInfo);
+
+		/** 
+		 * Returns a cached shadow map for the provided light, creating a new one if one doesn't exist or if the 
+		 * existing one is of different size. Newly created maps are marked as dirty.
+		 */
+		ShadowCachedMap& getCachedShadowMap(const Light* light, UINT32 size, bool cube);
+
+		/** Registers information about a shadow map rendered for a light. */
+		void addShadowInfo(LightShadows& lightShadows, const ShadowInfo& info);
+
+		/** Checks should the shadow of the provided light be split into a cached static and a per-frame dynamic part. */
+		static bool useCachedShadows(const RendererLight& light);
 
-		/** Renders shadow maps for the provided radial light. */
-		void renderRadialShadowMap(const RendererLight& light, const ShadowMapOptions& options, RendererScene& scene, 
-			const FrameInfo& frameInfo);
+		/** Checks does the renderable cast shadows of the provided type. */
+		static bool isCasterOfType(const Renderable& renderable, ShadowCasters casters);
 
 		/** 
 		 * Calculates optimal shadow map size, taking into account all views in the scene. Also calculates a fade value
@@ -590,6 +669,7 @@ namespace bs { namespace ct
 		Vector<ShadowMapAtlas> mDynamicShadowMaps;
 		Vector<ShadowCascadedMap> mCascadedShadowMaps;
 		Vector<ShadowCubemap> mShadowCubemaps;
+		UnorderedMap<const Light*, ShadowCachedMap> mCachedShadowMaps;
 
 		Vector<ShadowInfo> mShadowInfos;
 
@@ -610,6 +690,8 @@ namespace bs { namespace ct
 		Vector<bool> mRenderableVisibility; // Transient
 		Vector<ShadowMapOptions> mSpotLightShadowOptions; // Transient
 		Vector<ShadowMapOptions> mRadialLightShadowOptions; // Transient
+		Vector<UINT32> mShadowCasters; // Transient
+		Vector<UINT32> mShadowCasterFaceMasks; // Transient
 	};
 
 	/* @} */
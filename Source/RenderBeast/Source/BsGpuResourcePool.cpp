@@ -9,7 +9,7 @@
 namespace bs { namespace ct
 {
 	PooledRenderTexture::PooledRenderTexture(GpuResourcePool* pool)
-		:mPool(pool), mIsFree(false)
+		:mPool(pool), mIsFree(false), mDescHash(0)
 	{ }
 
 	PooledRenderTexture::~PooledRenderTexture()
@@ -19,7 +19,7 @@ namespace bs { namespace ct
 	}
 
 	PooledStorageBuffer::PooledStorageBuffer(GpuResourcePool* pool)
-		:mPool(pool), mIsFree(false)
+		:mPool(pool), mIsFree(false), mDescHash(0)
 	{ }
 
 	PooledStorageBuffer::~PooledStorageBuffer()
@@ -39,26 +39,70 @@ namespace bs { namespace ct
 
 	SPtr<PooledRenderTexture> GpuResourcePool::get(const POOLED_RENDER_TEXTURE_DESC& desc)
 	{
-		for (auto& texturePair : mTextures)
-		{
-			SPtr<PooledRenderTexture> textureData = texturePair.second.lock();
+		size_t hash = getHash(desc);
 
-			if (!textureData->mIsFree)
-				continue;
+		auto iterFind = mFreeTextures.find(hash);
+		if (iterFind != mFreeTextures.end())
+		{
+			Vector<PooledRenderTexture*>& freeTextures = iterFind->second;
+			for (auto iter = freeTextures.rbegin(); iter != freeTextures.rend(); ++iter)
+			{
+				SPtr<PooledRenderTexture> textureData = mTextures[*iter].lock();
 
-			if (textureData->texture == nullptr)
-				continue;
+				// Check in case of a hash collision
+				if (matches(textureData->mDesc, desc))
+				{
+					freeTextures.erase(std::next(iter).base());
 
-			if (matches(textureData->texture, desc))
-			{
-				textureData->mIsFree = false;
-				return textureData;
+					textureData->mIsFree = false;
+					return textureData;
+				}
 			}
 		}
 
 		SPtr<PooledRenderTexture> newTextureData = bs_shared_ptr_new<PooledRenderTexture>(this);
+		newTextureData->mDescHash = hash;
+		newTextureData->mDesc = desc;
 		_registerTexture(newTextureData);
 
+		allocate(*newTextureData, desc);
+		return newTextureData;
+	}
+
+	SPtr<PooledStorageBuffer> GpuResourcePool::get(const POOLED_STORAGE_BUFFER_DESC& desc)
+	{
+		size_t hash = getHash(desc);
+
+		auto iterFind = mFreeBuffers.find(hash);
+		if (iterFind != mFreeBuffers.end())
+		{
+			Vector<PooledStorageBuffer*>& freeBuffers = iterFind->second;
+			for (auto iter = freeBuffers.rbegin(); iter != freeBuffers.rend(); ++iter)
+			{
+				SPtr<PooledStorageBuffer> bufferData = mBuffers[*iter].lock();
+
+				// Check in case of a hash collision
+				if (matches(bufferData->mDesc, desc))
+				{
+					freeBuffers.erase(std::next(iter).base());
+
+					bufferData->mIsFree = false;
+					return bufferData;
+				}
+			}
+		}
+
+		SPtr<PooledStorageBuffer> newBufferData = bs_shared_ptr_new<PooledStorageBuffer>(this);
+		newBufferData->mDescHash = hash;
+		newBufferData->mDesc = desc;
+		_registerBuffer(newBufferData);
+
+		allocate(*newBufferData, desc);
+		return newBufferData;
+	}
+
+	void GpuResourcePool::allocate(PooledRenderTexture& texture, const POOLED_RENDER_TEXTURE_DESC& desc)
+	{
 		TEXTURE_DESC texDesc;
 		texDesc.type = desc.type;
 		texDesc.width = desc.width;
@@ -72,7 +116,7 @@ namespace bs { namespace ct
 		if (desc.type != TEX_TYPE_3D)
 			texDesc.numArraySlices = desc.arraySize;
 
-		newTextureData->texture = TextureManager::instance().createTexture(texDesc);
+		texture.texture = TextureManager::instance().createTexture(texDesc);
 		
 		if ((desc.flag & (TU_RENDERTARGET | TU_DEPTHSTENCIL)) != 0)
 		{
@@ -80,48 +124,26 @@ namespace bs { namespace ct
 
 			if ((desc.flag & TU_RENDERTARGET) != 0)
 			{
-				rtDesc.colorSurfaces[0].texture = newTextureData->texture;
+				rtDesc.colorSurfaces[0].texture = texture.texture;
 				rtDesc.colorSurfaces[0].face = 0;
-				rtDesc.colorSurfaces[0].numFaces = newTextureData->texture->getProperties().getNumFaces();
+				rtDesc.colorSurfaces[0].numFaces = texture.texture->getProperties().getNumFaces();
 				rtDesc.colorSurfaces[0].mipLevel = 0;
 			}
 
 			if ((desc.flag & TU_DEPTHSTENCIL) != 0)
 			{
-				rtDesc.depthStencilSurface.texture = newTextureData->texture;
+				rtDesc.depthStencilSurface.texture = texture.texture;
 				rtDesc.depthStencilSurface.face = 0;
-				rtDesc.depthStencilSurface.numFaces = newTextureData->texture->getProperties().getNumFaces();
+				rtDesc.depthStencilSurface.numFaces = texture.texture->getProperties().getNumFaces();
 				rtDesc.depthStencilSurface.mipLevel = 0;
 			}
 
-			newTextureData->renderTexture = TextureManager::instance().createRenderTexture(rtDesc);
+			texture.renderTexture = TextureManager::instance().createRenderTexture(rtDesc);
 		}
-
-		return newTextureData;
 	}
 
-	SPtr<PooledStorageBuffer> GpuResourcePool::get(const POOLED_STORAGE_BUFFER_DESC& desc)
+	void GpuResourcePool::allocate(PooledStorageBuffer& buffer, const POOLED_STORAGE_BUFFER_DESC& desc)
 	{
-		for (auto& bufferPair : mBuffers)
-		{
-			SPtr<PooledStorageBuffer> bufferData = bufferPair.second.lock();
-
-			if (!bufferData->mIsFree)
-				continue;
-
-			if (bufferData->buffer == nullptr)
-				continue;
-
-			if (matches(bufferData->buffer, desc))
-			{
-				bufferData->mIsFree = false;
-				return bufferData;
-			}
-		}
-
-		SPtr<PooledStorageBuffer> newBufferData = bs_shared_ptr_new<PooledStorageBuffer>(this);
-		_registerBuffer(newBufferData);
-
 		GPU_BUFFER_DESC bufferDesc;
 		bufferDesc.type = desc.type;
 		bufferDesc.elementSize = desc.elementSize;
@@ -129,57 +151,57 @@ namespace bs { namespace ct
 		bufferDesc.format = desc.format;
 		bufferDesc.randomGpuWrite = true;
 
-		newBufferData->buffer = GpuBuffer::create(bufferDesc);
-
-		return newBufferData;
+		buffer.buffer = GpuBuffer::create(bufferDesc);
 	}
 
 	void GpuResourcePool::release(const SPtr<PooledRenderTexture>& texture)
 	{
-		auto iterFind = mTextures.find(texture.get());
-		iterFind->second.lock()->mIsFree = true;
+		if (texture->mIsFree)
+			return;
+
+		texture->mIsFree = true;
+		mFreeTextures[texture->mDescHash].push_back(texture.get());
 	}
 
 	void GpuResourcePool::release(const SPtr<PooledStorageBuffer>& buffer)
 	{
-		auto iterFind = mBuffers.find(buffer.get());
-		iterFind->second.lock()->mIsFree = true;
+		if (buffer->mIsFree)
+			return;
+
+		buffer->mIsFree = true;
+		mFreeBuffers[buffer->mDescHash].push_back(buffer.get());
 	}
 
-	bool GpuResourcePool::matches(const SPtr<Texture>& texture, const POOLED_RENDER_TEXTURE_DESC& desc)
+	bool GpuResourcePool::matches(const POOLED_RENDER_TEXTURE_DESC& a, const POOLED_RENDER_TEXTURE_DESC& b)
 	{
-		const TextureProperties& texProps = texture->getProperties();
-
-		bool match = texProps.getTextureType() == desc.type 
-			&& texProps.getFormat() == desc.format 
-			&& texProps.getWidth() == desc.width 
-			&& texProps.getHeight() == desc.height
-			&& (texProps.getUsage() & desc.flag) == desc.flag
+		bool match = a.type == b.type 
+			&& a.format == b.format 
+			&& a.width == b.width 
+			&& a.height == b.height
+			&& a.flag == b.flag
 			&& (
-				(desc.type == TEX_TYPE_2D 
-					&& texProps.isHardwareGammaEnabled() == desc.hwGamma 
-					&& texProps.getNumSamples() == desc.numSamples)
-				|| (desc.type == TEX_TYPE_3D 
-					&& texProps.getDepth() == desc.depth)
-				|| (desc.type == TEX_TYPE_CUBE_MAP)
+				(a.type == TEX_TYPE_2D 
+					&& a.hwGamma == b.hwGamma 
+					&& a.numSamples == b.numSamples)
+				|| (a.type == TEX_TYPE_3D 
+					&& a.depth == b.depth)
+				|| (a.type == TEX_TYPE_CUBE_MAP)
 				)
-			&& texProps.getNumArraySlices() == desc.arraySize
+			&& a.arraySize == b.arraySize
 			;
 
 		return match;
 	}
 
-	bool GpuResourcePool::matches(const SPtr<GpuBuffer>& buffer, const POOLED_STORAGE_BUFFER_DESC& desc)
+	bool GpuResourcePool::matches(const POOLED_STORAGE_BUFFER_DESC& a, const POOLED_STORAGE_BUFFER_DESC& b)
 	{
-		const GpuBufferProperties& props = buffer->getProperties();
-
-		bool match = props.getType() == desc.type && props.getElementCount() == desc.numElements;
+		bool match = a.type == b.type && a.numElements == b.numElements;
 		if(match)
 		{
-			if (desc.type == GBT_STANDARD)
-				match = props.getFormat() == desc.format;
+			if (a.type == GBT_STANDARD)
+				match = a.format == b.format;
 			else // Structured
-				match = props.getElementSize() == desc.elementSize;
+				match = a.elementSize == b.elementSize;
 		}
 
 		return match;
@@ -193,6 +215,15 @@ namespace bs { namespace ct
 	void GpuResourcePool::_unregisterTexture(PooledRenderTexture* texture)
 	{
 		mTextures.erase(texture);
+
+		if (texture->mIsFree)
+		{
+			Vector<PooledRenderTexture*>& freeTextures = mFreeTextures[texture->mDescHash];
+
+			auto iterFind = std::find(freeTextures.begin(), freeTextures.end(), texture);
+			if (iterFind != freeTextures.end())
+				freeTextures.erase(iterFind);
+		}
 	}
 
 	void GpuResourcePool::_registerBuffer(const SPtr<PooledStorageBuffer>& buffer)
@@ -203,6 +234,51 @@ namespace bs { namespace ct
 	void GpuResourcePool::_unregisterBuffer(PooledStorageBuffer* buffer)
 	{
 		mBuffers.erase(buffer);
+
+		if (buffer->mIsFree)
+		{
+			Vector<PooledStorageBuffer*>& freeBuffers = mFreeBuffers[buffer->mDescHash];
+
+			auto iterFind = std::find(freeBuffers.begin(), freeBuffers.end(), buffer);
+			if (iterFind != freeBuffers.end())
+				freeBuffers.erase(iterFind);
+		}
+	}
+
+	size_t GpuResourcePool::getHash(const POOLED_RENDER_TEXTURE_DESC& desc)
+	{
+		// Note: Only hash the properties that are compared by matches()
+		size_t hash = 0;
+		hash_combine(hash, (UINT32)desc.type);
+		hash_combine(hash, (UINT32)desc.format);
+		hash_combine(hash, desc.width);
+		hash_combine(hash, desc.height);
+		hash_combine(hash, (UINT32)desc.flag);
+		hash_combine(hash, desc.arraySize);
+
+		if (desc.type == TEX_TYPE_2D)
+		{
+			hash_combine(hash, desc.hwGamma);
+			hash_combine(hash, desc.numSamples);
+		}
+		else if (desc.type == TEX_TYPE_3D)
+			hash_combine(hash, desc.depth);
+
+		return hash;
+	}
+
+	size_t GpuResourcePool::getHash(const POOLED_STORAGE_BUFFER_DESC& desc)
+	{
+		size_t hash = 0;
+		hash_combine(hash, (UINT32)desc.type);
+		hash_combine(hash, desc.numElements);
+
+		if (desc.type == GBT_STANDARD)
+			hash_combine(hash, (UINT32)desc.format);
+		else // Structured
+			hash_combine(hash, desc.elementSize);
+
+		return hash;
 	}
 
 	POOLED_RENDER_TEXTURE_DESC POOLED_RENDER_TEXTURE_DESC::create2D(PixelFormat format, UINT32 width, UINT32 height,
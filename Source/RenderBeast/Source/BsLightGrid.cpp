@@ -8,6 +8,8 @@
 #include "BsRenderTargets.h"
 #include "BsLightRendering.h"
 #include "BsImageBasedLighting.h"
+#include "BsTaskScheduler.h"
+#include "BsSIMD.h"
 
 namespace bs { namespace ct
 {
@@ -237,6 +239,313 @@ namespace bs { namespace ct
 		gridProbeIndices = mGridProbeIndices;
 	}
 
+	void LightGridCPU::BoundsSoA::resize(UINT32 count, bool cones)
+	{
+		this->count = count;
+
+		UINT32 paddedCount = (count + 3) & ~3U;
+		x.resize(paddedCount);
+		y.resize(paddedCount);
+		z.resize(paddedCount);
+		radius.resize(paddedCount);
+
+		UINT32 coneCount = cones ? paddedCount : 0;
+		tipX.resize(coneCount);
+		tipY.resize(coneCount);
+		tipZ.resize(coneCount);
+		dirX.resize(coneCount);
+		dirY.resize(coneCount);
+		dirZ.resize(coneCount);
+		cosAngle.resize(coneCount);
+		sinAngle.resize(coneCount);
+		range.resize(coneCount);
+	}
+
+	void LightGridCPU::assign(const Vector3I& gridSize, UINT32 maxPerCell, const LightGridViewInfo& view, 
+		const LightData* lights, const Vector3I& lightCounts, const ReflProbeData* probes, UINT32 numProbes)
+	{
+		mGridSize = gridSize;
+		mMaxPerCell = maxPerCell;
+		mView = view;
+
+		// Transform light and probe bounds to view space, so they can be tested directly against cell bounds
+		mRadialOffset = lightCounts[0];
+		mSpotOffset = lightCounts[0] + lightCounts[1];
+
+		mRadialBounds.resize(lightCounts[1], false);
+		for(UINT32 i = 0; i < (UINT32)lightCounts[1]; i++)
+		{
+			const LightData& light = lights[mRadialOffset + i];
+			Vector3 position = view.viewTransform.multiplyAffine(light.position);
+
+			mRadialBounds.x[i] = position.x;
+			mRadialBounds.y[i] = position.y;
+			mRadialBounds.z[i] = position.z;
+			mRadialBounds.radius[i] = light.attRadius;
+		}
+
+		mSpotBounds.resize(lightCounts[2], true);
+		for(UINT32 i = 0; i < (UINT32)lightCounts[2]; i++)
+		{
+			const LightData& light = lights[mSpotOffset + i];
+			Vector3 position = view.viewTransform.multiplyAffine(light.position);
+			Vector3 tip = view.viewTransform.multiplyAffine(light.shiftedLightPosition);
+			Vector3 direction = Vector3::normalize(view.viewTransform.multiplyDirection(light.direction));
+
+			mSpotBounds.x[i] = position.x;
+			mSpotBounds.y[i] = position.y;
+			mSpotBounds.z[i] = position.z;
+			mSpotBounds.radius[i] = light.attRadius;
+
+			// Cone tip is shifted back for area lights, so extend the range to account for it
+			mSpotBounds.tipX[i] = tip.x;
+			mSpotBounds.tipY[i] = tip.y;
+			mSpotBounds.tipZ[i] = tip.z;
+			mSpotBounds.dirX[i] = direction.x;
+			mSpotBounds.dirY[i] = direction.y;
+			mSpotBounds.dirZ[i] = direction.z;
+			mSpotBounds.cosAngle[i] = light.spotAngles.y;
+			mSpotBounds.sinAngle[i] = Math::sin(Radian(light.spotAngles.x));
+			mSpotBounds.range[i] = light.attRadius + light.position.distance(light.shiftedLightPosition);
+		}
+
+		mProbeBounds.resize(numProbes, false);
+		for(UINT32 i = 0; i < numProbes; i++)
+		{
+			Vector3 position = view.viewTransform.multiplyAffine(probes[i].position);
+
+			mProbeBounds.x[i] = position.x;
+			mProbeBounds.y[i] = position.y;
+			mProbeBounds.z[i] = position.z;
+			mProbeBounds.radius[i] = probes[i].radius;
+		}
+
+		// Each cell gets a fixed number of slots in the scratch buffers, so slices can be processed independently
+		UINT32 numCells = gridSize[0] * gridSize[1] * gridSize[2];
+		mLightCountsTemp.resize(numCells * 2);
+		mLightIndicesTemp.resize(numCells * maxPerCell);
+		mProbeCountsTemp.resize(numCells);
+		mProbeIndicesTemp.resize(numCells * maxPerCell);
+
+		// Distribute depth slices between worker threads, with the calling thread processing the first range
+		UINT32 numSlices = (UINT32)gridSize[2];
+		UINT32 numThreads = Math::clamp(TaskScheduler::instance().getNumWorkers() + 1, 1U, numSlices);
+		UINT32 slicesPerThread = (numSlices + numThreads - 1) / numThreads;
+
+		Vector<SPtr<Task>> tasks;
+		for(UINT32 start = slicesPerThread; start < numSlices; start += slicesPerThread)
+		{
+			UINT32 end = std::min(start + slicesPerThread, numSlices);
+
+			SPtr<Task> task = Task::create("LightGridAssignment", 
+				std::bind(&LightGridCPU::assignSlices, this, start, end), TaskPriority::High);
+			TaskScheduler::instance().addTask(task);
+
+			tasks.push_back(task);
+		}
+
+		assignSlices(0, std::min(slicesPerThread, numSlices));
+
+		for (auto& task : tasks)
+			task->wait();
+
+		// Compact the per-cell lists into sequential arrays
+		mLightOffsetsAndSize.resize(numCells * 4);
+		mProbeOffsetsAndSize.resize(numCells * 2);
+		mLightIndices.clear();
+		mProbeIndices.clear();
+
+		for(UINT32 i = 0; i < numCells; i++)
+		{
+			UINT32 numRadialLights = mLightCountsTemp[i * 2 + 0];
+			UINT32 numSpotLights = mLightCountsTemp[i * 2 + 1];
+			UINT32 numLights = numRadialLights + numSpotLights;
+
+			mLightOffsetsAndSize[i * 4 + 0] = (UINT32)mLightIndices.size();
+			mLightOffsetsAndSize[i * 4 + 1] = numRadialLights;
+			mLightOffsetsAndSize[i * 4 + 2] = numSpotLights;
+			mLightOffsetsAndSize[i * 4 + 3] = 0;
+
+			const UINT32* cellLights = &mLightIndicesTemp[i * maxPerCell];
+			mLightIndices.insert(mLightIndices.end(), cellLights, cellLights + numLights);
+
+			UINT32 numCellProbes = mProbeCountsTemp[i];
+			mProbeOffsetsAndSize[i * 2 + 0] = (UINT32)mProbeIndices.size();
+			mProbeOffsetsAndSize[i * 2 + 1] = numCellProbes;
+
+			const UINT32* cellProbes = &mProbeIndicesTemp[i * maxPerCell];
+			mProbeIndices.insert(mProbeIndices.end(), cellProbes, cellProbes + numCellProbes);
+		}
+	}
+
+	void LightGridCPU::assignSlices(UINT32 startZ, UINT32 endZ)
+	{
+		for(UINT32 z = startZ; z < endZ; z++)
+		{
+			for(UINT32 y = 0; y < (UINT32)mGridSize[1]; y++)
+			{
+				for(UINT32 x = 0; x < (UINT32)mGridSize[0]; x++)
+				{
+					UINT32 cellIdx = (z * mGridSize[1] + y) * mGridSize[0] + x;
+
+					INT32 cell[3] = { (INT32)x, (INT32)y, (INT32)z };
+
+					Vector3 center;
+					Vector3 extent;
+					calcCellBounds(mGridSize, mView, Vector3I(cell), center, extent);
+
+					// Radial lights are placed before spot lights, as is the convention
+					UINT32* lightOutput = &mLightIndicesTemp[cellIdx * mMaxPerCell];
+					UINT32 numRadialLights = findIntersecting(center, extent, mRadialBounds, false, mRadialOffset, 
+						lightOutput, mMaxPerCell);
+					UINT32 numSpotLights = findIntersecting(center, extent, mSpotBounds, true, mSpotOffset, 
+						lightOutput + numRadialLights, mMaxPerCell - numRadialLights);
+
+					mLightCountsTemp[cellIdx * 2 + 0] = numRadialLights;
+					mLightCountsTemp[cellIdx * 2 + 1] = numSpotLights;
+
+					UINT32* probeOutput = &mProbeIndicesTemp[cellIdx * mMaxPerCell];
+					mProbeCountsTemp[cellIdx] = findIntersecting(center, extent, mProbeBounds, false, 0, probeOutput, 
+						mMaxPerCell);
+				}
+			}
+		}
+	}
+
+	UINT32 LightGridCPU::findIntersecting(const Vector3& center, const Vector3& extent, const BoundsSoA& bounds,
+		bool testCones, UINT32 indexOffset, UINT32* output, UINT32 maxCount)
+	{
+		// Radius of the sphere bounding the cell, used for cone tests
+		float cellRadius = extent.length();
+
+		simd::float4 centerX = simd::splat(center.x);
+		simd::float4 centerY = simd::splat(center.y);
+		simd::float4 centerZ = simd::splat(center.z);
+		simd::float4 extentX = simd::splat(extent.x);
+		simd::float4 extentY = simd::splat(extent.y);
+		simd::float4 extentZ = simd::splat(extent.z);
+		simd::float4 zero = simd::splat(0.0f);
+
+		UINT32 numFound = 0;
+		for(UINT32 i = 0; i < bounds.count; i += 4)
+		{
+			// Test four bounding spheres at once, using the distance from the sphere center to the closest point on the box
+			simd::float4 offsetX = simd::abs(simd::sub(simd::load(&bounds.x[i]), centerX));
+			simd::float4 distX = simd::max(simd::sub(offsetX, extentX), zero);
+
+			simd::float4 offsetY = simd::abs(simd::sub(simd::load(&bounds.y[i]), centerY));
+			simd::float4 distY = simd::max(simd::sub(offsetY, extentY), zero);
+
+			simd::float4 offsetZ = simd::abs(simd::sub(simd::load(&bounds.z[i]), centerZ));
+			simd::float4 distZ = simd::max(simd::sub(offsetZ, extentZ), zero);
+			simd::float4 distSqrd = simd::add(simd::add(simd::mul(distX, distX), simd::mul(distY, distY)), 
+				simd::mul(distZ, distZ));
+
+			simd::float4 radius = simd::load(&bounds.radius[i]);
+			int intersectMask = ~simd::lessMask(simd::mul(radius, radius), distSqrd) & 0xF;
+
+			if (intersectMask == 0)
+				continue;
+
+			UINT32 numValid = std::min(bounds.count - i, 4U);
+			for(UINT32 j = 0; j < numValid; j++)
+			{
+				if ((intersectMask & (1 << j)) == 0)
+					continue;
+
+				// Only the few entries that pass the sphere test need the more expensive cone test
+				if(testCones)
+				{
+					UINT32 idx = i + j;
+
+					float toCellX = center.x - bounds.tipX[idx];
+					float toCellY = center.y - bounds.tipY[idx];
+					float toCellZ = center.z - bounds.tipZ[idx];
+
+					float toCellDistSqrd = toCellX * toCellX + toCellY * toCellY + toCellZ * toCellZ;
+					float distAlongAxis = toCellX * bounds.dirX[idx] + toCellY * bounds.dirY[idx] + 
+						toCellZ * bounds.dirZ[idx];
+					float distFromAxis = std::sqrt(std::max(toCellDistSqrd - distAlongAxis * distAlongAxis, 0.0f));
+
+					// Distance from the cell bounding sphere center to the closest point on the cone surface
+					float distToCone = bounds.cosAngle[idx] * distFromAxis - distAlongAxis * bounds.sinAngle[idx];
+
+					bool outsideAngle = distToCone > cellRadius;
+					bool outsideFront = distAlongAxis > cellRadius + bounds.range[idx];
+					bool outsideBack = distAlongAxis < -cellRadius;
+
+					if (outsideAngle || outsideFront || outsideBack)
+						continue;
+				}
+
+				if (numFound >= maxCount)
+					return numFound;
+
+				output[numFound++] = indexOffset + i + j;
+			}
+		}
+
+		return numFound;
+	}
+
+	void LightGridCPU::calcCellBounds(const Vector3I& gridSize, const LightGridViewInfo& view, const Vector3I& cell,
+		Vector3& center, Vector3& extent)
+	{
+		// Note: Must match calcCellAABB() in LightGridLLCreation.bsl and calcViewZFromCellZ() in LightGridCommon.bslinc
+		auto calcViewZFromCellZ = [&](INT32 cellZ)
+		{
+			float sliceSqrd = (float)(cellZ * cellZ) / (float)(gridSize[2] * gridSize[2]);
+			return -(sliceSqrd * (view.nearFar.y - view.nearFar.x) + view.nearFar.x);
+		};
+
+		auto convertToNDCZ = [&](float viewZ)
+		{
+			return -view.NDCZToViewZ.y + (view.NDCZToViewZ.x / viewZ);
+		};
+
+		// Convert grid XY coordinates to clip coordinates
+		float ax = 2.0f / gridSize[0];
+		float ay = 2.0f / gridSize[1];
+
+		Vector3 ndcMin(cell[0] * ax - 1.0f, cell[1] * ay - 1.0f, 0.0f);
+		Vector3 ndcMax((cell[0] + 1) * ax - 1.0f, (cell[1] + 1) * ay - 1.0f, 0.0f);
+
+		// Flip Y depending on render API, depending if Y in NDC is facing up or down
+		float flipY = -Math::sign(view.projTransform[1][1]);
+		ndcMin.y *= flipY;
+		ndcMax.y *= flipY;
+
+		// Because we're viewing along negative Z, farther end is the minimum
+		float viewZMin = calcViewZFromCellZ(cell[2] + 1);
+		float viewZMax = calcViewZFromCellZ(cell[2]);
+
+		ndcMin.z = convertToNDCZ(viewZMax);
+		ndcMax.z = convertToNDCZ(viewZMin);
+
+		Vector3 viewMin(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), viewZMin);
+		Vector3 viewMax(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max(), viewZMax);
+		for(UINT32 i = 0; i < 8; i++)
+		{
+			Vector4 ndcCorner(
+				(i & 1) ? ndcMax.x : ndcMin.x, 
+				(i & 2) ? ndcMax.y : ndcMin.y, 
+				(i & 4) ? ndcMax.z : ndcMin.z, 
+				1.0f);
+
+			Vector4 corner = view.invProjTransform.multiply(ndcCorner);
+			float x = corner.x / corner.w;
+			float y = corner.y / corner.w;
+
+			viewMin.x = std::min(viewMin.x, x);
+			viewMin.y = std::min(viewMin.y, y);
+			viewMax.x = std::max(viewMax.x, x);
+			viewMax.y = std::max(viewMax.y, y);
+		}
+
+		extent = (viewMax - viewMin) * 0.5f;
+		center = viewMin + extent;
+	}
+
 	LightGrid::LightGrid()
 	{
 		mGridParamBuffer = gLightGridParamDefDef.createBuffer();
@@ -286,6 +595,40 @@ namespace bs { namespace ct
 		gLightGridParamDefDef.gMaxNumLightsPerCell.set(mGridParamBuffer, MAX_LIGHTS_PER_CELL);
 		gLightGridParamDefDef.gGridPixelSize.set(mGridParamBuffer, Vector2I(CELL_XY_SIZE, CELL_XY_SIZE));
 
+		const RenderAPICapabilities& caps = RenderAPI::instance().getCapabilities(0);
+		mLastUpdateOnCPU = mUseCPU || !caps.hasCapability(RSC_COMPUTE_PROGRAM);
+
+		if(mLastUpdateOnCPU)
+		{
+			const RendererViewProperties& viewProps = view.getProperties();
+
+			LightGridViewInfo viewInfo;
+			viewInfo.viewTransform = viewProps.viewTransform;
+			viewInfo.projTransform = viewProps.projTransform;
+			viewInfo.invProjTransform = viewProps.projTransform.inverse();
+			viewInfo.nearFar = Vector2(viewProps.nearPlane, viewProps.farPlane);
+			viewInfo.NDCZToViewZ = RendererView::getNDCZToViewZ(viewProps.projTransform);
+
+			INT32 numLightsPerType[3] = { lightCount[0], lightCount[1], lightCount[2] };
+			mCPUAssignment.assign(gridSize, MAX_LIGHTS_PER_CELL, viewInfo, lightData.getLightData().data(), 
+				Vector3I(numLightsPerType), probeData.getProbeData().data(), probeData.getNumProbes());
+
+			createCPUBuffers(numCells);
+
+			auto writeBuffer = [](const SPtr<GpuBuffer>& buffer, const Vector<UINT32>& data)
+			{
+				if (!data.empty())
+					buffer->writeData(0, (UINT32)data.size() * sizeof(UINT32), data.data(), BWT_DISCARD);
+			};
+
+			writeBuffer(mCPULightOffsetsAndSize, mCPUAssignment.getLightOffsetsAndSize());
+			writeBuffer(mCPULightIndices, mCPUAssignment.getLightIndices());
+			writeBuffer(mCPUProbeOffsetsAndSize, mCPUAssignment.getProbeOffsetsAndSize());
+			writeBuffer(mCPUProbeIndices, mCPUAssignment.getProbeIndices());
+
+			return;
+		}
+
 		mLLCreationMat.setParams(gridSize, mGridParamBuffer, lightData.getLightBuffer(), probeData.getProbeBuffer());
 		mLLCreationMat.execute(view);
 
@@ -303,7 +646,41 @@ namespace bs { namespace ct
 		SPtr<GpuBuffer>& gridProbeOffsetsAndSize, SPtr<GpuBuffer>& gridProbeIndices, 
 		SPtr<GpuParamBlockBuffer>& gridParams) const
 	{
-		mLLReductionMat.getOutputs(gridLightOffsetsAndSize, gridLightIndices, gridProbeOffsetsAndSize, gridProbeIndices);
+		if(mLastUpdateOnCPU)
+		{
+			gridLightOffsetsAndSize = mCPULightOffsetsAndSize;
+			gridLightIndices = mCPULightIndices;
+			gridProbeOffsetsAndSize = mCPUProbeOffsetsAndSize;
+			gridProbeIndices = mCPUProbeIndices;
+		}
+		else
+			mLLReductionMat.getOutputs(gridLightOffsetsAndSize, gridLightIndices, gridProbeOffsetsAndSize, gridProbeIndices);
+
 		gridParams = mGridParamBuffer;
 	}
+
+	void LightGrid::createCPUBuffers(UINT32 numCells)
+	{
+		if (numCells <= mCPUBufferNumCells && mCPUBufferNumCells != 0)
+			return;
+
+		GPU_BUFFER_DESC desc;
+		desc.elementCount = numCells;
+		desc.format = BF_32X4U;
+		desc.type = GBT_STANDARD;
+		desc.elementSize = 0;
+		desc.usage = GBU_DYNAMIC;
+
+		mCPULightOffsetsAndSize = GpuBuffer::create(desc);
+
+		desc.format = BF_32X2U;
+		mCPUProbeOffsetsAndSize = GpuBuffer::create(desc);
+
+		desc.format = BF_32X1U;
+		desc.elementCount = numCells * MAX_LIGHTS_PER_CELL;
+		mCPULightIndices = GpuBuffer::create(desc);
+		mCPUProbeIndices = GpuBuffer::create(desc);
+
+		mCPUBufferNumCells = numCells;
+	}
 }}
@@ -130,6 +130,8 @@ namespace bs { namespace ct
 		for (UINT32 i = 0; i < (UINT32)LightType::Count; i++)
 			mVisibleLights[i].clear();
 
+		mLightData.clear();
+
 		// Generate a list of lights and their GPU buffers
 		UINT32 numDirLights = (UINT32)sceneInfo.directionalLights.size();
 		for (UINT32 i = 0; i < numDirLights; i++)
@@ -189,12 +191,12 @@ namespace bs { namespace ct
 		{
 			for(auto& entry : lightsPerType)
 			{
-				mLightDataTemp.push_back(LightData());
-				entry->getParameters(mLightDataTemp.back());
+				mLightData.push_back(LightData());
+				entry->getParameters(mLightData.back());
 			}
 		}
 
-		UINT32 size = (UINT32)mLightDataTemp.size() * sizeof(LightData);
+		UINT32 size = (UINT32)mLightData.size() * sizeof(LightData);
 		UINT32 curBufferSize;
 
 		if (mLightBuffer != nullptr)
@@ -217,9 +219,7 @@ namespace bs { namespace ct
 		}
 
 		if (size > 0)
-			mLightBuffer->writeData(0, size, mLightDataTemp.data(), BWT_DISCARD);
-
-		mLightDataTemp.clear();
+			mLightBuffer->writeData(0, size, mLightData.data(), BWT_DISCARD);
 	}
 
 	const UINT32 TiledDeferredLighting::TILE_SIZE = 16;
@@ -26,41 +26,42 @@ namespace bs { namespace ct
 		// Do nothing
 	}
 
-	void DownsampleMat::execute(const SPtr<Texture>& target, PostProcessInfo& ppInfo)
+	void DownsampleMat::execute(const SPtr<Texture>& input, const SPtr<RenderTexture>& output)
 	{
 		// Set parameters
-		mInputTexture.set(target);
+		mInputTexture.set(input);
 
-		const TextureProperties& rtProps = target->getProperties();
+		const TextureProperties& rtProps = input->getProperties();
 		Vector2 invTextureSize(1.0f / rtProps.getWidth(), 1.0f / rtProps.getHeight());
 
 		gDownsampleParamDef.gInvTexSize.set(mParamBuffer, invTextureSize);
 
-		// Set output
-		UINT32 width = std::max(1, Math::ceilToInt(rtProps.getWidth() * 0.5f));
-		UINT32 height = std::max(1, Math::ceilToInt(rtProps.getHeight() * 0.5f));
-
-		mOutputDesc = POOLED_RENDER_TEXTURE_DESC::create2D(rtProps.getFormat(), width, height, TU_RENDERTARGET);
-
 		// Render
-		ppInfo.downsampledSceneTex = GpuResourcePool::instance().get(mOutputDesc);
-
 		RenderAPI& rapi = RenderAPI::instance();
-		rapi.setRenderTarget(ppInfo.downsampledSceneTex->renderTexture, FBT_DEPTH | FBT_STENCIL);
+		rapi.setRenderTarget(output, FBT_DEPTH | FBT_STENCIL);
 
 		gRendererUtility().setPass(mMaterial);
 		gRendererUtility().setPassParams(mParamsSet);
 		gRendererUtility().drawScreenQuad();
 
 		rapi.setRenderTarget(nullptr);
+	}
 
-		mOutput = ppInfo.downsampledSceneTex->renderTexture;
+	POOLED_RENDER_TEXTURE_DESC DownsampleMat::getOutputDesc(const SPtr<Texture>& input)
+	{
+		Vector2I size = getOutputSize(input);
+		return POOLED_RENDER_TEXTURE_DESC::create2D(input->getProperties().getFormat(), size.x, size.y, TU_RENDERTARGET);
 	}
 
-	void DownsampleMat::release(PostProcessInfo& ppInfo)
+	Vector2I DownsampleMat::getOutputSize(const SPtr<Texture>& input)
 	{
-		GpuResourcePool::instance().release(ppInfo.downsampledSceneTex);
-		mOutput = nullptr;
+		const TextureProperties& rtProps = input->getProperties();
+
+		Vector2I size;
+		size.x = std::max(1, Math::ceilToInt(rtProps.getWidth() * 0.5f));
+		size.y = std::max(1, Math::ceilToInt(rtProps.getHeight() * 0.5f));
+
+		return size;
 	}
 
 	EyeAdaptHistogramParamDef gEyeAdaptHistogramParamDef;
@@ -83,56 +84,46 @@ namespace bs { namespace ct
 		defines.set("LOOP_COUNT_Y", LOOP_COUNT_Y);
 	}
 
-	void EyeAdaptHistogramMat::execute(PostProcessInfo& ppInfo)
+	void EyeAdaptHistogramMat::execute(const SPtr<Texture>& input, const SPtr<Texture>& output, 
+		const PostProcessInfo& ppInfo)
 	{
 		// Set parameters
-		SPtr<RenderTexture> target = ppInfo.downsampledSceneTex->renderTexture;
-		mSceneColor.set(ppInfo.downsampledSceneTex->texture);
+		mSceneColor.set(input);
 
-		const RenderTextureProperties& props = target->getProperties();
+		const TextureProperties& props = input->getProperties();
 		int offsetAndSize[4] = { 0, 0, (INT32)props.getWidth(), (INT32)props.getHeight() };
 
 		gEyeAdaptHistogramParamDef.gHistogramParams.set(mParamBuffer, getHistogramScaleOffset(ppInfo));
 		gEyeAdaptHistogramParamDef.gPixelOffsetAndSize.set(mParamBuffer, Vector4I(offsetAndSize));
 
-		Vector2I threadGroupCount = getThreadGroupCount(target);
+		Vector2I threadGroupCount = getThreadGroupCount(props.getWidth(), props.getHeight());
 		gEyeAdaptHistogramParamDef.gThreadGroupCount.set(mParamBuffer, threadGroupCount);
 
-		// Set output
-		UINT32 numHistograms = threadGroupCount.x * threadGroupCount.y;
-
-		mOutputDesc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_FLOAT16_RGBA, HISTOGRAM_NUM_TEXELS, numHistograms,
-			TU_LOADSTORE);
-
 		// Dispatch
-		ppInfo.histogramTex = GpuResourcePool::instance().get(mOutputDesc);
-
-		mOutputTex.set(ppInfo.histogramTex->texture);
+		mOutputTex.set(output);
 
 		RenderAPI& rapi = RenderAPI::instance();
 		gRendererUtility().setComputePass(mMaterial);
 		gRendererUtility().setPassParams(mParamsSet);
 		rapi.dispatchCompute(threadGroupCount.x, threadGroupCount.y);
-
-		mOutput = ppInfo.histogramTex->renderTexture;
 	}
 
-	void EyeAdaptHistogramMat::release(PostProcessInfo& ppInfo)
+	POOLED_RENDER_TEXTURE_DESC EyeAdaptHistogramMat::getOutputDesc(UINT32 inputWidth, UINT32 inputHeight)
 	{
-		GpuResourcePool::instance().release(ppInfo.histogramTex);
-		mOutput = nullptr;
+		Vector2I threadGroupCount = getThreadGroupCount(inputWidth, inputHeight);
+		UINT32 numHistograms = threadGroupCount.x * threadGroupCount.y;
+
+		return POOLED_RENDER_TEXTURE_DESC::create2D(PF_FLOAT16_RGBA, HISTOGRAM_NUM_TEXELS, numHistograms, TU_LOADSTORE);
 	}
 
-	Vector2I EyeAdaptHistogramMat::getThreadGroupCount(const SPtr<RenderTexture>& target)
+	Vector2I EyeAdaptHistogramMat::getThreadGroupCount(UINT32 width, UINT32 height)
 	{
 		const UINT32 texelsPerThreadGroupX = THREAD_GROUP_SIZE_X * LOOP_COUNT_X;
 		const UINT32 texelsPerThreadGroupY = THREAD_GROUP_SIZE_Y * LOOP_COUNT_Y;
 
-		const RenderTextureProperties& props = target->getProperties();
-	
 		Vector2I threadGroupCount;
-		threadGroupCount.x = ((INT32)props.getWidth() + texelsPerThreadGroupX - 1) / texelsPerThreadGroupX;
-		threadGroupCount.y = ((INT32)props.getHeight() + texelsPerThreadGroupY - 1) / texelsPerThreadGroupY;
+		threadGroupCount.x = ((INT32)width + texelsPerThreadGroupX - 1) / texelsPerThreadGroupX;
+		threadGroupCount.y = ((INT32)height + texelsPerThreadGroupY - 1) / texelsPerThreadGroupY;
 
 		return threadGroupCount;
 	}
@@ -165,10 +156,11 @@ namespace bs { namespace ct
 		// Do nothing
 	}
 
-	void EyeAdaptHistogramReduceMat::execute(PostProcessInfo& ppInfo)
+	void EyeAdaptHistogramReduceMat::execute(const SPtr<Texture>& sceneColor, const SPtr<Texture>& histogram,
+		const SPtr<RenderTexture>& output, const PostProcessInfo& ppInfo)
 	{
 		// Set parameters
-		mHistogramTex.set(ppInfo.histogramTex->texture);
+		mHistogramTex.set(histogram);
 
 		SPtr<PooledRenderTexture> eyeAdaptationRT = ppInfo.eyeAdaptationTex[ppInfo.lastEyeAdaptationTex];
 		SPtr<Texture> eyeAdaptationTex;
@@ -180,20 +172,15 @@ namespace bs { namespace ct
 
 		mEyeAdaptationTex.set(eyeAdaptationTex);
 
-		Vector2I threadGroupCount = EyeAdaptHistogramMat::getThreadGroupCount(ppInfo.downsampledSceneTex->renderTexture);
+		const TextureProperties& props = sceneColor->getProperties();
+		Vector2I threadGroupCount = EyeAdaptHistogramMat::getThreadGroupCount(props.getWidth(), props.getHeight());
 		UINT32 numHistograms = threadGroupCount.x * threadGroupCount.y;
 
 		gEyeAdaptHistogramReduceParamDef.gThreadGroupCount.set(mParamBuffer, numHistograms);
 
-		// Set output
-		mOutputDesc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_FLOAT16_RGBA, EyeAdaptHistogramMat::HISTOGRAM_NUM_TEXELS, 2,
-			TU_RENDERTARGET);
-
 		// Render
-		ppInfo.histogramReduceTex = GpuResourcePool::instance().get(mOutputDesc);
-
 		RenderAPI& rapi = RenderAPI::instance();
-		rapi.setRenderTarget(ppInfo.histogramReduceTex->renderTexture, FBT_DEPTH | FBT_STENCIL);
+		rapi.setRenderTarget(output, FBT_DEPTH | FBT_STENCIL);
 
 		gRendererUtility().setPass(mMaterial);
 		gRendererUtility().setPassParams(mParamsSet);
@@ -202,14 +189,12 @@ namespace bs { namespace ct
 		gRendererUtility().drawScreenQuad(drawUV);
 
 		rapi.setRenderTarget(nullptr);
-
-		mOutput = ppInfo.histogramReduceTex->renderTexture;
 	}
 
-	void EyeAdaptHistogramReduceMat::release(PostProcessInfo& ppInfo)
+	POOLED_RENDER_TEXTURE_DESC EyeAdaptHistogramReduceMat::getOutputDesc()
 	{
-		GpuResourcePool::instance().release(ppInfo.histogramReduceTex);
-		mOutput = nullptr;
+		return POOLED_RENDER_TEXTURE_DESC::create2D(PF_FLOAT16_RGBA, EyeAdaptHistogramMat::HISTOGRAM_NUM_TEXELS, 2,
+			TU_RENDERTARGET);
 	}
 
 	EyeAdaptationParamDef gEyeAdaptationParamDef;
@@ -227,20 +212,12 @@ namespace bs { namespace ct
 		defines.set("THREADGROUP_SIZE_Y", EyeAdaptHistogramMat::THREAD_GROUP_SIZE_Y);
 	}
 
-	void EyeAdaptationMat::execute(PostProcessInfo& ppInfo, float frameDelta)
+	void EyeAdaptationMat::execute(const SPtr<Texture>& reducedHistogram, PostProcessInfo& ppInfo, float frameDelta)
 	{
-		bool texturesInitialized = ppInfo.eyeAdaptationTex[0] != nullptr && ppInfo.eyeAdaptationTex[1] != nullptr;
-		if(!texturesInitialized)
-		{
-			POOLED_RENDER_TEXTURE_DESC outputDesc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_FLOAT32_R, 1, 1, TU_RENDERTARGET);
-			ppInfo.eyeAdaptationTex[0] = GpuResourcePool::instance().get(outputDesc);
-			ppInfo.eyeAdaptationTex[1] = GpuResourcePool::instance().get(outputDesc);
-		}
-
 		ppInfo.lastEyeAdaptationTex = (ppInfo.lastEyeAdaptationTex + 1) % 2; // TODO - Do I really need two targets?
 
 		// Set parameters
-		mReducedHistogramTex.set(ppInfo.histogramReduceTex->texture);
+		mReducedHistogramTex.set(reducedHistogram);
 
 		Vector2 histogramScaleAndOffset = EyeAdaptHistogramMat::getHistogramScaleOffset(ppInfo);
 
@@ -284,6 +261,11 @@ namespace bs { namespace ct
 		rapi.setRenderTarget(nullptr);
 	}
 
+	POOLED_RENDER_TEXTURE_DESC EyeAdaptationMat::getOutputDesc()
+	{
+		return POOLED_RENDER_TEXTURE_DESC::create2D(PF_FLOAT32_R, 1, 1, TU_RENDERTARGET);
+	}
+
 	CreateTonemapLUTParamDef gCreateTonemapLUTParamDef;
 	WhiteBalanceParamDef gWhiteBalanceParamDef;
 
@@ -339,13 +321,7 @@ namespace bs { namespace ct
 		gWhiteBalanceParamDef.gWhiteTemp.set(mWhiteBalanceParamBuffer, settings.whiteBalance.temperature);
 		gWhiteBalanceParamDef.gWhiteOffset.set(mWhiteBalanceParamBuffer, settings.whiteBalance.tint);
 
-		// Set output
-		POOLED_RENDER_TEXTURE_DESC outputDesc = POOLED_RENDER_TEXTURE_DESC::create3D(PF_R8G8B8A8, 
-			LUT_SIZE, LUT_SIZE, LUT_SIZE, TU_LOADSTORE);
-
 		// Dispatch
-		ppInfo.colorLUT = GpuResourcePool::instance().get(outputDesc);
-
 		mOutputTex.set(ppInfo.colorLUT->texture);
 
 		RenderAPI& rapi = RenderAPI::instance();
@@ -355,9 +331,9 @@ namespace bs { namespace ct
 		rapi.dispatchCompute(LUT_SIZE / 8, LUT_SIZE / 8, LUT_SIZE);
 	}
 
-	void CreateTonemapLUTMat::release(PostProcessInfo& ppInfo)
+	POOLED_RENDER_TEXTURE_DESC CreateTonemapLUTMat::getOutputDesc()
 	{
-		GpuResourcePool::instance().release(ppInfo.colorLUT);
+		return POOLED_RENDER_TEXTURE_DESC::create3D(PF_R8G8B8A8, LUT_SIZE, LUT_SIZE, LUT_SIZE, TU_LOADSTORE);
 	}
 
 	TonemappingParamDef gTonemappingParamDef;
@@ -437,37 +413,105 @@ namespace bs { namespace ct
 		Rect2 viewportRect = viewProps.nrmViewRect;
 
 		bool hdr = viewProps.isHDR;
+		bool autoExposure = hdr && settings.enableAutoExposure;
+		bool tonemapping = hdr && settings.enableTonemapping;
 
-		if(hdr && settings.enableAutoExposure)
+		// Textures that persist across frames are owned by the view and imported into the graph, while the intermediate
+		// textures are transient and get re-used between passes by the graph
+		Vector<RenderGraphResource> tonemapInputs;
+		if(autoExposure)
 		{
-			mDownsample.execute(sceneColor, ppInfo);
-			mEyeAdaptHistogram.execute(ppInfo);
-			mDownsample.release(ppInfo);
-
-			mEyeAdaptHistogramReduce.execute(ppInfo);
-			mEyeAdaptHistogram.release(ppInfo);
-
-			mEyeAdaptation.execute(ppInfo, frameDelta);
-			mEyeAdaptHistogramReduce.release(ppInfo);
+			bool texturesInitialized = ppInfo.eyeAdaptationTex[0] != nullptr && ppInfo.eyeAdaptationTex[1] != nullptr;
+			if(!texturesInitialized)
+			{
+				POOLED_RENDER_TEXTURE_DESC desc = EyeAdaptationMat::getOutputDesc();
+				ppInfo.eyeAdaptationTex[0] = GpuResourcePool::instance().get(desc);
+				ppInfo.eyeAdaptationTex[1] = GpuResourcePool::instance().get(desc);
+			}
+
+			UINT32 nextEyeAdaptationTex = (ppInfo.lastEyeAdaptationTex + 1) % 2;
+			RenderGraphResource eyeAdaptation = mRenderGraph.importTexture("EyeAdaptation", 
+				ppInfo.eyeAdaptationTex[nextEyeAdaptationTex]);
+
+			Vector2I downsampledSize = DownsampleMat::getOutputSize(sceneColor);
+
+			RenderGraphResource downsampled = mRenderGraph.createTexture("DownsampledSceneColor", 
+				DownsampleMat::getOutputDesc(sceneColor));
+			RenderGraphResource histogram = mRenderGraph.createTexture("Histogram", 
+				EyeAdaptHistogramMat::getOutputDesc(downsampledSize.x, downsampledSize.y));
+			RenderGraphResource reducedHistogram = mRenderGraph.createTexture("ReducedHistogram", 
+				EyeAdaptHistogramReduceMat::getOutputDesc());
+
+			mRenderGraph.addPass("Downsample", {}, { downsampled }, 
+				[&, downsampled](const RenderGraph& graph)
+			{
+				mDownsample.execute(sceneColor, graph.getTexture(downsampled)->renderTexture);
+			});
+
+			mRenderGraph.addPass("EyeAdaptHistogram", { downsampled }, { histogram }, 
+				[&, downsampled, histogram](const RenderGraph& graph)
+			{
+				mEyeAdaptHistogram.execute(graph.getTexture(downsampled)->texture, graph.getTexture(histogram)->texture,
+					ppInfo);
+			});
+
+			mRenderGraph.addPass("EyeAdaptHistogramReduce", { downsampled, histogram }, { reducedHistogram }, 
+				[&, downsampled, histogram, reducedHistogram](const RenderGraph& graph)
+			{
+				mEyeAdaptHistogramReduce.execute(graph.getTexture(downsampled)->texture, 
+					graph.getTexture(histogram)->texture, graph.getTexture(reducedHistogram)->renderTexture, ppInfo);
+			});
+
+			mRenderGraph.addPass("EyeAdaptation", { reducedHistogram }, { eyeAdaptation }, 
+				[&, reducedHistogram](const RenderGraph& graph)
+			{
+				mEyeAdaptation.execute(graph.getTexture(reducedHistogram)->texture, ppInfo, frameDelta);
+			});
+
+			tonemapInputs.push_back(eyeAdaptation);
 		}
 
-		if (hdr && settings.enableTonemapping)
+		if (tonemapping)
 		{
-			if (ppInfo.settingDirty) // Rebuild LUT if PP settings changed
-				mCreateLUT.execute(ppInfo);
-
-			if (settings.enableAutoExposure)
-				mTonemapping_AE.execute(sceneColor, finalRT, viewportRect, ppInfo);
-			else
-				mTonemapping.execute(sceneColor, finalRT, viewportRect, ppInfo);
+			bool createLUT = ppInfo.settingDirty || ppInfo.colorLUT == nullptr;
+			if (ppInfo.colorLUT == nullptr)
+				ppInfo.colorLUT = GpuResourcePool::instance().get(CreateTonemapLUTMat::getOutputDesc());
+
+			RenderGraphResource colorLUT = mRenderGraph.importTexture("ColorLUT", ppInfo.colorLUT);
+
+			// Rebuild LUT if PP settings changed
+			if (createLUT)
+			{
+				mRenderGraph.addPass("CreateTonemapLUT", {}, { colorLUT }, 
+					[&](const RenderGraph& graph)
+				{
+					mCreateLUT.execute(ppInfo);
+				});
+			}
+
+			tonemapInputs.push_back(colorLUT);
 		}
-		else
+
+		mRenderGraph.addPass("Tonemap", tonemapInputs, {}, 
+			[&](const RenderGraph& graph)
 		{
-			if (hdr && settings.enableAutoExposure)
-				mTonemapping_AE_GO.execute(sceneColor, finalRT, viewportRect, ppInfo);
+			if (tonemapping)
+			{
+				if (autoExposure)
+					mTonemapping_AE.execute(sceneColor, finalRT, viewportRect, ppInfo);
+				else
+					mTonemapping.execute(sceneColor, finalRT, viewportRect, ppInfo);
+			}
 			else
-				mTonemapping_GO.execute(sceneColor, finalRT, viewportRect, ppInfo);
-		}
+			{
+				if (autoExposure)
+					mTonemapping_AE_GO.execute(sceneColor, finalRT, viewportRect, ppInfo);
+				else
+					mTonemapping_GO.execute(sceneColor, finalRT, viewportRect, ppInfo);
+			}
+		}, true);
+
+		mRenderGraph.execute();
 
 		if (ppInfo.settingDirty)
 			ppInfo.settingDirty = false;
@@ -16,6 +16,8 @@
 #include "BsProfilerGPU.h"
 #include "BsShader.h"
 #include "BsGpuParamBlockBuffer.h"
+#include "BsGpuParams.h"
+#include "BsGpuParamDesc.h"
 #include "BsTime.h"
 #include "BsRenderableElement.h"
 #include "BsCoreObjectManager.h"
@@ -26,6 +28,7 @@
 #include "BsRendererUtility.h"
 #include "BsAnimationManager.h"
 #include "BsSkeleton.h"
+#include "BsBonePaletteBuffer.h"
 #include "BsGpuBuffer.h"
 #include "BsGpuParamsSet.h"
 #include "BsRendererExtension.h"
@@ -36,6 +39,10 @@
 #include "BsSkybox.h"
 #include "BsShadowRendering.h"
 #include "BsStandardDeferredLighting.h"
+#include "BsTextureStreamingManager.h"
+#include "BsTaskScheduler.h"
+#include "BsCommandBuffer.h"
+#include "BsInput.h"
 
 using namespace std::placeholders;
 
@@ -136,30 +143,49 @@ namespace bs { namespace ct
 
 		for(auto& entry : rendererObject->elements)
 			mObjectRenderer->initElement(*rendererObject, entry);
+
+		if (ShadowRendering::isStaticCaster(*renderable))
+			ShadowRendering::instance().notifyCasterChanged(renderable->getBounds().getSphere());
 	}
 
 	void RenderBeast::notifyRenderableRemoved(Renderable* renderable)
 	{
+		// Note: Always notify, as mobility changes are reported as a removal followed by an addition, in which case
+		// the renderable already reports its new mobility
+		ShadowRendering::instance().notifyCasterChanged(renderable->getBounds().getSphere());
+
 		mScene->unregisterRenderable(renderable);
 	}
 
 	void RenderBeast::notifyRenderableUpdated(Renderable* renderable)
 	{
+		if (ShadowRendering::isStaticCaster(*renderable))
+		{
+			const SceneInfo& sceneInfo = mScene->getSceneInfo();
+			const CullInfo& cullInfo = sceneInfo.renderableCullInfos[renderable->getRendererId()];
+
+			ShadowRendering::instance().notifyCasterChanged(cullInfo.bounds.getSphere());
+			ShadowRendering::instance().notifyCasterChanged(renderable->getBounds().getSphere());
+		}
+
 		mScene->updateRenderable(renderable);
 	}
 
 	void RenderBeast::notifyLightAdded(Light* light)
 	{
 		mScene->registerLight(light);
+		ShadowRendering::instance().notifyLightChanged(light);
 	}
 
 	void RenderBeast::notifyLightUpdated(Light* light)
 	{
 		mScene->updateLight(light);
+		ShadowRendering::instance().notifyLightChanged(light);
 	}
 
 	void RenderBeast::notifyLightRemoved(Light* light)
 	{
+		ShadowRendering::instance().notifyLightChanged(light);
 		mScene->unregisterLight(light);
 	}
 
@@ -292,6 +318,7 @@ namespace bs { namespace ct
 
 		mScene->setOptions(mCoreOptions);
 		ShadowRendering::instance().setShadowMapSize(mCoreOptions->shadowMapSize);
+		mLightGrid->setUseCPU(mCoreOptions->cpuLightGrid);
 	}
 
 	void RenderBeast::renderAll() 
@@ -305,10 +332,20 @@ namespace bs { namespace ct
 			mOptionsDirty = false;
 		}
 
-		gCoreThread().queueCommand(std::bind(&RenderBeast::renderAllCore, this, gTime().getTime(), gTime().getFrameDelta()));
+		SPtr<InputSampler> inputSampler;
+		LookInput consumedLook;
+		if (Input::isStarted())
+		{
+			inputSampler = gInput()._getSampler();
+			consumedLook = gInput()._getConsumedLookInput();
+		}
+
+		gCoreThread().queueCommand(std::bind(&RenderBeast::renderAllCore, this, gTime().getTime(), 
+			gTime().getFrameDelta(), inputSampler, consumedLook));
 	}
 
-	void RenderBeast::renderAllCore(float time, float delta)
+	void RenderBeast::renderAllCore(float time, float delta, const SPtr<InputSampler>& inputSampler, 
+		const LookInput& consumedLook)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -328,12 +365,25 @@ namespace bs { namespace ct
 		// Retrieve animation data
 		AnimationManager::instance().waitUntilComplete();
 		const RendererAnimationData& animData = AnimationManager::instance().getRendererData();
+		BonePaletteBuffer::instance().update(animData);
 		
 		sceneInfo.renderableReady.resize(sceneInfo.renderables.size(), false);
 		sceneInfo.renderableReady.assign(sceneInfo.renderables.size(), false);
 		
 		FrameInfo frameInfo(delta, animData);
 
+		// Account for any look input received after the simulation thread processed input for this frame, as late as
+		// possible before the views are used
+		LookInput lookDelta;
+		if (inputSampler != nullptr)
+		{
+			LookInput latestLook = inputSampler->getLookInput();
+			lookDelta.mouse = latestLook.mouse - consumedLook.mouse;
+			lookDelta.gamepad = latestLook.gamepad - consumedLook.gamepad;
+		}
+
+		applyLateLatchedInput(lookDelta);
+
 		// Gather all views
 		Vector<RendererView*> views;
 		for (auto& rtInfo : sceneInfo.renderTargets)
@@ -353,11 +403,22 @@ namespace bs { namespace ct
 		mMainViewGroup.setViews(views.data(), (UINT32)views.size());
 		mMainViewGroup.determineVisibility(sceneInfo);
 
+		// Report how large are textures on screen, so the streaming system knows which mip levels to load
+		mTextureUsage.clear();
+		for (auto& view : views)
+			view->calculateTextureUsage(sceneInfo.renderables, sceneInfo.renderableCullInfos, mTextureUsage);
+
+		TextureStreamingManager::instance()._notifyTextureUsage(mTextureUsage);
+
 		// Render shadow maps
+		gProfilerGPU().beginSample("ShadowMaps");
 		ShadowRendering::instance().renderShadowMaps(*mScene, mMainViewGroup, frameInfo);
+		gProfilerGPU().endSample("ShadowMaps");
 
 		// Update reflection probes
+		gProfilerGPU().beginSample("LightProbes");
 		updateLightProbes(frameInfo);
+		gProfilerGPU().endSample("LightProbes");
 
 		// Render everything
 		renderViews(mMainViewGroup, frameInfo);
@@ -374,6 +435,50 @@ namespace bs { namespace ct
 		gProfilerCPU().endSample("renderAllCore");
 	}
 
+	void RenderBeast::applyLateLatchedInput(const LookInput& lookDelta)
+	{
+		const SceneInfo& sceneInfo = mScene->getSceneInfo();
+		for (auto& view : sceneInfo.views)
+		{
+			Camera* camera = view->getSceneCamera();
+			if (camera == nullptr || !camera->isLateLatchEnabled() || camera->isCustomViewMatrixEnabled())
+				continue;
+
+			// Always recalculate from the camera's own transform (even if there is no new input), so rotation from 
+			// previous frames doesn't carry over into views of cameras that weren't updated since
+			const Vector2& mouseSensitivity = camera->getLateLatchMouseSensitivity();
+			const Vector2& gamepadSensitivity = camera->getLateLatchGamepadSensitivity();
+
+			Degree yaw(lookDelta.mouse.x * mouseSensitivity.x + lookDelta.gamepad.x * gamepadSensitivity.x);
+			Degree pitch(lookDelta.mouse.y * mouseSensitivity.y + lookDelta.gamepad.y * gamepadSensitivity.y);
+
+			const Vector3& position = camera->getPosition();
+			Quaternion rotation = Quaternion(Vector3::UNIT_Y, yaw) * camera->getRotation() * 
+				Quaternion(Vector3::UNIT_X, pitch);
+			rotation.normalize();
+
+			Matrix4 viewMatrix;
+			viewMatrix.makeView(position, rotation);
+
+			Matrix4 worldMatrix;
+			worldMatrix.setTRS(position, rotation, Vector3::ONE);
+
+			const Vector<Plane>& frustumPlanes = camera->getFrustum().getPlanes();
+			Vector<Plane> worldPlanes(frustumPlanes.size());
+			for (UINT32 i = 0; i < (UINT32)frustumPlanes.size(); i++)
+				worldPlanes[i] = worldMatrix.multiplyAffine(frustumPlanes[i]);
+
+			view->setTransform(
+				position,
+				rotation.rotate(-Vector3::UNIT_Z),
+				viewMatrix,
+				camera->getProjectionMatrixRS(),
+				ConvexVolume(worldPlanes));
+
+			view->updatePerViewBuffer();
+		}
+	}
+
 	void RenderBeast::renderViews(const RendererViewGroup& viewGroup, const FrameInfo& frameInfo)
 	{
 		const SceneInfo& sceneInfo = mScene->getSceneInfo();
@@ -436,7 +541,9 @@ namespace bs { namespace ct
 		viewInfo->beginRendering(true);
 
 		// Prepare light grid required for transparent object rendering
+		gProfilerGPU().beginSample("LightGrid");
 		mLightGrid->updateGrid(*viewInfo, *mVisibleLightInfo, *mVisibleReflProbeInfo, viewProps.noLighting);
+		gProfilerGPU().endSample("LightGrid");
 
 		SPtr<GpuParamBlockBuffer> gridParams;
 		SPtr<GpuBuffer> gridLightOffsetsAndSize, gridLightIndices;
@@ -506,6 +613,8 @@ namespace bs { namespace ct
 			}
 		}
 
+		gProfilerGPU().beginSample("BasePass");
+
 		SPtr<RenderTargets> renderTargets = viewInfo->getRenderTargets();
 		renderTargets->allocate(RTT_GBuffer);
 		renderTargets->bindGBuffer();
@@ -530,11 +639,7 @@ namespace bs { namespace ct
 
 		// Render base pass
 		const Vector<RenderQueueElement>& opaqueElements = viewInfo->getOpaqueQueue()->getSortedElements();
-		for (auto iter = opaqueElements.begin(); iter != opaqueElements.end(); ++iter)
-		{
-			BeastRenderableElement* renderElem = static_cast<BeastRenderableElement*>(iter->renderElem);
-			renderElement(*renderElem, iter->passIdx, iter->applyPass, viewProj);
-		}
+		renderQueue(opaqueElements, viewProj, renderTargets->getGBufferRT(), 0);
 
 		// Trigger post-base-pass callbacks
 		if (viewProps.triggerCallbacks)
@@ -555,6 +660,9 @@ namespace bs { namespace ct
 		RenderAPI& rapi = RenderAPI::instance();
 		rapi.setRenderTarget(nullptr);
 
+		gProfilerGPU().endSample("BasePass");
+		gProfilerGPU().beginSample("Lighting");
+
 		// Accumulate all direct lighting into the light accumulation texture
 		renderTargets->allocate(RTT_LightAccumulation);
 
@@ -625,6 +733,9 @@ namespace bs { namespace ct
 												  renderTargets->getSceneColor());
 		}
 
+		gProfilerGPU().endSample("Lighting");
+		gProfilerGPU().beginSample("Skybox");
+
 		// Render skybox (if any)
 		if (mSkyboxTexture != nullptr)
 		{
@@ -644,16 +755,15 @@ namespace bs { namespace ct
 
 		renderTargets->bindSceneColor(false);
 
+		gProfilerGPU().endSample("Skybox");
+		gProfilerGPU().beginSample("Transparent");
+
 		// Render transparent objects
 		// TODO: Transparent objects cannot receive shadows. In order to support this I'd have to render the light occlusion
 		// for all lights affecting this object into a single (or a few) textures. I can likely use texture arrays for this,
 		// or to avoid sampling many textures, perhaps just jam it all in one or few texture channels. 
 		const Vector<RenderQueueElement>& transparentElements = viewInfo->getTransparentQueue()->getSortedElements();
-		for (auto iter = transparentElements.begin(); iter != transparentElements.end(); ++iter)
-		{
-			BeastRenderableElement* renderElem = static_cast<BeastRenderableElement*>(iter->renderElem);
-			renderElement(*renderElem, iter->passIdx, iter->applyPass, viewProj);
-		}
+		renderQueue(transparentElements, viewProj, renderTargets->getSceneColorRT(), 0);
 
 		// Trigger post-light-pass callbacks
 		if (viewProps.triggerCallbacks)
@@ -671,6 +781,9 @@ namespace bs { namespace ct
 			}
 		}
 
+		gProfilerGPU().endSample("Transparent");
+		gProfilerGPU().beginSample("PostProcess");
+
 		// Post-processing and final resolve
 		Rect2 viewportArea = viewProps.nrmViewRect;
 
@@ -703,6 +816,9 @@ namespace bs { namespace ct
 
 		renderTargets->release(RTT_SceneColor);
 
+		gProfilerGPU().endSample("PostProcess");
+		gProfilerGPU().beginSample("Overlay");
+
 		// Trigger overlay callbacks
 		if (viewProps.triggerCallbacks)
 		{
@@ -719,6 +835,8 @@ namespace bs { namespace ct
 			}
 		}
 
+		gProfilerGPU().endSample("Overlay");
+
 		viewInfo->endRendering();
 
 		gProfilerCPU().endSample("Render");
@@ -727,6 +845,7 @@ namespace bs { namespace ct
 	void RenderBeast::renderOverlay(RendererView* viewInfo)
 	{
 		gProfilerCPU().beginSample("RenderOverlay");
+		gProfilerGPU().beginSample("Overlay");
 
 		viewInfo->getPerViewBuffer()->flushToGPU();
 		viewInfo->beginRendering(false);
@@ -776,24 +895,129 @@ namespace bs { namespace ct
 
 		viewInfo->endRendering();
 
+		gProfilerGPU().endSample("Overlay");
 		gProfilerCPU().endSample("RenderOverlay");
 	}
 	
 	void RenderBeast::renderElement(const BeastRenderableElement& element, UINT32 passIdx, bool bindPass, 
-									const Matrix4& viewProj)
+									const Matrix4& viewProj, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		SPtr<Material> material = element.material;
 
 		if (bindPass)
-			gRendererUtility().setPass(material, passIdx, element.techniqueIdx);
+			gRendererUtility().setPass(material, passIdx, element.techniqueIdx, commandBuffer);
 
-		gRendererUtility().setPassParams(element.params, passIdx);
+		gRendererUtility().setPassParams(element.params, passIdx, commandBuffer);
 
 		if(element.morphVertexDeclaration == nullptr)
-			gRendererUtility().draw(element.mesh, element.subMesh);
+			gRendererUtility().draw(element.mesh, element.subMesh, 1, commandBuffer);
 		else
 			gRendererUtility().drawMorph(element.mesh, element.subMesh, element.morphShapeBuffer, 
-				element.morphVertexDeclaration);
+				element.morphVertexDeclaration, commandBuffer);
+	}
+
+	void RenderBeast::renderQueue(const Vector<RenderQueueElement>& elements, const Matrix4& viewProj, 
+		const SPtr<RenderTarget>& target, UINT32 readOnlyFlags)
+	{
+		RenderAPI& rapi = RenderAPI::instance();
+		UINT32 numElements = (UINT32)elements.size();
+
+		// Only split the queue if there's enough work to make up for the recording overhead
+		UINT32 numRanges = 1;
+		if (mCoreOptions->parallelRecording && rapi.getAPIInfo().isFlagSet(RenderAPIFeatureFlag::ParallelCBRecording))
+		{
+			UINT32 minPerRange = std::max(mCoreOptions->minElementsPerRecordingThread, 1U);
+			UINT32 maxRanges = TaskScheduler::instance().getNumWorkers() + 1;
+
+			numRanges = Math::clamp(numElements / minPerRange, 1U, maxRanges);
+		}
+
+		if (numRanges <= 1)
+		{
+			recordQueueRange(elements, 0, numElements, viewProj, nullptr);
+			return;
+		}
+
+		gProfilerCPU().beginSample("RecordRenderQueue");
+
+		UINT32 elementsPerRange = (numElements + numRanges - 1) / numRanges;
+
+		// Param buffers can be shared between elements (e.g. per-camera data), and uploading them isn't thread safe, so
+		// make sure they're all up to date before recording starts
+		UINT32 queueIdx = CommandSyncMask::getGlobalQueueIdx(GQT_GRAPHICS, 0);
+		for (auto& entry : elements)
+		{
+			BeastRenderableElement* renderElem = static_cast<BeastRenderableElement*>(entry.renderElem);
+			SPtr<GpuParams> gpuParams = renderElem->params->getGpuParams(entry.passIdx);
+			if (gpuParams == nullptr)
+				continue;
+
+			for (UINT32 i = 0; i < GPT_COUNT; i++)
+			{
+				SPtr<GpuParamDesc> paramDesc = gpuParams->getParamDesc((GpuProgramType)i);
+				if (paramDesc == nullptr)
+					continue;
+
+				for (auto& paramBlock : paramDesc->paramBlocks)
+				{
+					SPtr<GpuParamBlockBuffer> buffer = gpuParams->getParamBlockBuffer(paramBlock.second.set, 
+						paramBlock.second.slot);
+
+					if (buffer != nullptr)
+						buffer->flushToGPU(queueIdx);
+				}
+			}
+		}
+
+		// Command buffers must be created, and their render target set, on the core thread. The first range is recorded
+		// by this thread directly into the main command buffer, while the rest are recorded by the workers.
+		Vector<SPtr<CommandBuffer>> secondaryCBs;
+		Vector<SPtr<Task>> tasks;
+		for (UINT32 start = elementsPerRange; start < numElements; start += elementsPerRange)
+		{
+			UINT32 end = std::min(start + elementsPerRange, numElements);
+
+			SPtr<CommandBuffer> secondaryCB = CommandBuffer::create(GQT_GRAPHICS, 0, 0, true);
+			rapi.setRenderTarget(target, readOnlyFlags, RT_NONE, secondaryCB);
+			rapi.setViewport(Rect2(0.0f, 0.0f, 1.0f, 1.0f), secondaryCB);
+
+			SPtr<Task> task = Task::create("RecordRenderQueue", std::bind(&RenderBeast::recordQueueRange, this, 
+				std::cref(elements), start, end, std::cref(viewProj), secondaryCB), TaskPriority::High);
+			TaskScheduler::instance().addTask(task);
+
+			secondaryCBs.push_back(secondaryCB);
+			tasks.push_back(task);
+		}
+
+		recordQueueRange(elements, 0, elementsPerRange, viewProj, nullptr);
+
+		// Append in the original order, so the result is the same as when rendering the queue directly
+		for (UINT32 i = 0; i < (UINT32)tasks.size(); i++)
+		{
+			tasks[i]->wait();
+			rapi.addCommands(nullptr, secondaryCBs[i]);
+		}
+
+		// Meshes recorded on the workers must be notified they're in use from the core thread
+		for (UINT32 i = elementsPerRange; i < numElements; i++)
+		{
+			BeastRenderableElement* renderElem = static_cast<BeastRenderableElement*>(elements[i].renderElem);
+			renderElem->mesh->_notifyUsedOnGPU();
+		}
+
+		gProfilerCPU().endSample("RecordRenderQueue");
+	}
+
+	void RenderBeast::recordQueueRange(const Vector<RenderQueueElement>& elements, UINT32 start, UINT32 end, 
+		const Matrix4& viewProj, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		for (UINT32 i = start; i < end; i++)
+		{
+			const RenderQueueElement& entry = elements[i];
+
+			BeastRenderableElement* renderElem = static_cast<BeastRenderableElement*>(entry.renderElem);
+			renderElement(*renderElem, entry.passIdx, entry.applyPass || i == start, viewProj, commandBuffer);
+		}
 	}
 
 	void RenderBeast::updateLightProbes(const FrameInfo& frameInfo)
@@ -0,0 +1,16 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsRenderBeastTestSuite.h"
+#include "BsConsoleTestOutput.h"
+
+using namespace bs;
+
+int main()
+{
+	SPtr<TestSuite> tests = ct::RenderBeastTestSuite::create<ct::RenderBeastTestSuite>();
+
+	ConsoleTestOutput testOutput;
+	tests->run(testOutput);
+
+	return 0;
+}
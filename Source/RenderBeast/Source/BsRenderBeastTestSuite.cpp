@@ -0,0 +1,322 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsRenderBeastTestSuite.h"
+#include "BsGpuResourcePool.h"
+#include "BsRenderGraph.h"
+#include "BsLightGrid.h"
+#include "BsLightRendering.h"
+#include "BsImageBasedLighting.h"
+#include "BsThreadPool.h"
+#include "BsTaskScheduler.h"
+
+namespace bs { namespace ct
+{
+	/** Resource pool that doesn't create any GPU objects, and only counts how many resources it was asked to create. */
+	class TestGpuResourcePool : public GpuResourcePool
+	{
+	public:
+		UINT32 numAllocations = 0;
+
+	protected:
+		void allocate(PooledRenderTexture&, const POOLED_RENDER_TEXTURE_DESC&) override
+		{
+			numAllocations++;
+		}
+
+		void allocate(PooledStorageBuffer&, const POOLED_STORAGE_BUFFER_DESC&) override
+		{
+			numAllocations++;
+		}
+	};
+
+	/** Deterministic pseudo-random number generator, so test failures are reproducible. */
+	class TestRandom
+	{
+	public:
+		/** Returns a value in range [min, max]. */
+		float get(float min, float max)
+		{
+			mState = mState * 1664525u + 1013904223u;
+			return min + (max - min) * ((mState >> 8) / (float)(1 << 24));
+		}
+
+		Vector3 getVector(float min, float max)
+		{
+			float x = get(min, max);
+			float y = get(min, max);
+			float z = get(min, max);
+
+			return Vector3(x, y, z);
+		}
+
+	private:
+		UINT32 mState = 12345;
+	};
+
+	/** Checks does a sphere intersect a box, in the same way as the light grid assignment does. */
+	bool referenceIntersectsSphere(const Vector3& center, const Vector3& extent, const Vector3& position, float radius)
+	{
+		float distX = std::max(std::abs(position.x - center.x) - extent.x, 0.0f);
+		float distY = std::max(std::abs(position.y - center.y) - extent.y, 0.0f);
+		float distZ = std::max(std::abs(position.z - center.z) - extent.z, 0.0f);
+
+		return (distX * distX + distY * distY + distZ * distZ) <= radius * radius;
+	}
+
+	/** Checks does a spot light cone intersect the sphere bounding a box, in the same way as the light grid does. */
+	bool referenceIntersectsCone(const Vector3& center, const Vector3& extent, const Vector3& tip, 
+		const Vector3& direction, float angle, float cosAngle, float range)
+	{
+		float cellRadius = extent.length();
+
+		Vector3 toCell = center - tip;
+		float distAlongAxis = toCell.x * direction.x + toCell.y * direction.y + toCell.z * direction.z;
+		float distSqrd = toCell.x * toCell.x + toCell.y * toCell.y + toCell.z * toCell.z;
+		float distFromAxis = std::sqrt(std::max(distSqrd - distAlongAxis * distAlongAxis, 0.0f));
+		float distToCone = cosAngle * distFromAxis - distAlongAxis * Math::sin(Radian(angle));
+
+		return distToCone <= cellRadius && distAlongAxis <= cellRadius + range && distAlongAxis >= -cellRadius;
+	}
+
+	RenderBeastTestSuite::RenderBeastTestSuite()
+	{
+		BS_ADD_TEST(RenderBeastTestSuite::testRenderGraphAliasing);
+		BS_ADD_TEST(RenderBeastTestSuite::testLightGridAssignment);
+	}
+
+	void RenderBeastTestSuite::startUp()
+	{
+		GpuResourcePool::startUp<TestGpuResourcePool>();
+
+		if (!TaskScheduler::isStarted())
+		{
+			ThreadPool::startUp<TThreadPool<ThreadNoPolicy>>(BS_THREAD_HARDWARE_CONCURRENCY + 1);
+			TaskScheduler::startUp();
+
+			mOwnsTaskScheduler = true;
+		}
+	}
+
+	void RenderBeastTestSuite::shutDown()
+	{
+		if (mOwnsTaskScheduler)
+		{
+			TaskScheduler::shutDown();
+			ThreadPool::shutDown();
+
+			mOwnsTaskScheduler = false;
+		}
+
+		GpuResourcePool::shutDown();
+	}
+
+	void RenderBeastTestSuite::testRenderGraphAliasing()
+	{
+		TestGpuResourcePool& pool = static_cast<TestGpuResourcePool&>(GpuResourcePool::instance());
+		UINT32 startNumAllocations = pool.numAllocations;
+
+		POOLED_RENDER_TEXTURE_DESC desc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_R8G8B8A8, 64, 64, TU_RENDERTARGET);
+
+		RenderGraph renderGraph;
+		std::weak_ptr<PooledRenderTexture> lastTexture;
+		for (UINT32 i = 0; i < 4; i++)
+		{
+			RenderGraphResource first = renderGraph.createTexture("First", desc);
+			RenderGraphResource second = renderGraph.createTexture("Second", desc);
+
+			// Only hold raw references, so the test doesn't keep the textures alive
+			PooledRenderTexture* firstTexture = nullptr;
+			PooledRenderTexture* secondTexture = nullptr;
+
+			renderGraph.addPass("WriteFirst", {}, { first }, 
+				[&, first](const RenderGraph& graph) 
+			{
+				firstTexture = graph.getTexture(first).get();
+				lastTexture = graph.getTexture(first);
+			});
+			renderGraph.addPass("ReadFirst", { first }, {}, [](const RenderGraph&) { }, true);
+			renderGraph.addPass("WriteSecond", {}, { second }, 
+				[&, second](const RenderGraph& graph) { secondTexture = graph.getTexture(second).get(); });
+			renderGraph.addPass("ReadSecond", { second }, {}, [](const RenderGraph&) { }, true);
+			renderGraph.execute();
+
+			// Lifetimes don't overlap, so both resources must share the same texture
+			BS_TEST_ASSERT(firstTexture != nullptr && firstTexture == secondTexture);
+
+			// The texture must be kept alive and re-used between executions, instead of being re-created
+			BS_TEST_ASSERT(pool.numAllocations == startNumAllocations + 1);
+		}
+
+		// Texture must be freed once the graph stops using it
+		for (UINT32 i = 0; i < 16; i++)
+			renderGraph.execute();
+
+		BS_TEST_ASSERT(lastTexture.expired());
+	}
+
+	void RenderBeastTestSuite::testLightGridAssignment()
+	{
+		static const UINT32 NUM_DIRECTIONAL = 1;
+		static const UINT32 NUM_RADIAL = 40;
+		static const UINT32 NUM_SPOT = 30;
+		static const UINT32 NUM_PROBES = 20;
+		static const UINT32 MAX_PER_CELL = 16;
+
+		TestRandom random;
+
+		Vector3 cameraPosition(3.0f, 2.0f, 10.0f);
+		Quaternion cameraRotation(Degree(-10.0f), Degree(30.0f), Degree(0.0f));
+
+		LightGridViewInfo view;
+		view.viewTransform = Matrix4::view(cameraPosition, cameraRotation);
+		view.projTransform = Matrix4::projectionPerspective(Degree(90.0f), 16.0f / 9.0f, 0.5f, 100.0f);
+		view.invProjTransform = view.projTransform.inverse();
+		view.nearFar = Vector2(0.5f, 100.0f);
+
+		// Same as RendererView::getNDCZToViewZ(), for a perspective projection
+		view.NDCZToViewZ.x = view.projTransform[2][3] / view.projTransform[3][2];
+		view.NDCZToViewZ.y = -view.projTransform[2][2] / view.projTransform[3][2];
+
+		// Place lights in front of the camera, so most of them end up overlapping some cells
+		auto getPosition = [&]()
+		{
+			Vector3 local(random.get(-40.0f, 40.0f), random.get(-25.0f, 25.0f), random.get(-60.0f, 5.0f));
+			return cameraPosition + cameraRotation.rotate(local);
+		};
+
+		Vector<LightData> lights(NUM_DIRECTIONAL + NUM_RADIAL + NUM_SPOT);
+		for(UINT32 i = 0; i < (UINT32)lights.size(); i++)
+		{
+			LightData& light = lights[i];
+
+			light.position = getPosition();
+			light.attRadius = random.get(1.0f, 10.0f);
+			light.direction = Vector3::normalize(random.getVector(-1.0f, 1.0f) + Vector3(0.0f, 0.0f, -0.1f));
+
+			float angle = random.get(0.2f, 1.2f);
+			light.spotAngles = Vector3(angle, Math::cos(Radian(angle)), 0.0f);
+			light.shiftedLightPosition = light.position - light.direction * random.get(0.0f, 1.0f);
+		}
+
+		Vector<ReflProbeData> probes(NUM_PROBES);
+		for(UINT32 i = 0; i < NUM_PROBES; i++)
+		{
+			probes[i].position = getPosition();
+			probes[i].radius = random.get(2.0f, 15.0f);
+		}
+
+		INT32 gridSizeValues[3] = { 12, 7, 16 };
+		Vector3I gridSize(gridSizeValues);
+
+		INT32 lightCountValues[3] = { (INT32)NUM_DIRECTIONAL, (INT32)NUM_RADIAL, (INT32)NUM_SPOT };
+		Vector3I lightCounts(lightCountValues);
+
+		LightGridCPU lightGrid;
+		lightGrid.assign(gridSize, MAX_PER_CELL, view, lights.data(), lightCounts, probes.data(), NUM_PROBES);
+
+		const Vector<UINT32>& lightOffsetsAndSize = lightGrid.getLightOffsetsAndSize();
+		const Vector<UINT32>& lightIndices = lightGrid.getLightIndices();
+		const Vector<UINT32>& probeOffsetsAndSize = lightGrid.getProbeOffsetsAndSize();
+		const Vector<UINT32>& probeIndices = lightGrid.getProbeIndices();
+
+		UINT32 numCells = gridSize[0] * gridSize[1] * gridSize[2];
+		BS_TEST_ASSERT(lightOffsetsAndSize.size() == numCells * 4);
+		BS_TEST_ASSERT(probeOffsetsAndSize.size() == numCells * 2);
+
+		if (lightOffsetsAndSize.size() != numCells * 4 || probeOffsetsAndSize.size() != numCells * 2)
+			return;
+
+		// Compare against a brute force assignment, testing every light against every cell
+		UINT32 numAssignedLights = 0;
+		UINT32 expectedLightOffset = 0;
+		UINT32 expectedProbeOffset = 0;
+		for(INT32 z = 0; z < gridSize[2]; z++)
+		{
+			for(INT32 y = 0; y < gridSize[1]; y++)
+			{
+				for(INT32 x = 0; x < gridSize[0]; x++)
+				{
+					UINT32 cellIdx = (z * gridSize[1] + y) * gridSize[0] + x;
+
+					INT32 cell[3] = { x, y, z };
+
+					Vector3 center;
+					Vector3 extent;
+					LightGridCPU::calcCellBounds(gridSize, view, Vector3I(cell), center, extent);
+
+					Vector<UINT32> expectedRadial;
+					for(UINT32 i = NUM_DIRECTIONAL; i < NUM_DIRECTIONAL + NUM_RADIAL; i++)
+					{
+						Vector3 position = view.viewTransform.multiplyAffine(lights[i].position);
+						if (referenceIntersectsSphere(center, extent, position, lights[i].attRadius))
+							expectedRadial.push_back(i);
+					}
+
+					Vector<UINT32> expectedSpot;
+					for(UINT32 i = NUM_DIRECTIONAL + NUM_RADIAL; i < (UINT32)lights.size(); i++)
+					{
+						const LightData& light = lights[i];
+
+						Vector3 position = view.viewTransform.multiplyAffine(light.position);
+						if (!referenceIntersectsSphere(center, extent, position, light.attRadius))
+							continue;
+
+						Vector3 tip = view.viewTransform.multiplyAffine(light.shiftedLightPosition);
+						Vector3 direction = Vector3::normalize(view.viewTransform.multiplyDirection(light.direction));
+						float range = light.attRadius + light.position.distance(light.shiftedLightPosition);
+
+						if (referenceIntersectsCone(center, extent, tip, direction, light.spotAngles.x, 
+							light.spotAngles.y, range))
+							expectedSpot.push_back(i);
+					}
+
+					Vector<UINT32> expectedProbes;
+					for(UINT32 i = 0; i < NUM_PROBES; i++)
+					{
+						Vector3 position = view.viewTransform.multiplyAffine(probes[i].position);
+						if (referenceIntersectsSphere(center, extent, position, probes[i].radius))
+							expectedProbes.push_back(i);
+					}
+
+					// Lists are truncated to the maximum number of entries per cell, with radial lights taking priority
+					UINT32 numRadial = std::min((UINT32)expectedRadial.size(), MAX_PER_CELL);
+					UINT32 numSpot = std::min((UINT32)expectedSpot.size(), MAX_PER_CELL - numRadial);
+					UINT32 numProbes = std::min((UINT32)expectedProbes.size(), MAX_PER_CELL);
+
+					expectedRadial.resize(numRadial);
+					expectedSpot.resize(numSpot);
+					expectedProbes.resize(numProbes);
+
+					BS_TEST_ASSERT(lightOffsetsAndSize[cellIdx * 4 + 0] == expectedLightOffset);
+					BS_TEST_ASSERT(lightOffsetsAndSize[cellIdx * 4 + 1] == numRadial);
+					BS_TEST_ASSERT(lightOffsetsAndSize[cellIdx * 4 + 2] == numSpot);
+					BS_TEST_ASSERT(probeOffsetsAndSize[cellIdx * 2 + 0] == expectedProbeOffset);
+					BS_TEST_ASSERT(probeOffsetsAndSize[cellIdx * 2 + 1] == numProbes);
+
+					Vector<UINT32> expectedLights = expectedRadial;
+					expectedLights.insert(expectedLights.end(), expectedSpot.begin(), expectedSpot.end());
+
+					UINT32 lightOffset = lightOffsetsAndSize[cellIdx * 4 + 0];
+					bool lightsMatch = (lightOffset + expectedLights.size()) <= lightIndices.size() &&
+						std::equal(expectedLights.begin(), expectedLights.end(), lightIndices.begin() + lightOffset);
+					BS_TEST_ASSERT(lightsMatch);
+
+					UINT32 probeOffset = probeOffsetsAndSize[cellIdx * 2 + 0];
+					bool probesMatch = (probeOffset + expectedProbes.size()) <= probeIndices.size() &&
+						std::equal(expectedProbes.begin(), expectedProbes.end(), probeIndices.begin() + probeOffset);
+					BS_TEST_ASSERT(probesMatch);
+
+					expectedLightOffset += (UINT32)expectedLights.size();
+					expectedProbeOffset += (UINT32)expectedProbes.size();
+					numAssignedLights += (UINT32)expectedLights.size();
+				}
+			}
+		}
+
+		BS_TEST_ASSERT(lightIndices.size() == expectedLightOffset);
+		BS_TEST_ASSERT(probeIndices.size() == expectedProbeOffset);
+
+		// Make sure the scene actually exercises the assignment
+		BS_TEST_ASSERT(numAssignedLights > 0);
+	}
+}}
@@ -0,0 +1,237 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsRenderGraph.h"
+
+namespace bs { namespace ct
+{
+	RenderGraphResource RenderGraph::createTexture(const String& name, const POOLED_RENDER_TEXTURE_DESC& desc)
+	{
+		ResourceInfo info;
+		info.name = name;
+		info.isTexture = true;
+		info.textureDesc = desc;
+
+		mResources.push_back(info);
+		return RenderGraphResource((UINT32)mResources.size() - 1);
+	}
+
+	RenderGraphResource RenderGraph::createBuffer(const String& name, const POOLED_STORAGE_BUFFER_DESC& desc)
+	{
+		ResourceInfo info;
+		info.name = name;
+		info.isTexture = false;
+		info.bufferDesc = desc;
+
+		mResources.push_back(info);
+		return RenderGraphResource((UINT32)mResources.size() - 1);
+	}
+
+	RenderGraphResource RenderGraph::importTexture(const String& name, const SPtr<PooledRenderTexture>& texture)
+	{
+		ResourceInfo info;
+		info.name = name;
+		info.isTexture = true;
+		info.isImported = true;
+		info.texture = texture;
+
+		mResources.push_back(info);
+		return RenderGraphResource((UINT32)mResources.size() - 1);
+	}
+
+	RenderGraphResource RenderGraph::importBuffer(const String& name, const SPtr<PooledStorageBuffer>& buffer)
+	{
+		ResourceInfo info;
+		info.name = name;
+		info.isTexture = false;
+		info.isImported = true;
+		info.buffer = buffer;
+
+		mResources.push_back(info);
+		return RenderGraphResource((UINT32)mResources.size() - 1);
+	}
+
+	void RenderGraph::addPass(const String& name, const Vector<RenderGraphResource>& reads,
+		const Vector<RenderGraphResource>& writes, const RenderGraphPassCallback& callback, bool hasSideEffects)
+	{
+		PassInfo pass;
+		pass.name = name;
+		pass.callback = callback;
+		pass.hasSideEffects = hasSideEffects;
+
+		for (auto& entry : reads)
+		{
+			assert(entry.isValid() && entry.id < (UINT32)mResources.size());
+			pass.reads.push_back(entry.id);
+		}
+
+		for (auto& entry : writes)
+		{
+			assert(entry.isValid() && entry.id < (UINT32)mResources.size());
+			pass.writes.push_back(entry.id);
+		}
+
+		mPasses.push_back(pass);
+	}
+
+	void RenderGraph::execute()
+	{
+		cullPasses();
+		calculateLifetimes();
+
+		for (UINT32 i = 0; i < (UINT32)mPasses.size(); i++)
+		{
+			PassInfo& pass = mPasses[i];
+			if (pass.isCulled)
+				continue;
+
+			// Allocate transient resources first used by this pass
+			for (auto& resource : mResources)
+			{
+				if (resource.isImported || resource.firstPass != i)
+					continue;
+
+				if (resource.isTexture)
+					resource.texture = GpuResourcePool::instance().get(resource.textureDesc);
+				else
+					resource.buffer = GpuResourcePool::instance().get(resource.bufferDesc);
+			}
+
+			pass.callback(*this);
+
+			// Return transient resources no longer needed to the pool, so following passes may re-use them
+			for (auto& resource : mResources)
+			{
+				if (resource.isImported || resource.lastPass != i)
+					continue;
+
+				release(resource);
+			}
+		}
+
+		clear();
+
+		// Free transient resources that haven't been needed for a while
+		for (auto iter = mRetainedTextures.begin(); iter != mRetainedTextures.end();)
+		{
+			if ((mNumExecutions - iter->second.lastUsed) >= MAX_UNUSED_EXECUTIONS)
+				iter = mRetainedTextures.erase(iter);
+			else
+				++iter;
+		}
+
+		for (auto iter = mRetainedBuffers.begin(); iter != mRetainedBuffers.end();)
+		{
+			if ((mNumExecutions - iter->second.lastUsed) >= MAX_UNUSED_EXECUTIONS)
+				iter = mRetainedBuffers.erase(iter);
+			else
+				++iter;
+		}
+
+		mNumExecutions++;
+	}
+
+	const SPtr<PooledRenderTexture>& RenderGraph::getTexture(RenderGraphResource resource) const
+	{
+		assert(resource.isValid() && mResources[resource.id].isTexture);
+		return mResources[resource.id].texture;
+	}
+
+	const SPtr<PooledStorageBuffer>& RenderGraph::getBuffer(RenderGraphResource resource) const
+	{
+		assert(resource.isValid() && !mResources[resource.id].isTexture);
+		return mResources[resource.id].buffer;
+	}
+
+	void RenderGraph::cullPasses()
+	{
+		// Walk the passes in reverse, keeping track of resources whose contents are required by passes executed later
+		Vector<bool> isResourceUsed(mResources.size(), false);
+		for (UINT32 i = 0; i < (UINT32)mResources.size(); i++)
+			isResourceUsed[i] = mResources[i].isImported;
+
+		mNumCulledPasses = 0;
+		for (auto iter = mPasses.rbegin(); iter != mPasses.rend(); ++iter)
+		{
+			PassInfo& pass = *iter;
+
+			bool isUsed = pass.hasSideEffects;
+			for (auto& entry : pass.writes)
+				isUsed |= isResourceUsed[entry];
+
+			pass.isCulled = !isUsed;
+			if (pass.isCulled)
+			{
+				mNumCulledPasses++;
+				continue;
+			}
+
+			for (auto& entry : pass.reads)
+				isResourceUsed[entry] = true;
+		}
+	}
+
+	void RenderGraph::calculateLifetimes()
+	{
+		for (UINT32 i = 0; i < (UINT32)mPasses.size(); i++)
+		{
+			const PassInfo& pass = mPasses[i];
+			if (pass.isCulled)
+				continue;
+
+			auto registerUse = [&](UINT32 resourceIdx)
+			{
+				ResourceInfo& resource = mResources[resourceIdx];
+
+				if (resource.firstPass == (UINT32)-1)
+					resource.firstPass = i;
+
+				resource.lastPass = i;
+			};
+
+			for (auto& entry : pass.reads)
+				registerUse(entry);
+
+			for (auto& entry : pass.writes)
+				registerUse(entry);
+		}
+	}
+
+	void RenderGraph::release(ResourceInfo& resource)
+	{
+		if (resource.texture != nullptr)
+		{
+			GpuResourcePool::instance().release(resource.texture);
+
+			RetainedResource<PooledRenderTexture>& retained = mRetainedTextures[resource.texture.get()];
+			retained.resource = resource.texture;
+			retained.lastUsed = mNumExecutions;
+
+			resource.texture = nullptr;
+		}
+
+		if (resource.buffer != nullptr)
+		{
+			GpuResourcePool::instance().release(resource.buffer);
+
+			RetainedResource<PooledStorageBuffer>& retained = mRetainedBuffers[resource.buffer.get()];
+			retained.resource = resource.buffer;
+			retained.lastUsed = mNumExecutions;
+
+			resource.buffer = nullptr;
+		}
+	}
+
+	void RenderGraph::clear()
+	{
+		for (auto& resource : mResources)
+		{
+			if (resource.isImported)
+				continue;
+
+			release(resource);
+		}
+
+		mResources.clear();
+		mPasses.clear();
+	}
+}}
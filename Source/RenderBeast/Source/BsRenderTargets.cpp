@@ -272,6 +272,11 @@ namespace bs { namespace ct
 		RenderAPI::instance().clearViewport(FBT_COLOR, Color::ZERO, 1.0f, 0, 0xFF & ~0x01);
 	}
 
+	SPtr<RenderTexture> RenderTargets::getGBufferRT() const
+	{
+		return mGBufferRT;
+	}
+
 	void RenderTargets::bindSceneColor(bool readOnlyDepthStencil)
 	{
 		int readOnlyFlags = 0;
@@ -285,6 +290,11 @@ namespace bs { namespace ct
 		rapi.setViewport(area);
 	}
 
+	SPtr<RenderTexture> RenderTargets::getSceneColorRT() const
+	{
+		return mSceneColorRT;
+	}
+
 	void RenderTargets::bindLightAccumulation()
 	{
 		RenderAPI& rapi = RenderAPI::instance();
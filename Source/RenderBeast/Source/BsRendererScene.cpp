@@ -11,6 +11,7 @@
 #include "BsGpuParamsSet.h"
 #include "BsRenderBeastOptions.h"
 #include "BsRenderBeast.h"
+#include "BsGpuBuffer.h"
 
 namespace bs {	namespace ct
 {
@@ -681,15 +682,35 @@ namespace bs {	namespace ct
 		if (mInfo.renderableReady[idx])
 			return;
 		
-		// Note: Before uploading bone matrices perhaps check if they has actually been changed since last frame
-		mInfo.renderables[idx]->renderable->updateAnimationBuffers(frameInfo.animData);
-		
+		RendererObject* rendererObject = mInfo.renderables[idx];
+		Renderable* renderable = rendererObject->renderable;
+		renderable->updateAnimationBuffers(frameInfo.animData);
+
+		// Bone matrices live in a palette shared by all renderables, which gets re-allocated when it grows
+		const SPtr<GpuBuffer>& boneMatrixBuffer = renderable->getBoneMatrixBuffer();
+		if (boneMatrixBuffer != nullptr)
+		{
+			for (auto& element : rendererObject->elements)
+			{
+				if (element.boneMatrixBuffer == boneMatrixBuffer)
+					continue;
+
+				element.boneMatrixBuffer = boneMatrixBuffer;
+
+				SPtr<GpuParams> gpuParams = element.params->getGpuParams();
+				if (gpuParams->hasBuffer(GPT_VERTEX_PROGRAM, "boneMatrices"))
+					gpuParams->setBuffer(GPT_VERTEX_PROGRAM, "boneMatrices", boneMatrixBuffer);
+			}
+		}
+
+		gPerObjectParamDef.gBoneOffset.set(rendererObject->perObjectParamBuffer, (INT32)renderable->getBoneMatrixOffset());
+
 		// Note: Could this step be moved in notifyRenderableUpdated, so it only triggers when material actually gets
 		// changed? Although it shouldn't matter much because if the internal versions keeping track of dirty params.
-		for (auto& element : mInfo.renderables[idx]->elements)
+		for (auto& element : rendererObject->elements)
 			element.material->updateParamsSet(element.params);
 		
-		mInfo.renderables[idx]->perObjectParamBuffer->flushToGPU();
+		rendererObject->perObjectParamBuffer->flushToGPU();
 		mInfo.renderableReady[idx] = true;
 	}
 }}
@@ -10,6 +10,8 @@
 #include "BsLightRendering.h"
 #include "BsGpuParamsSet.h"
 #include "BsRendererScene.h"
+#include "BsMaterialParams.h"
+#include "BsTextureStreamingManager.h"
 
 namespace bs { namespace ct
 {
@@ -291,6 +293,71 @@ namespace bs { namespace ct
 		}
 	}
 
+	void RendererView::calculateTextureUsage(const Vector<RendererObject*>& renderables, 
+		const Vector<CullInfo>& cullInfos, UnorderedMap<const Texture*, float>& usage) const
+	{
+		if (mProperties.isOverlay || !TextureStreamingManager::isStarted() || 
+			!TextureStreamingManager::instance()._isActive())
+			return;
+
+		// Scale that converts a view space size into a size in pixels, at unit distance
+		float projScale = mProperties.projTransform[1][1] * mProperties.viewRect.height * 0.5f;
+
+		for (UINT32 i = 0; i < (UINT32)cullInfos.size(); i++)
+		{
+			if (!mVisibility.renderables[i])
+				continue;
+
+			const Sphere& bounds = cullInfos[i].bounds.getSphere();
+
+			float screenRadius;
+			if (mProperties.projType == PT_PERSPECTIVE)
+			{
+				float distance = (bounds.getCenter() - mProperties.viewOrigin).length() - bounds.getRadius();
+				distance = std::max(distance, mProperties.nearPlane);
+
+				screenRadius = bounds.getRadius() * projScale / distance;
+			}
+			else
+				screenRadius = bounds.getRadius() * projScale;
+
+			// Note: Assuming textures are mapped once over the entire object. This doesn't account for tiling or texture
+			// atlases, but only relative sizes matter for mip selection so this is a reasonable approximation.
+			float screenSize = screenRadius * 2.0f;
+			for (auto& element : renderables[i]->elements)
+			{
+				SPtr<MaterialParams> params = element.material->_getInternalParams();
+				if (element.streamableTexturesParams != params.get() || 
+					element.streamableTexturesVersion != params->getParamVersion())
+				{
+					element.streamableTextures.clear();
+					for (UINT32 j = 0; j < params->getNumParams(); j++)
+					{
+						const MaterialParams::ParamData* paramData = params->getParamData(j);
+						if (paramData->type != MaterialParams::ParamType::Texture)
+							continue;
+
+						SPtr<Texture> texture;
+						TextureSurface surface;
+						params->getTexture(*paramData, texture, surface);
+
+						if (texture != nullptr && TextureStreamingManager::_canStream(texture->getProperties()))
+							element.streamableTextures.push_back(texture.get());
+					}
+
+					element.streamableTexturesParams = params.get();
+					element.streamableTexturesVersion = params->getParamVersion();
+				}
+
+				for (auto& texture : element.streamableTextures)
+				{
+					float& maxScreenSize = usage[texture];
+					maxScreenSize = std::max(maxScreenSize, screenSize);
+				}
+			}
+		}
+	}
+
 	Vector2 RendererView::getDeviceZToViewZ(const Matrix4& projMatrix)
 	{
 		// Returns a set of values that will transform depth buffer values (in range [0, 1]) to a distance
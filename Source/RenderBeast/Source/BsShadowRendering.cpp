@@ -461,6 +461,31 @@ namespace bs { namespace ct
 		return mShadowMap->renderTexture;
 	}
 
+	ShadowCachedMap::ShadowCachedMap(UINT32 size, bool cube)
+		:ShadowMapBase(size), mIsDirty(true)
+	{
+		if (cube)
+		{
+			mShadowMap = GpuResourcePool::instance().get(
+				POOLED_RENDER_TEXTURE_DESC::createCube(SHADOW_MAP_FORMAT, size, size, TU_DEPTHSTENCIL));
+		}
+		else
+		{
+			mShadowMap = GpuResourcePool::instance().get(
+				POOLED_RENDER_TEXTURE_DESC::create2D(SHADOW_MAP_FORMAT, size, size, TU_DEPTHSTENCIL));
+		}
+	}
+
+	ShadowCachedMap::~ShadowCachedMap()
+	{
+		GpuResourcePool::instance().release(mShadowMap);
+	}
+
+	SPtr<RenderTexture> ShadowCachedMap::getTarget() const
+	{
+		return mShadowMap->renderTexture;
+	}
+
 	ShadowCascadedMap::ShadowCascadedMap(UINT32 size)
 		:ShadowMapBase(size)
 	{
@@ -558,15 +583,78 @@ namespace bs { namespace ct
 		mCascadedShadowMaps.clear();
 		mDynamicShadowMaps.clear();
 		mShadowCubemaps.clear();
+		mCachedShadowMaps.clear();
+	}
+
+	void ShadowRendering::notifyLightChanged(const Light* light)
+	{
+		mCachedShadowMaps.erase(light);
+	}
+
+	void ShadowRendering::notifyCasterChanged(const Sphere& bounds)
+	{
+		for (auto& entry : mCachedShadowMaps)
+		{
+			if (entry.first->getBounds().intersects(bounds))
+				entry.second.markDirty();
+		}
+	}
+
+	bool ShadowRendering::isStaticCaster(const Renderable& renderable)
+	{
+		// Animated geometry changes its shape every frame, even if it cannot move
+		return renderable.getMobility() != ObjectMobility::Movable && 
+			renderable.getAnimType() == RenderableAnimType::None;
+	}
+
+	bool ShadowRendering::isCasterOfType(const Renderable& renderable, ShadowCasters casters)
+	{
+		switch(casters)
+		{
+		case ShadowCasters::Static:
+			return isStaticCaster(renderable);
+		case ShadowCasters::Dynamic:
+			return !isStaticCaster(renderable);
+		default:
+			return true;
+		}
+	}
+
+	bool ShadowRendering::useCachedShadows(const RendererLight& light)
+	{
+		return light.internal->getMobility() != ObjectMobility::Movable;
+	}
+
+	ShadowCachedMap& ShadowRendering::getCachedShadowMap(const Light* light, UINT32 size, bool cube)
+	{
+		auto iterFind = mCachedShadowMaps.find(light);
+		if (iterFind != mCachedShadowMaps.end())
+		{
+			if (iterFind->second.getSize() == size)
+				return iterFind->second;
+
+			mCachedShadowMaps.erase(iterFind);
+		}
+
+		auto iterNew = mCachedShadowMaps.emplace(std::piecewise_construct, std::forward_as_tuple(light),
+			std::forward_as_tuple(size, cube));
+
+		return iterNew.first->second;
+	}
+
+	void ShadowRendering::addShadowInfo(LightShadows& lightShadows, const ShadowInfo& info)
+	{
+		mShadowInfos[lightShadows.startIdx + lightShadows.numShadows] = info;
+		lightShadows.numShadows++;
 	}
 
 	void ShadowRendering::renderShadowMaps(RendererScene& scene, const RendererViewGroup& viewGroup, 
 		const FrameInfo& frameInfo)
 	{
-		// Note: Currently all shadows are dynamic and are rebuilt every frame. I should later added support for static
-		// shadow maps which can be used for immovable lights. Such a light can then maintain a set of shadow maps,
-		// one of which is static and only effects the static geometry, while the rest are per-object shadow maps used
-		// for dynamic objects. Then only a small subset of geometry needs to be redrawn, instead of everything.
+		// Note: Immovable spot and radial lights maintain a cached shadow map containing only static geometry, which is
+		// only re-rendered when such geometry within the light's influence changes. Dynamic geometry is rendered into a
+		// separate per-frame map, and the two are combined when projecting the shadows. Directional lights use cascades
+		// that follow the view, and are therefore always rebuilt every frame.
 
 		// Note: Add support for per-object shadows and a way to force a renderable to use per-object shadows. This can be
 		// used for adding high quality shadows on specific objects (e.g. important characters during cinematics).
@@ -594,6 +682,10 @@ namespace bs { namespace ct
 		for (auto& entry : mShadowCubemaps)
 			entry.clear();
 
+		// Cached maps keep their contents, this only updates the last used counter
+		for (auto& entry : mCachedShadowMaps)
+			entry.second.clear();
+
 		// Determine shadow map sizes and sort them
 		UINT32 shadowInfoCount = 0;
 		for (UINT32 i = 0; i < (UINT32)sceneInfo.spotLights.size(); ++i)
@@ -619,7 +711,8 @@ namespace bs { namespace ct
 			mSpotLightShadows[i].startIdx = shadowInfoCount;
 			mSpotLightShadows[i].numShadows = 0;
 
-			shadowInfoCount++; // For now, always a single fully dynamic shadow for a single light, but that may change
+			// Immovable lights have a cached map for static casters, and an optional per-frame map for dynamic casters
+			shadowInfoCount += useCachedShadows(light) ? 2 : 1;
 		}
 
 		for (UINT32 i = 0; i < (UINT32)sceneInfo.radialLights.size(); ++i)
@@ -645,7 +738,8 @@ namespace bs { namespace ct
 			mRadialLightShadows[i].startIdx = shadowInfoCount;
 			mRadialLightShadows[i].numShadows = 0;
 
-			shadowInfoCount++; // For now, always a single fully dynamic shadow for a single light, but that may change
+			// Immovable lights have a cached map for static casters, and an optional per-frame map for dynamic casters
+			shadowInfoCount += useCachedShadows(light) ? 2 : 1;
 		}
 
 		// Sort spot lights by size so they fit neatly in the texture atlas
@@ -669,14 +763,26 @@ namespace bs { namespace ct
 
 		for(auto& entry : mSpotLightShadowOptions)
 		{
-			UINT32 lightIdx = entry.lightIdx;
-			renderSpotShadowMap(sceneInfo.spotLights[lightIdx], entry, scene, frameInfo);
+			const RendererLight& light = sceneInfo.spotLights[entry.lightIdx];
+			if (useCachedShadows(light))
+			{
+				renderSpotShadowMap(light, entry, ShadowCasters::Static, scene, frameInfo);
+				renderSpotShadowMap(light, entry, ShadowCasters::Dynamic, scene, frameInfo);
+			}
+			else
+				renderSpotShadowMap(light, entry, ShadowCasters::All, scene, frameInfo);
 		}
 
 		for (auto& entry : mRadialLightShadowOptions)
 		{
-			UINT32 lightIdx = entry.lightIdx;
-			renderRadialShadowMap(sceneInfo.radialLights[lightIdx], entry, scene, frameInfo);
+			const RendererLight& light = sceneInfo.radialLights[entry.lightIdx];
+			if (useCachedShadows(light))
+			{
+				renderRadialShadowMap(light, entry, ShadowCasters::Static, scene, frameInfo);
+				renderRadialShadowMap(light, entry, ShadowCasters::Dynamic, scene, frameInfo);
+			}
+			else
+				renderRadialShadowMap(light, entry, ShadowCasters::All, scene, frameInfo);
 		}
 		
 		// Deallocate unused textures
@@ -705,6 +811,14 @@ namespace bs { namespace ct
 			else
 				++iter;
 		}
+
+		for(auto iter = mCachedShadowMaps.begin(); iter != mCachedShadowMaps.end();)
+		{
+			if (iter->second.getLastUsedCounter() >= MAX_UNUSED_FRAMES)
+				iter = mCachedShadowMaps.erase(iter);
+			else
+				++iter;
+		}
 	}
 
 	/**
@@ -745,6 +859,38 @@ namespace bs { namespace ct
 		return output;
 	}
 
+	/** Checks if all of the provided points lie on the outer side of any of the volume's planes. */
+	bool isOutside(const ConvexVolume& volume, const std::array<Vector3, 8>& points)
+	{
+		for (auto& plane : volume.getPlanes())
+		{
+			bool allOutside = true;
+			for (auto& point : points)
+			{
+				if (plane.getDistance(point) >= 0.0f)
+				{
+					allOutside = false;
+					break;
+				}
+			}
+
+			if (allOutside)
+				return true;
+		}
+
+		return false;
+	}
+
+	/**
+	 * Performs a conservative intersection test between two frustums. Returns false only if the frustums are guaranteed
+	 * not to intersect. Corners are expected in the format returned by getFrustum().
+	 */
+	bool intersectsConservative(const ConvexVolume& frustumA, const std::array<Vector3, 8>& cornersA,
+		const ConvexVolume& frustumB, const std::array<Vector3, 8>& cornersB)
+	{
+		return !isOutside(frustumA, cornersB) && !isOutside(frustumB, cornersA);
+	}
+
 	void ShadowRendering::renderShadowOcclusion(const RendererScene& scene, UINT32 shadowQuality, 
 		const RendererLight& rendererLight, UINT32 viewIdx)
 	{
@@ -797,7 +943,12 @@ namespace bs { namespace ct
 				float lightRadius = light->getAttenuationRadius() + viewProps.nearPlane * 3.0f;
 				bool viewerInsideVolume = (light->getPosition() - viewProps.viewOrigin).length() < lightRadius;
 
-				SPtr<Texture> shadowMap = mShadowCubemaps[shadowInfo.textureIdx].getTexture();
+				SPtr<Texture> shadowMap;
+				if (shadowInfo.isCached)
+					shadowMap = mCachedShadowMaps.at(light).getTexture();
+				else
+					shadowMap = mShadowCubemaps[shadowInfo.textureIdx].getTexture();
+
 				SPtr<RenderTargets> renderTargets = view->getRenderTargets();
 
 				ShadowProjectParams shadowParams(*light, shadowMap, 0, shadowOmniParamBuffer, perViewBuffer, *renderTargets);
@@ -885,7 +1036,9 @@ namespace bs { namespace ct
 
 				SPtr<Texture> shadowMap;
 				UINT32 shadowMapFace = 0;
-				if(!isCSM)
+				if (shadowInfo->isCached)
+					shadowMap = mCachedShadowMaps.at(light).getTexture();
+				else if(!isCSM)
 					shadowMap = mDynamicShadowMaps[shadowInfo->textureIdx].getTexture();
 				else
 				{
@@ -927,6 +1080,7 @@ namespace bs { namespace ct
 		ShadowInfo shadowInfo;
 		shadowInfo.lightIdx = lightIdx;
 		shadowInfo.textureIdx = -1;
+		shadowInfo.isCached = false;
 
 		UINT32 mapSize = std::min(mShadowMapSize, MAX_ATLAS_SIZE);
 		shadowInfo.area = Rect2I(0, 0, mapSize, mapSize);
@@ -956,6 +1110,18 @@ namespace bs { namespace ct
 
 		ShadowCascadedMap& shadowMap = mCascadedShadowMaps[shadowInfo.textureIdx];
 
+		// Find casters that can affect any of the cascades first, so that each cascade only needs to test those. Volume 
+		// is extruded towards the light so it includes off-screen casters that shadow visible receivers.
+		Sphere viewBounds;
+		ConvexVolume viewCullVolume = getCSMSplitFrustum(*view, -lightDir, 0, 1, viewBounds);
+
+		mShadowCasters.clear();
+		for (UINT32 i = 0; i < sceneInfo.renderables.size(); i++)
+		{
+			if (viewCullVolume.intersects(sceneInfo.renderableCullInfos[i].bounds.getSphere()))
+				mShadowCasters.push_back(i);
+		}
+
 		Matrix4 viewMat = Matrix4::view(light->getPosition(), light->getRotation());
 		for (int i = 0; i < NUM_CASCADE_SPLITS; ++i)
 		{
@@ -995,7 +1161,7 @@ namespace bs { namespace ct
 
 			mDepthDirectionalMat.bind(shadowParamsBuffer);
 
-			for (UINT32 j = 0; j < sceneInfo.renderables.size(); j++)
+			for (auto& j : mShadowCasters)
 			{
 				if (!cascadeCullVolume.intersects(sceneInfo.renderableCullInfos[j].bounds.getSphere()))
 					continue;
@@ -1022,48 +1188,36 @@ namespace bs { namespace ct
 	}
 
 	void ShadowRendering::renderSpotShadowMap(const RendererLight& rendererLight, const ShadowMapOptions& options,
-		RendererScene& scene, const FrameInfo& frameInfo)
+		ShadowCasters casters, RendererScene& scene, const FrameInfo& frameInfo)
 	{
 		Light* light = rendererLight.internal;
+		LightShadows& lightShadows = mSpotLightShadows[options.lightIdx];
 
-		const SceneInfo& sceneInfo = scene.getSceneInfo();
-		SPtr<GpuParamBlockBuffer> shadowParamsBuffer = gShadowParamsDef.createBuffer();
-
-		ShadowInfo mapInfo;
-		mapInfo.fadePerView = options.fadePercents;
-		mapInfo.lightIdx = options.lightIdx;
-		mapInfo.cascadeIdx = -1;
-
-		bool foundSpace = false;
-		for (UINT32 i = 0; i < (UINT32)mDynamicShadowMaps.size(); i++)
+		// If static casters haven't changed since last time, re-use the cached shadow map
+		ShadowCachedMap* cachedMap = nullptr;
+		if (casters == ShadowCasters::Static)
 		{
-			ShadowMapAtlas& atlas = mDynamicShadowMaps[i];
+			cachedMap = &getCachedShadowMap(light, options.mapSize, false);
+			cachedMap->markAsUsed();
 
-			if (atlas.addMap(options.mapSize, mapInfo.area, SHADOW_MAP_BORDER))
+			if (!cachedMap->isDirty())
 			{
-				mapInfo.textureIdx = i;
+				ShadowInfo mapInfo = cachedMap->getShadowInfo();
+				mapInfo.fadePerView = options.fadePercents;
+				mapInfo.lightIdx = options.lightIdx;
 
-				foundSpace = true;
-				break;
+				addShadowInfo(lightShadows, mapInfo);
+				return;
 			}
 		}
 
-		if (!foundSpace)
-		{
-			mapInfo.textureIdx = (UINT32)mDynamicShadowMaps.size();
-			mDynamicShadowMaps.push_back(ShadowMapAtlas(MAX_ATLAS_SIZE));
-
-			ShadowMapAtlas& atlas = mDynamicShadowMaps.back();
-			atlas.addMap(options.mapSize, mapInfo.area, SHADOW_MAP_BORDER);
-		}
-
-		mapInfo.updateNormArea(MAX_ATLAS_SIZE);
-		ShadowMapAtlas& atlas = mDynamicShadowMaps[mapInfo.textureIdx];
+		const SceneInfo& sceneInfo = scene.getSceneInfo();
 
-		RenderAPI& rapi = RenderAPI::instance();
-		rapi.setRenderTarget(atlas.getTarget());
-		rapi.setViewport(mapInfo.normArea);
-		rapi.clearViewport(FBT_DEPTH);
+		ShadowInfo mapInfo;
+		mapInfo.fadePerView = options.fadePercents;
+		mapInfo.lightIdx = options.lightIdx;
+		mapInfo.cascadeIdx = -1;
+		mapInfo.isCached = cachedMap != nullptr;
 
 		mapInfo.depthNear = 0.05f;
 		mapInfo.depthFar = light->getAttenuationRadius();
@@ -1083,13 +1237,6 @@ namespace bs { namespace ct
 
 		mapInfo.shadowVPTransform = proj * view;
 
-		gShadowParamsDef.gDepthBias.set(shadowParamsBuffer, mapInfo.depthBias);
-		gShadowParamsDef.gInvDepthRange.set(shadowParamsBuffer, 1.0f / mapInfo.depthRange);
-		gShadowParamsDef.gMatViewProj.set(shadowParamsBuffer, mapInfo.shadowVPTransform);
-		gShadowParamsDef.gNDCZToDeviceZ.set(shadowParamsBuffer, RendererView::getNDCZToDeviceZ());
-
-		mDepthNormalMat.bind(shadowParamsBuffer);
-
 		const Vector<Plane>& frustumPlanes = localFrustum.getPlanes();
 		Matrix4 worldMatrix = view.transpose();
 
@@ -1102,14 +1249,79 @@ namespace bs { namespace ct
 		}
 
 		ConvexVolume worldFrustum(worldPlanes);
+
+		mShadowCasters.clear();
 		for (UINT32 i = 0; i < sceneInfo.renderables.size(); i++)
 		{
+			if (!isCasterOfType(*sceneInfo.renderables[i]->renderable, casters))
+				continue;
+
 			if (!worldFrustum.intersects(sceneInfo.renderableCullInfos[i].bounds.getSphere()))
 				continue;
 
-			scene.prepareRenderable(i, frameInfo);
+			mShadowCasters.push_back(i);
+		}
+
+		// Dynamic shadow map is optional when a cached map is present
+		if (casters == ShadowCasters::Dynamic && mShadowCasters.empty())
+			return;
+
+		SPtr<RenderTarget> target;
+		if (cachedMap != nullptr)
+		{
+			mapInfo.textureIdx = -1;
+			mapInfo.area = Rect2I(0, 0, options.mapSize, options.mapSize);
+			mapInfo.updateNormArea(options.mapSize);
+
+			target = cachedMap->getTarget();
+		}
+		else
+		{
+			bool foundSpace = false;
+			for (UINT32 i = 0; i < (UINT32)mDynamicShadowMaps.size(); i++)
+			{
+				ShadowMapAtlas& atlas = mDynamicShadowMaps[i];
+
+				if (atlas.addMap(options.mapSize, mapInfo.area, SHADOW_MAP_BORDER))
+				{
+					mapInfo.textureIdx = i;
+
+					foundSpace = true;
+					break;
+				}
+			}
+
+			if (!foundSpace)
+			{
+				mapInfo.textureIdx = (UINT32)mDynamicShadowMaps.size();
+				mDynamicShadowMaps.push_back(ShadowMapAtlas(MAX_ATLAS_SIZE));
+
+				ShadowMapAtlas& atlas = mDynamicShadowMaps.back();
+				atlas.addMap(options.mapSize, mapInfo.area, SHADOW_MAP_BORDER);
+			}
+
+			mapInfo.updateNormArea(MAX_ATLAS_SIZE);
+			target = mDynamicShadowMaps[mapInfo.textureIdx].getTarget();
+		}
+
+		RenderAPI& rapi = RenderAPI::instance();
+		rapi.setRenderTarget(target);
+		rapi.setViewport(mapInfo.normArea);
+		rapi.clearViewport(FBT_DEPTH);
+
+		SPtr<GpuParamBlockBuffer> shadowParamsBuffer = gShadowParamsDef.createBuffer();
+		gShadowParamsDef.gDepthBias.set(shadowParamsBuffer, mapInfo.depthBias);
+		gShadowParamsDef.gInvDepthRange.set(shadowParamsBuffer, 1.0f / mapInfo.depthRange);
+		gShadowParamsDef.gMatViewProj.set(shadowParamsBuffer, mapInfo.shadowVPTransform);
+		gShadowParamsDef.gNDCZToDeviceZ.set(shadowParamsBuffer, RendererView::getNDCZToDeviceZ());
+
+		mDepthNormalMat.bind(shadowParamsBuffer);
+
+		for (auto& idx : mShadowCasters)
+		{
+			scene.prepareRenderable(idx, frameInfo);
 
-			RendererObject* renderable = sceneInfo.renderables[i];
+			RendererObject* renderable = sceneInfo.renderables[idx];
 			mDepthNormalMat.setPerObjectBuffer(renderable->perObjectParamBuffer);
 
 			for (auto& element : renderable->elements)
@@ -1125,54 +1337,47 @@ namespace bs { namespace ct
 		// Restore viewport
 		rapi.setViewport(Rect2(0.0f, 0.0f, 1.0f, 1.0f));
 
-		LightShadows& lightShadows = mSpotLightShadows[options.lightIdx];
+		if (cachedMap != nullptr)
+			cachedMap->setShadowInfo(mapInfo);
 
-		mShadowInfos[lightShadows.startIdx + lightShadows.numShadows] = mapInfo;
-		lightShadows.numShadows++;
+		addShadowInfo(lightShadows, mapInfo);
 	}
 
 	void ShadowRendering::renderRadialShadowMap(const RendererLight& rendererLight, 
-		const ShadowMapOptions& options, RendererScene& scene, const FrameInfo& frameInfo)
+		const ShadowMapOptions& options, ShadowCasters casters, RendererScene& scene, const FrameInfo& frameInfo)
 	{
 		Light* light = rendererLight.internal;
+		LightShadows& lightShadows = mRadialLightShadows[options.lightIdx];
+
+		// If static casters haven't changed since last time, re-use the cached shadow map
+		ShadowCachedMap* cachedMap = nullptr;
+		if (casters == ShadowCasters::Static)
+		{
+			cachedMap = &getCachedShadowMap(light, options.mapSize, true);
+			cachedMap->markAsUsed();
+
+			if (!cachedMap->isDirty())
+			{
+				ShadowInfo mapInfo = cachedMap->getShadowInfo();
+				mapInfo.fadePerView = options.fadePercents;
+				mapInfo.lightIdx = options.lightIdx;
+
+				addShadowInfo(lightShadows, mapInfo);
+				return;
+			}
+		}
 
 		const SceneInfo& sceneInfo = scene.getSceneInfo();
-		SPtr<GpuParamBlockBuffer> shadowParamsBuffer = gShadowParamsDef.createBuffer();
-		SPtr<GpuParamBlockBuffer> shadowCubeMatricesBuffer = gShadowCubeMatricesDef.createBuffer();
-		SPtr<GpuParamBlockBuffer> shadowCubeMasksBuffer = gShadowCubeMasksDef.createBuffer();
 
 		ShadowInfo mapInfo;
 		mapInfo.lightIdx = options.lightIdx;
 		mapInfo.textureIdx = -1;
 		mapInfo.fadePerView = options.fadePercents;
 		mapInfo.cascadeIdx = -1;
+		mapInfo.isCached = cachedMap != nullptr;
 		mapInfo.area = Rect2I(0, 0, options.mapSize, options.mapSize);
 		mapInfo.updateNormArea(options.mapSize);
 
-		for (UINT32 i = 0; i < (UINT32)mShadowCubemaps.size(); i++)
-		{
-			ShadowCubemap& cubemap = mShadowCubemaps[i];
-
-			if (!cubemap.isUsed() && cubemap.getSize() == options.mapSize)
-			{
-				mapInfo.textureIdx = i;
-				cubemap.markAsUsed();
-
-				break;
-			}
-		}
-
-		if (mapInfo.textureIdx == -1)
-		{
-			mapInfo.textureIdx = (UINT32)mShadowCubemaps.size();
-			mShadowCubemaps.push_back(ShadowCubemap(options.mapSize));
-
-			ShadowCubemap& cubemap = mShadowCubemaps.back();
-			cubemap.markAsUsed();
-		}
-
-		ShadowCubemap& cubemap = mShadowCubemaps[mapInfo.textureIdx];
-
 		mapInfo.depthNear = 0.05f;
 		mapInfo.depthFar = light->getAttenuationRadius();
 		mapInfo.depthFade = mapInfo.depthFar;
@@ -1185,6 +1390,10 @@ namespace bs { namespace ct
 
 		RenderAPI::instance().convertProjectionMatrix(proj, proj);
 
+		SPtr<GpuParamBlockBuffer> shadowParamsBuffer = gShadowParamsDef.createBuffer();
+		SPtr<GpuParamBlockBuffer> shadowCubeMatricesBuffer = gShadowCubeMatricesDef.createBuffer();
+		SPtr<GpuParamBlockBuffer> shadowCubeMasksBuffer = gShadowCubeMasksDef.createBuffer();
+
 		gShadowParamsDef.gDepthBias.set(shadowParamsBuffer, mapInfo.depthBias);
 		gShadowParamsDef.gInvDepthRange.set(shadowParamsBuffer, 1.0f / mapInfo.depthRange);
 		gShadowParamsDef.gMatViewProj.set(shadowParamsBuffer, Matrix4::IDENTITY);
@@ -1192,8 +1401,28 @@ namespace bs { namespace ct
 
 		Matrix4 viewOffsetMat = Matrix4::translation(-light->getPosition());
 
+		// Calculate view frustums, so we can skip faces that cannot affect any visible receivers. This doesn't apply to
+		// cached maps, as they must remain valid when the views move.
+		struct ViewFrustum
+		{
+			ConvexVolume volume;
+			std::array<Vector3, 8> corners;
+		};
+
+		SmallVector<ViewFrustum, 4> viewFrustums;
+		if (cachedMap == nullptr)
+		{
+			for (auto& view : sceneInfo.views)
+			{
+				ViewFrustum viewFrustum;
+				viewFrustum.corners = getFrustum(view->getProperties().viewProjTransform.inverse(), viewFrustum.volume);
+
+				viewFrustums.push_back(viewFrustum);
+			}
+		}
+
 		ConvexVolume frustums[6];
-		Vector<Plane> boundingPlanes;
+		bool activeFaces[6];
 		for (UINT32 i = 0; i < 6; i++)
 		{
 			// Calculate view matrix
@@ -1246,33 +1475,109 @@ namespace bs { namespace ct
 
 			frustums[i] = ConvexVolume(worldPlanes);
 
-			// Register far plane of all frustums
-			boundingPlanes.push_back(worldPlanes.back());
+			// Receivers in a face can only be shadowed by casters in the same face, so if none of the views can see into
+			// the face, it doesn't need to be rendered
+			if (cachedMap == nullptr)
+			{
+				ConvexVolume faceFrustum;
+				std::array<Vector3, 8> faceCorners = getFrustum(mapInfo.shadowVPTransforms[i].inverse(), faceFrustum);
+
+				activeFaces[i] = false;
+				for (auto& viewFrustum : viewFrustums)
+				{
+					if (intersectsConservative(faceFrustum, faceCorners, viewFrustum.volume, viewFrustum.corners))
+					{
+						activeFaces[i] = true;
+						break;
+					}
+				}
+			}
+			else
+				activeFaces[i] = true;
+		}
+
+		// First cull against the light bounds, then against individual faces
+		const Sphere& lightBounds = light->getBounds();
+
+		mShadowCasters.clear();
+		mShadowCasterFaceMasks.clear();
+		for (UINT32 i = 0; i < sceneInfo.renderables.size(); i++)
+		{
+			if (!isCasterOfType(*sceneInfo.renderables[i]->renderable, casters))
+				continue;
+
+			const Sphere& bounds = sceneInfo.renderableCullInfos[i].bounds.getSphere();
+			if (!lightBounds.intersects(bounds))
+				continue;
+
+			UINT32 faceMask = 0;
+			for (UINT32 j = 0; j < 6; j++)
+			{
+				if (activeFaces[j] && frustums[j].intersects(bounds))
+					faceMask |= 1 << j;
+			}
+
+			if (faceMask == 0)
+				continue;
+
+			mShadowCasters.push_back(i);
+			mShadowCasterFaceMasks.push_back(faceMask);
+		}
+
+		// Dynamic shadow map is optional when a cached map is present
+		if (casters == ShadowCasters::Dynamic && mShadowCasters.empty())
+			return;
+
+		SPtr<RenderTarget> target;
+		if (cachedMap != nullptr)
+			target = cachedMap->getTarget();
+		else
+		{
+			for (UINT32 i = 0; i < (UINT32)mShadowCubemaps.size(); i++)
+			{
+				ShadowCubemap& cubemap = mShadowCubemaps[i];
+
+				if (!cubemap.isUsed() && cubemap.getSize() == options.mapSize)
+				{
+					mapInfo.textureIdx = i;
+					cubemap.markAsUsed();
+
+					break;
+				}
+			}
+
+			if (mapInfo.textureIdx == -1)
+			{
+				mapInfo.textureIdx = (UINT32)mShadowCubemaps.size();
+				mShadowCubemaps.push_back(ShadowCubemap(options.mapSize));
+
+				ShadowCubemap& cubemap = mShadowCubemaps.back();
+				cubemap.markAsUsed();
+			}
+
+			target = mShadowCubemaps[mapInfo.textureIdx].getTarget();
 		}
 
 		RenderAPI& rapi = RenderAPI::instance();
-		rapi.setRenderTarget(cubemap.getTarget());
+		rapi.setRenderTarget(target);
 		rapi.clearRenderTarget(FBT_DEPTH);
 
 		mDepthCubeMat.bind(shadowParamsBuffer, shadowCubeMatricesBuffer);
 
-		// First cull against a global volume
-		ConvexVolume boundingVolume(boundingPlanes);
-		for (UINT32 i = 0; i < sceneInfo.renderables.size(); i++)
+		for (UINT32 i = 0; i < (UINT32)mShadowCasters.size(); i++)
 		{
-			const Sphere& bounds = sceneInfo.renderableCullInfos[i].bounds.getSphere();
-			if (!boundingVolume.intersects(bounds))
-				continue;
+			UINT32 idx = mShadowCasters[i];
+			UINT32 faceMask = mShadowCasterFaceMasks[i];
 
-			scene.prepareRenderable(i, frameInfo);
+			scene.prepareRenderable(idx, frameInfo);
 
 			for(UINT32 j = 0; j < 6; j++)
 			{
-				int mask = frustums[j].intersects(bounds) ? 1 : 0;
+				int mask = (faceMask & (1 << j)) != 0 ? 1 : 0;
 				gShadowCubeMasksDef.gFaceMasks.set(shadowCubeMasksBuffer, mask, j);
 			}
 
-			RendererObject* renderable = sceneInfo.renderables[i];
+			RendererObject* renderable = sceneInfo.renderables[idx];
 			mDepthCubeMat.setPerObjectBuffer(renderable->perObjectParamBuffer, shadowCubeMasksBuffer);
 
 			for (auto& element : renderable->elements)
@@ -1285,10 +1590,10 @@ namespace bs { namespace ct
 			}
 		}
 
-		LightShadows& lightShadows = mRadialLightShadows[options.lightIdx];
+		if (cachedMap != nullptr)
+			cachedMap->setShadowInfo(mapInfo);
 
-		mShadowInfos[lightShadows.startIdx + lightShadows.numShadows] = mapInfo;
-		lightShadows.numShadows++;
+		addShadowInfo(lightShadows, mapInfo);
 	}
 
 	void ShadowRendering::calcShadowMapProperties(const RendererLight& light, RendererScene& scene, UINT32 border,
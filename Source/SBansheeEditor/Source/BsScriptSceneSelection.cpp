@@ -115,40 +115,44 @@ namespace bs
 			}
 		}
 
-		Vector<HSceneObject> pickedObjects = ScenePicking::instance().pickObjects(thisPtr->mCamera, *inputPos, 
-			*area, ignoredSceneObjects);
-
-		if (pickedObjects.size() != 0)
+		// Area selection doesn't need to return anything to the caller, so avoid stalling on the GPU and apply the
+		// selection once the results are available
+		auto onPicked = [additive](const Vector<HSceneObject>& pickedObjects, const SnapData&)
 		{
-			if (additive) // Append to existing selection
+			if (pickedObjects.size() != 0)
 			{
-				Vector<HSceneObject> selectedSOs = Selection::instance().getSceneObjects();
-
-				for (int i = 0; i < pickedObjects.size(); i++) 
+				if (additive) // Append to existing selection
 				{
-					bool found = false;
-					for (int j = 0; j < selectedSOs.size(); j++)
+					Vector<HSceneObject> selectedSOs = Selection::instance().getSceneObjects();
+
+					for (int i = 0; i < pickedObjects.size(); i++) 
 					{
-						if (selectedSOs[j] == pickedObjects[i])
+						bool found = false;
+						for (int j = 0; j < selectedSOs.size(); j++)
 						{
-							found = true;
-							break;
+							if (selectedSOs[j] == pickedObjects[i])
+							{
+								found = true;
+								break;
+							}
 						}
+
+						if (!found)
+							selectedSOs.push_back(pickedObjects[i]);
 					}
 
-					if (!found)
-						selectedSOs.push_back(pickedObjects[i]);
+					Selection::instance().setSceneObjects(selectedSOs);
 				}
-
-				Selection::instance().setSceneObjects(selectedSOs);
+				else
+					Selection::instance().setSceneObjects(pickedObjects);
 			}
-			else
-				Selection::instance().setSceneObjects(pickedObjects);
-		}
-		else if (!additive)
-		{
-			Selection::instance().clearSceneSelection();
-		}
+			else if (!additive)
+			{
+				Selection::instance().clearSceneSelection();
+			}
+		};
+
+		ScenePicking::instance().pickObjectsAsync(thisPtr->mCamera, *inputPos, *area, ignoredSceneObjects, onPicked);
 	}
 
 	MonoObject* ScriptSceneSelection::internal_Snap(ScriptSceneSelection* thisPtr, Vector2I* inputPos, SnapData* data, 